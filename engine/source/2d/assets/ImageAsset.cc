@@ -123,6 +123,16 @@ static EnumTable::Enums textureFilterLookup[] =
 
 EnumTable textureFilterTable(sizeof(textureFilterLookup) / sizeof(EnumTable::Enums), &textureFilterLookup[0]);
 
+static EnumTable::Enums residencyPriorityLookup[] =
+                {
+                { TextureHandle::ResidencyLow,      "LOW"       },
+                { TextureHandle::ResidencyNormal,   "NORMAL"    },
+                { TextureHandle::ResidencyHigh,     "HIGH"      },
+                { TextureHandle::ResidencyPinned,   "PINNED"    },
+                };
+
+EnumTable residencyPriorityTable(sizeof(residencyPriorityLookup) / sizeof(EnumTable::Enums), &residencyPriorityLookup[0]);
+
 //------------------------------------------------------------------------------
 
 ImageAsset::TextureFilterMode ImageAsset::getFilterModeEnum(const char* label)
@@ -155,9 +165,42 @@ const char* ImageAsset::getFilterModeDescription( ImageAsset::TextureFilterMode
 
 //------------------------------------------------------------------------------
 
+TextureHandle::ResidencyPriority ImageAsset::getResidencyPriorityEnum(const char* label)
+{
+    // Search for Mnemonic.
+    for(U32 i = 0; i < (sizeof(residencyPriorityLookup) / sizeof(EnumTable::Enums)); i++)
+        if( dStricmp(residencyPriorityLookup[i].label, label) == 0)
+            return((TextureHandle::ResidencyPriority)residencyPriorityLookup[i].index);
+
+    // Warn.
+    Con::warnf("ImageAsset::getResidencyPriorityEnum() - Invalid residency-priority '%s'", label );
+
+    return TextureHandle::ResidencyNormal;
+}
+
+//------------------------------------------------------------------------------
+
+const char* ImageAsset::getResidencyPriorityDescription( TextureHandle::ResidencyPriority residencyPriority )
+{
+    // Search for Mode.
+    for(U32 i = 0; i < (sizeof(residencyPriorityLookup) / sizeof(EnumTable::Enums)); i++)
+        if( residencyPriorityLookup[i].index == residencyPriority )
+            return residencyPriorityLookup[i].label;
+
+    // Warn.
+    Con::warnf("ImageAsset::getResidencyPriorityDescription() - Invalid residency-priority." );
+
+    return StringTable->EmptyString;
+}
+
+//------------------------------------------------------------------------------
+
 ImageAsset::ImageAsset() :  mImageFile(StringTable->EmptyString),
                             mForce16Bit(false),
+                            mMipmaps(false),
+                            mPremultipliedAlpha(false),
                             mLocalFilterMode(FILTER_INVALID),
+                            mResidencyPriority(TextureHandle::ResidencyNormal),
                             mExplicitMode(false),
 
                             mCellRowOrder(true),
@@ -170,17 +213,39 @@ ImageAsset::ImageAsset() :  mImageFile(StringTable->EmptyString),
                             mCellWidth(0),
                             mCellHeight(0),
 
-                            mImageTextureHandle(NULL)
+                            mpExplicitFrames(new ExplicitFrameTable()),
+                            mImplicitFrameCount(0),
+                            mImplicitPlaceholder(false),
+                            mCellStepX(0),
+                            mCellStepY(0),
+                            mTexelWidthScale(1.0f),
+                            mTexelHeightScale(1.0f),
+                            mTextureOffset(0, 0),
+
+                            mImageTextureHandle(NULL),
+                            mTextureLoadPending(false),
+                            mpAtlasEntry(NULL)
 {
+    // Use the local frames.
+    mpFrames = &mFrames;
+
     // Set Vector Associations.
     VECTOR_SET_ASSOCIATION( mFrames );
-    VECTOR_SET_ASSOCIATION( mExplicitFrames );
 }
 
 //------------------------------------------------------------------------------
 
 ImageAsset::~ImageAsset()
 {
+    // Ignore any pending texture load.
+    TextureManager::cancelAsyncCallbacks( this );
+
+    // Release any atlas image.
+    releaseAtlasEntry();
+
+    // Release the explicit frames.
+    if ( --mpExplicitFrames->mRefCount == 0 )
+        delete mpExplicitFrames;
 }
 
 //------------------------------------------------------------------------------
@@ -193,7 +258,10 @@ void ImageAsset::initPersistFields()
     // Fields.
     addProtectedField("ImageFile", TypeAssetLooseFilePath, Offset(mImageFile, ImageAsset), &setImageFile, &getImageFile, &defaultProtectedWriteFn, "");
     addProtectedField("Force16bit", TypeBool, Offset(mForce16Bit, ImageAsset), &setForce16Bit, &defaultProtectedGetFn, &writeForce16Bit, "");
+    addProtectedField("Mipmaps", TypeBool, Offset(mMipmaps, ImageAsset), &setMipmaps, &defaultProtectedGetFn, &writeMipmaps, "");
+    addProtectedField("PremultipliedAlpha", TypeBool, Offset(mPremultipliedAlpha, ImageAsset), &setPremultipliedAlpha, &defaultProtectedGetFn, &writePremultipliedAlpha, "");
     addProtectedField("FilterMode", TypeEnum, Offset(mLocalFilterMode, ImageAsset), &setFilterMode, &defaultProtectedGetFn, &writeFilterMode, 1, &textureFilterTable);   
+    addProtectedField("ResidencyPriority", TypeEnum, Offset(mResidencyPriority, ImageAsset), &setResidencyPriority, &defaultProtectedGetFn, &writeResidencyPriority, 1, &residencyPriorityTable);
     addProtectedField("ExplicitMode", TypeBool, Offset(mExplicitMode, ImageAsset), &setExplicitMode, &defaultProtectedGetFn, &defaultProtectedNotWriteFn, "");
 
     addProtectedField("CellRowOrder", TypeBool, Offset(mCellRowOrder, ImageAsset), &setCellRowOrder, &defaultProtectedGetFn, &writeCellRowOrder, "");
@@ -263,11 +331,14 @@ void ImageAsset::copyTo(SimObject* object)
     // Copy state.
     pAsset->setImageFile( getImageFile() );
     pAsset->setForce16Bit( getForce16Bit() );
+    pAsset->setMipmaps( getMipmaps() );
+    pAsset->setPremultipliedAlpha( getPremultipliedAlpha() );
     pAsset->setFilterMode( getFilterMode() );
+    pAsset->setResidencyPriority( getResidencyPriority() );
     pAsset->setExplicitMode( getExplicitMode() );
     pAsset->setCellRowOrder( getCellRowOrder() );
-    pAsset->setCellOffsetX( getCellCountX() );
-    pAsset->setCellOffsetY( getCellCountY() );
+    pAsset->setCellOffsetX( getCellOffsetX() );
+    pAsset->setCellOffsetY( getCellOffsetY() );
     pAsset->setCellStrideX( getCellStrideX() );
     pAsset->setCellStrideY( getCellStrideY() );
     pAsset->setCellCountX( getCellCountX() );
@@ -279,35 +350,51 @@ void ImageAsset::copyTo(SimObject* object)
     if ( !getExplicitMode() )
         return;
 
-    // Fetch the explicit cell count.
-    const S32 explicitCellCount = getExplicitCellCount();
+    // Share the explicit cells until either asset modifies them.
+    pAsset->shareExplicitFrames( mpExplicitFrames );
+    pAsset->refreshAsset();
+}
 
-    // Finish if no explicit cells exist.
-    if ( explicitCellCount == 0 )
+//------------------------------------------------------------------------------
+
+void ImageAsset::setForce16Bit( const bool force16Bit )
+{
+    // Ignore no change,
+    if ( force16Bit == mForce16Bit )
         return;
 
-    // Copy explicit cells.
-    pAsset->clearExplicitCells();
-    for( S32 index = 0; index < explicitCellCount; ++index )
-    {
-        // Fetch the cell pixel area.
-        const FrameArea::PixelArea& pixelArea = getImageFrameArea( index ).mPixelArea;
+    // Update.
+    mForce16Bit = force16Bit;
 
-        // Add the explicit cell.
-        pAsset->addExplicitCell( pixelArea.mPixelOffset.x, pixelArea.mPixelOffset.y, pixelArea.mPixelWidth, pixelArea.mPixelHeight );
-    }
+    // Refresh the asset.
+    refreshAsset();
 }
 
 //------------------------------------------------------------------------------
 
-void ImageAsset::setForce16Bit( const bool force16Bit )
+void ImageAsset::setMipmaps( const bool mipmaps )
 {
     // Ignore no change,
-    if ( force16Bit == mForce16Bit )
+    if ( mipmaps == mMipmaps )
         return;
 
     // Update.
-    mForce16Bit = force16Bit;
+    mMipmaps = mipmaps;
+
+    // Refresh the asset.
+    refreshAsset();
+}
+
+//------------------------------------------------------------------------------
+
+void ImageAsset::setPremultipliedAlpha( const bool premultipliedAlpha )
+{
+    // Ignore no change,
+    if ( premultipliedAlpha == mPremultipliedAlpha )
+        return;
+
+    // Update.
+    mPremultipliedAlpha = premultipliedAlpha;
 
     // Refresh the asset.
     refreshAsset();
@@ -338,6 +425,19 @@ void ImageAsset::setFilterMode( const ImageAsset::TextureFilterMode filterMode )
 
 //------------------------------------------------------------------------------
 
+void ImageAsset::setResidencyPriority( const TextureHandle::ResidencyPriority residencyPriority )
+{
+    // Update.
+    mResidencyPriority = residencyPriority;
+
+    // Set the texture priority.
+    // Atlas pages are shared so keep their default priority.
+    if ( mpAtlasEntry == NULL )
+        mImageTextureHandle.setResidencyPriority( mResidencyPriority );
+}
+
+//------------------------------------------------------------------------------
+
 void ImageAsset::setExplicitMode( const bool explicitMode )
 {
     // Ignore no change,
@@ -563,7 +663,7 @@ bool ImageAsset::clearExplicitCells( void )
     }
 
     // Clear explicit frames.
-    mExplicitFrames.clear();
+    getWritableExplicitCells().clear();
 
     // Refresh the asset.
     refreshAsset();
@@ -621,7 +721,7 @@ bool ImageAsset::addExplicitCell( const S32 cellOffsetX, const S32 cellOffsetY,
 
     // Store frame.
     FrameArea::PixelArea pixelArea( cellOffsetX, cellOffsetY, cellWidth, cellHeight );
-    mExplicitFrames.push_back( pixelArea );
+    getWritableExplicitCells().push_back( pixelArea );
 
     // Refresh the asset.
     refreshAsset();
@@ -646,7 +746,7 @@ bool ImageAsset::insertExplicitCell( const S32 cellIndex, const S32 cellOffsetX,
     const S32 imageHeight = getImageHeight();
 
     // Fetch the explicit frame count.
-    const S32 explicitFramelCount = mExplicitFrames.size();
+    const S32 explicitFramelCount = getExplicitCellCount();
 
     // The cell index needs to be in range.
     if ( cellIndex < 0 )
@@ -692,14 +792,15 @@ bool ImageAsset::insertExplicitCell( const S32 cellIndex, const S32 cellOffsetX,
     FrameArea::PixelArea pixelArea( cellOffsetX, cellOffsetY, cellWidth, cellHeight );
 
     // Insert frame appropriately.
+    typeExplicitFrameAreaVector& explicitCells = getWritableExplicitCells();
     if ( cellIndex >= explicitFramelCount )
     {
-        mExplicitFrames.push_back( pixelArea );
+        explicitCells.push_back( pixelArea );
     }
     else
     {
-        mExplicitFrames.insert( cellIndex );
-        mExplicitFrames[cellIndex] = pixelArea;
+        explicitCells.insert( cellIndex );
+        explicitCells[cellIndex] = pixelArea;
     }
 
     // Refresh the asset.
@@ -725,7 +826,7 @@ bool ImageAsset::setExplicitCell( const S32 cellIndex, const S32 cellOffsetX, co
     const S32 imageHeight = getImageHeight();
 
     // Fetch the explicit frame count.
-    const S32 explicitFrameCount = mExplicitFrames.size();
+    const S32 explicitFrameCount = getExplicitCellCount();
 
     // The cell index needs to be in range.
     if ( cellIndex < 0 || cellIndex >= explicitFrameCount )
@@ -771,7 +872,7 @@ bool ImageAsset::setExplicitCell( const S32 cellIndex, const S32 cellOffsetX, co
     FrameArea::PixelArea pixelArea( cellOffsetX, cellOffsetY, cellWidth, cellHeight );
 
     // Set cell.
-    mExplicitFrames[cellIndex] = pixelArea;
+    getWritableExplicitCells()[cellIndex] = pixelArea;
 
     // Refresh the asset.
     refreshAsset();
@@ -792,7 +893,7 @@ bool ImageAsset::removeExplicitCell( const S32 cellIndex )
     }
 
     // Fetch the explicit frame count.
-    const S32 explicitFrameCount = mExplicitFrames.size();
+    const S32 explicitFrameCount = getExplicitCellCount();
 
     // The cell index needs to be in range.
     if ( cellIndex < 0 || cellIndex >= explicitFrameCount )
@@ -803,7 +904,7 @@ bool ImageAsset::removeExplicitCell( const S32 cellIndex )
     }
 
     // Remove cell.
-    mExplicitFrames.erase(cellIndex);
+    getWritableExplicitCells().erase(cellIndex);
 
     // Refresh the asset.
     refreshAsset();
@@ -907,15 +1008,68 @@ void ImageAsset::calculateImage( void )
     PROFILE_SCOPE(ImageAsset_CalculateImage);
 
     // Clear frames.
-    mFrames.clear();
+    clearFrames();
+
+    // Ignore any pending texture load.
+    TextureManager::cancelAsyncCallbacks( this );
+    mTextureLoadPending = false;
+
+    // Release any atlas image.
+    releaseAtlasEntry();
 
     // If we have an existing texture and we're setting to the same bitmap then force the texture manager
     // to refresh the texture itself.
     if ( !mImageTextureHandle.IsNull() && dStricmp(mImageTextureHandle.getTextureKey(), mImageFile) == 0 )
         TextureManager::refresh( mImageFile );
 
+    // Is the local filter mode specified?
+    TextureFilterMode filterMode = mLocalFilterMode;
+    if ( filterMode == FILTER_INVALID )
+    {
+        filterMode = FILTER_NEAREST;
+
+        // No, so fetch the global filter.
+        const char* pGlobalFilter = Con::getVariable( "$pref::T2D::imageAssetGlobalFilterMode" );
+
+        // Fetch the global filter mode.
+        if ( pGlobalFilter != NULL && dStrlen(pGlobalFilter) > 0 )
+            filterMode = getFilterModeEnum( pGlobalFilter );
+
+        // If global filter mode is invalid then use local filter mode.
+        if ( filterMode == FILTER_INVALID )
+            filterMode = FILTER_NEAREST;
+    }
+
+    // Fetch the upload flags.
+    U32 uploadFlags = TextureHandle::UploadDefault;
+    if ( getMipmaps() )
+        uploadFlags |= TextureHandle::UploadMipmaps;
+    if ( getPremultipliedAlpha() )
+        uploadFlags |= TextureHandle::UploadPremultiplyAlpha;
+
     // Get image texture.
-    mImageTextureHandle.set( mImageFile, TextureHandle::BitmapTexture, true, getForce16Bit() );
+    // Asynchronous loads render a placeholder until the texture is uploaded.
+    // Small images are packed into a shared atlas page when atlasing is enabled.
+    // Atlas pages are uploaded as-is so images with upload flags are never atlased.
+    if ( Con::getBoolVariable( "$pref::T2D::imageAssetAsyncLoad", false ) )
+    {
+        mImageTextureHandle.setAsync( mImageFile, TextureHandle::BitmapTexture, true, getForce16Bit(), &textureLoadCallback, this, uploadFlags );
+    }
+    else
+    {
+        // Images that cannot be packed hand back their bitmap so they are not decoded again.
+        GBitmap* pUnpackedBitmap = NULL;
+        if ( !getForce16Bit() && uploadFlags == TextureHandle::UploadDefault && Con::getBoolVariable( "$pref::T2D::imageAssetAtlas", false ) )
+        {
+            const S32 maxImageSize = Con::getIntVariable( "$pref::T2D::imageAssetAtlasMaxSize", TextureAtlas::DefaultMaxImageSize );
+            mpAtlasEntry = TextureAtlas::acquire( mImageFile, filterMode == FILTER_NEAREST ? GL_NEAREST : GL_LINEAR, maxImageSize, &atlasEntryMovedCallback, this, &pUnpackedBitmap );
+        }
+
+        if ( mpAtlasEntry != NULL )
+            mImageTextureHandle = mpAtlasEntry->getTexture();
+        else
+            mImageTextureHandle.set( mImageFile, TextureHandle::BitmapTexture, true, getForce16Bit(), uploadFlags, pUnpackedBitmap );
+    }
 
     // Is the texture valid?
     if ( mImageTextureHandle.IsNull() )
@@ -925,30 +1079,45 @@ void ImageAsset::calculateImage( void )
         return;
     }
 
-    // Is the local filter mode specified?
-    if ( mLocalFilterMode != FILTER_INVALID )
+    // Set filter mode.
+    setTextureFilter( filterMode );
+
+    // Set the residency priority and upload flags.
+    // The texture may already be loaded with different upload flags.
+    if ( mpAtlasEntry == NULL )
     {
-        // Yes, so set filter mode.
-        setTextureFilter( mLocalFilterMode );
+        mImageTextureHandle.setResidencyPriority( mResidencyPriority );
+        mImageTextureHandle.setUploadFlags( uploadFlags );
     }
-    else
+
+    // Use placeholder frames if the texture is still loading.
+    if ( mImageTextureHandle.isPending() )
     {
-        TextureFilterMode filterMode = FILTER_NEAREST;
+        mTextureLoadPending = true;
+        calculatePlaceholderFrames();
+        return;
+    }
 
-        // No, so fetch the global filter.
-        const char* pGlobalFilter = Con::getVariable( "$pref::T2D::imageAssetGlobalFilterMode" );
+    // Calculate the frames.
+    calculateFrames();
+}
 
-        // Fetch the global filter mode.
-        if ( pGlobalFilter != NULL && dStrlen(pGlobalFilter) > 0 )
-            filterMode = getFilterModeEnum( pGlobalFilter );
+//------------------------------------------------------------------------------
 
-        // If global filter mode is invalid then use local filter mode.
-        if ( filterMode == FILTER_INVALID )
-            filterMode = FILTER_NEAREST;
+void ImageAsset::calculateFrames( void )
+{
+    // Clear frames.
+    clearFrames();
 
-        // Set filter mode.
-        setTextureFilter( filterMode );
-    }
+    // Fetch the texture object.
+    TextureObject* pTextureObject = ((TextureObject*)mImageTextureHandle);
+
+    // Calculate texel scales.
+    mTexelWidthScale = 1.0f / (F32)pTextureObject->getTextureWidth();
+    mTexelHeightScale = 1.0f / (F32)pTextureObject->getTextureHeight();
+
+    // Texel areas are moved to the image position within any atlas page.
+    mTextureOffset = mpAtlasEntry == NULL ? Point2I( 0, 0 ) : mpAtlasEntry->getOffset();
 
     // Calculate according to mode.
     if ( mExplicitMode )
@@ -963,6 +1132,226 @@ void ImageAsset::calculateImage( void )
 
 //------------------------------------------------------------------------------
 
+void ImageAsset::clearFrames( void )
+{
+    mFrames.clear();
+    mpFrames = &mFrames;
+    mImplicitFrameCount = 0;
+    mImplicitPlaceholder = false;
+}
+
+//------------------------------------------------------------------------------
+
+void ImageAsset::setImplicitFrames( const U32 frameCount, const bool placeholder )
+{
+    // Clear frames.
+    clearFrames();
+
+    mImplicitFrameCount = frameCount;
+    mImplicitPlaceholder = placeholder;
+}
+
+//------------------------------------------------------------------------------
+
+ImageAsset::FrameArea ImageAsset::getImplicitFrameArea( const U32 frame ) const
+{
+    FrameArea frameArea;
+
+    // Placeholder frames match the cell size but cover the whole placeholder texture.
+    if ( mImplicitPlaceholder )
+    {
+        frameArea.mPixelArea.setArea( 0, 0, mCellWidth > 0 ? mCellWidth : 1, mCellHeight > 0 ? mCellHeight : 1 );
+        frameArea.mTexelArea.setArea( FrameArea::PixelArea( 0, 0, 1, 1 ), 1.0f, 1.0f );
+        return frameArea;
+    }
+
+    // Fetch the cell position in the configured order.
+    S32 cellX;
+    S32 cellY;
+    if ( mCellRowOrder )
+    {
+        cellX = frame % mCellCountX;
+        cellY = frame / mCellCountX;
+    }
+    else
+    {
+        cellX = frame / mCellCountY;
+        cellY = frame % mCellCountY;
+    }
+
+    // Set frame area.
+    setFrameArea( frameArea, mCellOffsetX + (cellX * mCellStepX), mCellOffsetY + (cellY * mCellStepY), mCellWidth, mCellHeight );
+
+    return frameArea;
+}
+
+//------------------------------------------------------------------------------
+
+ImageAsset::typeExplicitFrameAreaVector& ImageAsset::getWritableExplicitCells( void )
+{
+    // Copy the cells if they are shared.
+    if ( mpExplicitFrames->mRefCount > 1 )
+    {
+        ExplicitFrameTable* pExplicitFrames = new ExplicitFrameTable();
+        pExplicitFrames->mCells = mpExplicitFrames->mCells;
+
+        // Stop using the shared frames.
+        if ( mpFrames == &mpExplicitFrames->mFrames )
+            clearFrames();
+
+        mpExplicitFrames->mRefCount--;
+        mpExplicitFrames = pExplicitFrames;
+    }
+
+    // The frames need calculating again.
+    mpExplicitFrames->mFramesValid = false;
+
+    return mpExplicitFrames->mCells;
+}
+
+//------------------------------------------------------------------------------
+
+void ImageAsset::shareExplicitFrames( ExplicitFrameTable* pExplicitFrames )
+{
+    // Sanity!
+    AssertFatal( pExplicitFrames != NULL, "ImageAsset::shareExplicitFrames() - Cannot share NULL explicit frames." );
+
+    // Ignore no change.
+    if ( pExplicitFrames == mpExplicitFrames )
+        return;
+
+    pExplicitFrames->mRefCount++;
+
+    // Stop using the current frames.
+    if ( mpFrames == &mpExplicitFrames->mFrames )
+        clearFrames();
+
+    // Release the current explicit frames.
+    if ( --mpExplicitFrames->mRefCount == 0 )
+        delete mpExplicitFrames;
+
+    mpExplicitFrames = pExplicitFrames;
+}
+
+//------------------------------------------------------------------------------
+
+void ImageAsset::releaseAtlasEntry( void )
+{
+    // Finish if not in an atlas.
+    if ( mpAtlasEntry == NULL )
+        return;
+
+    // Release the texture before the atlas entry as that may delete the page.
+    mImageTextureHandle.clear();
+    TextureAtlas::release( mpAtlasEntry, this );
+    mpAtlasEntry = NULL;
+}
+
+//------------------------------------------------------------------------------
+
+void ImageAsset::atlasEntryMovedCallback( TextureAtlas::Entry* pEntry, void* userData )
+{
+    ImageAsset* pImageAsset = static_cast<ImageAsset*>( userData );
+
+    // The image may have moved to another page.
+    pImageAsset->mImageTextureHandle = pEntry->getTexture();
+
+    // Recalculate the frames.
+    pImageAsset->calculateFrames();
+}
+
+//------------------------------------------------------------------------------
+
+void ImageAsset::calculatePlaceholderFrames( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ImageAsset_CalculatePlaceholderFrames);
+
+    // Clear frames.
+    clearFrames();
+
+    // Every placeholder frame covers the whole placeholder texture.
+    // The frame pixel areas match the configured cells so frame counts and sizes are available immediately.
+    const FrameArea::PixelArea placeholderArea( 0, 0, 1, 1 );
+    const typeExplicitFrameAreaVector& explicitCells = mpExplicitFrames->mCells;
+
+    if ( mExplicitMode && explicitCells.size() > 0 )
+    {
+        for ( S32 index = 0; index < explicitCells.size(); ++index )
+        {
+            const FrameArea::PixelArea& pixelArea = explicitCells[index];
+            FrameArea frameArea( pixelArea.mPixelOffset.x, pixelArea.mPixelOffset.y, pixelArea.mPixelWidth, pixelArea.mPixelHeight, 1.0f, 1.0f );
+            frameArea.mTexelArea.setArea( placeholderArea, 1.0f, 1.0f );
+            mFrames.push_back( frameArea );
+        }
+
+        return;
+    }
+
+    const S32 frameCount = !mExplicitMode && mCellCountX > 0 && mCellCountY > 0 ? mCellCountX * mCellCountY : 1;
+
+    // Calculate implicit cells on demand.
+    if ( frameCount > 1 )
+    {
+        setImplicitFrames( frameCount, true );
+        return;
+    }
+
+    const U32 frameWidth = !mExplicitMode && mCellWidth > 0 ? mCellWidth : 1;
+    const U32 frameHeight = !mExplicitMode && mCellHeight > 0 ? mCellHeight : 1;
+    for ( S32 index = 0; index < frameCount; ++index )
+    {
+        FrameArea frameArea( 0, 0, frameWidth, frameHeight, 1.0f, 1.0f );
+        frameArea.mTexelArea.setArea( placeholderArea, 1.0f, 1.0f );
+        mFrames.push_back( frameArea );
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void ImageAsset::onTextureLoaded( const bool success )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ImageAsset_OnTextureLoaded);
+
+    mTextureLoadPending = false;
+
+    // Was the texture loaded?
+    if ( success )
+    {
+        // Yes, so calculate the frames.
+        calculateFrames();
+    }
+    else
+    {
+        // No, so warn.
+        Con::warnf( "Image '%s' could not load texture '%s'.", getAssetId(), mImageFile );
+
+        // Release the texture as a synchronous load would.
+        clearFrames();
+        mImageTextureHandle.clear();
+    }
+
+    // Notify script.
+    if ( isMethod( "onImageLoaded" ) )
+        Con::executef( this, 2, "onImageLoaded", success ? "1" : "0" );
+}
+
+//------------------------------------------------------------------------------
+
+void ImageAsset::textureLoadCallback( TextureObject* pTextureObject, const bool success, void *userData )
+{
+    ImageAsset* pImageAsset = static_cast<ImageAsset*>( userData );
+
+    // Ignore loads that completed immediately as the frames are calculated by the caller.
+    if ( !pImageAsset->mTextureLoadPending )
+        return;
+
+    pImageAsset->onTextureLoaded( success );
+}
+
+//------------------------------------------------------------------------------
+
 void ImageAsset::calculateImplicitMode( void )
 {
     // Debug Profiling.
@@ -971,19 +1360,13 @@ void ImageAsset::calculateImplicitMode( void )
     // Sanity!
     AssertFatal( !mExplicitMode, "Cannot calculate implicit cells when in explicit mode." );
 
-    // Fetch the texture object.
-    TextureObject* pTextureObject = ((TextureObject*)mImageTextureHandle);
- 
-    // Calculate texel scales.
-    const F32 texelWidthScale = 1.0f / (F32)pTextureObject->getTextureWidth();
-    const F32 texelHeightScale = 1.0f / (F32)pTextureObject->getTextureHeight();
-
     // Fetch the original image dimensions.
     const S32 imageWidth = getImageWidth();
     const S32 imageHeight = getImageHeight();
 
     // Set full-frame as default.
-    FrameArea frameArea( 0, 0, imageWidth, imageHeight, texelWidthScale, texelHeightScale );
+    FrameArea frameArea;
+    setFrameArea( frameArea, 0, 0, imageWidth, imageHeight );
     mFrames.push_back( frameArea );
 
     // Finish if no cell counts are specified.  This is how we default to full-frame mode.
@@ -1083,40 +1466,13 @@ void ImageAsset::calculateImplicitMode( void )
         return;
     }
 
-    // Clear default frame.
-    mFrames.clear();
-
-    // Cell Row Order?
-    if ( mCellRowOrder )
-    {
-        // Yes, so RowRow Order.
-        for ( S32 y = 0, cellPositionY = mCellOffsetY; y < mCellCountY; y++, cellPositionY+=cellStepY )
-        {
-            for ( S32 x = 0, cellPositionX = mCellOffsetX; x < mCellCountX; x++, cellPositionX+=cellStepX )
-            {
-                // Set frame area.
-                frameArea.setArea( cellPositionX, cellPositionY, mCellWidth, mCellHeight, texelWidthScale, texelHeightScale );
-
-                // Store fame.
-                mFrames.push_back( frameArea );
-            }
-        }
+    // Store the cell steps.
+    mCellStepX = cellStepX;
+    mCellStepY = cellStepY;
 
-        return;
-    }
-
-    // No, so Column Order.
-    for ( S32 x = 0, cellPositionX = mCellOffsetX; x < mCellCountX; x++, cellPositionX+=cellStepX )
-    {
-        for ( S32 y = 0, cellPositionY = mCellOffsetY; y < mCellCountY; y++, cellPositionY+=cellStepY )
-        {
-            // Set frame area.
-            frameArea.setArea( cellPositionX, cellPositionY, mCellWidth, mCellHeight, texelWidthScale, texelHeightScale );
-
-            // Store fame.
-            mFrames.push_back( frameArea );
-        }
-    }
+    // Calculate the cells on demand rather than storing every frame.
+    // Large tile sheets typically only use a small number of their frames.
+    setImplicitFrames( mCellCountX * mCellCountY, false );
 }
 
 //------------------------------------------------------------------------------
@@ -1129,42 +1485,61 @@ void ImageAsset::calculateExplicitMode( void )
     // Sanity!
     AssertFatal( mExplicitMode, "Cannot calculate explicit cells when not in explicit mode." );
 
-    // Fetch the texture object.
-    TextureObject* pTextureObject = ((TextureObject*)mImageTextureHandle);
- 
-    // Calculate texel scales.
-    const F32 texelWidthScale = 1.0f / (F32)pTextureObject->getTextureWidth();
-    const F32 texelHeightScale = 1.0f / (F32)pTextureObject->getTextureHeight();
-
-    // Fetch the original image dimensions.
-    const S32 imageWidth = getImageWidth();
-    const S32 imageHeight = getImageHeight();
-
-    // Clear default frame.
-    mFrames.clear();
+    // Fetch the explicit frames.
+    ExplicitFrameTable* pExplicitFrames = mpExplicitFrames;
 
     // Are any explicit frames set.
-    if ( mExplicitFrames.size() == 0 )
+    if ( pExplicitFrames->mCells.size() == 0 )
     {
         // No, so set full-frame as default.
-        FrameArea frameArea( 0, 0, imageWidth, imageHeight, texelWidthScale, texelHeightScale );
+        FrameArea frameArea;
+        setFrameArea( frameArea, 0, 0, getImageWidth(), getImageHeight() );
         mFrames.push_back( frameArea );
 
         return;
     }
 
-    // Iterate explicit frames.
-    for( typeExplicitFrameAreaVector::iterator frameItr = mExplicitFrames.begin(); frameItr != mExplicitFrames.end(); ++frameItr )
+    // Are the frames already calculated for this texture layout?
+    const bool sameLayout =
+        pExplicitFrames->mTexelWidthScale == mTexelWidthScale &&
+        pExplicitFrames->mTexelHeightScale == mTexelHeightScale &&
+        pExplicitFrames->mTextureOffset == mTextureOffset;
+
+    if ( pExplicitFrames->mFramesValid )
+    {
+        // Yes, so use the frames shared with any clones.
+        if ( sameLayout )
+        {
+            mpFrames = &pExplicitFrames->mFrames;
+            return;
+        }
+
+        // No, so copy the cells if the frames are shared with a different layout.
+        if ( pExplicitFrames->mRefCount > 1 )
+        {
+            getWritableExplicitCells();
+            pExplicitFrames = mpExplicitFrames;
+        }
+    }
+
+    // Calculate the frames.
+    typeFrameAreaVector& frames = pExplicitFrames->mFrames;
+    frames.setSize( pExplicitFrames->mCells.size() );
+    for( S32 index = 0; index < pExplicitFrames->mCells.size(); ++index )
     {
         // Fetch pixel area.
-        const FrameArea::PixelArea& pixelArea = *frameItr;
+        const FrameArea::PixelArea& pixelArea = pExplicitFrames->mCells[index];
 
         // Set frame area.
-        FrameArea frameArea( pixelArea.mPixelOffset.x, pixelArea.mPixelOffset.y, pixelArea.mPixelWidth, pixelArea.mPixelHeight, texelWidthScale, texelHeightScale );
-
-        // Store frame.
-        mFrames.push_back( frameArea );
+        setFrameArea( frames[index], pixelArea.mPixelOffset.x, pixelArea.mPixelOffset.y, pixelArea.mPixelWidth, pixelArea.mPixelHeight );
     }
+
+    pExplicitFrames->mFramesValid = true;
+    pExplicitFrames->mTexelWidthScale = mTexelWidthScale;
+    pExplicitFrames->mTexelHeightScale = mTexelHeightScale;
+    pExplicitFrames->mTextureOffset = mTextureOffset;
+
+    mpFrames = &frames;
 }
 
 //------------------------------------------------------------------------------
@@ -1193,7 +1568,7 @@ void ImageAsset::onTamlCustomWrite( TamlCustomNodes& customNodes )
     TamlCustomNode* pCustomCellNodes = customNodes.addNode( cellCustomNodeName );
 
     // Iterate explicit frames.
-    for( typeExplicitFrameAreaVector::iterator frameItr = mExplicitFrames.begin(); frameItr != mExplicitFrames.end(); ++frameItr )
+    for( typeExplicitFrameAreaVector::iterator frameItr = mpExplicitFrames->mCells.begin(); frameItr != mpExplicitFrames->mCells.end(); ++frameItr )
     {
         // Fetch pixel area.
         const FrameArea::PixelArea& pixelArea = *frameItr;
@@ -1311,7 +1686,7 @@ void ImageAsset::onTamlCustomRead( const TamlCustomNodes& customNodes )
 
         // Add explicit frame.
         FrameArea::PixelArea pixelArea( cellOffset.x, cellOffset.y, cellWidth, cellHeight );
-        mExplicitFrames.push_back( pixelArea );
+        getWritableExplicitCells().push_back( pixelArea );
     }
 }
 
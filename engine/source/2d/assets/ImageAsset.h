@@ -39,6 +39,10 @@
 #include "graphics/TextureManager.h"
 #endif
 
+#ifndef _TEXTURE_ATLAS_H_
+#include "graphics/TextureAtlas.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 DefineConsoleType( TypeImageAssetPtr )
@@ -118,6 +122,7 @@ public:
         };
 
     public:
+        FrameArea() {}
         FrameArea( const S32 pixelFrameOffsetX, const S32 pixelFrameOffsetY, const U32 pixelFrameWidth, const U32 pixelFrameHeight, const F32 texelWidthScale, const F32 texelHeightScale )
         {
             setArea( pixelFrameOffsetX, pixelFrameOffsetY, pixelFrameWidth, pixelFrameHeight, texelWidthScale, texelHeightScale );
@@ -137,10 +142,28 @@ private:
     typedef Vector<FrameArea> typeFrameAreaVector;
     typedef Vector<FrameArea::PixelArea> typeExplicitFrameAreaVector;
 
+    /// Explicit cells shared between clones until one of them modifies the cells.
+    /// The frames calculated from the cells are shared too as long as the texture layout matches.
+    struct ExplicitFrameTable
+    {
+        ExplicitFrameTable() : mRefCount( 1 ), mFramesValid( false ), mTexelWidthScale( 0.0f ), mTexelHeightScale( 0.0f ), mTextureOffset( 0, 0 ) {}
+
+        U32                         mRefCount;
+        typeExplicitFrameAreaVector mCells;
+        typeFrameAreaVector         mFrames;
+        bool                        mFramesValid;
+        F32                         mTexelWidthScale;
+        F32                         mTexelHeightScale;
+        Point2I                     mTextureOffset;
+    };
+
     /// Configuration.
     StringTableEntry            mImageFile;
     bool						mForce16Bit;
+    bool                        mMipmaps;
+    bool                        mPremultipliedAlpha;
     TextureFilterMode           mLocalFilterMode;
+    TextureHandle::ResidencyPriority mResidencyPriority;
     bool                        mExplicitMode;
     bool                        mCellRowOrder;
     S32                         mCellOffsetX;
@@ -153,9 +176,20 @@ private:
     S32                         mCellCountY;
 
     /// Imagery.
+    /// Implicit cells are calculated on demand and explicit frames come from the shared explicit frame table.
     typeFrameAreaVector         mFrames;
-    typeExplicitFrameAreaVector mExplicitFrames;
+    const typeFrameAreaVector*  mpFrames;
+    ExplicitFrameTable*         mpExplicitFrames;
+    U32                         mImplicitFrameCount;
+    bool                        mImplicitPlaceholder;
+    S32                         mCellStepX;
+    S32                         mCellStepY;
+    F32                         mTexelWidthScale;
+    F32                         mTexelHeightScale;
+    Point2I                     mTextureOffset;
     TextureHandle               mImageTextureHandle;
+    bool                        mTextureLoadPending;
+    TextureAtlas::Entry*        mpAtlasEntry;
 
 public:
     ImageAsset();
@@ -173,9 +207,18 @@ public:
     void                    setForce16Bit( const bool force16Bit );
     inline bool             getForce16Bit( void ) const                     { return mForce16Bit; }
 
+    void                    setMipmaps( const bool mipmaps );
+    inline bool             getMipmaps( void ) const                        { return mMipmaps; }
+
+    void                    setPremultipliedAlpha( const bool premultipliedAlpha );
+    inline bool             getPremultipliedAlpha( void ) const             { return mPremultipliedAlpha; }
+
     void                    setFilterMode( const TextureFilterMode filterMode );
     TextureFilterMode       getFilterMode( void ) const                     { return mLocalFilterMode; }
 
+    void                    setResidencyPriority( const TextureHandle::ResidencyPriority residencyPriority );
+    TextureHandle::ResidencyPriority getResidencyPriority( void ) const     { return mResidencyPriority; }
+
     void                    setExplicitMode( const bool explicitMode );
     bool                    getExplicitMode( void ) const                   { return mExplicitMode; }
 
@@ -207,11 +250,13 @@ public:
     S32                     getCellHeight( void) const						{ return mCellHeight; }
 
     inline TextureHandle&   getImageTexture( void )                         { return mImageTextureHandle; }
-    inline S32              getImageWidth( void ) const                     { return mImageTextureHandle.getWidth(); }
-    inline S32              getImageHeight( void ) const                    { return mImageTextureHandle.getHeight(); }
-    inline U32              getFrameCount( void ) const                     { return (U32)mFrames.size(); };
+    inline S32              getImageWidth( void ) const                     { return mpAtlasEntry == NULL ? mImageTextureHandle.getWidth() : mpAtlasEntry->getWidth(); }
+    inline S32              getImageHeight( void ) const                    { return mpAtlasEntry == NULL ? mImageTextureHandle.getHeight() : mpAtlasEntry->getHeight(); }
+    inline Point2I          getImageAtlasOffset( void ) const               { return mpAtlasEntry == NULL ? Point2I( 0, 0 ) : mpAtlasEntry->getOffset(); }
+    inline U32              getFrameCount( void ) const                     { return mImplicitFrameCount != 0 ? mImplicitFrameCount : (U32)mpFrames->size(); };
 
-    inline const FrameArea& getImageFrameArea( U32 frame ) const            { clampFrame(frame); return mFrames[frame]; };
+    /// Implicit cell frames are calculated on demand so frames are returned by value.
+    inline FrameArea        getImageFrameArea( U32 frame ) const            { clampFrame(frame); return mImplicitFrameCount != 0 ? getImplicitFrameArea(frame) : (*mpFrames)[frame]; };
     inline const void       bindImageTexture( void)                         { glBindTexture( GL_TEXTURE_2D, getImageTexture().getGLName() ); };
     
     virtual bool            isAssetValid( void ) const                      { return !mImageTextureHandle.IsNull(); }
@@ -222,10 +267,12 @@ public:
     bool                    insertExplicitCell( const S32 cellIndex, const S32 cellOffsetX, const S32 cellOffsetY, const S32 cellWidth, const S32 cellHeight );
     bool                    removeExplicitCell( const S32 cellIndex );
     bool                    setExplicitCell( const S32 cellIndex, const S32 cellOffsetX, const S32 cellOffsetY, const S32 cellWidth, const S32 cellHeight );
-    inline S32              getExplicitCellCount( void ) const              { return mExplicitFrames.size(); }
+    inline S32              getExplicitCellCount( void ) const              { return mpExplicitFrames->mCells.size(); }
     
     static TextureFilterMode getFilterModeEnum(const char* label);
     static const char* getFilterModeDescription( TextureFilterMode filterMode );
+    static TextureHandle::ResidencyPriority getResidencyPriorityEnum(const char* label);
+    static const char* getResidencyPriorityDescription( TextureHandle::ResidencyPriority residencyPriority );
 
     /// Declare Console Object.
     DECLARE_CONOBJECT(ImageAsset);
@@ -233,8 +280,24 @@ public:
 private:
     inline void clampFrame( U32& frame ) const                              { const U32 totalFrames = getFrameCount(); if ( frame >= totalFrames ) frame = (totalFrames == 0 ? 0 : totalFrames-1 ); };
     void calculateImage( void );
+    void calculateFrames( void );
+    void calculatePlaceholderFrames( void );
+    void onTextureLoaded( const bool success );
+    void releaseAtlasEntry( void );
     void calculateImplicitMode( void );
     void calculateExplicitMode( void );
+    void clearFrames( void );
+    void setImplicitFrames( const U32 frameCount, const bool placeholder );
+    FrameArea getImplicitFrameArea( const U32 frame ) const;
+    typeExplicitFrameAreaVector& getWritableExplicitCells( void );
+    void shareExplicitFrames( ExplicitFrameTable* pExplicitFrames );
+    inline void setFrameArea( FrameArea& frameArea, const S32 pixelOffsetX, const S32 pixelOffsetY, const U32 pixelWidth, const U32 pixelHeight ) const
+    {
+        // The pixel area is relative to the image but the texel area is relative to the texture the image is in.
+        frameArea.mPixelArea.setArea( pixelOffsetX, pixelOffsetY, pixelWidth, pixelHeight );
+        const FrameArea::PixelArea texturePixelArea( pixelOffsetX + mTextureOffset.x, pixelOffsetY + mTextureOffset.y, pixelWidth, pixelHeight );
+        frameArea.mTexelArea.setArea( texturePixelArea, mTexelWidthScale, mTexelHeightScale );
+    }
     void setTextureFilter( const TextureFilterMode filterMode );
 
 protected:
@@ -250,6 +313,8 @@ protected:
 
 protected:
     static void textureEventCallback( const U32 eventCode, void *userData );
+    static void textureLoadCallback( TextureObject* pTextureObject, const bool success, void *userData );
+    static void atlasEntryMovedCallback( TextureAtlas::Entry* pEntry, void* userData );
 
     static bool setImageFile( void* obj, const char* data )                 { static_cast<ImageAsset*>(obj)->setImageFile(data); return false; }
     static const char* getImageFile(void* obj, const char* data)            { return static_cast<ImageAsset*>(obj)->getImageFile(); }
@@ -258,9 +323,18 @@ protected:
     static bool setForce16Bit( void* obj, const char* data )                { static_cast<ImageAsset*>(obj)->setForce16Bit(dAtob(data)); return false; }
     static bool writeForce16Bit( void* obj, StringTableEntry pFieldName )   { return static_cast<ImageAsset*>(obj)->getForce16Bit() == true; }
 
+    static bool setMipmaps( void* obj, const char* data )                   { static_cast<ImageAsset*>(obj)->setMipmaps(dAtob(data)); return false; }
+    static bool writeMipmaps( void* obj, StringTableEntry pFieldName )      { return static_cast<ImageAsset*>(obj)->getMipmaps() == true; }
+
+    static bool setPremultipliedAlpha( void* obj, const char* data )        { static_cast<ImageAsset*>(obj)->setPremultipliedAlpha(dAtob(data)); return false; }
+    static bool writePremultipliedAlpha( void* obj, StringTableEntry pFieldName ) { return static_cast<ImageAsset*>(obj)->getPremultipliedAlpha() == true; }
+
     static bool setFilterMode( void* obj, const char* data );
     static bool writeFilterMode( void* obj, StringTableEntry pFieldName )   { return static_cast<ImageAsset*>(obj)->getFilterMode() != FILTER_BILINEAR; }
 
+    static bool setResidencyPriority( void* obj, const char* data )         { static_cast<ImageAsset*>(obj)->setResidencyPriority(getResidencyPriorityEnum(data)); return false; }
+    static bool writeResidencyPriority( void* obj, StringTableEntry pFieldName ) { return static_cast<ImageAsset*>(obj)->getResidencyPriority() != TextureHandle::ResidencyNormal; }
+
     static bool setExplicitMode( void* obj, const char* data )              { static_cast<ImageAsset*>(obj)->setExplicitMode(dAtob(data)); return false; }
 
     static bool setCellRowOrder( void* obj, const char* data )              { static_cast<ImageAsset*>(obj)->setCellRowOrder(dAtob(data)); return false; }
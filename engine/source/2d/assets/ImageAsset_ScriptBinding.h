@@ -65,6 +65,23 @@ ConsoleMethod(ImageAsset, getFilterMode, const char*, 2, 2,   "() Gets the filte
 
 //-----------------------------------------------------------------------------
 
+ConsoleMethod(ImageAsset, setResidencyPriority, void, 3, 3,     "(priority) Sets the texture residency priority used when evicting textures to stay within the texture budget.\n"
+                                                                "@param priority The priority of LOW, NORMAL, HIGH or PINNED.  Pinned textures are never evicted.\n"
+                                                                "@return No return value.")
+{
+    object->setResidencyPriority( ImageAsset::getResidencyPriorityEnum( argv[2] ) );
+}
+
+//------------------------------------------------------------------------------
+
+ConsoleMethod(ImageAsset, getResidencyPriority, const char*, 2, 2, "() Gets the texture residency priority.\n"
+                                                                "@return The texture residency priority.")
+{
+    return ImageAsset::getResidencyPriorityDescription( object->getResidencyPriority() );
+}
+
+//-----------------------------------------------------------------------------
+
 ConsoleMethod(ImageAsset, setForce16Bit, void, 3, 3,          "(force16Bit?) Sets whether 16-bit image is forced or not.\n"
                                                                         "@return No return value.")
 {
@@ -81,6 +98,39 @@ ConsoleMethod(ImageAsset, getForce16Bit, bool, 2, 2,          "() Gets whether 1
 
 //-----------------------------------------------------------------------------
 
+ConsoleMethod(ImageAsset, setMipmaps, void, 3, 3,             "(mipmaps?) Sets whether a mipmap chain is generated when the texture is loaded.\n"
+                                                                        "@return No return value.")
+{
+    object->setMipmaps( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(ImageAsset, getMipmaps, bool, 2, 2,             "() Gets whether a mipmap chain is generated when the texture is loaded.\n"
+                                                                        "@return Whether a mipmap chain is generated when the texture is loaded.")
+{
+    return object->getMipmaps();
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(ImageAsset, setPremultipliedAlpha, void, 3, 3,  "(premultipliedAlpha?) Sets whether the texture colors are premultiplied by alpha when the texture is loaded.\n"
+                                                                        "Premultiplied textures render alpha and additive blending in the same batch.\n"
+                                                                        "@return No return value.")
+{
+    object->setPremultipliedAlpha( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(ImageAsset, getPremultipliedAlpha, bool, 2, 2,  "() Gets whether the texture colors are premultiplied by alpha when the texture is loaded.\n"
+                                                                        "@return Whether the texture colors are premultiplied by alpha when the texture is loaded.")
+{
+    return object->getPremultipliedAlpha();
+}
+
+//-----------------------------------------------------------------------------
+
 ConsoleMethod(ImageAsset, setCellRowOrder, void, 3, 3,        "(rowOrder?) Sets whether CELL row order should be used or not.\n"
                                                                         "@return No return value.")
 {
@@ -289,7 +339,7 @@ ConsoleMethod(ImageAsset, getFrameSize, const char*, 3, 3,    "(int frame) - Get
     }
 
     // Fetch Selected Frame Pixel Area.
-    const ImageAsset::FrameArea::PixelArea& framePixelArea = object->getImageFrameArea( frame ).mPixelArea;
+    const ImageAsset::FrameArea::PixelArea framePixelArea = object->getImageFrameArea( frame ).mPixelArea;
 
     // Create Returnable Buffer.
     char* pBuffer = Con::getReturnBuffer(32);
@@ -78,6 +78,10 @@ void AmbientForceController::copyTo(SimObject* object)
 
 void AmbientForceController::integrate( Scene* pScene, const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats )
 {
+    // Finish if the force would have no effect.
+    if ( mForce.isZero() )
+        return;
+
     // Process all the scene objects.
     for( SceneObjectSet::iterator itr = begin(); itr != end(); ++itr )
     {
@@ -81,6 +81,19 @@ void BuoyancyController::copyTo(SimObject* object)
     AssertFatal(pController != NULL, "BuoyancyController::copyTo() - Object is not the correct type.");
 }
 
+//------------------------------------------------------------------------------
+
+bool BuoyancyController::getRegion( b2AABB& region, WorldQueryFilter& queryFilter )
+{
+    // The region is the fluid area.
+    region = mFluidArea;
+
+    // Fetch the query filter.
+    queryFilter = getQueryFilter();
+
+    return true;
+}
+
 //------------------------------------------------------------------------------
 /*
 * Copyright (c) 2006-2009 Erin Catto http://www.box2d.org
@@ -103,20 +116,14 @@ void BuoyancyController::copyTo(SimObject* object)
 
 void BuoyancyController::integrate( Scene* pScene, const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats )
 {
-    // Prepare query filter.
-    WorldQuery* pWorldQuery = prepareQueryFilter( pScene );
-
-    // Query for candidate objects.
-    pWorldQuery->anyQueryAABB( mFluidArea ); 
-
-    // Fetch results.
-    typeWorldQueryResultVector& queryResults = pWorldQuery->getQueryResults();
+    // Fetch the candidates gathered by the scene region query.
+    typeSceneObjectVector& regionCandidates = getRegionCandidates();
 
-    // Iterate the results.
-    for ( U32 n = 0; n < (U32)queryResults.size(); n++ )
+    // Iterate the candidates.
+    for ( U32 n = 0; n < (U32)regionCandidates.size(); n++ )
     {
         // Fetch the scene object.
-        SceneObject* pSceneObject = queryResults[n].mpSceneObject;
+        SceneObject* pSceneObject = regionCandidates[n];
 
         // Skip if asleep.
         if ( !pSceneObject->getAwake() )
@@ -73,6 +73,9 @@ public:
     static void initPersistFields();
     virtual void copyTo(SimObject* object);
 
+    /// Regions.
+    virtual bool getRegion( b2AABB& region, WorldQueryFilter& queryFilter );
+
     /// Integration.
     virtual void integrate( Scene* pScene, const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
 
@@ -94,54 +94,57 @@ void PointForceController::setTrackedObject( SceneObject* pSceneObject )
 
 //------------------------------------------------------------------------------
 
-void PointForceController::integrate( Scene* pScene, const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats )
+bool PointForceController::getRegion( b2AABB& region, WorldQueryFilter& queryFilter )
 {
-    // Finish if the attractor would have no effect.
+    // No region if the attractor would have no effect.
     if ( mIsZero( mForce ) || mIsZero( mRadius ) )
-        return;
-
-    // Prepare query filter.
-    WorldQuery* pWorldQuery = prepareQueryFilter( pScene );
+        return false;
 
     // Fetch the current position.
     const Vector2 currentPosition = getCurrentPosition();
 
     // Calculate the AABB of the attractor.
-    b2AABB aabb;
-    aabb.lowerBound.Set( currentPosition.x - mRadius, currentPosition.y - mRadius );
-    aabb.upperBound.Set( currentPosition.x + mRadius, currentPosition.y + mRadius );
+    region.lowerBound.Set( currentPosition.x - mRadius, currentPosition.y - mRadius );
+    region.upperBound.Set( currentPosition.x + mRadius, currentPosition.y + mRadius );
 
-    // Query for candidate objects.
-    pWorldQuery->anyQueryAABB( aabb ); 
+    // Fetch the query filter.
+    queryFilter = getQueryFilter();
 
-    // Fetch results.
-    typeWorldQueryResultVector& queryResults = pWorldQuery->getQueryResults();
+    return true;
+}
 
-    // Fetch result count.
-    const U32 resultCount = (U32)queryResults.size();
+//------------------------------------------------------------------------------
 
-    // Finish if nothing to process.
-    if ( resultCount == 0 )
+void PointForceController::integrate( Scene* pScene, const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats )
+{
+    // Finish if the attractor would have no effect.
+    if ( mIsZero( mForce ) || mIsZero( mRadius ) )
         return;
 
-    // Calculate the radius squared.
-    const F32 radiusSqr = mRadius * mRadius;
+    // Fetch the candidates gathered by the scene region query.
+    typeSceneObjectVector& regionCandidates = getRegionCandidates();
 
-    // Calculate the force squared in-case we need it.
-    const F32 forceSqr = mForce * mForce * (( mForce < 0.0f ) ? -1.0f : 1.0f);
+    // Fetch candidate count.
+    const U32 regionCandidateCount = (U32)regionCandidates.size();
 
-    // Calculate drag coefficients (time-integrated).
-    const F32 linearDrag = mClampF( mLinearDrag, 0.0f, 1.0f ) * elapsedTime;
-    const F32 angularDrag = mClampF( mAngularDrag, 0.0f, 1.0f ) * elapsedTime;
+    // Finish if nothing to process.
+    if ( regionCandidateCount == 0 )
+        return;
+
+    // Fetch the current position.
+    const Vector2 currentPosition = getCurrentPosition();
 
     // Fetch the tracked object.
     const SceneObject* pTrackedObject = mTrackedObject;
 
-    // Iterate the results.
-    for ( U32 n = 0; n < resultCount; n++ )
+    // Gather the candidate offsets to the controllers current position.
+    mCandidateObjects.clear();
+    mCandidateOffsetX.clear();
+    mCandidateOffsetY.clear();
+    for ( U32 n = 0; n < regionCandidateCount; n++ )
     {
         // Fetch the scene object.
-        SceneObject* pSceneObject = queryResults[n].mpSceneObject;
+        SceneObject* pSceneObject = regionCandidates[n];
 
         // Ignore if it's the tracked object.
         if ( pSceneObject == pTrackedObject )
@@ -151,30 +154,74 @@ void PointForceController::integrate( Scene* pScene, const F32 totalTime, const
         if ( pSceneObject->getBodyType() == b2_staticBody )
             continue;
 
-        // Calculate the force distance to the controllers current position.
-        Vector2 distanceForce = currentPosition - pSceneObject->getPosition();
+        // Fetch the position.
+        const b2Vec2& position = pSceneObject->getBody()->GetPosition();
+
+        mCandidateObjects.push_back( pSceneObject );
+        mCandidateOffsetX.push_back( currentPosition.x - position.x );
+        mCandidateOffsetY.push_back( currentPosition.y - position.y );
+    }
 
-        // Fetch distance squared.
-        const F32 distanceSqr = distanceForce.LengthSquared();
+    // Fetch candidate count.
+    const U32 candidateCount = (U32)mCandidateObjects.size();
 
-        // Skip if the position is outside the radius or is centered on the controller.
-        if ( distanceSqr > radiusSqr || distanceSqr < FLT_EPSILON )
-            continue;
+    // Finish if nothing to process.
+    if ( candidateCount == 0 )
+        return;
+
+    // Calculate the radius squared.
+    const F32 radiusSqr = mRadius * mRadius;
+
+    // Calculate the force squared in-case we need it.
+    const F32 forceSqr = mForce * mForce * (( mForce < 0.0f ) ? -1.0f : 1.0f);
 
-        // Non-Linear force?
-        if ( mNonLinear )
+    // Calculate the force scale for each candidate.
+    // These loops are kept branch-free over flat arrays so the compiler can vectorize them.
+    // Candidates outside the radius or centered on the controller get a zero scale.
+    mCandidateScale.setSize( candidateCount );
+    const F32* pOffsetX = mCandidateOffsetX.address();
+    const F32* pOffsetY = mCandidateOffsetY.address();
+    F32* pScale = mCandidateScale.address();
+    if ( mNonLinear )
+    {
+        // Use an approximation of the inverse-square law.
+        for ( U32 n = 0; n < candidateCount; n++ )
         {
-            // Yes, so use an approximation of the inverse-square law.
-            distanceForce *= (1.0f / distanceSqr) * forceSqr;
+            const F32 distanceSqr = pOffsetX[n] * pOffsetX[n] + pOffsetY[n] * pOffsetY[n];
+            const bool inRange = distanceSqr <= radiusSqr && distanceSqr >= FLT_EPSILON;
+            pScale[n] = inRange ? forceSqr / getMax( distanceSqr, FLT_EPSILON ) : 0.0f;
         }
-        else
+    }
+    else
+    {
+        // Normalize to the specified force (linear).
+        for ( U32 n = 0; n < candidateCount; n++ )
         {
-            // No, so normalize to the specified force (linear).
-            distanceForce.Normalize( mForce );
+            const F32 distanceSqr = pOffsetX[n] * pOffsetX[n] + pOffsetY[n] * pOffsetY[n];
+            const bool inRange = distanceSqr <= radiusSqr && distanceSqr >= FLT_EPSILON;
+            pScale[n] = inRange ? mForce / mSqrt( getMax( distanceSqr, FLT_EPSILON ) ) : 0.0f;
         }
+    }
+
+    // Calculate drag coefficients (time-integrated).
+    const F32 linearDrag = mClampF( mLinearDrag, 0.0f, 1.0f ) * elapsedTime;
+    const F32 angularDrag = mClampF( mAngularDrag, 0.0f, 1.0f ) * elapsedTime;
+
+    // Apply the forces.
+    for ( U32 n = 0; n < candidateCount; n++ )
+    {
+        // Fetch the force scale.
+        const F32 scale = pScale[n];
+
+        // Skip if out of range.
+        if ( scale == 0.0f )
+            continue;
+
+        // Fetch the scene object.
+        SceneObject* pSceneObject = mCandidateObjects[n];
 
         // Apply the force.
-        pSceneObject->applyForce( distanceForce, true );
+        pSceneObject->applyForce( Vector2( pOffsetX[n] * scale, pOffsetY[n] * scale ), true );
 
         // Linear drag?
         if ( linearDrag > 0.0f )
@@ -59,6 +59,12 @@ private:
     /// Tracked object.
     SimObjectPtr<SceneObject> mTrackedObject;
 
+    /// Candidate scratch laid out as flat arrays for the force calculation.
+    typeSceneObjectVector mCandidateObjects;
+    Vector<F32> mCandidateOffsetX;
+    Vector<F32> mCandidateOffsetY;
+    Vector<F32> mCandidateScale;
+
 public:
     PointForceController();
     virtual ~PointForceController();
@@ -89,6 +95,9 @@ public:
         return pSceneObject == NULL ? mPosition : b2Mul( pSceneObject->getTransform(), mPosition);
     }
 
+    /// Regions.
+    virtual bool getRegion( b2AABB& region, WorldQueryFilter& queryFilter );
+
     /// Integration.
     virtual void integrate( Scene* pScene, const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
 
@@ -71,8 +71,7 @@ WorldQuery* PickingSceneController::prepareQueryFilter( Scene* pScene, const boo
     WorldQuery* pWorldQuery = pScene->getWorldQuery( clearQuery );
 
     // Set filter.
-    WorldQueryFilter queryFilter( mControlLayerMask, mControlGroupMask, true, false, true, true );
-    pWorldQuery->setQueryFilter( queryFilter );
+    pWorldQuery->setQueryFilter( getQueryFilter() );
 
     return pWorldQuery;
 }
@@ -23,6 +23,10 @@
 #ifndef _SCENE_CONTROLLER_H_
 #define _SCENE_CONTROLLER_H_
 
+#ifndef _WORLD_QUERY_FILTER_H_
+#include "2d/scene/WorldQueryFilter.h"
+#endif
+
 //------------------------------------------------------------------------------
 
 class Scene;
@@ -38,11 +42,21 @@ public:
     SceneController() {}
     virtual ~SceneController() {}
 
+    /// Regions.
+    /// Controllers acting on a spatial region return it here so the scene can gather the candidates
+    /// for all its controllers with a shared broadphase query before integrating them.
+    /// The candidates are the same as an "anyQueryAABB()" of the region would find.
+    virtual bool getRegion( b2AABB& region, WorldQueryFilter& queryFilter ) { return false; }
+    inline typeSceneObjectVector& getRegionCandidates( void ) { return mRegionCandidates; }
+
     /// Integration.
     virtual void integrate( Scene* pScene, const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats ) = 0;
 
     // Scene render.
     virtual void renderOverlay( Scene* pScene, const SceneRenderState* pSceneRenderState, BatchRender* pBatchRenderer ) = 0;
+
+protected:
+    typeSceneObjectVector mRegionCandidates;
 };
 
 #endif // _SCENE_CONTROLLER_H_
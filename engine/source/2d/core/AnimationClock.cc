@@ -0,0 +1,208 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "2d/core/AnimationClock.h"
+
+#ifndef _TICKABLE_H_
+#include "platform/Tickable.h"
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+AnimationClock::AnimationClock( AnimationClockSet* pClockSet, const AnimationAsset* pAnimationAsset, const F32 timeScale ) :
+    mpClockSet( pClockSet ),
+    mpAnimationAsset( pAnimationAsset ),
+    mTimeScale( timeScale ),
+    mTime( 0.0f ),
+    mSubscriberCount( 0 )
+{
+}
+
+//-----------------------------------------------------------------------------
+
+F32 AnimationClock::getTime( const F32 phase ) const
+{
+    // Fetch the animation length.
+    const F32 totalTime = mpAnimationAsset->getAnimationTime();
+
+    // Finish if the animation has no length.
+    if ( totalTime <= 0.0f )
+        return 0.0f;
+
+    // Wrap the phased time.
+    const F32 time = mFmod( mTime + phase, totalTime );
+
+    return time < 0.0f ? time + totalTime : time;
+}
+
+//-----------------------------------------------------------------------------
+
+S32 AnimationClock::getFrameIndex( const F32 phase ) const
+{
+    // Fetch the validated frame count.
+    const S32 frameCount = mpAnimationAsset->getValidatedAnimationFrames().size();
+
+    // Fetch the animation length.
+    const F32 totalTime = mpAnimationAsset->getAnimationTime();
+
+    // Finish if there's nothing to animate.
+    if ( frameCount == 0 || totalTime <= 0.0f )
+        return 0;
+
+    // Calculate the frame index.
+    const S32 frameIndex = (S32)(getTime( phase ) * (F32)frameCount / totalTime);
+
+    return frameIndex < frameCount ? frameIndex : frameCount-1;
+}
+
+//-----------------------------------------------------------------------------
+
+void AnimationClock::advance( const F32 elapsedTime )
+{
+    // Fetch the animation length.
+    const F32 totalTime = mpAnimationAsset->getAnimationTime();
+
+    // Finish if the animation has no length.
+    if ( totalTime <= 0.0f )
+        return;
+
+    // Update the time, keeping it wrapped so precision doesn't degrade over long sessions.
+    mTime = mFmod( mTime + elapsedTime * mTimeScale, totalTime );
+}
+
+//-----------------------------------------------------------------------------
+
+AnimationClockSet::AnimationClockSet()
+{
+    // Set Vector Associations.
+    VECTOR_SET_ASSOCIATION( mClocks );
+}
+
+//-----------------------------------------------------------------------------
+
+AnimationClockSet::~AnimationClockSet()
+{
+    // Sanity!
+    AssertWarn( mClocks.size() == 0, "AnimationClockSet::~AnimationClockSet() - Animation clocks are still subscribed." );
+
+    // Delete any remaining clocks.
+    for ( S32 n = 0; n < mClocks.size(); ++n )
+    {
+        delete mClocks[n];
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+AnimationClock* AnimationClockSet::acquireClock( const AnimationAsset* pAnimationAsset, const F32 timeScale )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AnimationClockSet_AcquireClock);
+
+    // Sanity!
+    AssertFatal( pAnimationAsset != NULL, "AnimationClockSet::acquireClock() - Animation asset cannot be NULL." );
+
+    // Find an existing clock.
+    AnimationClock* pAnimationClock = NULL;
+    for ( S32 n = 0; n < mClocks.size(); ++n )
+    {
+        AnimationClock* pClock = mClocks[n];
+
+        if ( pClock->mpAnimationAsset == pAnimationAsset && pClock->mTimeScale == timeScale )
+        {
+            pAnimationClock = pClock;
+            break;
+        }
+    }
+
+    // Create a clock if none was found.
+    if ( pAnimationClock == NULL )
+    {
+        pAnimationClock = new AnimationClock( this, pAnimationAsset, timeScale );
+        mClocks.push_back( pAnimationClock );
+    }
+
+    // Subscribe.
+    pAnimationClock->mSubscriberCount++;
+
+    return pAnimationClock;
+}
+
+//-----------------------------------------------------------------------------
+
+void AnimationClockSet::releaseClock( AnimationClock* pAnimationClock )
+{
+    // Sanity!
+    AssertFatal( pAnimationClock != NULL && pAnimationClock->mpClockSet == this, "AnimationClockSet::releaseClock() - Clock does not belong to this set." );
+    AssertFatal( pAnimationClock->mSubscriberCount > 0, "AnimationClockSet::releaseClock() - Clock has no subscribers." );
+
+    // Finish if the clock is still subscribed.
+    if ( --pAnimationClock->mSubscriberCount > 0 )
+        return;
+
+    // Remove the clock.
+    for ( S32 n = 0; n < mClocks.size(); ++n )
+    {
+        if ( mClocks[n] == pAnimationClock )
+        {
+            mClocks.erase_fast( n );
+            break;
+        }
+    }
+
+    delete pAnimationClock;
+}
+
+//-----------------------------------------------------------------------------
+
+void AnimationClockSet::advance( const F32 elapsedTime )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AnimationClockSet_Advance);
+
+    for ( S32 n = 0; n < mClocks.size(); ++n )
+    {
+        mClocks[n]->advance( elapsedTime );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+/// Clock set advanced by the tick process.
+class GlobalAnimationClockSet : public AnimationClockSet, public virtual Tickable
+{
+public:
+    virtual void processTick( void )                    { advance( Tickable::smTickSec ); }
+    virtual void interpolateTick( F32 delta )           {}
+    virtual void advanceTime( F32 timeDelta )           {}
+};
+
+//-----------------------------------------------------------------------------
+
+AnimationClockSet* AnimationClockSet::getGlobalClocks( void )
+{
+    static GlobalAnimationClockSet globalClocks;
+    return &globalClocks;
+}
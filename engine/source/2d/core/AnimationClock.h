@@ -0,0 +1,101 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _ANIMATION_CLOCK_H_
+#define _ANIMATION_CLOCK_H_
+
+#ifndef _ANIMATION_ASSET_H_
+#include "2d/assets/AnimationAsset.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class AnimationClockSet;
+
+//-----------------------------------------------------------------------------
+
+/// A shared playback clock for every synchronized frame provider playing the same
+/// animation at the same time scale.
+/// The clock is advanced once per tick and each subscriber derives its current
+/// frame from the clock time plus its own phase offset so synchronized providers
+/// need no per-instance integration.
+class AnimationClock
+{
+    friend class AnimationClockSet;
+
+public:
+    inline AnimationClockSet*       getClockSet( void ) const               { return mpClockSet; }
+    inline const AnimationAsset*    getAnimationAsset( void ) const         { return mpAnimationAsset; }
+    inline F32                      getTimeScale( void ) const              { return mTimeScale; }
+    inline U32                      getSubscriberCount( void ) const        { return mSubscriberCount; }
+
+    /// Animation time for the phase offset, wrapped to the animation length.
+    F32                             getTime( const F32 phase = 0.0f ) const;
+
+    /// Validated frame index for the phase offset.
+    S32                             getFrameIndex( const F32 phase = 0.0f ) const;
+
+private:
+    AnimationClock( AnimationClockSet* pClockSet, const AnimationAsset* pAnimationAsset, const F32 timeScale );
+
+    void                            advance( const F32 elapsedTime );
+
+private:
+    AnimationClockSet*              mpClockSet;
+    const AnimationAsset*           mpAnimationAsset;
+    F32                             mTimeScale;
+    F32                             mTime;
+    U32                             mSubscriberCount;
+};
+
+//-----------------------------------------------------------------------------
+
+/// The animation clocks for a single time-line such as a scene.
+/// Clocks are created on first subscription and destroyed when the last
+/// subscriber releases them.
+class AnimationClockSet
+{
+public:
+    AnimationClockSet();
+    virtual ~AnimationClockSet();
+
+    /// Subscription.
+    AnimationClock*     acquireClock( const AnimationAsset* pAnimationAsset, const F32 timeScale );
+    void                releaseClock( AnimationClock* pAnimationClock );
+
+    /// Advance every clock.
+    void                advance( const F32 elapsedTime );
+
+    inline U32          getClockCount( void ) const                         { return mClocks.size(); }
+
+    /// Clocks advanced by the tick process for providers outside of a scene.
+    static AnimationClockSet* getGlobalClocks( void );
+
+private:
+    Vector<AnimationClock*> mClocks;
+};
+
+#endif // _ANIMATION_CLOCK_H_
@@ -45,6 +45,10 @@ BatchRender::BatchRender() :
     mDstBlendFactor( GL_ONE_MINUS_SRC_ALPHA ),
     mBlendColor( ColorF(1.0f,1.0f,1.0f,1.0f) ),
     mAlphaTestMode( -1.0f ),
+    mBatchBlendMode( true ),
+    mBatchSrcBlendFactor( GL_SRC_ALPHA ),
+    mBatchDstBlendFactor( GL_ONE_MINUS_SRC_ALPHA ),
+    mBatchBlendColor( ColorF(1.0f,1.0f,1.0f,1.0f) ),
     mWireframeMode( false ),
     mBatchEnabled( true )
 {
@@ -116,6 +120,26 @@ void BatchRender::SubmitQuad(
 
     PROFILE_START(BatchRender_SubmitQuad);
 
+    // Resolve the blend state for the quad.
+    bool blendMode;
+    GLenum srcFactor;
+    GLenum dstFactor;
+    ColorF blendColor;
+    ColorF quadColor;
+    resolveBlendState( texture, color, blendMode, srcFactor, dstFactor, blendColor, quadColor );
+
+    // Flush if the blend state differs from the batch.
+    if (    blendMode != mBatchBlendMode ||
+            ( blendMode && ( srcFactor != mBatchSrcBlendFactor || dstFactor != mBatchDstBlendFactor || blendColor != mBatchBlendColor ) ) )
+    {
+        flush( mpDebugStats->batchBlendStateFlush );
+
+        mBatchBlendMode = blendMode;
+        mBatchSrcBlendFactor = srcFactor;
+        mBatchDstBlendFactor = dstFactor;
+        mBatchBlendColor = blendColor;
+    }
+
     // Do we have anything batched?
     if ( mQuadCount > 0 )
     {
@@ -123,25 +147,25 @@ void BatchRender::SubmitQuad(
         if ( mColorCount == 0 )
         {
             // No, so flush if color is specified.
-            if ( color != NoColor  )
+            if ( quadColor != NoColor  )
                 flush( mpDebugStats->batchColorStateFlush );
         }
         else
         {
             // Yes, so flush if color is not specified.
-            if ( color == NoColor  )
+            if ( quadColor == NoColor  )
                 flush( mpDebugStats->batchColorStateFlush );
         }
     }
 
     // Is a color specified?
-    if ( color != NoColor )
+    if ( quadColor != NoColor )
     {
         // Yes, so add colors.
-        mColorBuffer[mColorCount++] = color;
-        mColorBuffer[mColorCount++] = color;
-        mColorBuffer[mColorCount++] = color;
-        mColorBuffer[mColorCount++] = color;
+        mColorBuffer[mColorCount++] = quadColor;
+        mColorBuffer[mColorCount++] = quadColor;
+        mColorBuffer[mColorCount++] = quadColor;
+        mColorBuffer[mColorCount++] = quadColor;
     }
 
     // Strict order mode?
@@ -245,6 +269,44 @@ void BatchRender::SubmitQuad(
 
 //-----------------------------------------------------------------------------
 
+void BatchRender::resolveBlendState( const TextureHandle& texture, const ColorF& color, bool& blendMode, GLenum& srcFactor, GLenum& dstFactor, ColorF& blendColor, ColorF& quadColor ) const
+{
+    // Use the requested state by default.
+    blendMode = mBlendMode;
+    srcFactor = mSrcBlendFactor;
+    dstFactor = mDstBlendFactor;
+    blendColor = mBlendColor;
+    quadColor = color;
+
+    // Finish if not standard alpha or additive blending of a premultiplied-alpha texture.
+    if (    !mBlendMode ||
+            mSrcBlendFactor != GL_SRC_ALPHA ||
+            ( mDstBlendFactor != GL_ONE_MINUS_SRC_ALPHA && mDstBlendFactor != GL_ONE ) ||
+            !texture.getPremultipliedAlpha() )
+        return;
+
+    // Premultiply the quad color.
+    // The blend color is folded into the quad color so it does not split the batch.
+    const ColorF& sourceColor = color != NoColor ? color : mBlendColor;
+    quadColor.set( sourceColor.red * sourceColor.alpha, sourceColor.green * sourceColor.alpha, sourceColor.blue * sourceColor.alpha, sourceColor.alpha );
+    blendColor.set( 1.0f, 1.0f, 1.0f, 1.0f );
+    srcFactor = GL_ONE;
+    dstFactor = GL_ONE_MINUS_SRC_ALPHA;
+
+    // Additive blending.
+    if ( mDstBlendFactor == GL_ONE )
+    {
+        // A zero alpha adds the color without occluding the destination.
+        // Alpha-testing needs the alpha so keep it and add explicitly instead.
+        if ( mAlphaTestMode >= 0.0f )
+            dstFactor = GL_ONE;
+        else
+            quadColor.alpha = 0.0f;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 void BatchRender::flush( U32& reasonMetric )
 {
     // Finish if no quads to flush.
@@ -305,11 +367,11 @@ void BatchRender::flushInternal( void )
     }
 
     // Set blend mode.
-    if ( mBlendMode )
+    if ( mBatchBlendMode )
     {
         glEnable( GL_BLEND );
-        glBlendFunc( mSrcBlendFactor, mDstBlendFactor );
-        glColor4f(mBlendColor.red, mBlendColor.green, mBlendColor.blue, mBlendColor.alpha );
+        glBlendFunc( mBatchSrcBlendFactor, mBatchDstBlendFactor );
+        glColor4f(mBatchBlendColor.red, mBatchBlendColor.green, mBatchBlendColor.blue, mBatchBlendColor.alpha );
     }
     else
     {
@@ -82,18 +82,9 @@ public:
     inline bool getStrictOrderMode( void ) const { return mStrictOrderMode; }
 
     /// Turns-on blend mode with the specified blend factors and color.
+    /// The batch is only flushed when a quad is submitted with a different effective blend state.
     inline void setBlendMode( GLenum srcFactor, GLenum dstFactor, const ColorF& blendColor = ColorF(1.0f, 1.0f, 1.0f, 1.0f))
     {
-        // Ignore no change.
-        if (    mBlendMode &&
-                mSrcBlendFactor == srcFactor &&
-                mDstBlendFactor == dstFactor &&
-                mBlendColor == blendColor )
-                return;
-
-        // Flush.
-        flush( mpDebugStats->batchBlendStateFlush );
-
         mBlendMode = true;
         mSrcBlendFactor = srcFactor;
         mDstBlendFactor = dstFactor;
@@ -103,13 +94,6 @@ public:
     /// Turns-off blend mode.
     inline void setBlendOff( void )
     {
-        // Ignore no change,
-        if ( !mBlendMode )
-            return;
-
-        // Flush.
-        flush( mpDebugStats->batchBlendStateFlush );
-
         mBlendMode = false;
     }
 
@@ -212,6 +196,10 @@ private:
     /// Flush (render) any pending batches.
     void flushInternal( void );
 
+    /// Resolve the blend state and color used to render a quad.
+    /// Alpha and additive blending of premultiplied-alpha textures share a single blend state.
+    void resolveBlendState( const TextureHandle& texture, const ColorF& color, bool& blendMode, GLenum& srcFactor, GLenum& dstFactor, ColorF& blendColor, ColorF& quadColor ) const;
+
 private:
     typedef Vector<U32> indexVectorType;
     typedef HashMap<U32, indexVectorType*> textureBatchType;
@@ -238,6 +226,12 @@ private:
     ColorF              mBlendColor;
     F32                 mAlphaTestMode;
 
+    /// Blend state of the quads currently batched.
+    bool                mBatchBlendMode;
+    GLenum              mBatchSrcBlendFactor;
+    GLenum              mBatchDstBlendFactor;
+    ColorF              mBatchBlendColor;
+
     bool                mStrictOrderMode;
     TextureHandle       mStrictOrderTextureHandle;
     DebugStats*         mpDebugStats;
@@ -47,7 +47,13 @@
 
 //-----------------------------------------------------------------------------
 
-ImageFrameProviderCore::ImageFrameProviderCore() : mpImageAsset(NULL), mpAnimationAsset(NULL)
+ImageFrameProviderCore::ImageFrameProviderCore() :
+    mpImageAsset(NULL),
+    mpAnimationAsset(NULL),
+    mAnimationSynchronized(false),
+    mAnimationPhase(0.0f),
+    mpAnimationClockSet(NULL),
+    mpAnimationClock(NULL)
 {
 }
 
@@ -83,6 +89,9 @@ void ImageFrameProviderCore::allocateAssets( AssetPtr<ImageAsset>* pImageAssetPt
 
 void ImageFrameProviderCore::resetState( void )
 {
+    // Release any animation clock.
+    detachAnimationClock();
+
     mSelfTick = false;
 
     mCurrentFrameIndex = 0;
@@ -95,6 +104,8 @@ void ImageFrameProviderCore::resetState( void )
     mFrameIntegrationTime = 0.0f;
     mAnimationPaused = false;
     mAnimationFinished = true;
+    mAnimationSynchronized = false;
+    mAnimationPhase = 0.0f;
 
     clearAssets();
 }
@@ -109,6 +120,10 @@ void ImageFrameProviderCore::copyTo( ImageFrameProviderCore* pImageFrameProvider
     // Set self ticking.
     pImageFrameProviderCore->mSelfTick = mSelfTick;
 
+    // Set animation synchronization.
+    pImageFrameProviderCore->setAnimationPhase( mAnimationPhase );
+    pImageFrameProviderCore->setAnimationSynchronized( mAnimationSynchronized );
+
     // Static provider?
     if ( isStaticFrameProvider() )
     {
@@ -141,6 +156,10 @@ bool ImageFrameProviderCore::update( const F32 elapsedTime )
     if ( isAnimationFinished() )
         return false;
 
+    // Finish if a shared clock is driving the animation.
+    if ( isAnimationClocked() )
+        return false;
+
     // Finish if animation is paused.
     if ( isAnimationPaused() )
         return true;
@@ -247,8 +266,9 @@ void ImageFrameProviderCore::renderGui( GuiControl& owner, Point2I offset, const
     else
     {
         // Valid, so calculate source region.
-        const ImageAsset::FrameArea& frameArea = getProviderImageFrameArea();
-        RectI sourceRegion( frameArea.mPixelArea.mPixelOffset, Point2I(frameArea.mPixelArea.mPixelWidth, frameArea.mPixelArea.mPixelHeight) );
+        const ImageAsset::FrameArea frameArea = getProviderImageFrameArea();
+        const AssetPtr<ImageAsset>& imageAsset = isStaticFrameProvider() ? (*mpImageAsset) : (*mpAnimationAsset)->getImage();
+        RectI sourceRegion( frameArea.mPixelArea.mPixelOffset + imageAsset->getImageAtlasOffset(), Point2I(frameArea.mPixelArea.mPixelWidth, frameArea.mPixelArea.mPixelHeight) );
 
         // Calculate destination region.
         RectI destinationRegion(offset, owner.mBounds.extent);
@@ -331,10 +351,13 @@ const U32 ImageFrameProviderCore::getCurrentAnimationFrame( void ) const
     // Fetch validated frames.
     const Vector<S32>& validatedFrames = (*mpAnimationAsset)->getValidatedAnimationFrames();
 
+    // Fetch the current frame index.
+    const S32 currentFrameIndex = getCurrentFrameIndex();
+
     // Sanity!
-    AssertFatal( mCurrentFrameIndex < validatedFrames.size(), "Animation controller requested the current frame but it is out of bounds of the validated frames." );
+    AssertFatal( currentFrameIndex < validatedFrames.size(), "Animation controller requested the current frame but it is out of bounds of the validated frames." );
 
-    return validatedFrames[mCurrentFrameIndex];
+    return validatedFrames[currentFrameIndex];
 };
 
 //-----------------------------------------------------------------------------
@@ -349,7 +372,7 @@ bool ImageFrameProviderCore::isAnimationValid( void ) const
     const Vector<S32>& validatedFrames = (*mpAnimationAsset)->getValidatedAnimationFrames();
 
     // Not valid if current frame index is out of bounds of the validated frames.
-    if ( mCurrentFrameIndex >= validatedFrames.size() )
+    if ( getCurrentFrameIndex() >= validatedFrames.size() )
         return false;
 
     // Fetch image asset.
@@ -394,8 +417,9 @@ bool ImageFrameProviderCore::setAnimation( const char* pAnimationAssetId )
     if ( !playAnimation( *mpAnimationAsset ) )
         return false;
 
-    // Turn-on tick processing.
-    setProcessTicks( true );
+    // Turn-on tick processing if a shared clock isn't driving the animation.
+    if ( !isAnimationClocked() )
+        setProcessTicks( true );
 
     // Return Okay.
     return true;
@@ -445,6 +469,10 @@ bool ImageFrameProviderCore::playAnimation( const AssetPtr<AnimationAsset>& anim
     {
         // Yes, so calculate start time.
         mCurrentTime = CoreMath::mGetRandomF(0.0f, mTotalIntegrationTime*0.999f);
+
+        // Use it as the phase when synchronized.
+        if ( mAnimationSynchronized )
+            mAnimationPhase = mCurrentTime;
     }
     else
     {
@@ -458,6 +486,9 @@ bool ImageFrameProviderCore::playAnimation( const AssetPtr<AnimationAsset>& anim
     // Do an initial animation update.
     updateAnimation(0.0f);
 
+    // Subscribe to a shared clock if synchronized.
+    attachAnimationClock( false );
+
     // Return Okay.
     return true;
 }
@@ -477,6 +508,10 @@ bool ImageFrameProviderCore::updateAnimation( const F32 elapsedTime )
     if ( mAnimationFinished )
         return false;
 
+    // Finish if a shared clock is driving the animation.
+    if ( isAnimationClocked() )
+        return false;
+
     // Fetch validated frames.
     const Vector<S32>& validatedFrames = (*mpAnimationAsset)->getValidatedAnimationFrames();
 
@@ -549,6 +584,14 @@ void ImageFrameProviderCore::setAnimationFrame( const U32 frameIndex )
         return;
     }
 
+    // Is a shared clock driving the animation?
+    if ( isAnimationClocked() )
+    {
+        // Yes, so offset the phase to show the frame now.
+        mAnimationPhase = frameIndex*mFrameIntegrationTime - mpAnimationClock->getTime();
+        return;
+    }
+
     // Calculate current time.
     mCurrentTime = frameIndex*mFrameIntegrationTime;
 
@@ -556,10 +599,131 @@ void ImageFrameProviderCore::setAnimationFrame( const U32 frameIndex )
     updateAnimation(0.0f);
 }
 
+//-----------------------------------------------------------------------------
+
+void ImageFrameProviderCore::setAnimationTimeScale( const F32 scale )
+{
+    // Finish if the scale is unchanged.
+    if ( mAnimationTimeScale == scale )
+        return;
+
+    // Clocks are shared per time scale so move to the clock for the new scale.
+    detachAnimationClock();
+    mAnimationTimeScale = scale;
+    attachAnimationClock( false );
+}
+
+//-----------------------------------------------------------------------------
+
+void ImageFrameProviderCore::pauseAnimation( const bool animationPaused )
+{
+    mAnimationPaused = animationPaused;
+
+    // A paused animation holds its own time and rejoins the shared clock when resumed.
+    if ( mAnimationPaused )
+        detachAnimationClock();
+    else
+        attachAnimationClock( false );
+}
+
+//-----------------------------------------------------------------------------
+
+void ImageFrameProviderCore::stopAnimation( void )
+{
+    mAnimationFinished = true;
+    mAnimationPaused = false;
+
+    // Release any animation clock.
+    detachAnimationClock();
+}
+
+//-----------------------------------------------------------------------------
+
+void ImageFrameProviderCore::setAnimationSynchronized( const bool synchronized, const bool keepCurrentTime )
+{
+    mAnimationSynchronized = synchronized;
+
+    if ( mAnimationSynchronized )
+        attachAnimationClock( keepCurrentTime );
+    else
+        detachAnimationClock();
+}
+
+//-----------------------------------------------------------------------------
+
+void ImageFrameProviderCore::setAnimationPhase( const F32 phase )
+{
+    mAnimationPhase = phase;
+}
+
+//-----------------------------------------------------------------------------
+
+void ImageFrameProviderCore::setAnimationClockSet( AnimationClockSet* pAnimationClockSet )
+{
+    // Finish if the clock set is unchanged.
+    if ( mpAnimationClockSet == pAnimationClockSet )
+        return;
+
+    // Move to a clock in the new set.
+    detachAnimationClock();
+    mpAnimationClockSet = pAnimationClockSet;
+    attachAnimationClock( true );
+}
+
+//-----------------------------------------------------------------------------
+
+void ImageFrameProviderCore::attachAnimationClock( const bool keepCurrentTime )
+{
+    // Finish if not synchronized or already subscribed.
+    if ( !mAnimationSynchronized || mpAnimationClock != NULL )
+        return;
+
+    // Finish if there's no cycling animation running.
+    // Non-cycling animations must detect their end so are always integrated per-instance.
+    if ( isStaticFrameProvider() || mAnimationFinished || mAnimationPaused || mpAnimationAsset == NULL || mpAnimationAsset->isNull() || !(*mpAnimationAsset)->getAnimationCycle() )
+        return;
+
+    // Subscribe to the shared clock, using the global clocks if there's no specific set.
+    AnimationClockSet* pAnimationClockSet = mpAnimationClockSet != NULL ? mpAnimationClockSet : AnimationClockSet::getGlobalClocks();
+    mpAnimationClock = pAnimationClockSet->acquireClock( *mpAnimationAsset, mAnimationTimeScale );
+
+    // Offset the phase to continue from the current time if requested.
+    if ( keepCurrentTime )
+        mAnimationPhase = mCurrentTime - mpAnimationClock->getTime();
+
+    // The shared clock drives the animation so turn-off tick processing.
+    setProcessTicks( false );
+}
+
+//-----------------------------------------------------------------------------
+
+void ImageFrameProviderCore::detachAnimationClock( void )
+{
+    // Finish if not subscribed.
+    if ( mpAnimationClock == NULL )
+        return;
+
+    // Continue from the clocked time.
+    mCurrentTime = mpAnimationClock->getTime( mAnimationPhase );
+    mCurrentModTime = mCurrentTime;
+    mCurrentFrameIndex = mLastFrameIndex = mpAnimationClock->getFrameIndex( mAnimationPhase );
+
+    // Release the clock.
+    mpAnimationClock->getClockSet()->releaseClock( mpAnimationClock );
+    mpAnimationClock = NULL;
+
+    // Turn-on tick processing if the animation is still running.
+    if ( !isStaticFrameProvider() && !mAnimationFinished && !mAnimationPaused )
+        setProcessTicks( true );
+}
+
 //------------------------------------------------------------------------------
 
 void ImageFrameProviderCore::clearAssets( void )
 {
+    // Release any animation clock.
+    detachAnimationClock();
+
     // Clear assets.
     if ( mpAnimationAsset != NULL )
         mpAnimationAsset->clear();
@@ -31,6 +31,10 @@
 #include "2d/assets/AnimationAsset.h"
 #endif
 
+#ifndef _ANIMATION_CLOCK_H_
+#include "2d/core/AnimationClock.h"
+#endif
+
 #ifndef _TICKABLE_H_
 #include "platform/Tickable.h"
 #endif
@@ -79,6 +83,11 @@ protected:
     bool                                    mAnimationPaused;
     bool                                    mAnimationFinished;
 
+    bool                                    mAnimationSynchronized;
+    F32                                     mAnimationPhase;
+    AnimationClockSet*                      mpAnimationClockSet;
+    AnimationClock*                         mpAnimationClock;
+
 public:
     ImageFrameProviderCore();
     virtual ~ImageFrameProviderCore();
@@ -120,25 +129,35 @@ public:
     virtual bool setAnimation( const char* pAnimationAssetId );
     inline StringTableEntry getAnimation( void ) const { return mpAnimationAsset->getAssetId(); }
     void setAnimationFrame( const U32 frameIndex );
-    void setAnimationTimeScale( const F32 scale ) { mAnimationTimeScale = scale; }
+    void setAnimationTimeScale( const F32 scale );
     inline F32 getAnimationTimeScale( void ) const { return mAnimationTimeScale; }
     bool playAnimation( const AssetPtr<AnimationAsset>& animationAsset);
-    inline void pauseAnimation( const bool animationPaused ) { mAnimationPaused = animationPaused; }
-    inline void stopAnimation( void ) { mAnimationFinished = true; mAnimationPaused = false; }
+    void pauseAnimation( const bool animationPaused );
+    void stopAnimation( void );
     inline void resetAnimationTime( void ) { mCurrentTime = 0.0f; }
     inline bool isAnimationPaused( void ) const { return mAnimationPaused; }
     inline bool isAnimationFinished( void ) const { return mAnimationFinished; };
     bool isAnimationValid( void ) const;
 
+    /// Synchronized animation.
+    /// Synchronized providers playing a cycling animation subscribe to a clock shared by every
+    /// provider playing the same animation at the same time scale and are offset from it by their phase.
+    void setAnimationSynchronized( const bool synchronized, const bool keepCurrentTime = false );
+    inline bool getAnimationSynchronized( void ) const { return mAnimationSynchronized; }
+    void setAnimationPhase( const F32 phase );
+    inline F32 getAnimationPhase( void ) const { return mAnimationPhase; }
+    void setAnimationClockSet( AnimationClockSet* pAnimationClockSet );
+    inline bool isAnimationClocked( void ) const { return mpAnimationClock != NULL; }
+
     /// Frame provision.
     inline bool isStaticFrameProvider( void ) const { return mStaticProvider; }
     inline TextureHandle& getProviderTexture( void ) const { return !validRender() ? BadTextureHandle : isStaticFrameProvider() ? (*mpImageAsset)->getImageTexture() : (*mpAnimationAsset)->getImage()->getImageTexture(); };
-    inline const ImageAsset::FrameArea& getProviderImageFrameArea( void ) const  { return !validRender() ? BadFrameArea : isStaticFrameProvider() ? (*mpImageAsset)->getImageFrameArea(mImageFrame) : (*mpAnimationAsset)->getImage()->getImageFrameArea(getCurrentAnimationFrame()); };
+    inline ImageAsset::FrameArea getProviderImageFrameArea( void ) const        { return !validRender() ? BadFrameArea : isStaticFrameProvider() ? (*mpImageAsset)->getImageFrameArea(mImageFrame) : (*mpAnimationAsset)->getImage()->getImageFrameArea(getCurrentAnimationFrame()); };
 
     inline const AnimationAsset* getCurrentAnimation( void ) const { return mpAnimationAsset->notNull() ? *mpAnimationAsset : NULL; };
     inline const StringTableEntry getCurrentAnimationAssetId( void ) const { return mpAnimationAsset->getAssetId(); };
     const U32 getCurrentAnimationFrame( void ) const;
-    inline const F32 getCurrentAnimationTime( void ) const { return mCurrentTime; };
+    inline const F32 getCurrentAnimationTime( void ) const { return mpAnimationClock != NULL ? mpAnimationClock->getTime( mAnimationPhase ) : mCurrentTime; };
 
     void clearAssets( void );
 
@@ -147,6 +166,11 @@ public:
 protected:
     virtual void onAnimationEnd( void ) {}
     virtual void onAssetRefreshed( AssetPtrBase* pAssetPtrBase );
+
+private:
+    void attachAnimationClock( const bool keepCurrentTime );
+    void detachAnimationClock( void );
+    inline S32 getCurrentFrameIndex( void ) const { return mpAnimationClock != NULL ? mpAnimationClock->getFrameIndex( mAnimationPhase ) : mCurrentFrameIndex; }
 };
 
 
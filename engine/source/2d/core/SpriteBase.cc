@@ -57,6 +57,8 @@ void SpriteBase::initPersistFields()
     addProtectedField("Image", TypeImageAssetPtr, Offset(mImageAsset, SpriteBase), &setImage, &getImage, &writeImage, "");
     addProtectedField("Frame", TypeS32, Offset(mImageFrame, SpriteBase), &setImageFrame, &defaultProtectedGetFn, &writeImageFrame, "");
     addProtectedField("Animation", TypeAnimationAssetPtr, Offset(mAnimationAsset, SpriteBase), &setAnimation, &getAnimation, &writeAnimation, "");
+    addProtectedField("AnimationSynchronized", TypeBool, Offset(mAnimationSynchronized, SpriteBase), &setAnimationSynchronized, &defaultProtectedGetFn, &writeAnimationSynchronized, "");
+    addProtectedField("AnimationPhase", TypeF32, Offset(mAnimationPhase, SpriteBase), &setAnimationPhase, &defaultProtectedGetFn, &writeAnimationPhase, "");
 }
 
 //-----------------------------------------------------------------------------
@@ -96,6 +98,28 @@ void SpriteBase::copyTo(SimObject* object)
 
 //------------------------------------------------------------------------------
 
+void SpriteBase::OnRegisterScene( Scene* pScene )
+{
+    // Call parent.
+    Parent::OnRegisterScene( pScene );
+
+    // Use the scene animation clocks so synchronized animations follow the scene time.
+    ImageFrameProvider::setAnimationClockSet( &pScene->getAnimationClocks() );
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBase::OnUnregisterScene( Scene* pScene )
+{
+    // Stop using the scene animation clocks.
+    ImageFrameProvider::setAnimationClockSet( NULL );
+
+    // Call parent.
+    Parent::OnUnregisterScene( pScene );
+}
+
+//------------------------------------------------------------------------------
+
 void SpriteBase::onAnimationEnd( void )
 {
     // Do script callback.
@@ -44,6 +44,8 @@ public:
     static void initPersistFields();
 
     virtual void integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
+    virtual bool hasCustomIntegration( void ) const { return !isStaticFrameProvider() && !isAnimationFinished() && !isAnimationClocked(); }
+    virtual void setProcessTicks( bool tick ) { ImageFrameProvider::setProcessTicks( tick ); updateTickState(); }
 
     virtual bool validRender( void ) const;
     virtual bool shouldRender( void ) const { return true; }
@@ -54,6 +56,9 @@ public:
     DECLARE_CONOBJECT( SpriteBase );
 
 protected:
+    virtual void OnRegisterScene( Scene* pScene );
+    virtual void OnUnregisterScene( Scene* pScene );
+
     virtual void onAnimationEnd( void );
 
 protected:
@@ -65,6 +70,10 @@ protected:
     static bool setAnimation(void* obj, const char* data)                   { DYNAMIC_VOID_CAST_TO(SpriteBase, ImageFrameProvider, obj)->setAnimation(data); return false; };
     static const char* getAnimation(void* obj, const char* data)            { return DYNAMIC_VOID_CAST_TO(SpriteBase, ImageFrameProvider, obj)->getAnimation(); }
     static bool writeAnimation( void* obj, StringTableEntry pFieldName )    { SpriteBase* pCastObject = static_cast<SpriteBase*>(obj); if ( pCastObject->isStaticFrameProvider() ) return false; return pCastObject->mAnimationAsset.notNull(); }
+    static bool setAnimationSynchronized(void* obj, const char* data)       { DYNAMIC_VOID_CAST_TO(SpriteBase, ImageFrameProvider, obj)->setAnimationSynchronized(dAtob(data)); return false; };
+    static bool writeAnimationSynchronized( void* obj, StringTableEntry pFieldName ) { return static_cast<SpriteBase*>(obj)->getAnimationSynchronized(); }
+    static bool setAnimationPhase(void* obj, const char* data)              { DYNAMIC_VOID_CAST_TO(SpriteBase, ImageFrameProvider, obj)->setAnimationPhase(dAtof(data)); return false; };
+    static bool writeAnimationPhase( void* obj, StringTableEntry pFieldName ) { return mNotZero( static_cast<SpriteBase*>(obj)->getAnimationPhase() ); }
 };
 
 #endif // _SPRITE_BASE_H_
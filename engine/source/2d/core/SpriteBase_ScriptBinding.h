@@ -254,3 +254,38 @@ ConsoleMethod(SpriteBase, getAnimationTimeScale, F32, 2, 2,     "() - Get the an
 
     return object->getAnimationTimeScale();
 }
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(SpriteBase, setAnimationSynchronized, void, 3, 3,    "(bool synchronized) - Sets whether the animation is synchronized.\n"
+                                                                "Synchronized sprites playing the same cycling animation at the same time scale share a single scene clock and are not integrated individually.\n"
+                                                                "@param synchronized Whether the animation is synchronized.\n"
+                                                                "@return No return value.")
+{
+    static_cast<ImageFrameProvider*>(object)->setAnimationSynchronized( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(SpriteBase, getAnimationSynchronized, bool, 2, 2,    "() - Gets whether the animation is synchronized.\n"
+                                                                "@return (bool) Whether the animation is synchronized.")
+{
+    return object->getAnimationSynchronized();
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(SpriteBase, setAnimationPhase, void, 3, 3,   "(float phase) - Sets the time offset of a synchronized animation from its shared clock.\n"
+                                                        "@param phase The time offset (in seconds) from the shared clock.\n"
+                                                        "@return No return value.")
+{
+    static_cast<ImageFrameProvider*>(object)->setAnimationPhase( dAtof(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(SpriteBase, getAnimationPhase, F32, 2, 2,    "() - Gets the time offset of a synchronized animation from its shared clock.\n"
+                                                        "@return (float) The time offset (in seconds) from the shared clock.")
+{
+    return object->getAnimationPhase();
+}
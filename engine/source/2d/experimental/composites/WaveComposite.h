@@ -56,6 +56,7 @@ public:
     virtual void preIntegrate( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
     virtual void integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
     virtual void interpolateObject( const F32 timeDelta );
+    virtual bool hasCustomIntegration( void ) const { return true; }
 
     virtual void copyTo( SimObject* object );
 
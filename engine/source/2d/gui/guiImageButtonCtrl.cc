@@ -262,8 +262,8 @@ void GuiImageButtonCtrl::renderButton( ImageAsset* pImageAsset, const U32 frame,
     if ( pImageAsset->isAssetValid() && frame < pImageAsset->getFrameCount() )
     {
         // Yes, so calculate the source region.
-        const ImageAsset::FrameArea::PixelArea& pixelArea = pImageAsset->getImageFrameArea( frame ).mPixelArea;
-        RectI sourceRegion( pixelArea.mPixelOffset, Point2I(pixelArea.mPixelWidth, pixelArea.mPixelHeight) );
+        const ImageAsset::FrameArea::PixelArea pixelArea = pImageAsset->getImageFrameArea( frame ).mPixelArea;
+        RectI sourceRegion( pixelArea.mPixelOffset + pImageAsset->getImageAtlasOffset(), Point2I(pixelArea.mPixelWidth, pixelArea.mPixelHeight) );
 
         // Calculate destination region.
         RectI destinationRegion(offset, mBounds.extent);
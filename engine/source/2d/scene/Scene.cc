@@ -56,6 +56,30 @@
 #include "2d/core/particleSystem.h"
 #endif
 
+#ifndef _PLATFORM_THREADS_JOBPOOL_H_
+#include "platform/threads/jobPool.h"
+#endif
+
+#ifndef _SCENE_SNAPSHOT_H_
+#include "2d/scene/SceneSnapshot.h"
+#endif
+
+#ifndef _SCENE_REPLICATION_H_
+#include "2d/scene/SceneReplication.h"
+#endif
+
+#ifndef _SCENE_POOL_H_
+#include "2d/scene/ScenePool.h"
+#endif
+
+#ifndef _NETCONNECTION_H_
+#include "network/netConnection.h"
+#endif
+
+#ifndef _STRINGUNIT_H_
+#include "string/stringUnit.h"
+#endif
+
 // Script bindings.
 #include "Scene_ScriptBinding.h"
 
@@ -65,6 +89,12 @@
 //------------------------------------------------------------------------------
 
 SimObjectPtr<Scene> Scene::LoadingScene = NULL;
+SimObjectPtr<Scene> Scene::ReplicationClientScene = NULL;
+
+//------------------------------------------------------------------------------
+
+/// Seconds the client replication time can drift before it is reset.
+static const F32 replicationResyncTime = 0.5f;
 
 //------------------------------------------------------------------------------
 
@@ -152,10 +182,27 @@ Scene::Scene() :
     mWorldGravity(0.0f, 0.0f),
     mVelocityIterations(8),
     mPositionIterations(3),
+    mSpatialHash(false),
+    mSpatialHashCellSize((F32)SpatialHash::DefaultCellSize),
+
+    /// Scene occupancy.
+    mTickInProgress(false),
+    mTickInParallel(false),
+    mParallelTick(false),
 
     /// Joint access.
     mJointMasterId(1),
 
+    /// Taml children.
+    mTamlChildIndex(0),
+    mTamlChildSceneIndex(0),
+
+    /// Replication.
+    mReplicationMode(REPLICATION_NONE),
+    mReplicationTime(0.0f),
+    mReplicationServerTime(0.0f),
+    mReplicationDelay(0.1f),
+
     /// Scene time.
     mSceneTime(0.0f),
     mScenePause(false),
@@ -175,10 +222,15 @@ Scene::Scene() :
 {
     // Set Vector Associations.
     VECTOR_SET_ASSOCIATION( mSceneObjects );
+    VECTOR_SET_ASSOCIATION( mTickedSceneObjects );
+    VECTOR_SET_ASSOCIATION( mFastTickedSceneObjects );
+    VECTOR_SET_ASSOCIATION( mParallelTickedSceneObjects );
+    VECTOR_SET_ASSOCIATION( mInterpolatedSceneObjects );
     VECTOR_SET_ASSOCIATION( mDeleteRequests );
     VECTOR_SET_ASSOCIATION( mDeleteRequestsTemp );
     VECTOR_SET_ASSOCIATION( mEndContacts );
     VECTOR_SET_ASSOCIATION( mAssetPreloads );
+    VECTOR_SET_ASSOCIATION( mReplicatedFields );
      
     // Initialize layer sort mode.
     for ( U32 n = 0; n < MAX_LAYERS_SUPPORTED; ++n )
@@ -236,6 +288,7 @@ bool Scene::onAdd()
 
     // Create world query.
     mpWorldQuery = new WorldQuery(this);
+    mpWorldQuery->setSpatialHashCellSize( mSpatialHashCellSize );
 
     // Set loading scene.
     Scene::LoadingScene = this;
@@ -254,6 +307,12 @@ void Scene::onRemove()
     // Turn-off tick processing.
     setProcessTicks( false );
 
+    // Clear snapshots.
+    clearSnapshots();
+
+    // Stop replication.
+    setReplicationMode( REPLICATION_NONE );
+
     // Clear Scene.
     clearScene();
 
@@ -307,6 +366,11 @@ void Scene::initPersistFields()
     addField("VelocityIterations", TypeS32, Offset(mVelocityIterations, Scene), &writeVelocityIterations, "" );
     addField("PositionIterations", TypeS32, Offset(mPositionIterations, Scene), &writePositionIterations, "" );
 
+    // Spatial hash.
+    addProtectedField("SpatialHash", TypeBool, Offset(mSpatialHash, Scene), &setSpatialHash, &defaultProtectedGetFn, &writeSpatialHash, "Whether all objects are indexed by the spatial hash rather than the dynamic tree." );
+    addProtectedField("SpatialHashCellSize", TypeF32, Offset(mSpatialHashCellSize, Scene), &setSpatialHashCellSize, &defaultProtectedGetFn, &writeSpatialHashCellSize, "The size of each spatial hash cell in world units." );
+    addField("ParallelTick", TypeBool, Offset(mParallelTick, Scene), &writeParallelTick, "Whether thread-safe objects are integrated on the job pool." );
+
     // Layer sort modes.
     char buffer[64];
     for ( U32 n = 0; n < MAX_LAYERS_SUPPORTED; n++ )
@@ -749,33 +813,75 @@ void Scene::processTick( void )
         // Update scene time.
         mSceneTime += Tickable::smTickSec;
 
+        // Advance the shared animation clocks.
+        mAnimationClocks.advance( Tickable::smTickSec );
+
         // Clear ticked scene objects.
         mTickedSceneObjects.clear();
+        mFastTickedSceneObjects.clear();
+        mParallelTickedSceneObjects.clear();
+
+        // Fetch whether thread-safe objects are ticked on the job pool.
+        const bool parallelTick = mParallelTick && JobPool::Instance != NULL && JobPool::Instance->getWorkerCount() > 0;
+
+        // Flag tick in progress.
+        mTickInProgress = true;
 
-        // Iterate scene objects.
-        for( S32 n = 0; n < mSceneObjects.size(); ++n )
+        // Fetch scene object count.
+        const U32 sceneObjectCount = mTickState.size();
+
+        // Iterate the packed tick state.
+        for( U32 n = 0; n < sceneObjectCount; ++n )
         {
-            // Fetch scene object.
-            SceneObject* pSceneObject = mSceneObjects[n];
+            // Fetch tick flags.
+            const U32 tickFlags = mTickState.getFlags( n );
+
+            // Skip parked objects without touching their bodies or counting them.
+            if ( tickFlags & SceneTickState::TICK_POOLED )
+                continue;
 
             // Update awake/asleep counts.
-            if ( pSceneObject->getAwake() )
+            if ( mTickState.getBody( n )->IsAwake() )
                 objectsAwake++;
 
             // Update visible.
-            if ( pSceneObject->getVisible() )
+            if ( tickFlags & SceneTickState::TICK_VISIBLE )
                 objectsVisible++;
 
-            // Push scene object if it's eligible for ticking.
-            if ( pSceneObject->isEnabled() )
+            // Skip if not eligible for ticking.
+            if ( (tickFlags & SceneTickState::TICK_ENABLED) == 0 )
+                continue;
+
+            // Update enabled.
+            objectsEnabled++;
+
+            // Skip if the object is being deleted.
+            if ( tickFlags & SceneTickState::TICK_BEING_DELETED )
+                continue;
+
+            // Skip if this is not a "normal" scene and the object is not marked as allowing editor ticks.
+            if ( !isNormalScene && !mSceneObjects[n]->getIsEditorTickAllowed() )
+                continue;
+
+            // Can the object be ticked on the job pool?
+            // Objects with lifetimes, attachments or post-integration (components and script callbacks) stay on the main thread.
+            if ( parallelTick && (tickFlags & (SceneTickState::TICK_THREAD_SAFE | SceneTickState::TICK_INTEGRATE | SceneTickState::TICK_POST_INTEGRATE)) == SceneTickState::TICK_THREAD_SAFE )
             {
-                // Update enabled.
-                objectsEnabled++;
+                // Yes, so tick it in parallel.
+                mParallelTickedSceneObjects.push_back( n );
+                continue;
+            }
 
-                // Add to ticked objects if object is not being deleted and this is a "normal" scene or
-                // the object is marked as allowing editor ticks.
-                if ( !pSceneObject->isBeingDeleted() && (isNormalScene || pSceneObject->getIsEditorTickAllowed() )  )
-                    mTickedSceneObjects.push_back( pSceneObject );
+            // Does the object override the integration stages?
+            if ( tickFlags & SceneTickState::TICK_CUSTOM_INTEGRATION )
+            {
+                // Yes, so it must be ticked virtually.
+                mTickedSceneObjects.push_back( mSceneObjects[n] );
+            }
+            else
+            {
+                // No, so it can be ticked from the packed state.
+                mFastTickedSceneObjects.push_back( n );
             }
         }
 
@@ -790,10 +896,24 @@ void Scene::processTick( void )
         // Fetch ticked scene object count.
         const S32 tickedSceneObjectCount = mTickedSceneObjects.size();
 
+        // Fetch parallel-ticked scene object count.
+        const U32 parallelTickedSceneObjectCount = mParallelTickedSceneObjects.size();
+
         // ****************************************************
         // Pre-integrate objects.
         // ****************************************************
 
+        // Pre-integrate parallel-ticked scene objects.
+        if ( parallelTickedSceneObjectCount > 0 )
+        {
+            // Debug Profiling.
+            PROFILE_SCOPE(Scene_PreIntegrateParallel);
+
+            mTickInParallel = true;
+            JobPool::Instance->parallelFor( &Scene::parallelPreIntegrate, this, parallelTickedSceneObjectCount, ParallelTickBatchSize );
+            mTickInParallel = false;
+        }
+
         // Iterate ticked scene objects.
         for ( S32 i = 0; i < tickedSceneObjectCount; ++i )
         {
@@ -804,34 +924,73 @@ void Scene::processTick( void )
             mTickedSceneObjects[i]->preIntegrate( mSceneTime, Tickable::smTickSec, pDebugStats );
         }
 
+        // Pre-integrate fast-ticked scene objects.
+        {
+            // Debug Profiling.
+            PROFILE_SCOPE(Scene_PreIntegrateFast);
+
+            for ( S32 i = 0; i < mFastTickedSceneObjects.size(); ++i )
+            {
+                // Fetch scene object index.
+                const U32 index = mFastTickedSceneObjects[i];
+
+                // Skip if removed or nothing is dirty.
+                if ( index == U32_MAX || (mTickState.getFlags( index ) & SceneTickState::TICK_SPATIAL_DIRTY) == 0 )
+                    continue;
+
+                // Pre-integrate.
+                mSceneObjects[index]->SceneObject::preIntegrate( mSceneTime, Tickable::smTickSec, pDebugStats );
+            }
+        }
+
+        // Drop objects that no longer need interpolating now their spatials have been reset.
+        compactInterpolatedSceneObjects();
+
+        // Drive the replicas towards the server state.
+        if ( mReplicationMode == REPLICATION_CLIENT )
+            driveReplicas();
+
         // ****************************************************
         // Integrate controllers.
         // ****************************************************
 
-        // Fetch the controller set.
-        SimSet* pControllerSet = getControllers();
+        // Fetch the scene controllers.
+        const Vector<SceneController*>& sceneControllers = getSceneControllers();
+
+        // Fetch scene controller count.
+        const S32 sceneControllerCount = sceneControllers.size();
 
         // Do we have any scene controllers?
-        if ( pControllerSet != NULL )
+        if ( sceneControllerCount > 0 )
         {
             // Debug Profiling.
             PROFILE_SCOPE(Scene_IntegrateSceneControllers);
 
-            // Yes, so fetch scene controller count.
-            const S32 sceneControllerCount = (S32)pControllerSet->size();
-
-            // Iterate scene controllers.
+            // Yes, so gather the controller regions.
+            mControllerRegions.clear();
             for( S32 i = 0; i < sceneControllerCount; i++ )
             {
                 // Fetch the scene controller.
-                SceneController* pController = dynamic_cast<SceneController*>((*pControllerSet)[i]);
+                SceneController* pController = sceneControllers[i];
 
-                // Skip if not a controller.
-                if ( pController == NULL )
-                    continue;
+                // Add the region if the controller has one.
+                WorldQueryRegion region;
+                if ( pController->getRegion( region.mAABB, region.mQueryFilter ) )
+                {
+                    region.mpResults = &pController->getRegionCandidates();
+                    mControllerRegions.push_back( region );
+                }
+            }
 
+            // Gather the candidates for all the regions together.
+            if ( mControllerRegions.size() > 0 )
+                mpWorldQuery->regionQuery( mControllerRegions );
+
+            // Iterate scene controllers.
+            for( S32 i = 0; i < sceneControllerCount; i++ )
+            {
                 // Integrate.
-                pController->integrate( this, mSceneTime, Tickable::smTickSec, pDebugStats );
+                sceneControllers[i]->integrate( this, mSceneTime, Tickable::smTickSec, pDebugStats );
             }
         }
 
@@ -859,6 +1018,20 @@ void Scene::processTick( void )
         // Integrate objects.
         // ****************************************************
 
+        // Integrate parallel-ticked scene objects.
+        if ( parallelTickedSceneObjectCount > 0 )
+        {
+            // Debug Profiling.
+            PROFILE_SCOPE(Scene_IntegrateObjectParallel);
+
+            mTickInParallel = true;
+            JobPool::Instance->parallelFor( &Scene::parallelIntegrate, this, parallelTickedSceneObjectCount, ParallelTickBatchSize );
+            mTickInParallel = false;
+
+            // Apply the world proxy updates deferred by the parallel integration.
+            commitParallelIntegration();
+        }
+
         // Iterate ticked scene objects.
         for ( S32 i = 0; i < tickedSceneObjectCount; ++i )
         {
@@ -869,10 +1042,44 @@ void Scene::processTick( void )
             mTickedSceneObjects[i]->integrateObject( mSceneTime, Tickable::smTickSec, pDebugStats );
         }
 
+        // Integrate fast-ticked scene objects.
+        {
+            // Debug Profiling.
+            PROFILE_SCOPE(Scene_IntegrateObjectFast);
+
+            for ( S32 i = 0; i < mFastTickedSceneObjects.size(); ++i )
+            {
+                // Fetch scene object index.
+                const U32 index = mFastTickedSceneObjects[i];
+
+                // Skip if removed.
+                if ( index == U32_MAX )
+                    continue;
+
+                // Skip if the object has not moved and needs no other integration.
+                if ( (mTickState.getFlags( index ) & SceneTickState::TICK_INTEGRATE) == 0 && !mTickState.getMoved( index ) )
+                    continue;
+
+                // Integrate.
+                mSceneObjects[index]->SceneObject::integrateObject( mSceneTime, Tickable::smTickSec, pDebugStats );
+            }
+        }
+
         // ****************************************************
         // Post-Integrate Stage.
         // ****************************************************
 
+        // Post-integrate parallel-ticked scene objects.
+        if ( parallelTickedSceneObjectCount > 0 )
+        {
+            // Debug Profiling.
+            PROFILE_SCOPE(Scene_PostIntegrateParallel);
+
+            mTickInParallel = true;
+            JobPool::Instance->parallelFor( &Scene::parallelPostIntegrate, this, parallelTickedSceneObjectCount, ParallelTickBatchSize );
+            mTickInParallel = false;
+        }
+
         // Iterate ticked scene objects.
         for ( S32 i = 0; i < tickedSceneObjectCount; ++i )
         {
@@ -883,6 +1090,25 @@ void Scene::processTick( void )
             mTickedSceneObjects[i]->postIntegrate( mSceneTime, Tickable::smTickSec, pDebugStats );
         }
 
+        // Post-integrate fast-ticked scene objects.
+        {
+            // Debug Profiling.
+            PROFILE_SCOPE(Scene_PostIntegrateFast);
+
+            for ( S32 i = 0; i < mFastTickedSceneObjects.size(); ++i )
+            {
+                // Fetch scene object index.
+                const U32 index = mFastTickedSceneObjects[i];
+
+                // Skip if removed or no post-integration is needed.
+                if ( index == U32_MAX || (mTickState.getFlags( index ) & SceneTickState::TICK_POST_INTEGRATE) == 0 )
+                    continue;
+
+                // Post-integrate.
+                mSceneObjects[index]->SceneObject::postIntegrate( mSceneTime, Tickable::smTickSec, pDebugStats );
+            }
+        }
+
         // Scene update callback.
         if( mUpdateCallback )
         {
@@ -900,8 +1126,20 @@ void Scene::processTick( void )
             dispatchBeginContactCallbacks();
         }
 
+        // Dispatch the behavior raises queued during the tick.
+        BehaviorComponent::dispatchQueuedRaises();
+
+        // Flag the replicated state that changed.
+        if ( mReplicationMode == REPLICATION_SERVER )
+            updateReplicationState();
+
         // Clear ticked scene objects.
         mTickedSceneObjects.clear();
+        mFastTickedSceneObjects.clear();
+        mParallelTickedSceneObjects.clear();
+
+        // Flag tick complete.
+        mTickInProgress = false;
     }
 
     // Update debug stat ranges.
@@ -922,20 +1160,73 @@ void Scene::interpolateTick( F32 timeDelta )
     // Interpolate scene objects.
     // ****************************************************
 
-    // Fetch the scene object count.
-    const S32 sceneObjectCount = mSceneObjects.size();
+    // Fetch the interpolated scene object count.
+    const S32 interpolatedCount = mInterpolatedSceneObjects.size();
 
-    // Iterate scene objects.
-    for( S32 n = 0; n < sceneObjectCount; ++n )
+    // Iterate only the scene objects that moved, are attached or interpolate themselves.
+    for( S32 n = 0; n < interpolatedCount; ++n )
     {
         // Fetch scene object.
-        SceneObject* pSceneObject = mSceneObjects[n];
+        SceneObject* pSceneObject = mInterpolatedSceneObjects[n];
+
+        // Fetch tick flags.
+        const U32 tickFlags = mTickState.getFlags( pSceneObject->mSceneObjectIndex );
 
         // Skip interpolation of scene object if it's not eligible.
-        if ( !pSceneObject->isEnabled() || pSceneObject->isBeingDeleted() )
+        if ( (tickFlags & SceneTickState::TICK_ENABLED) == 0 || (tickFlags & SceneTickState::TICK_BEING_DELETED) )
+            continue;
+
+        // Does the object override the integration stages?
+        if ( tickFlags & SceneTickState::TICK_CUSTOM_INTEGRATION )
+        {
+            // Yes, so interpolate virtually.
+            pSceneObject->interpolateObject( timeDelta );
+            continue;
+        }
+
+        pSceneObject->SceneObject::interpolateObject( timeDelta );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::queueInterpolation( SceneObject* pSceneObject )
+{
+    // Fetch scene object index.
+    const U32 index = pSceneObject->mSceneObjectIndex;
+
+    // Finish if already queued.
+    if ( mTickState.getFlags( index ) & SceneTickState::TICK_INTERPOLATE_QUEUED )
+        return;
+
+    // Queue the scene object.
+    mTickState.setFlag( index, SceneTickState::TICK_INTERPOLATE_QUEUED, true );
+    mInterpolatedSceneObjects.push_back( pSceneObject );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::compactInterpolatedSceneObjects( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_CompactInterpolatedSceneObjects);
+
+    // Iterate interpolated scene objects.
+    for( S32 n = 0; n < mInterpolatedSceneObjects.size(); )
+    {
+        // Fetch scene object index.
+        const U32 index = mInterpolatedSceneObjects[n]->mSceneObjectIndex;
+
+        // Keep the scene object if it still needs interpolating.
+        if ( mTickState.getFlags( index ) & (SceneTickState::TICK_SPATIAL_DIRTY | SceneTickState::TICK_ATTACHED | SceneTickState::TICK_CUSTOM_INTEGRATION) )
+        {
+            ++n;
             continue;
+        }
 
-        pSceneObject->interpolateObject( timeDelta );
+        // Remove the scene object.
+        mTickState.setFlag( index, SceneTickState::TICK_INTERPOLATE_QUEUED, false );
+        mInterpolatedSceneObjects.erase_fast( n );
     }
 }
 
@@ -1218,30 +1509,23 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
     // Draw controllers.
     if ( getDebugMask() & Scene::SCENE_DEBUG_CONTROLLERS )
     {
-        // Fetch the controller set.
-        SimSet* pControllerSet = getControllers();
+        // Fetch the scene controllers.
+        const Vector<SceneController*>& sceneControllers = getSceneControllers();
 
         // Do we have any scene controllers?
-        if ( pControllerSet != NULL )
+        if ( sceneControllers.size() > 0 )
         {
             // Debug Profiling.
             PROFILE_SCOPE(Scene_RenderControllers);
 
             // Yes, so fetch scene controller count.
-            const S32 sceneControllerCount = (S32)pControllerSet->size();
+            const S32 sceneControllerCount = sceneControllers.size();
 
             // Iterate scene controllers.
             for( S32 i = 0; i < sceneControllerCount; i++ )
             {
-                // Fetch the scene controller.
-                SceneController* pController = dynamic_cast<SceneController*>((*pControllerSet)[i]);
-
-                // Skip if not a controller.
-                if ( pController == NULL )
-                    continue;
-
                 // Render the overlay.
-                pController->renderOverlay( this, pSceneRenderState, &mBatchRenderer );
+                sceneControllers[i]->renderOverlay( this, pSceneRenderState, &mBatchRenderer );
             }
 
             // Flush isolated batch.
@@ -1274,6 +1558,393 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
 
 //-----------------------------------------------------------------------------
 
+U32 Scene::saveSnapshot( const char* pSnapshotName, const char* pFields )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_SaveSnapshot);
+
+    // Sanity!
+    AssertFatal( pSnapshotName != NULL, "Scene::saveSnapshot() - Cannot use a NULL snapshot name." );
+
+    StringTableEntry snapshotName = StringTable->insert( pSnapshotName );
+
+    // Find the snapshot.
+    typeSnapshotHash::iterator snapshotItr = mSnapshots.find( snapshotName );
+
+    // Create the snapshot if it doesn't exist.
+    SceneSnapshot* pSnapshot;
+    if ( snapshotItr == mSnapshots.end() )
+    {
+        pSnapshot = new SceneSnapshot();
+        mSnapshots.insert( snapshotName, pSnapshot );
+    }
+    else
+    {
+        pSnapshot = snapshotItr->value;
+    }
+
+    // Capture the scene.
+    pSnapshot->capture( this, pFields );
+
+    return pSnapshot->getMemorySize();
+}
+
+//-----------------------------------------------------------------------------
+
+bool Scene::restoreSnapshot( const char* pSnapshotName )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_RestoreSnapshot);
+
+    // Find the snapshot.
+    typeSnapshotHash::iterator snapshotItr = mSnapshots.find( StringTable->insert( pSnapshotName ) );
+
+    // Finish if the snapshot doesn't exist.
+    if ( snapshotItr == mSnapshots.end() )
+    {
+        // Warn.
+        Con::warnf( "Scene::restoreSnapshot() - Could not find snapshot '%s'.", pSnapshotName );
+        return false;
+    }
+
+    // Restore the scene.
+    snapshotItr->value->restore( this );
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool Scene::deleteSnapshot( const char* pSnapshotName )
+{
+    // Find the snapshot.
+    typeSnapshotHash::iterator snapshotItr = mSnapshots.find( StringTable->insert( pSnapshotName ) );
+
+    // Finish if the snapshot doesn't exist.
+    if ( snapshotItr == mSnapshots.end() )
+        return false;
+
+    delete snapshotItr->value;
+    mSnapshots.erase( snapshotItr );
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::clearSnapshots( void )
+{
+    for( typeSnapshotHash::iterator snapshotItr = mSnapshots.begin(); snapshotItr != mSnapshots.end(); ++snapshotItr )
+    {
+        delete snapshotItr->value;
+    }
+
+    mSnapshots.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setReplicationMode( const ReplicationMode replicationMode )
+{
+    // Finish if no change.
+    if ( mReplicationMode == replicationMode )
+        return;
+
+    // Delete the server ghosts.
+    // NOTE: Deleting a server ghost kills it on the clients.
+    if ( mReplicationMode == REPLICATION_SERVER )
+    {
+        for( typeReplicationHash::iterator ghostItr = mReplicationGhosts.begin(); ghostItr != mReplicationGhosts.end(); ++ghostItr )
+        {
+            ghostItr->value->deleteObject();
+        }
+    }
+
+    mReplicationGhosts.clear();
+    mInterestGrid.clear();
+
+    // Stop receiving replication.
+    if ( Scene::ReplicationClientScene == this )
+        Scene::ReplicationClientScene = NULL;
+
+    mReplicationMode = replicationMode;
+
+    // Ghost the scene objects if we're the server.
+    if ( mReplicationMode == REPLICATION_SERVER )
+    {
+        for ( S32 n = 0; n < mSceneObjects.size(); ++n )
+        {
+            createReplicationGhost( mSceneObjects[n] );
+        }
+    }
+    // Receive the replication if we're the client.
+    else if ( mReplicationMode == REPLICATION_CLIENT )
+    {
+        // Only a single scene can receive replication.
+        if ( !Scene::ReplicationClientScene.isNull() )
+        {
+            // Warn.
+            Con::warnf( "Scene::setReplicationMode() - Scene '%s' stopped receiving replication.", Scene::ReplicationClientScene->getIdString() );
+            Scene::ReplicationClientScene->setReplicationMode( REPLICATION_NONE );
+        }
+
+        Scene::ReplicationClientScene = this;
+        mReplicationTime = 0.0f;
+        mReplicationServerTime = 0.0f;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setReplicatedFields( const char* pFields )
+{
+    mReplicatedFields.clear();
+
+    // Fetch the fields.
+    const U32 fieldCount = StringUnit::getUnitCount( pFields, " \t\n" );
+    for ( U32 n = 0; n < fieldCount; ++n )
+    {
+        // Stop if there are too many fields.
+        if ( n == SceneObjectGhost::MaxFields )
+        {
+            // Warn.
+            Con::warnf( "Scene::setReplicatedFields() - Only the first %d fields can be replicated.", SceneObjectGhost::MaxFields );
+            break;
+        }
+
+        mReplicatedFields.push_back( StringUnit::getStringTableUnit( pFields, n, " \t\n" ) );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+const char* Scene::getReplicatedFields( void ) const
+{
+    // Fetch the size of the fields.
+    U32 bufferSize = 1;
+    for ( S32 n = 0; n < mReplicatedFields.size(); ++n )
+    {
+        bufferSize += dStrlen( mReplicatedFields[n] ) + 1;
+    }
+
+    // Format the fields.
+    char* pBuffer = Con::getReturnBuffer( bufferSize );
+    pBuffer[0] = 0;
+    for ( S32 n = 0; n < mReplicatedFields.size(); ++n )
+    {
+        if ( n > 0 )
+            dStrcat( pBuffer, " " );
+
+        dStrcat( pBuffer, mReplicatedFields[n] );
+    }
+
+    return pBuffer;
+}
+
+//-----------------------------------------------------------------------------
+
+SceneReplicationScope* Scene::replicateTo( NetConnection* pConnection )
+{
+    // Sanity!
+    AssertFatal( pConnection != NULL, "Scene::replicateTo() - Cannot replicate to a NULL connection." );
+
+    // Finish if we're not the server.
+    if ( mReplicationMode != REPLICATION_SERVER )
+    {
+        // Warn.
+        Con::warnf( "Scene::replicateTo() - The scene must be in the server replication mode." );
+        return NULL;
+    }
+
+    // Reuse any existing scope as ghosting can only be activated once.
+    SceneReplicationScope* pScope = dynamic_cast<SceneReplicationScope*>( pConnection->getScopeObject() );
+    if ( pScope != NULL )
+    {
+        pScope->setScene( this );
+        return pScope;
+    }
+
+    // Create the scope.
+    pScope = new SceneReplicationScope();
+    pScope->setScene( this );
+    if ( !pScope->registerObject() )
+    {
+        // Warn.
+        Con::warnf( "Scene::replicateTo() - Could not register the replication scope." );
+        delete pScope;
+        return NULL;
+    }
+
+    // The scope is deleted with the connection.
+    pConnection->addObject( pScope );
+    pConnection->setScopeObject( pScope );
+
+    // Start ghosting.
+    if ( !pConnection->isGhostingFrom() )
+        pConnection->setGhostFrom( true );
+
+    pConnection->activateGhosting();
+
+    return pScope;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::addReplica( SceneObject* pReplica, SceneObjectGhost* pGhost )
+{
+    // Sanity!
+    AssertFatal( mReplicationMode == REPLICATION_CLIENT, "Scene::addReplica() - The scene is not receiving replication." );
+
+    addToScene( pReplica );
+    mReplicationGhosts.insert( pReplica, pGhost );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::receiveReplicationTime( const F32 serverTime )
+{
+    // Track the latest server time.
+    // NOTE: A large step backwards means the server scene restarted.
+    if ( serverTime > mReplicationServerTime || serverTime < mReplicationServerTime - replicationResyncTime )
+        mReplicationServerTime = serverTime;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::createReplicationGhost( SceneObject* pSceneObject )
+{
+    // Create the ghost.
+    SceneObjectGhost* pGhost = new SceneObjectGhost();
+    pGhost->setSceneObject( pSceneObject );
+    if ( !pGhost->registerObject() )
+    {
+        // Warn.
+        Con::warnf( "Scene::createReplicationGhost() - Could not register the ghost for object '%s'.", pSceneObject->getIdString() );
+        delete pGhost;
+        return;
+    }
+
+    // Capture the initial state.
+    pGhost->updateDirtyState( mReplicatedFields );
+
+    // Enter the ghost into the interest grid.
+    Point2F center;
+    F32 radius;
+    pGhost->getInterestBounds( center, radius );
+    pGhost->setInterestProxy( mInterestGrid.addObject( pGhost, center, radius ) );
+
+    mReplicationGhosts.insert( pSceneObject, pGhost );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::removeReplicationGhost( SceneObject* pSceneObject )
+{
+    // Finish if nothing is replicated.
+    if ( mReplicationGhosts.size() == 0 )
+        return;
+
+    // Find the ghost.
+    typeReplicationHash::iterator ghostItr = mReplicationGhosts.find( pSceneObject );
+
+    // Finish if the object isn't replicated.
+    if ( ghostItr == mReplicationGhosts.end() )
+        return;
+
+    SceneObjectGhost* pGhost = ghostItr->value;
+    mReplicationGhosts.erase( ghostItr );
+
+    // Remove the ghost from the interest grid.
+    if ( pGhost->getInterestProxy() != NetInterestGrid::InvalidProxy )
+    {
+        mInterestGrid.removeObject( pGhost->getInterestProxy() );
+        pGhost->setInterestProxy( NetInterestGrid::InvalidProxy );
+    }
+
+    // Delete the server ghost.
+    // NOTE: The client ghosts own their replicas.
+    if ( mReplicationMode == REPLICATION_SERVER )
+        pGhost->deleteObject();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::updateReplicationState( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_UpdateReplicationState);
+
+    Point2F center;
+    F32 radius;
+    for( typeReplicationHash::iterator ghostItr = mReplicationGhosts.begin(); ghostItr != mReplicationGhosts.end(); ++ghostItr )
+    {
+        SceneObjectGhost* pGhost = ghostItr->value;
+        pGhost->updateDirtyState( mReplicatedFields );
+
+        // Move the ghost in the interest grid.
+        pGhost->getInterestBounds( center, radius );
+        mInterestGrid.moveObject( pGhost->getInterestProxy(), center, radius );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::driveReplicas( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_DriveReplicas);
+
+    // Advance the replication time, easing it towards the delayed server time.
+    mReplicationTime += Tickable::smTickSec;
+    const F32 drift = (mReplicationServerTime - mReplicationDelay) - mReplicationTime;
+    if ( mFabs( drift ) > replicationResyncTime )
+        mReplicationTime += drift;
+    else
+        mReplicationTime += drift * 0.1f;
+
+    for( typeReplicationHash::iterator ghostItr = mReplicationGhosts.begin(); ghostItr != mReplicationGhosts.end(); ++ghostItr )
+    {
+        ghostItr->value->driveReplica( mReplicationTime, Tickable::smTickSec );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setSpatialHash( const bool spatialHash )
+{
+    // Finish if no change.
+    if ( mSpatialHash == spatialHash )
+        return;
+
+    mSpatialHash = spatialHash;
+
+    // Move the world proxies to the new index.
+    for ( S32 n = 0; n < mSceneObjects.size(); ++n )
+    {
+        mSceneObjects[n]->refreshWorldProxy();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setSpatialHashCellSize( const F32 cellSize )
+{
+    // Sanity!
+    if ( cellSize <= 0.0f )
+    {
+        Con::warnf( "Scene::setSpatialHashCellSize() - Invalid cell size of '%g'.", cellSize );
+        return;
+    }
+
+    mSpatialHashCellSize = cellSize;
+
+    // Update the world query.
+    if ( mpWorldQuery != NULL )
+        mpWorldQuery->setSpatialHashCellSize( cellSize );
+}
+
+//-----------------------------------------------------------------------------
+
 void Scene::clearScene( bool deleteObjects )
 {
     while( mSceneObjects.size() > 0 )
@@ -1334,11 +2005,21 @@ void Scene::addToScene( SceneObject* pSceneObject )
     }
 
     // Add scene object.
+    pSceneObject->mSceneObjectIndex = mSceneObjects.size();
     mSceneObjects.push_back( pSceneObject );
+    mTickState.push_back();
 
     // Register with the scene.
     pSceneObject->OnRegisterScene( this );
 
+    // Populate the packed tick state.
+    mTickState.setBody( pSceneObject->mSceneObjectIndex, pSceneObject->getBody() );
+    pSceneObject->updateTickState();
+
+    // Ghost the object if replicating.
+    if ( mReplicationMode == REPLICATION_SERVER )
+        createReplicationGhost( pSceneObject );
+
     // Perform callback only if properly added to the simulation.
     if ( pSceneObject->isProperlyAdded() )
     {
@@ -1365,6 +2046,9 @@ void Scene::removeFromScene( SceneObject* pSceneObject )
         return;
     }
 
+    // Stop replicating the object.
+    removeReplicationGhost( pSceneObject );
+
     // Remove as debug-object if set.
     if ( pSceneObject == getDebugSceneObject() )
         setDebugSceneObject( NULL );
@@ -1384,22 +2068,240 @@ void Scene::removeFromScene( SceneObject* pSceneObject )
     // Unregister from scene.
     pSceneObject->OnUnregisterScene( this );
 
-    // Find scene object and remove it quickly.
-    for ( S32 n = 0; n < mSceneObjects.size(); ++n )
+    // Fetch the scene object index.
+    const U32 sceneObjectIndex = pSceneObject->mSceneObjectIndex;
+    const U32 lastIndex = mSceneObjects.size()-1;
+
+    // Sanity!
+    AssertFatal( mSceneObjects[sceneObjectIndex] == pSceneObject, "Scene::removeFromScene() - Scene object index is invalid." );
+
+    // Remove from the interpolation set if queued.
+    if ( mTickState.getFlags( sceneObjectIndex ) & SceneTickState::TICK_INTERPOLATE_QUEUED )
     {
-        if ( mSceneObjects[n] == pSceneObject )
+        for ( S32 n = 0; n < mInterpolatedSceneObjects.size(); ++n )
         {
-            mSceneObjects.erase_fast( n );
-            break;
+            if ( mInterpolatedSceneObjects[n] == pSceneObject )
+            {
+                mInterpolatedSceneObjects.erase_fast( n );
+                break;
+            }
         }
     }
 
+    // Remove scene object quickly.
+    mSceneObjects.erase_fast( sceneObjectIndex );
+    mTickState.erase_fast( sceneObjectIndex );
+    pSceneObject->mSceneObjectIndex = -1;
+
+    // Update the index of the scene object moved into the hole.
+    if ( sceneObjectIndex < lastIndex )
+        mSceneObjects[sceneObjectIndex]->mSceneObjectIndex = sceneObjectIndex;
+
+    // Patch the fast-ticked indices if we're mid-tick.
+    if ( mTickInProgress )
+        remapFastTickedSceneObjects( sceneObjectIndex, lastIndex );
+
     // Perform callback.
     Con::executef( pSceneObject, 2, "onRemoveFromScene", getIdString() );
 }
 
 //-----------------------------------------------------------------------------
 
+void Scene::remapFastTickedSceneObjects( const U32 removedIndex, const U32 movedIndex )
+{
+    // Iterate fast-ticked scene objects.
+    for ( S32 i = 0; i < mFastTickedSceneObjects.size(); ++i )
+    {
+        // Fetch scene object index.
+        U32& index = mFastTickedSceneObjects[i];
+
+        // Invalidate the removed object and follow the object moved into its place.
+        if ( index == removedIndex )
+            index = U32_MAX;
+        else if ( index == movedIndex )
+            index = removedIndex;
+    }
+
+    // Iterate parallel-ticked scene objects.
+    for ( S32 i = 0; i < mParallelTickedSceneObjects.size(); ++i )
+    {
+        // Fetch scene object index.
+        U32& index = mParallelTickedSceneObjects[i];
+
+        // Invalidate the removed object and follow the object moved into its place.
+        if ( index == removedIndex )
+            index = U32_MAX;
+        else if ( index == movedIndex )
+            index = removedIndex;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::parallelPreIntegrate( void* pContext, const U32 start, const U32 end )
+{
+    Scene* pScene = static_cast<Scene*>( pContext );
+
+    for ( U32 i = start; i < end; ++i )
+    {
+        // Fetch scene object index.
+        const U32 index = pScene->mParallelTickedSceneObjects[i];
+
+        // Skip if removed.
+        if ( index == U32_MAX )
+            continue;
+
+        // Fetch tick flags.
+        const U32 tickFlags = pScene->mTickState.getFlags( index );
+
+        // Does the object override the integration stages?
+        if ( tickFlags & SceneTickState::TICK_CUSTOM_INTEGRATION )
+        {
+            // Yes, so pre-integrate virtually.
+            pScene->mSceneObjects[index]->preIntegrate( pScene->mSceneTime, Tickable::smTickSec, &pScene->mDebugStats );
+            continue;
+        }
+
+        // Skip if nothing is dirty.
+        if ( (tickFlags & SceneTickState::TICK_SPATIAL_DIRTY) == 0 )
+            continue;
+
+        // Pre-integrate.
+        pScene->mSceneObjects[index]->SceneObject::preIntegrate( pScene->mSceneTime, Tickable::smTickSec, &pScene->mDebugStats );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::parallelIntegrate( void* pContext, const U32 start, const U32 end )
+{
+    Scene* pScene = static_cast<Scene*>( pContext );
+
+    for ( U32 i = start; i < end; ++i )
+    {
+        // Fetch scene object index.
+        const U32 index = pScene->mParallelTickedSceneObjects[i];
+
+        // Skip if removed.
+        if ( index == U32_MAX )
+            continue;
+
+        // Does the object override the integration stages?
+        if ( pScene->mTickState.getFlags( index ) & SceneTickState::TICK_CUSTOM_INTEGRATION )
+        {
+            // Yes, so integrate virtually.
+            pScene->mSceneObjects[index]->integrateObject( pScene->mSceneTime, Tickable::smTickSec, &pScene->mDebugStats );
+            continue;
+        }
+
+        // Skip if the object has not moved.
+        if ( !pScene->mTickState.getMoved( index ) )
+            continue;
+
+        // Integrate.
+        pScene->mSceneObjects[index]->SceneObject::integrateObject( pScene->mSceneTime, Tickable::smTickSec, &pScene->mDebugStats );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::parallelPostIntegrate( void* pContext, const U32 start, const U32 end )
+{
+    Scene* pScene = static_cast<Scene*>( pContext );
+
+    for ( U32 i = start; i < end; ++i )
+    {
+        // Fetch scene object index.
+        const U32 index = pScene->mParallelTickedSceneObjects[i];
+
+        // Skip if removed or the object does not override the integration stages.
+        if ( index == U32_MAX || (pScene->mTickState.getFlags( index ) & SceneTickState::TICK_CUSTOM_INTEGRATION) == 0 )
+            continue;
+
+        // Post-integrate.
+        pScene->mSceneObjects[index]->postIntegrate( pScene->mSceneTime, Tickable::smTickSec, &pScene->mDebugStats );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::commitParallelIntegration( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_CommitParallelIntegration);
+
+    for ( S32 i = 0; i < mParallelTickedSceneObjects.size(); ++i )
+    {
+        // Fetch scene object index.
+        const U32 index = mParallelTickedSceneObjects[i];
+
+        // Skip if removed or no update was deferred.
+        if ( index == U32_MAX || (mTickState.getFlags( index ) & SceneTickState::TICK_DEFERRED_UPDATE) == 0 )
+            continue;
+
+        // Fetch scene object.
+        SceneObject* pSceneObject = mSceneObjects[index];
+
+        // Clear the deferred update.
+        mTickState.setFlag( index, SceneTickState::TICK_DEFERRED_UPDATE, false );
+
+        // Queue for interpolation.
+        queueInterpolation( pSceneObject );
+
+        // Update world proxy.
+        pSceneObject->updateTickProxy();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+const Vector<SceneController*>& Scene::getSceneControllers( void )
+{
+    // Fetch the controller set.
+    SimSet* pControllerSet = getControllers();
+
+    // Fetch controller set count.
+    const U32 controllerSetCount = pControllerSet == NULL ? 0 : pControllerSet->size();
+
+    // Has the controller set changed since the controllers were cached?
+    bool controllersChanged = controllerSetCount != (U32)mSceneControllerIds.size();
+    for ( U32 i = 0; i < controllerSetCount && !controllersChanged; ++i )
+    {
+        controllersChanged = (*pControllerSet)[i]->getId() != mSceneControllerIds[i];
+    }
+
+    // Finish if the cached controllers are current.
+    if ( !controllersChanged )
+        return mSceneControllers;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_CacheSceneControllers);
+
+    // Cache the controllers.
+    mSceneControllerIds.clear();
+    mSceneControllers.clear();
+    for ( U32 i = 0; i < controllerSetCount; ++i )
+    {
+        // Fetch the object.
+        SimObject* pObject = (*pControllerSet)[i];
+
+        mSceneControllerIds.push_back( pObject->getId() );
+
+        // Fetch the scene controller.
+        SceneController* pController = dynamic_cast<SceneController*>( pObject );
+
+        // Skip if not a controller.
+        if ( pController == NULL )
+            continue;
+
+        mSceneControllers.push_back( pController );
+    }
+
+    return mSceneControllers;
+}
+
+//-----------------------------------------------------------------------------
+
 SceneObject* Scene::getSceneObject( const U32 objectIndex ) const
 {
     // Sanity!
@@ -3649,6 +4551,7 @@ void Scene::addDeleteRequest( SceneObject* pSceneObject )
 
     // Flag Delete in Progress.
     pSceneObject->mBeingSafeDeleted = true;
+    pSceneObject->updateTickState();
 }
 
 
@@ -3723,8 +4626,9 @@ void Scene::processDeleteRequests( const bool forceImmediate )
             // Do script callback.
             Con::executef(this, 2, "onSafeDelete", pSceneObject->getIdString() );
 
-            // Destroy the object.
-            pSceneObject->deleteObject();
+            // Return pooled objects to their pool, otherwise destroy the object.
+            if ( pSceneObject->getScenePool() == NULL || !pSceneObject->getScenePool()->release( pSceneObject ) )
+                pSceneObject->deleteObject();
         }
 
         // Remove All delete-requests.
@@ -3747,8 +4651,9 @@ void Scene::processDeleteRequests( const bool forceImmediate )
                 // Do script callback.
                 Con::executef(this, 2, "onSafeDelete", pSceneObject->getIdString() );
 
-                // Destroy the object.
-                pSceneObject->deleteObject();
+                // Return pooled objects to their pool, otherwise destroy the object.
+                if ( pSceneObject->getScenePool() == NULL || !pSceneObject->getScenePool()->release( pSceneObject ) )
+                    pSceneObject->deleteObject();
 
                 // Quickly remove delete-request.
                 mDeleteRequestsTemp.erase_fast( requestIndex );
@@ -5226,16 +6131,54 @@ SceneRenderRequest* Scene::createDefaultRenderRequest( SceneRenderQueue* pSceneR
 
 //-----------------------------------------------------------------------------
 
+U32 Scene::getTamlChildCount( void ) const
+{
+    // Count the scene objects that aren't parked in a pool.
+    U32 childCount = 0;
+    for ( S32 n = 0; n < mSceneObjects.size(); ++n )
+    {
+        if ( !mSceneObjects[n]->getIsPooled() )
+            childCount++;
+    }
+
+    return childCount;
+}
+
+//-----------------------------------------------------------------------------
+
 SimObject* Scene::getTamlChild( const U32 childIndex ) const
 {
-    // Sanity!
-    AssertFatal( childIndex < (U32)mSceneObjects.size(), "Scene::getTamlChild() - Child index is out of range." );
+    // Continue from the previous child if reading in order, otherwise search from the start.
+    U32 index = 0;
+    U32 sceneIndex = 0;
+    if ( childIndex > 0 && childIndex == mTamlChildIndex + 1 && mTamlChildSceneIndex < (U32)mSceneObjects.size() )
+    {
+        index = childIndex;
+        sceneIndex = mTamlChildSceneIndex + 1;
+    }
 
-    // For when the assert is not used.
-    if ( childIndex >= (U32)mSceneObjects.size() )
-        return NULL;
+    // Find the child, skipping parked pool objects.
+    for ( ; sceneIndex < (U32)mSceneObjects.size(); ++sceneIndex )
+    {
+        SceneObject* pSceneObject = mSceneObjects[sceneIndex];
 
-    return mSceneObjects[ childIndex ];
+        if ( pSceneObject->getIsPooled() )
+            continue;
+
+        if ( index == childIndex )
+        {
+            mTamlChildIndex = childIndex;
+            mTamlChildSceneIndex = sceneIndex;
+            return pSceneObject;
+        }
+
+        index++;
+    }
+
+    // Sanity!
+    AssertFatal( false, "Scene::getTamlChild() - Child index is out of range." );
+
+    return NULL;
 }
 
 //-----------------------------------------------------------------------------
@@ -5364,6 +6307,47 @@ b2JointType Scene::getJointTypeEnum(const char* label)
 
 //-----------------------------------------------------------------------------
 
+static EnumTable::Enums replicationModeLookup[] =
+                {
+                { Scene::REPLICATION_NONE,      "None" },
+                { Scene::REPLICATION_SERVER,    "Server" },
+                { Scene::REPLICATION_CLIENT,    "Client" },
+                };
+
+//-----------------------------------------------------------------------------
+
+Scene::ReplicationMode Scene::getReplicationModeEnum(const char* label)
+{
+    // Search for Mnemonic.
+    for(U32 i = 0; i < (sizeof(replicationModeLookup) / sizeof(EnumTable::Enums)); i++)
+        if( dStricmp(replicationModeLookup[i].label, label) == 0)
+            return((Scene::ReplicationMode)replicationModeLookup[i].index);
+
+    // Warn.
+    Con::warnf( "Scene::getReplicationModeEnum() - Invalid replication mode '%s'.", label );
+
+    return Scene::REPLICATION_INVALID;
+}
+
+//-----------------------------------------------------------------------------
+
+const char* Scene::getReplicationModeDescription( Scene::ReplicationMode replicationMode )
+{
+    // Search for Mnemonic.
+    for (U32 i = 0; i < (sizeof(replicationModeLookup) / sizeof(EnumTable::Enums)); i++)
+    {
+        if( replicationModeLookup[i].index == replicationMode )
+            return replicationModeLookup[i].label;
+    }
+
+    // Warn.
+    Con::warnf( "Scene::getReplicationModeDescription() - Invalid replication mode.");
+
+    return StringTable->EmptyString;
+}
+
+//-----------------------------------------------------------------------------
+
 static EnumTable::Enums pickModeLookup[] =
                 {
                 { Scene::PICK_ANY,          "Any" },
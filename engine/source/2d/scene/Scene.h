@@ -35,6 +35,10 @@
 #include "network/netObject.h"
 #endif
 
+#ifndef _NETINTERESTGRID_H_
+#include "network/netInterestGrid.h"
+#endif
+
 #ifndef _TICKABLE_H_
 #include "platform/Tickable.h"
 #endif
@@ -47,6 +51,10 @@
 #include "2d/scene/WorldQuery.h"
 #endif
 
+#ifndef _SCENE_TICK_STATE_H_
+#include "2d/scene/SceneTickState.h"
+#endif
+
 #ifndef _DEBUG_DRAW_H_
 #include "2d/scene/DebugDraw.h"
 #endif
@@ -55,6 +63,10 @@
 #include "collection/hashTable.h"
 #endif
 
+#ifndef _ANIMATION_CLOCK_H_
+#include "2d/core/AnimationClock.h"
+#endif
+
 #ifndef _BATCH_RENDER_H_
 #include "2d/core/BatchRender.h"
 #endif
@@ -83,6 +95,11 @@ extern EnumTable jointTypeTable;
 
 class SceneObject;
 class SceneWindow;
+class SceneController;
+class SceneSnapshot;
+class SceneObjectGhost;
+class SceneReplicationScope;
+class NetConnection;
 
 ///-----------------------------------------------------------------------------
 
@@ -172,6 +189,8 @@ public:
     typedef Vector<TickContact>                 typeContactVector;
     typedef HashMap<b2Contact*, TickContact>    typeContactHash;
     typedef Vector<AssetPtr<AssetBase>*>        typeAssetPtrVector;
+    typedef HashMap<StringTableEntry, SceneSnapshot*> typeSnapshotHash;
+    typedef HashMap<SceneObject*, SceneObjectGhost*> typeReplicationHash;
 
     /// Scene Debug Options.
     enum DebugOption
@@ -203,6 +222,19 @@ public:
         PICK_COLLISION,
     };
 
+    /// Replication mode.
+    enum ReplicationMode
+    {
+        REPLICATION_INVALID,
+        ///---
+        REPLICATION_NONE,
+        REPLICATION_SERVER,
+        REPLICATION_CLIENT,
+    };
+
+    /// Number of parallel-ticked objects processed by each job.
+    enum { ParallelTickBatchSize = 128 };
+
     /// Debug drawing.
     DebugDraw                   mDebugDraw;
 
@@ -218,11 +250,22 @@ private:
     S32                         mPositionIterations;
     b2BlockAllocator            mBlockAllocator;
     b2Body*                     mpGroundBody;
+    bool                        mSpatialHash;
+    F32                         mSpatialHashCellSize;
 
     /// Scene occupancy.
     typeSceneObjectVector       mSceneObjects;
     typeSceneObjectVector       mTickedSceneObjects;
 
+    /// Packed tick state (indexed identically to the scene objects).
+    SceneTickState              mTickState;
+    Vector<U32>                 mFastTickedSceneObjects;
+    Vector<U32>                 mParallelTickedSceneObjects;
+    typeSceneObjectVector       mInterpolatedSceneObjects;
+    bool                        mTickInProgress;
+    bool                        mTickInParallel;
+    bool                        mParallelTick;
+
     /// Joint access.
     typeJointHash               mJoints;
     typeReverseJointHash        mReverseJoints;
@@ -230,14 +273,36 @@ private:
 
     /// Scene controllers.
     SimObjectPtr<SimSet>	    mControllers;
+    Vector<SimObjectId>         mSceneControllerIds;
+    Vector<SceneController*>    mSceneControllers;
+    Vector<WorldQueryRegion>    mControllerRegions;
 
     /// Asset pre-loads.
     typeAssetPtrVector          mAssetPreloads;
 
+    /// Snapshots.
+    typeSnapshotHash            mSnapshots;
+
+    /// Taml child cursor so children read in order skip parked pool objects without rescanning.
+    mutable U32                 mTamlChildIndex;
+    mutable U32                 mTamlChildSceneIndex;
+
+    /// Replication.
+    ReplicationMode             mReplicationMode;
+    typeReplicationHash         mReplicationGhosts;
+    NetInterestGrid             mInterestGrid;
+    Vector<StringTableEntry>    mReplicatedFields;
+    F32                         mReplicationTime;
+    F32                         mReplicationServerTime;
+    F32                         mReplicationDelay;
+
     /// Scene time.
     F32                         mSceneTime;
     bool                        mScenePause;
 
+    /// Shared clocks for synchronized animations.
+    AnimationClockSet           mAnimationClocks;
+
     /// Debug and metrics.
     DebugStats                  mDebugStats;
     U32                         mDebugMask;
@@ -268,6 +333,22 @@ private:
     U32                         mSceneIndex;
 
 private:   
+    /// Tick state.
+    void                        remapFastTickedSceneObjects( const U32 removedIndex, const U32 movedIndex );
+    void                        compactInterpolatedSceneObjects( void );
+
+    /// Parallel ticking.
+    void                        commitParallelIntegration( void );
+    static void                 parallelPreIntegrate( void* pContext, const U32 start, const U32 end );
+    static void                 parallelIntegrate( void* pContext, const U32 start, const U32 end );
+    static void                 parallelPostIntegrate( void* pContext, const U32 start, const U32 end );
+
+    /// Replication.
+    void                        createReplicationGhost( SceneObject* pSceneObject );
+    void                        removeReplicationGhost( SceneObject* pSceneObject );
+    void                        updateReplicationState( void );
+    void                        driveReplicas( void );
+
     /// Contacts.
     void                        forwardContacts( void );
     void                        dispatchBeginContactCallbacks( void );
@@ -340,6 +421,12 @@ public:
     inline void             setPositionIterations( const S32 iterations ) { mPositionIterations = iterations; }
     inline S32              getPositionIterations( void ) const         { return mPositionIterations; }
 
+    /// Spatial hash.
+    void                    setSpatialHash( const bool spatialHash );
+    inline bool             getSpatialHash( void ) const                { return mSpatialHash; }
+    void                    setSpatialHashCellSize( const F32 cellSize );
+    inline F32              getSpatialHashCellSize( void ) const        { return mSpatialHashCellSize; }
+
     /// Scene occupancy.
     void                    clearScene( bool deleteObjects = true );
     void                    addToScene( SceneObject* pSceneObject );
@@ -347,13 +434,38 @@ public:
 
     inline typeSceneObjectVectorConstRef getSceneObjects( void ) const  { return mSceneObjects; }
     inline U32              getSceneObjectCount( void ) const           { return mSceneObjects.size(); }
+    inline SceneTickState&  getTickState( void )                        { return mTickState; }
+    void                    queueInterpolation( SceneObject* pSceneObject );
+    inline void             setParallelTick( const bool parallelTick )  { mParallelTick = parallelTick; }
+    inline bool             getParallelTick( void ) const               { return mParallelTick; }
+    inline bool             getIsTickInParallel( void ) const           { return mTickInParallel; }
     SceneObject*            getSceneObject( const U32 objectIndex ) const;
+
+    /// Snapshots.
+    U32                     saveSnapshot( const char* pSnapshotName, const char* pFields = NULL );
+    bool                    restoreSnapshot( const char* pSnapshotName );
+    bool                    deleteSnapshot( const char* pSnapshotName );
+    void                    clearSnapshots( void );
+
+    /// Replication.
+    void                    setReplicationMode( const ReplicationMode replicationMode );
+    inline ReplicationMode  getReplicationMode( void ) const            { return mReplicationMode; }
+    void                    setReplicatedFields( const char* pFields );
+    const char*             getReplicatedFields( void ) const;
+    inline void             setReplicationDelay( const F32 delay )      { mReplicationDelay = delay; }
+    inline F32              getReplicationDelay( void ) const           { return mReplicationDelay; }
+    SceneReplicationScope*  replicateTo( NetConnection* pConnection );
+    inline const typeReplicationHash& getReplicationGhosts( void ) const { return mReplicationGhosts; }
+    inline const NetInterestGrid& getInterestGrid( void ) const         { return mInterestGrid; }
+    void                    addReplica( SceneObject* pReplica, SceneObjectGhost* pGhost );
+    void                    receiveReplicationTime( const F32 serverTime );
     U32                     getSceneObjects( typeSceneObjectVector& objects ) const;
     U32                     getSceneObjects( typeSceneObjectVector& objects, const U32 sceneLayer ) const;
 
     void                    mergeScene( const Scene* pScene );
 
     inline SimSet*			getControllers( void )						{ return mControllers; }
+    const Vector<SceneController*>& getSceneControllers( void );
 
     inline S32              getAssetPreloadCount( void ) const          { return mAssetPreloads.size(); }
     const AssetPtr<AssetBase>* getAssetPreload( const S32 index ) const;
@@ -363,6 +475,7 @@ public:
 
     /// Scene time.
     inline F32              getSceneTime( void ) const                  { return mSceneTime; };
+    inline AnimationClockSet& getAnimationClocks( void )                { return mAnimationClocks; }
     inline void             setScenePause( bool status )                { mScenePause = status; }
     inline bool             getScenePause( void ) const                 { return mScenePause; };
 
@@ -667,7 +780,8 @@ public:
     static SceneRenderRequest* createDefaultRenderRequest( SceneRenderQueue* pSceneRenderQueue, SceneObject* pSceneObject  );
 
     /// Taml children.
-    virtual U32 getTamlChildCount( void ) const                         { return (U32)mSceneObjects.size(); }
+    /// Parked pool objects are not persisted.
+    virtual U32 getTamlChildCount( void ) const;
     virtual SimObject* getTamlChild( const U32 childIndex ) const;
     virtual void addTamlChild( SimObject* pSimObject );
 
@@ -677,6 +791,8 @@ public:
     static const char* getPickModeDescription( PickMode pickMode );
     static DebugOption getDebugOptionEnum(const char* label);
     static const char* getDebugOptionDescription( DebugOption debugOption );
+    static ReplicationMode getReplicationModeEnum(const char* label);
+    static const char* getReplicationModeDescription( ReplicationMode replicationMode );
 
     /// Declare Console Object.
     DECLARE_CONOBJECT(Scene);
@@ -688,6 +804,11 @@ protected:
     static bool writeGravity( void* obj, StringTableEntry pFieldName )              { return Vector2(static_cast<Scene*>(obj)->getGravity()).notEqual( Vector2::getZero() ); }
     static bool writeVelocityIterations( void* obj, StringTableEntry pFieldName )   { return static_cast<Scene*>(obj)->getVelocityIterations() != 8; }
     static bool writePositionIterations( void* obj, StringTableEntry pFieldName )   { return static_cast<Scene*>(obj)->getPositionIterations() != 3; }
+    static bool writeParallelTick( void* obj, StringTableEntry pFieldName )         { return static_cast<Scene*>(obj)->getParallelTick(); }
+    static bool setSpatialHash( void* obj, const char* data )                       { static_cast<Scene*>(obj)->setSpatialHash( dAtob(data) ); return false; }
+    static bool writeSpatialHash( void* obj, StringTableEntry pFieldName )          { return static_cast<Scene*>(obj)->getSpatialHash(); }
+    static bool setSpatialHashCellSize( void* obj, const char* data )               { static_cast<Scene*>(obj)->setSpatialHashCellSize( dAtof(data) ); return false; }
+    static bool writeSpatialHashCellSize( void* obj, StringTableEntry pFieldName )  { return mNotEqual( static_cast<Scene*>(obj)->getSpatialHashCellSize(), (F32)SpatialHash::DefaultCellSize ); }
 
     static bool writeLayerSortMode( void* obj, StringTableEntry pFieldName )
     {
@@ -725,6 +846,10 @@ protected:
 
 public:
     static SimObjectPtr<Scene> LoadingScene;
+    /// The single scene receiving replication in this process.
+    /// Client ghosts are created by the connection without knowing the scene so every
+    /// replicated scene goes to this one.  Setting another scene to the client mode replaces it.
+    static SimObjectPtr<Scene> ReplicationClientScene;
 };
 
 //-----------------------------------------------------------------------------
@@ -0,0 +1,457 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCENE_POOL_H_
+#include "2d/scene/ScenePool.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _CONSOLETYPES_H_
+#include "console/consoleTypes.h"
+#endif
+
+// Script bindings.
+#include "ScenePool_ScriptBinding.h"
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+IMPLEMENT_CONOBJECT(ScenePool);
+
+//-----------------------------------------------------------------------------
+
+/// Where parked objects keep their world proxy, well away from anything queried.
+static const F32 scenePoolParkedPosition = 1.0e6f;
+
+//-----------------------------------------------------------------------------
+
+ScenePool::ScenePool() :
+    mGrowCount( DefaultGrowCount )
+{
+    // Set Vector Associations.
+    VECTOR_SET_ASSOCIATION( mPooledObjects );
+    VECTOR_SET_ASSOCIATION( mFreeObjects );
+}
+
+//-----------------------------------------------------------------------------
+
+ScenePool::~ScenePool()
+{
+}
+
+//-----------------------------------------------------------------------------
+
+void ScenePool::initPersistFields()
+{
+    // Call parent.
+    Parent::initPersistFields();
+
+    addProtectedField("Template", TypeSimObjectPtr, Offset(mTemplate, ScenePool), &setTemplate, &defaultProtectedGetFn, &writeTemplate, "The scene object that pooled objects are cloned from and reset to.");
+    addField("Scene", TypeSimObjectPtr, Offset(mScene, ScenePool), &writeScene, "The scene that pooled objects are added to.");
+    addField("GrowCount", TypeS32, Offset(mGrowCount, ScenePool), &writeGrowCount, "How many objects are added when acquiring from an empty pool.  Zero fixes the pool size.");
+}
+
+//-----------------------------------------------------------------------------
+
+void ScenePool::onRemove()
+{
+    // Destroy the pooled objects.
+    clear();
+
+    // Call parent.
+    Parent::onRemove();
+}
+
+//-----------------------------------------------------------------------------
+
+void ScenePool::setTemplate( SceneObject* pTemplate )
+{
+    // Ignore if the template is not changing.
+    if ( pTemplate == mTemplate )
+        return;
+
+    // The template cannot be one of our own objects.
+    if ( pTemplate != NULL && pTemplate->getScenePool() != NULL )
+    {
+        Con::warnf( "ScenePool::setTemplate() - Object '%s' is a pooled object and cannot be used as a template.", pTemplate->getIdString() );
+        return;
+    }
+
+    // Objects cloned from a previous template are no longer valid.
+    if ( mPooledObjects.size() > 0 )
+        clear();
+
+    mTemplate = pTemplate;
+}
+
+//-----------------------------------------------------------------------------
+
+void ScenePool::reserve( const U32 count )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ScenePool_Reserve);
+
+    // Finish if we already have enough objects.
+    if ( count <= (U32)mPooledObjects.size() )
+        return;
+
+    // We need a template to clone.
+    if ( mTemplate.isNull() )
+    {
+        Con::warnf( "ScenePool::reserve() - Cannot reserve objects without a template." );
+        return;
+    }
+
+    // Reserve the lists so that releasing never allocates.
+    mPooledObjects.reserve( count );
+    mFreeObjects.reserve( count );
+
+    while( (U32)mPooledObjects.size() < count )
+    {
+        // Create a pooled object.
+        SceneObject* pSceneObject = createPooledObject();
+
+        if ( pSceneObject == NULL )
+            return;
+
+        // Park it as free.
+        mPooledObjects.push_back( pSceneObject );
+        parkObject( pSceneObject );
+        mFreeObjects.push_back( pSceneObject );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+SceneObject* ScenePool::acquire( void )
+{
+    // Spawn at the template transform.
+    if ( mTemplate.isNull() )
+        return acquire( Vector2::getZero(), 0.0f );
+
+    return acquire( mTemplate->getPosition(), mTemplate->getAngle() );
+}
+
+//-----------------------------------------------------------------------------
+
+SceneObject* ScenePool::acquire( const Vector2& position, const F32 angle )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ScenePool_Acquire);
+
+    // The body cannot be activated whilst the world is stepping.
+    if ( !mScene.isNull() && mScene->getWorld()->IsLocked() )
+    {
+        Con::warnf( "ScenePool::acquire() - Cannot acquire from pool '%s' whilst the scene is stepping.", getIdString() );
+        return NULL;
+    }
+
+    // Fetch a free object.
+    SceneObject* pSceneObject = popFreeObject();
+
+    if ( pSceneObject == NULL )
+        return NULL;
+
+    // Spawn the object.
+    spawnObject( pSceneObject, position, angle );
+
+    return pSceneObject;
+}
+
+//-----------------------------------------------------------------------------
+
+bool ScenePool::release( SceneObject* pSceneObject )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ScenePool_Release);
+
+    // Sanity!
+    AssertFatal( pSceneObject != NULL, "ScenePool::release() - Cannot release a NULL object." );
+
+    // Is the object from this pool?
+    if ( pSceneObject->mpScenePool != this )
+    {
+        // No, so warn.
+        Con::warnf( "ScenePool::release() - Object '%s' was not acquired from pool '%s'.", pSceneObject->getIdString(), getIdString() );
+        return false;
+    }
+
+    // Finish if the object is already free.
+    if ( pSceneObject->mPooled )
+        return true;
+
+    // The body cannot be deactivated whilst the world is stepping.
+    Scene* pScene = pSceneObject->getScene();
+    if ( pScene != NULL && pScene->getWorld()->IsLocked() )
+        return false;
+
+    // Park the object as free.
+    parkObject( pSceneObject );
+    mFreeObjects.push_back( pSceneObject );
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool ScenePool::reclaim( SceneObject* pSceneObject )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ScenePool_Reclaim);
+
+    // Sanity!
+    AssertFatal( pSceneObject != NULL, "ScenePool::reclaim() - Cannot reclaim a NULL object." );
+
+    // Finish if the object isn't parked in this pool.
+    if ( pSceneObject->mpScenePool != this || !pSceneObject->mPooled )
+        return false;
+
+    // The body cannot be activated whilst the world is stepping.
+    if ( !mScene.isNull() && mScene->getWorld()->IsLocked() )
+        return false;
+
+    // Remove from the free objects.
+    for ( S32 n = 0; n < mFreeObjects.size(); ++n )
+    {
+        if ( mFreeObjects[n] == pSceneObject )
+        {
+            mFreeObjects.erase_fast( n );
+            break;
+        }
+    }
+
+    // Spawn the object where it was parked.
+    spawnObject( pSceneObject, pSceneObject->getPosition(), pSceneObject->getAngle() );
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void ScenePool::releaseAll( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ScenePool_ReleaseAll);
+
+    for ( S32 n = 0; n < mPooledObjects.size(); ++n )
+    {
+        // Fetch pooled object.
+        SceneObject* pSceneObject = mPooledObjects[n];
+
+        if ( !pSceneObject->mPooled )
+            release( pSceneObject );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void ScenePool::clear( void )
+{
+    // Transfer the objects as deleting them calls back into the pool.
+    Vector<SceneObject*> pooledObjects = mPooledObjects;
+    mPooledObjects.clear();
+    mFreeObjects.clear();
+
+    for ( S32 n = 0; n < pooledObjects.size(); ++n )
+    {
+        // Fetch pooled object.
+        SceneObject* pSceneObject = pooledObjects[n];
+
+        // Detach from the pool.
+        pSceneObject->mpScenePool = NULL;
+        pSceneObject->mPooled = false;
+
+        // Delete the object.
+        pSceneObject->safeDelete();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void ScenePool::onPooledObjectRemoved( SceneObject* pSceneObject )
+{
+    // Sanity!
+    AssertFatal( pSceneObject->mpScenePool == this, "ScenePool::onPooledObjectRemoved() - Object is not from this pool." );
+
+    // Remove from the free objects.
+    if ( pSceneObject->mPooled )
+    {
+        for ( S32 n = 0; n < mFreeObjects.size(); ++n )
+        {
+            if ( mFreeObjects[n] == pSceneObject )
+            {
+                mFreeObjects.erase_fast( n );
+                break;
+            }
+        }
+    }
+
+    // Remove from the pooled objects.
+    for ( S32 n = 0; n < mPooledObjects.size(); ++n )
+    {
+        if ( mPooledObjects[n] == pSceneObject )
+        {
+            mPooledObjects.erase_fast( n );
+            break;
+        }
+    }
+
+    pSceneObject->mpScenePool = NULL;
+    pSceneObject->mPooled = false;
+}
+
+//-----------------------------------------------------------------------------
+
+SceneObject* ScenePool::createPooledObject( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ScenePool_CreatePooledObject);
+
+    // Clone the template.
+    SceneObject* pSceneObject = dynamic_cast<SceneObject*>( mTemplate->clone( true ) );
+
+    if ( pSceneObject == NULL )
+    {
+        Con::warnf( "ScenePool::createPooledObject() - Unable to clone template '%s'.", mTemplate->getIdString() );
+        return NULL;
+    }
+
+    // Assign to the pool.
+    pSceneObject->mpScenePool = this;
+
+    // Add to the scene.
+    if ( !mScene.isNull() )
+        mScene->addToScene( pSceneObject );
+
+    return pSceneObject;
+}
+
+//-----------------------------------------------------------------------------
+
+SceneObject* ScenePool::popFreeObject( void )
+{
+    // Grow the pool if it is empty.
+    if ( mFreeObjects.size() == 0 )
+    {
+        if ( mGrowCount == 0 )
+        {
+            Con::warnf( "ScenePool::acquire() - Pool '%s' is exhausted.", getIdString() );
+            return NULL;
+        }
+
+        reserve( mPooledObjects.size() + mGrowCount );
+
+        if ( mFreeObjects.size() == 0 )
+            return NULL;
+    }
+
+    // Pop the most recently released object.
+    SceneObject* pSceneObject = mFreeObjects.last();
+    mFreeObjects.pop_back();
+
+    return pSceneObject;
+}
+
+//-----------------------------------------------------------------------------
+
+void ScenePool::parkObject( SceneObject* pSceneObject )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ScenePool_ParkObject);
+
+    // Flag as pooled.
+    pSceneObject->mPooled = true;
+    pSceneObject->mBeingSafeDeleted = false;
+
+    // Stop any movement.
+    pSceneObject->cancelMoveTo( false );
+    pSceneObject->cancelRotateTo( false );
+
+    // Let go of anything referencing the object.
+    pSceneObject->processDestroyNotifications();
+    pSceneObject->dismountCamera();
+
+    // Deactivate.
+    // NOTE:- Disabling deactivates the body and the pooled tick flag makes the scene skip the object entirely.
+    pSceneObject->setLifetime( 0.0f );
+    pSceneObject->setVisible( false );
+    pSceneObject->setEnabled( false );
+
+    // Park the world proxy.
+    Scene* pScene = pSceneObject->getScene();
+    if ( pScene != NULL )
+    {
+        b2AABB parkedAABB;
+        parkedAABB.lowerBound.Set( scenePoolParkedPosition, scenePoolParkedPosition );
+        parkedAABB.upperBound = parkedAABB.lowerBound;
+        pScene->getWorldQuery()->update( pSceneObject, parkedAABB, b2Vec2_zero );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void ScenePool::spawnObject( SceneObject* pSceneObject, const Vector2& position, const F32 angle )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ScenePool_SpawnObject);
+
+    // Return to the pool scene if the object was taken out of it.
+    if ( !mScene.isNull() && pSceneObject->getScene() != mScene )
+        mScene->addToScene( pSceneObject );
+
+    // Position before the body is activated.
+    pSceneObject->setPosition( position );
+    pSceneObject->setAngle( angle );
+
+    // Reset from the template.
+    // NOTE:- Only the state listed on the class is reset.
+    SceneObject* pTemplate = mTemplate;
+    if ( pTemplate != NULL )
+    {
+        pSceneObject->setSize( pTemplate->getSize() );
+        pSceneObject->setLinearVelocity( pTemplate->getLinearVelocity() );
+        pSceneObject->setAngularVelocity( pTemplate->getAngularVelocity() );
+        pSceneObject->setLifetime( pTemplate->getLifetime() );
+        pSceneObject->setSceneLayer( pTemplate->getSceneLayer() );
+        pSceneObject->setSceneGroup( pTemplate->getSceneGroup() );
+        pSceneObject->setBlendColor( pTemplate->getBlendColor() );
+        pSceneObject->setVisible( pTemplate->getVisible() );
+    }
+    else
+    {
+        pSceneObject->setVisible( true );
+    }
+
+    // Activate.
+    pSceneObject->mPooled = false;
+    pSceneObject->setEnabled( true );
+    pSceneObject->setAwake( true );
+
+    // Move the world proxy back from where it was parked.
+    if ( pSceneObject->getScene() != NULL )
+        pSceneObject->updateTickProxy();
+}
@@ -0,0 +1,114 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCENE_POOL_H_
+#define _SCENE_POOL_H_
+
+#ifndef _SCENE_OBJECT_H_
+#include "2d/sceneobject/SceneObject.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// Recycles scene objects cloned from a template object.
+/// Released objects are not destroyed but parked: they are disabled (which deactivates
+/// their physics body), flagged as pooled in the scene tick state (so ticking skips them
+/// without touching the object), hidden and have their world proxy moved out of the way.
+/// They remain registered and in the scene object list, where getIsPooled() identifies them,
+/// so they keep their SimObject Id and physics body.  Spawning and despawning therefore
+/// costs no allocation once the pool has grown to its working size.
+///
+/// Acquiring an object resets the size, velocities, lifetime, layer, group, blend colour and
+/// visibility from the template and the transform from the spawn position and angle.
+/// Anything else, such as behaviors, dynamic fields, collision shapes, images or animations,
+/// is cloned from the template when the object is created but keeps whatever value it had
+/// when it was released.  Callers that change such state must reset it themselves.
+class ScenePool : public SimObject
+{
+    typedef SimObject Parent;
+
+public:
+    enum
+    {
+        DefaultGrowCount    = 16,
+    };
+
+public:
+    ScenePool();
+    virtual ~ScenePool();
+
+    static void     initPersistFields();
+
+    virtual void    onRemove();
+
+    /// Template.
+    void            setTemplate( SceneObject* pTemplate );
+    inline SceneObject* getTemplate( void ) const                       { return mTemplate; }
+
+    /// Scene.
+    inline void     setScene( Scene* pScene )                           { mScene = pScene; }
+    inline Scene*   getScene( void ) const                              { return mScene; }
+
+    /// Sizing.
+    inline void     setGrowCount( const U32 growCount )                 { mGrowCount = growCount; }
+    inline U32      getGrowCount( void ) const                          { return mGrowCount; }
+    void            reserve( const U32 count );
+    inline U32      getPoolCount( void ) const                          { return mPooledObjects.size(); }
+    inline U32      getFreeCount( void ) const                          { return mFreeObjects.size(); }
+    inline U32      getActiveCount( void ) const                        { return mPooledObjects.size() - mFreeObjects.size(); }
+
+    /// Spawning.
+    SceneObject*    acquire( void );
+    SceneObject*    acquire( const Vector2& position, const F32 angle );
+    bool            release( SceneObject* pSceneObject );
+    bool            reclaim( SceneObject* pSceneObject );
+    void            releaseAll( void );
+    void            clear( void );
+
+    /// Called by a pooled object when it is deleted.
+    void            onPooledObjectRemoved( SceneObject* pSceneObject );
+
+    /// Declare Console Object.
+    DECLARE_CONOBJECT( ScenePool );
+
+protected:
+    static bool     setTemplate( void* obj, const char* data )          { static_cast<ScenePool*>(obj)->setTemplate( dynamic_cast<SceneObject*>(Sim::findObject(data)) ); return false; }
+    static bool     writeTemplate( void* obj, StringTableEntry pFieldName ) { return static_cast<ScenePool*>(obj)->getTemplate() != NULL; }
+    static bool     writeScene( void* obj, StringTableEntry pFieldName ) { return static_cast<ScenePool*>(obj)->getScene() != NULL; }
+    static bool     writeGrowCount( void* obj, StringTableEntry pFieldName ) { return static_cast<ScenePool*>(obj)->getGrowCount() != DefaultGrowCount; }
+
+private:
+    SceneObject*    createPooledObject( void );
+    SceneObject*    popFreeObject( void );
+    void            parkObject( SceneObject* pSceneObject );
+    void            spawnObject( SceneObject* pSceneObject, const Vector2& position, const F32 angle );
+
+private:
+    SimObjectPtr<SceneObject>   mTemplate;
+    SimObjectPtr<Scene>         mScene;
+    U32                         mGrowCount;
+
+    Vector<SceneObject*>        mPooledObjects;
+    Vector<SceneObject*>        mFreeObjects;
+};
+
+#endif // _SCENE_POOL_H_
@@ -0,0 +1,181 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(ScenePool, setTemplate, void, 3, 3,   "(sceneObject) Sets the scene object that pooled objects are cloned from and reset to.\n"
+                                                    "Any objects cloned from a previous template are deleted.\n"
+                                                    "@param sceneObject The template scene object.\n"
+                                                    "@return No return value.")
+{
+    // Find the specified object.
+    SceneObject* pSceneObject = dynamic_cast<SceneObject*>(Sim::findObject(argv[2]));
+
+    // Did we find the object?
+    if ( !pSceneObject )
+    {
+        // No, so warn.
+        Con::warnf("ScenePool::setTemplate() - Could not find the specified object '%s'.", argv[2]);
+        return;
+    }
+
+    object->setTemplate( pSceneObject );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(ScenePool, getTemplate, S32, 2, 2,    "() Gets the scene object that pooled objects are cloned from.\n"
+                                                    "@return The template scene object or 0 if none is set.")
+{
+    SceneObject* pTemplate = object->getTemplate();
+
+    return pTemplate == NULL ? 0 : pTemplate->getId();
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(ScenePool, reserve, void, 3, 3,       "(count) Grows the pool to hold at least the specified number of objects.\n"
+                                                    "@param count The number of objects to hold.\n"
+                                                    "@return No return value.")
+{
+    const S32 count = dAtoi(argv[2]);
+
+    // Is the count valid?
+    if ( count < 0 )
+    {
+        // No, so warn.
+        Con::warnf("ScenePool::reserve() - Invalid count '%d'.", count);
+        return;
+    }
+
+    object->reserve( (U32)count );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(ScenePool, acquire, S32, 2, 5,        "([float x, float y], [float angle]) Spawns an object from the pool, growing the pool if it is empty.\n"
+                                                    "The size, velocities, lifetime, layer, group, blend color and visibility are reset from the template.  Other state, such as behaviors and dynamic fields, keeps its value from when the object was released.\n"
+                                                    "@param x The horizontal position to spawn at.  Optional: Defaults to the template position.\n"
+                                                    "@param y The vertical position to spawn at.  Optional: Defaults to the template position.\n"
+                                                    "@param angle The angle in degrees to spawn at.  Optional: Defaults to the template angle.\n"
+                                                    "@return The spawned object or 0 if the pool is exhausted.")
+{
+    SceneObject* pSceneObject = NULL;
+
+    // ()
+    if ( argc == 2 )
+    {
+        pSceneObject = object->acquire();
+    }
+    else
+    {
+        // Elements in the first argument.
+        const U32 elementCount = Utility::mGetStringElementCount(argv[2]);
+
+        Vector2 position;
+        F32 angle = 0.0f;
+
+        // ("x y", [angle])
+        if ( elementCount == 2 && argc <= 4 )
+        {
+            position = Utility::mGetStringElementVector(argv[2]);
+            if ( argc == 4 )
+                angle = mDegToRad( dAtof(argv[3]) );
+        }
+        // (x, y, [angle])
+        else if ( elementCount == 1 && argc >= 4 )
+        {
+            position.Set( dAtof(argv[2]), dAtof(argv[3]) );
+            if ( argc == 5 )
+                angle = mDegToRad( dAtof(argv[4]) );
+        }
+        // Invalid
+        else
+        {
+            Con::warnf("ScenePool::acquire() - Invalid number of parameters!");
+            return 0;
+        }
+
+        pSceneObject = object->acquire( position, angle );
+    }
+
+    return pSceneObject == NULL ? 0 : pSceneObject->getId();
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(ScenePool, release, bool, 3, 3,       "(sceneObject) Returns an object to the pool.\n"
+                                                    "Calling 'safeDelete' on a pooled object also returns it to the pool.\n"
+                                                    "@param sceneObject The object to return.\n"
+                                                    "@return Whether the object was returned to the pool or not.")
+{
+    // Find the specified object.
+    SceneObject* pSceneObject = dynamic_cast<SceneObject*>(Sim::findObject(argv[2]));
+
+    // Did we find the object?
+    if ( !pSceneObject )
+    {
+        // No, so warn.
+        Con::warnf("ScenePool::release() - Could not find the specified object '%s'.", argv[2]);
+        return false;
+    }
+
+    return object->release( pSceneObject );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(ScenePool, releaseAll, void, 2, 2,    "() Returns all spawned objects to the pool.\n"
+                                                    "@return No return value.")
+{
+    object->releaseAll();
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(ScenePool, clear, void, 2, 2,         "() Deletes all the objects held by the pool, including any that are spawned.\n"
+                                                    "@return No return value.")
+{
+    object->clear();
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(ScenePool, getPoolCount, S32, 2, 2,   "() Gets the number of objects held by the pool.\n"
+                                                    "@return The number of objects held by the pool.")
+{
+    return object->getPoolCount();
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(ScenePool, getFreeCount, S32, 2, 2,   "() Gets the number of objects waiting in the pool.\n"
+                                                    "@return The number of objects waiting in the pool.")
+{
+    return object->getFreeCount();
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(ScenePool, getActiveCount, S32, 2, 2, "() Gets the number of objects spawned from the pool.\n"
+                                                    "@return The number of objects spawned from the pool.")
+{
+    return object->getActiveCount();
+}
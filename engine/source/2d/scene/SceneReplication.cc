@@ -0,0 +1,694 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCENE_REPLICATION_H_
+#include "2d/scene/SceneReplication.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _NETCONNECTION_H_
+#include "network/netConnection.h"
+#endif
+
+#ifndef _BITSTREAM_H_
+#include "io/bitStream.h"
+#endif
+
+#ifndef _CRC_H_
+#include "algorithm/crc.h"
+#endif
+
+// Script bindings.
+#include "SceneReplication_ScriptBinding.h"
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+IMPLEMENT_CO_NETOBJECT_V1(SceneObjectGhost);
+IMPLEMENT_CONOBJECT(SceneReplicationScope);
+
+//-----------------------------------------------------------------------------
+
+/// Quantization scales (units per step).
+static const F32 replicationPositionScale = 100.0f;
+static const F32 replicationVelocityScale = 100.0f;
+
+/// Seconds without a transform update before a replica restarts its snapshots.
+static const F32 replicationSnapshotGap = 0.25f;
+
+/// Maximum seconds a replica is extrapolated past its last snapshot.
+static const F32 replicationMaxExtrapolation = 0.25f;
+
+//-----------------------------------------------------------------------------
+
+static inline S32 quantizeSigned( const F32 value, const F32 scale, const U32 bitCount )
+{
+    const F32 limit = (F32)((1 << (bitCount-1)) - 1);
+    return (S32)mRound( mClampF( value * scale, -limit, limit ) );
+}
+
+//-----------------------------------------------------------------------------
+
+static inline U32 quantizeAngle( const F32 radians )
+{
+    F32 turns = mFmod( radians, M_2PI_F ) / M_2PI_F;
+    if ( turns < 0.0f )
+        turns += 1.0f;
+
+    return (U32)mRound( turns * (F32)BIT(SceneObjectGhost::AngleBits) ) & (BIT(SceneObjectGhost::AngleBits)-1);
+}
+
+//-----------------------------------------------------------------------------
+
+static inline F32 dequantizeAngle( const U32 angle )
+{
+    return (F32)angle * (M_2PI_F / (F32)BIT(SceneObjectGhost::AngleBits));
+}
+
+//-----------------------------------------------------------------------------
+
+static inline F32 wrapAngleDelta( F32 delta )
+{
+    while ( delta > M_PI_F )
+        delta -= M_2PI_F;
+
+    while ( delta < -M_PI_F )
+        delta += M_2PI_F;
+
+    return delta;
+}
+
+//-----------------------------------------------------------------------------
+
+SceneObjectGhost::SceneObjectGhost() :
+    mpSceneObject( NULL ),
+    mClassName( StringTable->EmptyString ),
+    mInterestProxy( NetInterestGrid::InvalidProxy ),
+    mTransformTime( 0.0f ),
+    mAngle( 0 ),
+    mAngularVelocity( 0 ),
+    mVisible( true ),
+    mSceneLayer( 0 ),
+    mSize( Vector2::getOne() ),
+    mSnapshotCount( 0 ),
+    mStateDirty( false )
+{
+    mPosition[0] = mPosition[1] = 0;
+    mLinearVelocity[0] = mLinearVelocity[1] = 0;
+
+    // Set Vector Associations.
+    VECTOR_SET_ASSOCIATION( mFieldNames );
+    VECTOR_SET_ASSOCIATION( mFieldHashes );
+    VECTOR_SET_ASSOCIATION( mPendingFields );
+
+    // Ghost to the clients.
+    // NOTE: The ghosting overwrites the net flags on the client.
+    mNetFlags.set( Ghostable );
+}
+
+//-----------------------------------------------------------------------------
+
+SceneObjectGhost::~SceneObjectGhost()
+{
+    // Free any pending fields.
+    for ( S32 n = 0; n < mPendingFields.size(); ++n )
+    {
+        dFree( mPendingFields[n].mpValue );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+bool SceneObjectGhost::onAdd()
+{
+    // Call Parent.
+    if ( !Parent::onAdd() )
+        return false;
+
+    // Create the replica if we're the client.
+    if ( isClientObject() )
+        createReplica();
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObjectGhost::onRemove()
+{
+    // Delete the replica if we're the client.
+    if ( isClientObject() && !mReplica.isNull() )
+    {
+        SceneObject* pReplica = mReplica;
+        mReplica = NULL;
+
+        // Remove from the scene.
+        Scene* pScene = pReplica->getScene();
+        if ( pScene != NULL )
+            pScene->removeFromScene( pReplica );
+
+        pReplica->safeDelete();
+    }
+
+    // Call Parent.
+    Parent::onRemove();
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObjectGhost::setSceneObject( SceneObject* pSceneObject )
+{
+    // Sanity!
+    AssertFatal( pSceneObject != NULL, "SceneObjectGhost::setSceneObject() - Cannot ghost a NULL scene object." );
+
+    mpSceneObject = pSceneObject;
+    mClassName = StringTable->insert( pSceneObject->getClassName() );
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObjectGhost::updateDirtyState( const Vector<StringTableEntry>& fields )
+{
+    // Finish if no scene object.
+    if ( mpSceneObject == NULL )
+        return;
+
+    U32 dirtyMask = 0;
+
+    // Update the transform.
+    const Vector2 position = mpSceneObject->getPosition();
+    const S32 positionX = quantizeSigned( position.x, replicationPositionScale, PositionBits );
+    const S32 positionY = quantizeSigned( position.y, replicationPositionScale, PositionBits );
+    const U32 angle = quantizeAngle( mpSceneObject->getAngle() );
+    if ( positionX != mPosition[0] || positionY != mPosition[1] || angle != mAngle )
+    {
+        mPosition[0] = positionX;
+        mPosition[1] = positionY;
+        mAngle = angle;
+        mTransformTime = mpSceneObject->getScene()->getSceneTime();
+        dirtyMask |= TransformMask;
+    }
+
+    // Update the velocities.
+    const Vector2 linearVelocity = mpSceneObject->getLinearVelocity();
+    const S32 linearVelocityX = quantizeSigned( linearVelocity.x, replicationVelocityScale, VelocityBits );
+    const S32 linearVelocityY = quantizeSigned( linearVelocity.y, replicationVelocityScale, VelocityBits );
+    const S32 angularVelocity = quantizeSigned( mpSceneObject->getAngularVelocity(), replicationVelocityScale, VelocityBits );
+    if ( linearVelocityX != mLinearVelocity[0] || linearVelocityY != mLinearVelocity[1] || angularVelocity != mAngularVelocity )
+    {
+        mLinearVelocity[0] = linearVelocityX;
+        mLinearVelocity[1] = linearVelocityY;
+        mAngularVelocity = angularVelocity;
+        dirtyMask |= VelocityMask;
+    }
+
+    // Update the state.
+    const bool visible = mpSceneObject->getVisible();
+    const U32 sceneLayer = mpSceneObject->getSceneLayer();
+    const Vector2 size = mpSceneObject->getSize();
+    if ( visible != mVisible || sceneLayer != mSceneLayer || size != mSize )
+    {
+        mVisible = visible;
+        mSceneLayer = sceneLayer;
+        mSize = size;
+        dirtyMask |= StateMask;
+    }
+
+    // Resize the fields if they changed.
+    const U32 fieldCount = getMin( (U32)fields.size(), (U32)MaxFields );
+    if ( (U32)mFieldNames.size() != fieldCount )
+    {
+        mFieldNames.setSize( fieldCount );
+        mFieldHashes.setSize( fieldCount );
+        for ( U32 n = 0; n < fieldCount; ++n )
+        {
+            mFieldNames[n] = NULL;
+        }
+    }
+
+    // Update the fields.
+    for ( U32 n = 0; n < fieldCount; ++n )
+    {
+        const char* pValue = mpSceneObject->getDataField( fields[n], NULL );
+        const U32 valueHash = calculateCRC( pValue, dStrlen( pValue ) );
+
+        if ( mFieldNames[n] != fields[n] || mFieldHashes[n] != valueHash )
+        {
+            mFieldNames[n] = fields[n];
+            mFieldHashes[n] = valueHash;
+            dirtyMask |= BIT(FieldMaskShift + n);
+        }
+    }
+
+    // Flag anything that changed.
+    if ( dirtyMask != 0 )
+        setMaskBits( dirtyMask );
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObjectGhost::getInterestBounds( Point2F& center, F32& radius ) const
+{
+    // Sanity!
+    AssertFatal( mpSceneObject != NULL, "SceneObjectGhost::getInterestBounds() - No scene object." );
+
+    // Use the circle around the bounds.
+    const b2AABB aabb = mpSceneObject->getAABB();
+    const b2Vec2 aabbCenter = aabb.GetCenter();
+    const b2Vec2 aabbExtents = aabb.GetExtents();
+    center.set( aabbCenter.x, aabbCenter.y );
+    radius = aabbExtents.Length();
+}
+
+F32 SceneObjectGhost::getUpdatePriority( CameraScopeQuery* pFocusObject, U32 updateMask, S32 updateSkips )
+{
+    // Fetch the distance to the client camera.
+    const F32 offsetX = (F32)mPosition[0] / replicationPositionScale - pFocusObject->pos.x;
+    const F32 offsetY = (F32)mPosition[1] / replicationPositionScale - pFocusObject->pos.y;
+    const F32 distance = mSqrt( offsetX * offsetX + offsetY * offsetY );
+
+    // Objects nearer the camera and those skipped for longer are updated first.
+    const F32 proximity = pFocusObject->visibleDistance > 0.0f ? 1.0f - mClampF( distance / pFocusObject->visibleDistance, 0.0f, 1.0f ) : 0.0f;
+
+    return proximity + (F32)updateSkips * 0.1f;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 SceneObjectGhost::packUpdate( NetConnection* pConnection, U32 mask, BitStream* pStream )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneObjectGhost_PackUpdate);
+
+    const S32 startPosition = pStream->getCurPos();
+
+    // Initial.
+    if ( pStream->writeFlag( mask & InitialMask ) )
+        pStream->writeString( mClassName );
+
+    // Transform.
+    if ( pStream->writeFlag( mask & TransformMask ) )
+    {
+        pStream->write( mTransformTime );
+        pStream->writeSignedInt( mPosition[0], PositionBits );
+        pStream->writeSignedInt( mPosition[1], PositionBits );
+        pStream->writeInt( mAngle, AngleBits );
+    }
+
+    // Velocity.
+    if ( pStream->writeFlag( mask & VelocityMask ) )
+    {
+        pStream->writeSignedInt( mLinearVelocity[0], VelocityBits );
+        pStream->writeSignedInt( mLinearVelocity[1], VelocityBits );
+        pStream->writeSignedInt( mAngularVelocity, VelocityBits );
+    }
+
+    // State.
+    if ( pStream->writeFlag( mask & StateMask ) )
+    {
+        pStream->writeFlag( mVisible );
+        pStream->writeInt( mSceneLayer, LayerBits );
+        pStream->write( mSize.x );
+        pStream->write( mSize.y );
+    }
+
+    // Fields.
+    const U32 fieldCount = mFieldNames.size();
+    if ( pStream->writeFlag( (mask & FieldMask) != 0 && fieldCount > 0 ) )
+    {
+        pStream->writeInt( fieldCount, FieldCountBits );
+
+        for ( U32 n = 0; n < fieldCount; ++n )
+        {
+            if ( pStream->writeFlag( mask & BIT(FieldMaskShift + n) ) )
+            {
+                pStream->writeString( mFieldNames[n] );
+                pStream->writeString( mpSceneObject->getDataField( mFieldNames[n], NULL ) );
+            }
+        }
+    }
+
+    // Measure the bandwidth for the connection.
+    SceneReplicationScope* pScope = dynamic_cast<SceneReplicationScope*>( pConnection->getScopeObject() );
+    if ( pScope != NULL )
+        pScope->addBitsSent( pStream->getCurPos() - startPosition );
+
+    return 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObjectGhost::unpackUpdate( NetConnection* pConnection, BitStream* pStream )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneObjectGhost_UnpackUpdate);
+
+    char buffer[256];
+
+    // Initial.
+    if ( pStream->readFlag() )
+    {
+        pStream->readString( buffer );
+        mClassName = StringTable->insert( buffer );
+    }
+
+    // Transform.
+    if ( pStream->readFlag() )
+    {
+        pStream->read( &mTransformTime );
+        mPosition[0] = pStream->readSignedInt( PositionBits );
+        mPosition[1] = pStream->readSignedInt( PositionBits );
+        mAngle = pStream->readInt( AngleBits );
+
+        // Queue the snapshot.
+        const Vector2 position( (F32)mPosition[0] / replicationPositionScale, (F32)mPosition[1] / replicationPositionScale );
+        pushSnapshot( mTransformTime, position, dequantizeAngle( mAngle ) );
+
+        // Track the server time.
+        Scene* pScene = Scene::ReplicationClientScene;
+        if ( pScene != NULL )
+            pScene->receiveReplicationTime( mTransformTime );
+    }
+
+    // Velocity.
+    if ( pStream->readFlag() )
+    {
+        mLinearVelocity[0] = pStream->readSignedInt( VelocityBits );
+        mLinearVelocity[1] = pStream->readSignedInt( VelocityBits );
+        mAngularVelocity = pStream->readSignedInt( VelocityBits );
+    }
+
+    // State.
+    if ( pStream->readFlag() )
+    {
+        mVisible = pStream->readFlag();
+        mSceneLayer = pStream->readInt( LayerBits );
+        pStream->read( &mSize.x );
+        pStream->read( &mSize.y );
+        mStateDirty = true;
+    }
+
+    // Fields.
+    if ( pStream->readFlag() )
+    {
+        const U32 fieldCount = pStream->readInt( FieldCountBits );
+
+        for ( U32 n = 0; n < fieldCount; ++n )
+        {
+            if ( !pStream->readFlag() )
+                continue;
+
+            PendingField pendingField;
+            pStream->readString( buffer );
+            pendingField.mFieldName = StringTable->insert( buffer );
+            pStream->readString( buffer );
+            pendingField.mpValue = dStrdup( buffer );
+            mPendingFields.push_back( pendingField );
+        }
+    }
+
+    // Apply to the replica.
+    applyPendingState();
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObjectGhost::createReplica( void )
+{
+    // Fetch the client scene.
+    Scene* pScene = Scene::ReplicationClientScene;
+
+    // Finish if there's no client scene.
+    if ( pScene == NULL )
+    {
+        // Warn.
+        Con::warnf( "SceneObjectGhost::createReplica() - No scene is receiving replication so '%s' cannot be replicated.", mClassName );
+        return;
+    }
+
+    // Finish if the class isn't a scene object.
+    // NOTE: The class name comes from the server so is checked before anything is created.
+    AbstractClassRep* pClassRep = AbstractClassRep::findClassRep( mClassName );
+    if ( pClassRep == NULL || !pClassRep->isClass( SceneObject::getStaticClassRep() ) )
+    {
+        // Warn.
+        Con::warnf( "SceneObjectGhost::createReplica() - Cannot replicate '%s' as it is not a scene object type.", mClassName );
+        return;
+    }
+
+    // Create the replica.
+    ConsoleObject* pObject = pClassRep->create();
+    SceneObject* pReplica = dynamic_cast<SceneObject*>( pObject );
+    if ( pReplica == NULL )
+    {
+        // Warn.
+        Con::warnf( "SceneObjectGhost::createReplica() - Could not create a scene object of type '%s'.", mClassName );
+        delete pObject;
+        return;
+    }
+
+    // Register the replica.
+    if ( !pReplica->registerObject() )
+    {
+        // Warn.
+        Con::warnf( "SceneObjectGhost::createReplica() - Could not register a scene object of type '%s'.", mClassName );
+        delete pReplica;
+        return;
+    }
+
+    // The replica is driven by the server state.
+    pReplica->setBodyType( b2_kinematicBody );
+
+    // Start at the latest server transform.
+    if ( mSnapshotCount > 0 )
+    {
+        const TransformSnapshot& snapshot = mSnapshots[mSnapshotCount-1];
+        pReplica->setPosition( snapshot.mPosition );
+        pReplica->setAngle( snapshot.mAngle );
+    }
+
+    mReplica = pReplica;
+
+    // Add to the client scene.
+    pScene->addReplica( pReplica, this );
+
+    // Apply the state received so far.
+    applyPendingState();
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObjectGhost::applyPendingState( void )
+{
+    // Fetch the replica.
+    SceneObject* pReplica = mReplica;
+
+    // Finish if no replica.
+    if ( pReplica == NULL )
+        return;
+
+    // Apply the state.
+    if ( mStateDirty )
+    {
+        pReplica->setVisible( mVisible );
+        pReplica->setSceneLayer( mSceneLayer );
+        pReplica->setSize( mSize );
+        mStateDirty = false;
+    }
+
+    // Apply the fields.
+    for ( S32 n = 0; n < mPendingFields.size(); ++n )
+    {
+        PendingField& pendingField = mPendingFields[n];
+        pReplica->setDataField( pendingField.mFieldName, NULL, pendingField.mpValue );
+        dFree( pendingField.mpValue );
+    }
+
+    mPendingFields.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObjectGhost::pushSnapshot( const F32 time, const Vector2& position, const F32 angle )
+{
+    if ( mSnapshotCount > 0 )
+    {
+        const TransformSnapshot lastSnapshot = mSnapshots[mSnapshotCount-1];
+
+        // Ignore stale snapshots.
+        if ( time <= lastSnapshot.mTime )
+            return;
+
+        // Restart the snapshots after a gap in the updates.
+        // NOTE: The last transform is held until just before the new one so the replica doesn't crawl across the gap.
+        if ( time - lastSnapshot.mTime > replicationSnapshotGap )
+        {
+            mSnapshots[0] = lastSnapshot;
+            mSnapshots[0].mTime = time - Tickable::smTickSec;
+            mSnapshotCount = 1;
+        }
+    }
+
+    // Drop the oldest snapshot if full.
+    if ( mSnapshotCount == SnapshotCount )
+    {
+        dMemmove( mSnapshots, mSnapshots + 1, sizeof(TransformSnapshot) * (SnapshotCount-1) );
+        mSnapshotCount--;
+    }
+
+    TransformSnapshot& snapshot = mSnapshots[mSnapshotCount++];
+    snapshot.mTime = time;
+    snapshot.mPosition = position;
+    snapshot.mAngle = angle;
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObjectGhost::sampleSnapshots( const F32 time, Vector2& position, F32& angle ) const
+{
+    // Hold before the first snapshot.
+    if ( time <= mSnapshots[0].mTime )
+    {
+        position = mSnapshots[0].mPosition;
+        angle = mSnapshots[0].mAngle;
+        return;
+    }
+
+    // Interpolate between the snapshots either side of the time.
+    for ( U32 n = 1; n < mSnapshotCount; ++n )
+    {
+        const TransformSnapshot& nextSnapshot = mSnapshots[n];
+
+        if ( time > nextSnapshot.mTime )
+            continue;
+
+        const TransformSnapshot& previousSnapshot = mSnapshots[n-1];
+        const F32 fraction = (time - previousSnapshot.mTime) / (nextSnapshot.mTime - previousSnapshot.mTime);
+        position = previousSnapshot.mPosition + (nextSnapshot.mPosition - previousSnapshot.mPosition) * fraction;
+        angle = previousSnapshot.mAngle + wrapAngleDelta( nextSnapshot.mAngle - previousSnapshot.mAngle ) * fraction;
+        return;
+    }
+
+    // Extrapolate past the last snapshot using the replicated velocities.
+    const TransformSnapshot& lastSnapshot = mSnapshots[mSnapshotCount-1];
+    const F32 extrapolation = getMin( time - lastSnapshot.mTime, replicationMaxExtrapolation );
+    const Vector2 linearVelocity( (F32)mLinearVelocity[0] / replicationVelocityScale, (F32)mLinearVelocity[1] / replicationVelocityScale );
+    position = lastSnapshot.mPosition + linearVelocity * extrapolation;
+    angle = lastSnapshot.mAngle + ((F32)mAngularVelocity / replicationVelocityScale) * extrapolation;
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObjectGhost::driveReplica( const F32 renderTime, const F32 timeDelta )
+{
+    // Fetch the replica.
+    SceneObject* pReplica = mReplica;
+
+    // Finish if no replica or transform.
+    if ( pReplica == NULL || mSnapshotCount == 0 )
+        return;
+
+    // Sample where the replica should be at the end of the tick.
+    Vector2 targetPosition;
+    F32 targetAngle;
+    sampleSnapshots( renderTime + timeDelta, targetPosition, targetAngle );
+
+    // Fetch the offsets to the target.
+    const Vector2 positionOffset = targetPosition - pReplica->getPosition();
+    const F32 angleOffset = wrapAngleDelta( targetAngle - pReplica->getAngle() );
+
+    // Move directly if the physics can't cover the offset in a single step.
+    if ( positionOffset.LengthSquared() > b2_maxTranslationSquared || mFabs( angleOffset ) > b2_maxRotation )
+    {
+        pReplica->setPosition( targetPosition );
+        pReplica->setAngle( targetAngle );
+        pReplica->setLinearVelocity( Vector2::getZero() );
+        pReplica->setAngularVelocity( 0.0f );
+        return;
+    }
+
+    // Drive the kinematic body to the target so the tick interpolation stays smooth.
+    const F32 inverseTimeDelta = 1.0f / timeDelta;
+    pReplica->setLinearVelocity( positionOffset * inverseTimeDelta );
+    pReplica->setAngularVelocity( angleOffset * inverseTimeDelta );
+}
+
+//-----------------------------------------------------------------------------
+
+SceneReplicationScope::SceneReplicationScope() :
+    mCameraPosition( 0.0f, 0.0f ),
+    mViewDistance( 100.0f ),
+    mBitsSent( 0 ),
+    mPeriodBits( 0 ),
+    mPeriodStart( 0 ),
+    mBandwidth( 0.0f ),
+    mScopedCount( 0 )
+{
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneReplicationScope::addBitsSent( const U32 bits )
+{
+    mBitsSent += bits;
+    mPeriodBits += bits;
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneReplicationScope::onCameraScopeQuery( NetConnection* pConnection, CameraScopeQuery* pCameraInfo )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneReplicationScope_OnCameraScopeQuery);
+
+    // Set the camera.
+    pCameraInfo->camera = this;
+    pCameraInfo->pos.set( mCameraPosition.x, mCameraPosition.y, 0.0f );
+    pCameraInfo->visibleDistance = mViewDistance;
+
+    // Update the bandwidth once per period.
+    const U32 currentTime = Platform::getRealMilliseconds();
+    const U32 elapsedTime = currentTime - mPeriodStart;
+    if ( elapsedTime >= BandwidthPeriod )
+    {
+        mBandwidth = mPeriodStart == 0 ? 0.0f : ((F32)mPeriodBits * 0.125f) * 1000.0f / (F32)elapsedTime;
+        mPeriodBits = 0;
+        mPeriodStart = currentTime;
+    }
+
+    mScopedCount = 0;
+
+    // Fetch the scene.
+    Scene* pScene = mScene;
+
+    // Finish if no scene.
+    if ( pScene == NULL )
+        return;
+
+    // Scope the replicated objects within the view distance of the camera.
+    mScopedCount = pScene->getInterestGrid().scopeObjects( pConnection, Point2F( mCameraPosition.x, mCameraPosition.y ), mViewDistance, MaxScopedGhosts );
+}
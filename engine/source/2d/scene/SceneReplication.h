@@ -0,0 +1,196 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCENE_REPLICATION_H_
+#define _SCENE_REPLICATION_H_
+
+#ifndef _NETOBJECT_H_
+#include "network/netObject.h"
+#endif
+
+#ifndef _SCENE_OBJECT_H_
+#include "2d/sceneobject/SceneObject.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// Ghosts a scene object from a server scene to the clients.
+/// Scene objects cannot be ghosted themselves so a server scene in replication mode
+/// creates one of these for each of its scene objects.  The state is quantized and
+/// only the parts that changed (per the dirty mask) are sent.  On the client the ghost
+/// creates a kinematic replica in the client scene and drives it through a short
+/// buffer of server snapshots so that it moves smoothly.
+/// The replica class comes from the server and must be a scene object type.
+/// Only one scene per process receives replication (see Scene::ReplicationClientScene).
+class SceneObjectGhost : public NetObject
+{
+    typedef NetObject Parent;
+
+public:
+    enum MaskBits
+    {
+        InitialMask     = BIT(0),
+        TransformMask   = BIT(1),
+        VelocityMask    = BIT(2),
+        StateMask       = BIT(3),
+        FieldMaskShift  = 4,
+        FieldMask       = ~(BIT(FieldMaskShift)-1),
+    };
+
+    enum Quantization
+    {
+        MaxFields       = 32 - FieldMaskShift,
+        FieldCountBits  = 5,
+        PositionBits    = 28,
+        AngleBits       = 14,
+        VelocityBits    = 20,
+        LayerBits       = 5,
+        SnapshotCount   = 4,
+    };
+
+public:
+    SceneObjectGhost();
+    virtual ~SceneObjectGhost();
+
+    virtual bool onAdd();
+    virtual void onRemove();
+
+    /// Server.
+    void            setSceneObject( SceneObject* pSceneObject );
+    inline SceneObject* getSceneObject( void ) const                    { return mpSceneObject; }
+    void            updateDirtyState( const Vector<StringTableEntry>& fields );
+    void            getInterestBounds( Point2F& center, F32& radius ) const;
+    inline void     setInterestProxy( const S32 proxyId )               { mInterestProxy = proxyId; }
+    inline S32      getInterestProxy( void ) const                      { return mInterestProxy; }
+
+    /// Client.
+    inline SceneObject* getReplica( void ) const                        { return mReplica; }
+    void            driveReplica( const F32 renderTime, const F32 timeDelta );
+
+    /// Networking.
+    virtual F32     getUpdatePriority( CameraScopeQuery* pFocusObject, U32 updateMask, S32 updateSkips );
+    virtual U32     packUpdate( NetConnection* pConnection, U32 mask, BitStream* pStream );
+    virtual void    unpackUpdate( NetConnection* pConnection, BitStream* pStream );
+
+    /// Declare Console Object.
+    DECLARE_CONOBJECT( SceneObjectGhost );
+
+private:
+    struct TransformSnapshot
+    {
+        F32     mTime;
+        Vector2 mPosition;
+        F32     mAngle;
+    };
+
+    struct PendingField
+    {
+        StringTableEntry    mFieldName;
+        char*               mpValue;
+    };
+
+    void            createReplica( void );
+    void            applyPendingState( void );
+    void            pushSnapshot( const F32 time, const Vector2& position, const F32 angle );
+    void            sampleSnapshots( const F32 time, Vector2& position, F32& angle ) const;
+
+private:
+    /// Server.
+    SceneObject*                mpSceneObject;
+    StringTableEntry            mClassName;
+    Vector<StringTableEntry>    mFieldNames;
+    Vector<U32>                 mFieldHashes;
+    S32                         mInterestProxy;
+
+    /// Quantized state shared by the server and client.
+    F32                         mTransformTime;
+    S32                         mPosition[2];
+    U32                         mAngle;
+    S32                         mLinearVelocity[2];
+    S32                         mAngularVelocity;
+    bool                        mVisible;
+    U32                         mSceneLayer;
+    Vector2                     mSize;
+
+    /// Client.
+    SimObjectPtr<SceneObject>   mReplica;
+    TransformSnapshot           mSnapshots[SnapshotCount];
+    U32                         mSnapshotCount;
+    bool                        mStateDirty;
+    Vector<PendingField>        mPendingFields;
+};
+
+//-----------------------------------------------------------------------------
+
+/// The scope object for a connection receiving a replicated scene.
+/// It holds the client camera used to scope and prioritize the ghosts and
+/// measures the replication bandwidth used by the connection.
+class SceneReplicationScope : public NetObject
+{
+    typedef NetObject Parent;
+
+public:
+    enum
+    {
+        MaxScopedGhosts = 3840,     ///< Leaves room for other ghosts on the connection.
+        BandwidthPeriod = 1000,     ///< Milliseconds.
+    };
+
+public:
+    SceneReplicationScope();
+    virtual ~SceneReplicationScope() {}
+
+    /// Scene.
+    inline void     setScene( Scene* pScene )                           { mScene = pScene; }
+    inline Scene*   getScene( void ) const                              { return mScene; }
+
+    /// Camera.
+    inline void     setCameraPosition( const Vector2& position )        { mCameraPosition = position; }
+    inline const Vector2& getCameraPosition( void ) const               { return mCameraPosition; }
+    inline void     setViewDistance( const F32 distance )               { mViewDistance = distance; }
+    inline F32      getViewDistance( void ) const                       { return mViewDistance; }
+
+    /// Metrics.
+    void            addBitsSent( const U32 bits );
+    inline U32      getBytesSent( void ) const                          { return (U32)(mBitsSent >> 3); }
+    inline F32      getBandwidth( void ) const                          { return mBandwidth; }
+    inline U32      getScopedCount( void ) const                        { return mScopedCount; }
+
+    virtual void    onCameraScopeQuery( NetConnection* pConnection, CameraScopeQuery* pCameraInfo );
+
+    /// Declare Console Object.
+    DECLARE_CONOBJECT( SceneReplicationScope );
+
+private:
+    SimObjectPtr<Scene>         mScene;
+    Vector2                     mCameraPosition;
+    F32                         mViewDistance;
+
+    /// Metrics.
+    U64                         mBitsSent;
+    U32                         mPeriodBits;
+    U32                         mPeriodStart;
+    F32                         mBandwidth;
+    U32                         mScopedCount;
+};
+
+#endif // _SCENE_REPLICATION_H_
@@ -0,0 +1,99 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(SceneReplicationScope, setCameraPosition, void, 3, 4, "(float x, float y) Sets the client camera position used to scope and prioritize the replicated objects.\n"
+                                                                    "@param x The horizontal position of the camera.\n"
+                                                                    "@param y The vertical position of the camera.\n"
+                                                                    "@return No return value.")
+{
+    // The new position.
+    Vector2 position;
+
+    // Elements in the first argument.
+    U32 elementCount = Utility::mGetStringElementCount(argv[2]);
+
+    // ("x y")
+    if ((elementCount == 2) && (argc == 3))
+        position = Utility::mGetStringElementVector(argv[2]);
+
+    // (x, y)
+    else if ((elementCount == 1) && (argc == 4))
+        position.Set(dAtof(argv[2]), dAtof(argv[3]));
+
+    // Invalid
+    else
+    {
+        Con::warnf("SceneReplicationScope::setCameraPosition() - Invalid number of parameters!");
+        return;
+    }
+
+    object->setCameraPosition( position );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(SceneReplicationScope, getCameraPosition, const char*, 2, 2, "() Gets the client camera position.\n"
+                                                                            "@return (float x/float y) The position of the camera.")
+{
+    return object->getCameraPosition().scriptThis();
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(SceneReplicationScope, setViewDistance, void, 3, 3,  "(distance) Sets the distance from the camera within which objects are replicated.\n"
+                                                                    "@param distance The view distance in world units.\n"
+                                                                    "@return No return value.")
+{
+    object->setViewDistance( dAtof(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(SceneReplicationScope, getViewDistance, F32, 2, 2,   "() Gets the distance from the camera within which objects are replicated.\n"
+                                                                    "@return The view distance in world units.")
+{
+    return object->getViewDistance();
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(SceneReplicationScope, getBandwidth, F32, 2, 2,      "() Gets the replication bandwidth used by the connection over the last second.\n"
+                                                                    "@return The bandwidth in bytes per second.")
+{
+    return object->getBandwidth();
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(SceneReplicationScope, getBytesSent, S32, 2, 2,      "() Gets the total replication data sent to the connection.\n"
+                                                                    "@return The total bytes sent.")
+{
+    return object->getBytesSent();
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(SceneReplicationScope, getScopedCount, S32, 2, 2,    "() Gets the number of replicated objects in scope for the connection.\n"
+                                                                    "@return The number of objects in scope.")
+{
+    return object->getScopedCount();
+}
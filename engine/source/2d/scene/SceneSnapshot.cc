@@ -0,0 +1,317 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCENE_SNAPSHOT_H_
+#include "2d/scene/SceneSnapshot.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _SCENE_OBJECT_H_
+#include "2d/sceneobject/SceneObject.h"
+#endif
+
+#ifndef _SCENE_POOL_H_
+#include "2d/scene/ScenePool.h"
+#endif
+
+#ifndef _STRINGUNIT_H_
+#include "string/stringUnit.h"
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+static const char* snapshotFieldSeparators = " \t\n";
+
+//-----------------------------------------------------------------------------
+
+SceneSnapshot::SceneSnapshot()
+{
+    // Set Vector Associations.
+    VECTOR_SET_ASSOCIATION( mObjectStates );
+    VECTOR_SET_ASSOCIATION( mFields );
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneSnapshot::clear( void )
+{
+    mObjectStates.clear();
+    mObjectIndex.clear();
+    mFields.clear();
+    mFieldData.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneSnapshot::capture( Scene* pScene, const char* pFields )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneSnapshot_Capture);
+
+    // Sanity!
+    AssertFatal( pScene != NULL, "SceneSnapshot::capture() - Cannot capture a NULL scene." );
+
+    // Reset the snapshot.
+    clear();
+
+    // Fetch the selected fields.
+    if ( pFields != NULL )
+    {
+        const U32 fieldCount = StringUnit::getUnitCount( pFields, snapshotFieldSeparators );
+        for ( U32 n = 0; n < fieldCount; ++n )
+        {
+            mFields.push_back( StringUnit::getStringTableUnit( pFields, n, snapshotFieldSeparators ) );
+        }
+    }
+
+    // Fetch the scene objects.
+    typeSceneObjectVectorConstRef sceneObjects = pScene->getSceneObjects();
+    const U32 sceneObjectCount = sceneObjects.size();
+
+    mObjectStates.reserve( sceneObjectCount );
+
+    // Capture the scene objects.
+    for ( U32 n = 0; n < sceneObjectCount; ++n )
+    {
+        SceneObject* pSceneObject = sceneObjects[n];
+
+        // Skip objects parked in a pool as the pool owns them.
+        if ( pSceneObject->getIsPooled() )
+            continue;
+
+        mObjectStates.increment();
+        ObjectState& objectState = mObjectStates.last();
+
+        objectState.mObjectId = pSceneObject->getId();
+        objectState.mClassName = pSceneObject->getClassName();
+        objectState.mObjectName = pSceneObject->getName();
+        objectState.mSize = pSceneObject->getSize();
+        objectState.mBodyType = (U32)pSceneObject->getBodyType();
+        objectState.mSceneLayer = pSceneObject->getSceneLayer();
+        objectState.mSceneGroup = pSceneObject->getSceneGroup();
+        objectState.mPosition = pSceneObject->getPosition();
+        objectState.mAngle = pSceneObject->getAngle();
+        objectState.mLinearVelocity = pSceneObject->getLinearVelocity();
+        objectState.mAngularVelocity = pSceneObject->getAngularVelocity();
+        objectState.mFlags =
+            (pSceneObject->isEnabled() ? OBJECT_ENABLED : 0) |
+            (pSceneObject->getVisible() ? OBJECT_VISIBLE : 0) |
+            (pSceneObject->getAwake() ? OBJECT_AWAKE : 0) |
+            (pSceneObject->getActive() ? OBJECT_ACTIVE : 0);
+        objectState.mFieldOffset = mFieldData.getBufferSize();
+
+        // Capture the selected fields.
+        captureFields( pSceneObject );
+
+        mObjectIndex.insert( objectState.mObjectId, mObjectStates.size() - 1 );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneSnapshot::captureFields( SceneObject* pSceneObject )
+{
+    // Write each field as its length (including the terminator) followed by the value.
+    for ( U32 n = 0; n < (U32)mFields.size(); ++n )
+    {
+        const char* pValue = pSceneObject->getDataField( mFields[n], NULL );
+        const U32 valueSize = dStrlen( pValue ) + 1;
+
+        mFieldData.write( valueSize );
+        mFieldData.write( valueSize, pValue );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneSnapshot::restore( Scene* pScene )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneSnapshot_Restore);
+
+    // Sanity!
+    AssertFatal( pScene != NULL, "SceneSnapshot::restore() - Cannot restore to a NULL scene." );
+
+    // Remove any scene objects not in the snapshot.
+    // NOTE: The scene objects are copied as removing them reorders the scene.
+    typeSceneObjectVector sceneObjects = pScene->getSceneObjects();
+    for ( S32 n = 0; n < sceneObjects.size(); ++n )
+    {
+        SceneObject* pSceneObject = sceneObjects[n];
+
+        // Skip if in the snapshot or already parked in a pool.
+        if ( mObjectIndex.find( pSceneObject->getId() ) != mObjectIndex.end() || pSceneObject->getIsPooled() )
+            continue;
+
+        // Return pooled objects to their pool.
+        ScenePool* pScenePool = pSceneObject->getScenePool();
+        if ( pScenePool != NULL && pScenePool->release( pSceneObject ) )
+            continue;
+
+        // Remove the object from the scene.
+        pScene->removeFromScene( pSceneObject );
+        pSceneObject->safeDelete();
+    }
+
+    // Restore the snapshot objects.
+    for ( U32 n = 0; n < (U32)mObjectStates.size(); ++n )
+    {
+        ObjectState& objectState = mObjectStates[n];
+
+        // Find the object.
+        SceneObject* pSceneObject = dynamic_cast<SceneObject*>( Sim::findObject( objectState.mObjectId ) );
+
+        // Does the object still exist?
+        if ( pSceneObject != NULL )
+        {
+            // Yes, so take it back out of its pool if it was released.
+            if ( pSceneObject->getIsPooled() )
+                pSceneObject->getScenePool()->reclaim( pSceneObject );
+
+            // Add it back to the scene if it was removed.
+            if ( pSceneObject->getScene() != pScene )
+                pScene->addToScene( pSceneObject );
+        }
+        else
+        {
+            // No, so recreate the object.
+            pSceneObject = recreateObject( pScene, objectState );
+
+            // Finish if the object could not be recreated.
+            if ( pSceneObject == NULL )
+            {
+                // Warn.
+                Con::warnf( "SceneSnapshot::restore() - Could not recreate object '%d'.", objectState.mObjectId );
+                continue;
+            }
+
+            // Track the recreated object.
+            mObjectIndex.erase( objectState.mObjectId );
+            objectState.mObjectId = pSceneObject->getId();
+            mObjectIndex.insert( objectState.mObjectId, n );
+        }
+
+        // Patch the object state.
+        patchObject( pSceneObject, objectState );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+SceneObject* SceneSnapshot::recreateObject( Scene* pScene, const ObjectState& objectState )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneSnapshot_RecreateObject);
+
+    // Create the object.
+    ConsoleObject* pConsoleObject = ConsoleObject::create( objectState.mClassName );
+
+    // Finish if not a scene object.
+    SceneObject* pSceneObject = dynamic_cast<SceneObject*>( pConsoleObject );
+    if ( pSceneObject == NULL )
+    {
+        delete pConsoleObject;
+        return NULL;
+    }
+
+    // Finish if the object cannot be registered.
+    if ( !pSceneObject->registerObject() )
+    {
+        delete pSceneObject;
+        return NULL;
+    }
+
+    // Restore the name if it's not been taken since.
+    if ( objectState.mObjectName != NULL && Sim::findObject( objectState.mObjectName ) == NULL )
+        pSceneObject->assignName( objectState.mObjectName );
+
+    // Restore the state that isn't patched.
+    pSceneObject->setSize( objectState.mSize );
+    pSceneObject->setBodyType( (b2BodyType)objectState.mBodyType );
+    pSceneObject->setSceneLayer( objectState.mSceneLayer );
+    pSceneObject->setSceneGroup( objectState.mSceneGroup );
+
+    // Add to the scene.
+    pScene->addToScene( pSceneObject );
+
+    return pSceneObject;
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneSnapshot::patchObject( SceneObject* pSceneObject, const ObjectState& objectState )
+{
+    // Patch the enabled state first as it can change the body state.
+    const bool enabled = (objectState.mFlags & OBJECT_ENABLED) != 0;
+    if ( pSceneObject->isEnabled() != enabled )
+        pSceneObject->setEnabled( enabled );
+
+    // Patch the transform.
+    if ( pSceneObject->getPosition() != objectState.mPosition )
+        pSceneObject->setPosition( objectState.mPosition );
+
+    if ( pSceneObject->getAngle() != objectState.mAngle )
+        pSceneObject->setAngle( objectState.mAngle );
+
+    // Patch the velocities.
+    if ( pSceneObject->getLinearVelocity() != objectState.mLinearVelocity )
+        pSceneObject->setLinearVelocity( objectState.mLinearVelocity );
+
+    if ( pSceneObject->getAngularVelocity() != objectState.mAngularVelocity )
+        pSceneObject->setAngularVelocity( objectState.mAngularVelocity );
+
+    // Patch the body state.
+    // NOTE: Awake is patched last as setting the velocities wakes the body.
+    const bool visible = (objectState.mFlags & OBJECT_VISIBLE) != 0;
+    if ( pSceneObject->getVisible() != visible )
+        pSceneObject->setVisible( visible );
+
+    const bool active = (objectState.mFlags & OBJECT_ACTIVE) != 0;
+    if ( pSceneObject->getActive() != active )
+        pSceneObject->setActive( active );
+
+    const bool awake = (objectState.mFlags & OBJECT_AWAKE) != 0;
+    if ( pSceneObject->getAwake() != awake )
+        pSceneObject->setAwake( awake );
+
+    // Patch the selected fields.
+    const U8* pFieldData = mFieldData.getBuffer() + objectState.mFieldOffset;
+    for ( U32 n = 0; n < (U32)mFields.size(); ++n )
+    {
+        U32 valueSize;
+        dMemcpy( &valueSize, pFieldData, sizeof(valueSize) );
+        const char* pValue = (const char*)(pFieldData + sizeof(valueSize));
+        pFieldData += sizeof(valueSize) + valueSize;
+
+        // Skip if unchanged.
+        if ( dStrcmp( pSceneObject->getDataField( mFields[n], NULL ), pValue ) == 0 )
+            continue;
+
+        pSceneObject->setDataField( mFields[n], NULL, pValue );
+    }
+}
@@ -0,0 +1,119 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCENE_SNAPSHOT_H_
+#define _SCENE_SNAPSHOT_H_
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
+#ifndef _GROWABLE_MEMSTREAM_H_
+#include "io/growableMemStream.h"
+#endif
+
+#ifndef _VECTOR2_H_
+#include "2d/core/Vector2.h"
+#endif
+
+#ifndef _SIM_OBJECT_H_
+#include "sim/simObject.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class Scene;
+class SceneObject;
+
+//-----------------------------------------------------------------------------
+
+/// An in-memory snapshot of the scene object state.
+/// Capturing records the class, name, size, layer, group, transform, velocities, body flags
+/// and any selected fields of every scene object into a compact packed buffer.  Restoring
+/// patches the objects that still exist in-place and only removes or recreates those that differ.
+/// Deleted objects are recreated from the captured state alone so any other state they need,
+/// such as an image or behaviors, must be included in the selected fields.
+/// Objects parked in a scene pool are not captured; restoring takes pooled objects
+/// back out of their pool or returns them to it as needed.
+class SceneSnapshot
+{
+public:
+    enum ObjectFlags
+    {
+        OBJECT_ENABLED  = BIT(0),
+        OBJECT_VISIBLE  = BIT(1),
+        OBJECT_AWAKE    = BIT(2),
+        OBJECT_ACTIVE   = BIT(3),
+    };
+
+    struct ObjectState
+    {
+        SimObjectId     mObjectId;
+        const char*     mClassName;
+        StringTableEntry mObjectName;
+        Vector2         mSize;
+        U32             mBodyType;
+        U32             mSceneLayer;
+        U32             mSceneGroup;
+        Vector2         mPosition;
+        F32             mAngle;
+        Vector2         mLinearVelocity;
+        F32             mAngularVelocity;
+        U32             mFlags;
+        U32             mFieldOffset;
+    };
+
+    typedef Vector<ObjectState>             typeObjectStateVector;
+    typedef HashMap<SimObjectId, U32>       typeObjectIndexHash;
+    typedef Vector<StringTableEntry>        typeFieldVector;
+
+public:
+    SceneSnapshot();
+    virtual ~SceneSnapshot() {}
+
+    /// Capture and restore.
+    void            capture( Scene* pScene, const char* pFields = NULL );
+    void            restore( Scene* pScene );
+    void            clear( void );
+
+    inline U32      getObjectCount( void ) const                        { return mObjectStates.size(); }
+    inline U32      getMemorySize( void ) const                         { return mObjectStates.memSize() + mFieldData.getBufferSize(); }
+
+private:
+    void            captureFields( SceneObject* pSceneObject );
+    void            patchObject( SceneObject* pSceneObject, const ObjectState& objectState );
+    SceneObject*    recreateObject( Scene* pScene, const ObjectState& objectState );
+
+private:
+    typeObjectStateVector   mObjectStates;
+    typeObjectIndexHash     mObjectIndex;
+    typeFieldVector         mFields;
+
+    /// Packed field values.
+    GrowableMemStream       mFieldData;
+};
+
+#endif // _SCENE_SNAPSHOT_H_
@@ -0,0 +1,127 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCENE_TICK_STATE_H_
+#define _SCENE_TICK_STATE_H_
+
+#ifndef BOX2D_H
+#include "box2d/Box2D.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class SceneObject;
+
+//-----------------------------------------------------------------------------
+
+/// Packed mirror of the per-object state the scene touches every tick.
+/// Each column is indexed identically to the scenes object list so the tick
+/// loops can walk flat arrays instead of dereferencing every scene object.
+class SceneTickState
+{
+public:
+    enum TickFlags
+    {
+        TICK_NONE               = 0,
+        ///
+        TICK_ENABLED            = BIT(0),
+        TICK_VISIBLE            = BIT(1),
+        TICK_BEING_DELETED      = BIT(2),
+        TICK_CUSTOM_INTEGRATION = BIT(3),   ///< Object overrides the integration stages so must be called virtually.
+        TICK_SPATIAL_DIRTY      = BIT(4),   ///< Object moved during the last tick.
+        TICK_INTEGRATE          = BIT(5),   ///< Object needs integration even when not moving (lifetime, GUI or camera attachment).
+        TICK_POST_INTEGRATE     = BIT(6),   ///< Object needs post-integration (components or script callbacks).
+        TICK_ATTACHED           = BIT(7),   ///< Object has a GUI or camera attached so needs interpolating every frame.
+        TICK_INTERPOLATE_QUEUED = BIT(8),   ///< Object is in the scenes interpolation set.
+        TICK_THREAD_SAFE        = BIT(9),   ///< Object can be integrated on the job pool.
+        TICK_DEFERRED_UPDATE    = BIT(10),  ///< Object moved on the job pool and awaits its world proxy update.
+        TICK_POOLED             = BIT(11),  ///< Object is parked in a scene pool so is skipped entirely.
+
+        /// Flags owned by the scene rather than the object.
+        TICK_SCENE_FLAGS        = TICK_INTERPOLATE_QUEUED | TICK_DEFERRED_UPDATE,
+    };
+
+public:
+    SceneTickState()
+    {
+        VECTOR_SET_ASSOCIATION( mBodies );
+        VECTOR_SET_ASSOCIATION( mFlags );
+        VECTOR_SET_ASSOCIATION( mPreTickPositions );
+        VECTOR_SET_ASSOCIATION( mPreTickAngles );
+    }
+
+    inline U32      size( void ) const                                  { return (U32)mFlags.size(); }
+
+    inline void     push_back( void )
+    {
+        mBodies.push_back( NULL );
+        mFlags.push_back( TICK_NONE );
+        mPreTickPositions.push_back( b2Vec2_zero );
+        mPreTickAngles.push_back( 0.0f );
+    }
+
+    inline void     erase_fast( const U32 index )
+    {
+        mBodies.erase_fast( index );
+        mFlags.erase_fast( index );
+        mPreTickPositions.erase_fast( index );
+        mPreTickAngles.erase_fast( index );
+    }
+
+    inline void     clear( void )
+    {
+        mBodies.clear();
+        mFlags.clear();
+        mPreTickPositions.clear();
+        mPreTickAngles.clear();
+    }
+
+    inline void     setBody( const U32 index, b2Body* pBody )           { mBodies[index] = pBody; }
+    inline b2Body*  getBody( const U32 index ) const                    { return mBodies[index]; }
+
+    inline void     setFlags( const U32 index, const U32 flags )        { mFlags[index] = flags | (mFlags[index] & TICK_SCENE_FLAGS); }
+    inline U32      getFlags( const U32 index ) const                   { return mFlags[index]; }
+    inline void     setFlag( const U32 index, const U32 flag, const bool status ) { if ( status ) mFlags[index] |= flag; else mFlags[index] &= ~flag; }
+
+    inline void     setPreTick( const U32 index, const b2Vec2& position, const F32 angle ) { mPreTickPositions[index] = position; mPreTickAngles[index] = angle; }
+
+    /// Whether the body has moved since the pre-tick transform was captured.
+    inline bool     getMoved( const U32 index ) const
+    {
+        const b2Body* pBody = mBodies[index];
+        const b2Vec2& position = pBody->GetPosition();
+        const b2Vec2& preTickPosition = mPreTickPositions[index];
+        return pBody->GetAngle() != mPreTickAngles[index] || position.x != preTickPosition.x || position.y != preTickPosition.y;
+    }
+
+public:
+    Vector<b2Body*>     mBodies;
+    Vector<U32>         mFlags;
+    Vector<b2Vec2>      mPreTickPositions;
+    Vector<F32>         mPreTickAngles;
+};
+
+#endif // _SCENE_TICK_STATE_H_
@@ -3362,6 +3362,180 @@ ConsoleMethod(Scene, getBatchingEnabled, bool, 2, 2,    "() Gets whether render
 
 //-----------------------------------------------------------------------------
 
+ConsoleMethod(Scene, setParallelTick, void, 3, 3,    "( bool parallelTick ) Sets whether thread-safe objects are integrated in parallel on the job pool.\n"
+                                                            "Objects using lifetimes, attachments, behaviors or script callbacks are always integrated on the main thread.\n"
+                                                            "@param parallelTick Whether thread-safe objects are integrated in parallel or not.\n"
+                                                            "@return No return value.\n" )
+{
+    // Fetch args.
+    const bool parallelTick = dAtob(argv[2]);
+
+    // Sets parallel tick.
+    object->setParallelTick( parallelTick );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(Scene, getParallelTick, bool, 2, 2,    "() Gets whether thread-safe objects are integrated in parallel on the job pool.\n"
+                                                            "@return Whether thread-safe objects are integrated in parallel or not.\n" )
+{
+    // Gets parallel tick.
+    return object->getParallelTick();
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(Scene, setSpatialHash, void, 3, 3,      "( bool spatialHash ) Sets whether all objects are indexed by the spatial hash rather than the dynamic tree.\n"
+                                                            "Objects can also choose the spatial hash individually with SceneObject::setSpatialHash().\n"
+                                                            "@param spatialHash Whether all objects are indexed by the spatial hash or not.\n"
+                                                            "@return No return value.\n" )
+{
+    object->setSpatialHash( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(Scene, getSpatialHash, bool, 2, 2,      "() Gets whether all objects are indexed by the spatial hash rather than the dynamic tree.\n"
+                                                            "@return Whether all objects are indexed by the spatial hash or not.\n" )
+{
+    return object->getSpatialHash();
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(Scene, setSpatialHashCellSize, void, 3, 3,  "( float cellSize ) Sets the size of each spatial hash cell in world units.\n"
+                                                            "Cells around the size of the typical hashed object work best.\n"
+                                                            "@param cellSize The size of each cell in world units.\n"
+                                                            "@return No return value.\n" )
+{
+    object->setSpatialHashCellSize( dAtof(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(Scene, getSpatialHashCellSize, F32, 2, 2,  "() Gets the size of each spatial hash cell in world units.\n"
+                                                            "@return The size of each cell in world units.\n" )
+{
+    return object->getSpatialHashCellSize();
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(Scene, saveSnapshot, S32, 3, 4,        "(snapshotName, [fields]) Captures the state of all scene objects into a named in-memory snapshot.\n"
+                                                            "The class, name, size, layer, group, transform, velocities and body state are always captured.  Any existing snapshot with the same name is replaced.\n"
+                                                            "@param snapshotName The name of the snapshot.\n"
+                                                            "@param fields An optional space-separated list of extra fields to capture.\n"
+                                                            "@return The size of the snapshot in bytes.\n" )
+{
+    return object->saveSnapshot( argv[2], argc > 3 ? argv[3] : NULL );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(Scene, restoreSnapshot, bool, 3, 3,     "(snapshotName) Restores the scene to a named snapshot.\n"
+                                                            "Existing objects are patched in-place, objects added since the snapshot are deleted and deleted objects are recreated.\n"
+                                                            "Recreated objects are assigned new Ids and only have the state that was captured.\n"
+                                                            "@param snapshotName The name of the snapshot.\n"
+                                                            "@return Whether the snapshot was restored or not.\n" )
+{
+    return object->restoreSnapshot( argv[2] );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(Scene, deleteSnapshot, bool, 3, 3,      "(snapshotName) Deletes a named snapshot.\n"
+                                                            "@param snapshotName The name of the snapshot.\n"
+                                                            "@return Whether the snapshot was deleted or not.\n" )
+{
+    return object->deleteSnapshot( argv[2] );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(Scene, setReplicationMode, void, 3, 3,  "(mode) Sets how the scene takes part in replication.\n"
+                                                            "A 'Server' scene ghosts its scene objects to the connections it replicates to.\n"
+                                                            "A 'Client' scene receives the ghosted objects as replicas.  Only a single scene per process can be a client so it receives every replicated scene and setting another scene as the client stops it.\n"
+                                                            "@param mode The replication mode of 'None', 'Server' or 'Client'.\n"
+                                                            "@return No return value.\n" )
+{
+    // Fetch the replication mode.
+    const Scene::ReplicationMode replicationMode = Scene::getReplicationModeEnum( argv[2] );
+
+    // Finish if invalid.
+    if ( replicationMode == Scene::REPLICATION_INVALID )
+        return;
+
+    object->setReplicationMode( replicationMode );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(Scene, getReplicationMode, const char*, 2, 2,  "() Gets how the scene takes part in replication.\n"
+                                                            "@return The replication mode of 'None', 'Server' or 'Client'.\n" )
+{
+    return Scene::getReplicationModeDescription( object->getReplicationMode() );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(Scene, setReplicatedFields, void, 3, 3, "(fields) Sets the extra fields replicated along with the transform, velocities and state.\n"
+                                                            "Each field is sent only when its value changes.\n"
+                                                            "@param fields A space-separated list of fields.\n"
+                                                            "@return No return value.\n" )
+{
+    object->setReplicatedFields( argv[2] );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(Scene, getReplicatedFields, const char*, 2, 2, "() Gets the extra fields replicated along with the transform, velocities and state.\n"
+                                                            "@return A space-separated list of fields.\n" )
+{
+    return object->getReplicatedFields();
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(Scene, setReplicationDelay, void, 3, 3, "(delay) Sets how far a client scene renders behind the server so it can interpolate between updates.\n"
+                                                            "@param delay The delay in seconds.\n"
+                                                            "@return No return value.\n" )
+{
+    object->setReplicationDelay( dAtof(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(Scene, getReplicationDelay, F32, 2, 2,  "() Gets how far a client scene renders behind the server.\n"
+                                                            "@return The delay in seconds.\n" )
+{
+    return object->getReplicationDelay();
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(Scene, replicateTo, S32, 3, 3,          "(connection) Starts replicating a server scene to a connection.\n"
+                                                            "@param connection The connection to replicate to.\n"
+                                                            "@return The replication scope used to set the client camera and read the bandwidth, or zero on failure.\n" )
+{
+    // Fetch the connection.
+    NetConnection* pConnection = dynamic_cast<NetConnection*>( Sim::findObject( argv[2] ) );
+
+    // Finish if no connection.
+    if ( pConnection == NULL )
+    {
+        // Warn.
+        Con::warnf( "Scene::replicateTo() - Could not find the connection '%s'.", argv[2] );
+        return 0;
+    }
+
+    // Replicate to the connection.
+    SceneReplicationScope* pScope = object->replicateTo( pConnection );
+
+    return pScope == NULL ? 0 : pScope->getId();
+}
+
+//-----------------------------------------------------------------------------
+
 ConsoleMethod(Scene, setIsEditorScene, void, 3, 3, "() Sets whether this is an editor scene.\n"
                                                             "@return No return value.")
 {
@@ -0,0 +1,194 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "2d/scene/SpatialHash.h"
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+SpatialHash::SpatialHash() :
+    mCellSize( (F32)DefaultCellSize ),
+    mInverseCellSize( 1.0f / (F32)DefaultCellSize ),
+    mDirty( false ),
+    mQueryStamp( 0 ),
+    mBucketMask( 0 )
+{
+    // Set Vector Associations.
+    VECTOR_SET_ASSOCIATION( mProxyObjects );
+    VECTOR_SET_ASSOCIATION( mProxyAABBs );
+    VECTOR_SET_ASSOCIATION( mProxyQueryStamps );
+    VECTOR_SET_ASSOCIATION( mBucketStarts );
+    VECTOR_SET_ASSOCIATION( mBucketCursors );
+    VECTOR_SET_ASSOCIATION( mBucketProxies );
+    VECTOR_SET_ASSOCIATION( mOversizedProxies );
+}
+
+//-----------------------------------------------------------------------------
+
+void SpatialHash::setCellSize( const F32 cellSize )
+{
+    // Sanity!
+    AssertFatal( cellSize > 0.0f, "SpatialHash::setCellSize() - Cell size must be greater than zero." );
+
+    mCellSize = cellSize;
+    mInverseCellSize = 1.0f / cellSize;
+
+    // Flag the cells for a rebuild.
+    mDirty = true;
+}
+
+//-----------------------------------------------------------------------------
+
+S32 SpatialHash::createProxy( SceneObject* pSceneObject, const b2AABB& aabb )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpatialHash_CreateProxy);
+
+    const S32 proxyId = mProxyObjects.size();
+
+    mProxyObjects.push_back( pSceneObject );
+    mProxyAABBs.push_back( aabb );
+    mProxyQueryStamps.push_back( 0 );
+
+    // Flag the cells for a rebuild.
+    mDirty = true;
+
+    return proxyId;
+}
+
+//-----------------------------------------------------------------------------
+
+SceneObject* SpatialHash::destroyProxy( const S32 proxyId )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpatialHash_DestroyProxy);
+
+    // Sanity!
+    AssertFatal( proxyId >= 0 && proxyId < mProxyObjects.size(), "SpatialHash::destroyProxy() - Invalid proxy Id." );
+
+    // Move the last proxy into the slot.
+    mProxyObjects.erase_fast( proxyId );
+    mProxyAABBs.erase_fast( proxyId );
+    mProxyQueryStamps.erase_fast( proxyId );
+
+    // Flag the cells for a rebuild.
+    mDirty = true;
+
+    // Return the object that now owns the proxy Id (if any).
+    return proxyId < mProxyObjects.size() ? mProxyObjects[proxyId] : NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+void SpatialHash::rebuild( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpatialHash_Rebuild);
+
+    const U32 proxyCount = mProxyObjects.size();
+
+    // Size the buckets to the next power-of-two above twice the proxy count.
+    U32 bucketCount = MinBucketCount;
+    while ( bucketCount < proxyCount * 2 )
+        bucketCount <<= 1;
+
+    mBucketMask = bucketCount - 1;
+    mBucketStarts.setSize( bucketCount + 1 );
+    dMemset( mBucketStarts.address(), 0, mBucketStarts.memSize() );
+    mOversizedProxies.clear();
+
+    // Count the cells each proxy covers per bucket.
+    U32 entryCount = 0;
+    for ( U32 proxyId = 0; proxyId < proxyCount; ++proxyId )
+    {
+        const b2AABB& aabb = mProxyAABBs[proxyId];
+        const S32 lowerX = getCell( aabb.lowerBound.x );
+        const S32 lowerY = getCell( aabb.lowerBound.y );
+        const S32 upperX = getCell( aabb.upperBound.x );
+        const S32 upperY = getCell( aabb.upperBound.y );
+
+        // Keep oversized proxies out of the cells.
+        if ( getIsOversized( lowerX, lowerY, upperX, upperY ) )
+        {
+            mOversizedProxies.push_back( proxyId );
+            continue;
+        }
+
+        for ( S32 cellY = lowerY; cellY <= upperY; ++cellY )
+        {
+            for ( S32 cellX = lowerX; cellX <= upperX; ++cellX )
+            {
+                mBucketStarts[getBucket( cellX, cellY ) + 1]++;
+                entryCount++;
+            }
+        }
+    }
+
+    // Convert the counts into bucket starts.
+    for ( U32 bucket = 0; bucket < bucketCount; ++bucket )
+    {
+        mBucketStarts[bucket+1] += mBucketStarts[bucket];
+    }
+
+    // Fill the buckets.
+    mBucketProxies.setSize( entryCount );
+    mBucketCursors.setSize( bucketCount );
+    dMemcpy( mBucketCursors.address(), mBucketStarts.address(), mBucketCursors.memSize() );
+    for ( U32 proxyId = 0; proxyId < proxyCount; ++proxyId )
+    {
+        const b2AABB& aabb = mProxyAABBs[proxyId];
+        const S32 lowerX = getCell( aabb.lowerBound.x );
+        const S32 lowerY = getCell( aabb.lowerBound.y );
+        const S32 upperX = getCell( aabb.upperBound.x );
+        const S32 upperY = getCell( aabb.upperBound.y );
+
+        // Skip oversized proxies.
+        if ( getIsOversized( lowerX, lowerY, upperX, upperY ) )
+            continue;
+
+        for ( S32 cellY = lowerY; cellY <= upperY; ++cellY )
+        {
+            for ( S32 cellX = lowerX; cellX <= upperX; ++cellX )
+            {
+                mBucketProxies[mBucketCursors[getBucket( cellX, cellY )]++] = proxyId;
+            }
+        }
+    }
+
+    mDirty = false;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 SpatialHash::nextQueryStamp( void )
+{
+    // Reset the proxy stamps when the stamp wraps.
+    if ( ++mQueryStamp == 0 )
+    {
+        dMemset( mProxyQueryStamps.address(), 0, mProxyQueryStamps.memSize() );
+        mQueryStamp = 1;
+    }
+
+    return mQueryStamp;
+}
@@ -0,0 +1,267 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SPATIAL_HASH_H_
+#define _SPATIAL_HASH_H_
+
+#ifndef BOX2D_H
+#include "box2d/Box2D.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _MMATHFN_H_
+#include "math/mMathFn.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class SceneObject;
+
+//-----------------------------------------------------------------------------
+
+/// Uniform-grid spatial hash used as an alternative to the dynamic tree for
+/// large numbers of small, fast-moving objects.
+/// Moving a proxy only records its new AABB. The cells are rebuilt in a single
+/// O(n) counting pass the first time the hash is queried after any change so
+/// there is no per-move rebalancing cost.
+class SpatialHash
+{
+public:
+    enum
+    {
+        DefaultCellSize = 4,
+        MinBucketCount = 64,
+        MaxCellSpan = 16,   ///< Proxies spanning more cells than this on either axis are checked by every query.
+        MaxCell = 1 << 24,  ///< Cells are clamped to this on either axis so distant or non-finite bounds cannot overflow.
+    };
+
+public:
+    SpatialHash();
+    virtual ~SpatialHash() {}
+
+    /// Cell size.
+    void            setCellSize( const F32 cellSize );
+    inline F32      getCellSize( void ) const                           { return mCellSize; }
+
+    /// Proxies.
+    S32             createProxy( SceneObject* pSceneObject, const b2AABB& aabb );
+    SceneObject*    destroyProxy( const S32 proxyId );
+    inline void     moveProxy( const S32 proxyId, const b2AABB& aabb )  { mProxyAABBs[proxyId] = aabb; mDirty = true; }
+    inline U32      getProxyCount( void ) const                         { return mProxyObjects.size(); }
+    inline SceneObject* getProxyObject( const S32 proxyId ) const       { return mProxyObjects[proxyId]; }
+
+    /// Report every proxy whose AABB overlaps the AABB.
+    /// The callback is "bool T::QuerySceneObject( SceneObject* )" and returning false stops the query.
+    template <typename T>
+    void            query( T* callback, const b2AABB& aabb );
+
+    /// Report every proxy whose AABB the ray may intersect.
+    /// The callback is "F32 T::RayCastSceneObject( const b2RayCastInput&, SceneObject* )" and returning zero stops the query.
+    template <typename T>
+    void            rayCast( T* callback, const b2RayCastInput& input );
+
+private:
+    template <typename T>
+    struct QueryVisitor
+    {
+        SpatialHash*    mpSpatialHash;
+        T*              mpCallback;
+
+        inline bool visitProxy( const U32 proxyId )
+        {
+            return mpCallback->QuerySceneObject( mpSpatialHash->mProxyObjects[proxyId] );
+        }
+    };
+
+    template <typename T>
+    struct RayCastVisitor
+    {
+        SpatialHash*            mpSpatialHash;
+        T*                      mpCallback;
+        const b2RayCastInput*   mpInput;
+        b2Vec2                  mAxis;
+        b2Vec2                  mAbsAxis;
+
+        inline bool visitProxy( const U32 proxyId )
+        {
+            // Skip if the segment is separated from the proxy.
+            const b2AABB& proxyAABB = mpSpatialHash->mProxyAABBs[proxyId];
+            const F32 separation = b2Abs( b2Dot( mAxis, mpInput->p1 - proxyAABB.GetCenter() ) ) - b2Dot( mAbsAxis, proxyAABB.GetExtents() );
+            if ( separation > 0.0f )
+                return true;
+
+            return mpCallback->RayCastSceneObject( *mpInput, mpSpatialHash->mProxyObjects[proxyId] ) != 0.0f;
+        }
+    };
+
+    template <typename T>
+    void            visitProxies( T* visitor, const b2AABB& aabb );
+    void            rebuild( void );
+    U32             nextQueryStamp( void );
+
+    inline S32      getCell( const F32 value ) const
+    {
+        // Clamp before converting as the cell may be out of range, or not a number, for distant bounds.
+        const F32 cell = mFloor( value * mInverseCellSize );
+        if ( !(cell > (F32)-MaxCell) )
+            return -MaxCell;
+        if ( !(cell < (F32)MaxCell) )
+            return MaxCell;
+        return (S32)cell;
+    }
+    inline U32      getBucket( const S32 cellX, const S32 cellY ) const { return (((U32)cellX * 73856093u) ^ ((U32)cellY * 19349663u)) & mBucketMask; }
+    inline bool     getIsOversized( const S32 lowerX, const S32 lowerY, const S32 upperX, const S32 upperY ) const
+    {
+        return (upperX - lowerX) >= MaxCellSpan || (upperY - lowerY) >= MaxCellSpan;
+    }
+
+private:
+    F32                     mCellSize;
+    F32                     mInverseCellSize;
+    bool                    mDirty;
+
+    /// Proxies.
+    Vector<SceneObject*>    mProxyObjects;
+    Vector<b2AABB>          mProxyAABBs;
+    Vector<U32>             mProxyQueryStamps;
+    U32                     mQueryStamp;
+
+    /// Cells hashed into buckets, stored as a compact counting-sort layout.
+    U32                     mBucketMask;
+    Vector<U32>             mBucketStarts;
+    Vector<U32>             mBucketCursors;
+    Vector<U32>             mBucketProxies;
+    Vector<U32>             mOversizedProxies;
+};
+
+//-----------------------------------------------------------------------------
+
+template <typename T>
+inline void SpatialHash::visitProxies( T* visitor, const b2AABB& aabb )
+{
+    // Finish if nothing to visit.
+    if ( mProxyObjects.size() == 0 )
+        return;
+
+    // Rebuild the cells if anything changed.
+    if ( mDirty )
+        rebuild();
+
+    // Fetch the cell range.
+    const S32 lowerX = getCell( aabb.lowerBound.x );
+    const S32 lowerY = getCell( aabb.lowerBound.y );
+    const S32 upperX = getCell( aabb.upperBound.x );
+    const S32 upperY = getCell( aabb.upperBound.y );
+
+    // Visit every proxy directly if the range covers more cells than there are buckets.
+    // The cells are clamped so the spans cannot overflow.
+    if ( (F32)(upperX - lowerX + 1) * (F32)(upperY - lowerY + 1) > (F32)(mBucketMask + 1) )
+    {
+        const U32 proxyCount = mProxyObjects.size();
+        for ( U32 proxyId = 0; proxyId < proxyCount; ++proxyId )
+        {
+            if ( b2TestOverlap( mProxyAABBs[proxyId], aabb ) && !visitor->visitProxy( proxyId ) )
+                return;
+        }
+
+        return;
+    }
+
+    // Visit the oversized proxies.
+    const U32 oversizedCount = mOversizedProxies.size();
+    for ( U32 n = 0; n < oversizedCount; ++n )
+    {
+        const U32 proxyId = mOversizedProxies[n];
+
+        if ( b2TestOverlap( mProxyAABBs[proxyId], aabb ) && !visitor->visitProxy( proxyId ) )
+            return;
+    }
+
+    const U32 queryStamp = nextQueryStamp();
+
+    // Visit the proxies in each covered cell.
+    for ( S32 cellY = lowerY; cellY <= upperY; ++cellY )
+    {
+        for ( S32 cellX = lowerX; cellX <= upperX; ++cellX )
+        {
+            const U32 bucket = getBucket( cellX, cellY );
+            const U32 bucketEnd = mBucketStarts[bucket+1];
+            for ( U32 n = mBucketStarts[bucket]; n < bucketEnd; ++n )
+            {
+                const U32 proxyId = mBucketProxies[n];
+
+                // Skip if already visited.
+                // Proxies spanning several cells or sharing a bucket with another cell are found more than once.
+                if ( mProxyQueryStamps[proxyId] == queryStamp )
+                    continue;
+
+                mProxyQueryStamps[proxyId] = queryStamp;
+
+                if ( b2TestOverlap( mProxyAABBs[proxyId], aabb ) && !visitor->visitProxy( proxyId ) )
+                    return;
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+template <typename T>
+inline void SpatialHash::query( T* callback, const b2AABB& aabb )
+{
+    QueryVisitor<T> visitor;
+    visitor.mpSpatialHash = this;
+    visitor.mpCallback = callback;
+    visitProxies( &visitor, aabb );
+}
+
+//-----------------------------------------------------------------------------
+
+template <typename T>
+inline void SpatialHash::rayCast( T* callback, const b2RayCastInput& input )
+{
+    // Fetch the segment.
+    const b2Vec2 p1 = input.p1;
+    const b2Vec2 p2 = p1 + input.maxFraction * (input.p2 - input.p1);
+    b2Vec2 r = input.p2 - input.p1;
+    r.Normalize();
+
+    RayCastVisitor<T> visitor;
+    visitor.mpSpatialHash = this;
+    visitor.mpCallback = callback;
+    visitor.mpInput = &input;
+
+    // Use the same separating axis as the dynamic tree.
+    visitor.mAxis = b2Cross( 1.0f, r );
+    visitor.mAbsAxis = b2Abs( visitor.mAxis );
+
+    // Visit the proxies overlapping the segment bounds.
+    b2AABB segmentAABB;
+    segmentAABB.lowerBound = b2Min( p1, p2 );
+    segmentAABB.upperBound = b2Max( p1, p2 );
+    visitProxies( &visitor, segmentAABB );
+}
+
+#endif // _SPATIAL_HASH_H_
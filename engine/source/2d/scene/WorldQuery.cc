@@ -62,6 +62,12 @@ S32 WorldQuery::add( SceneObject* pSceneObject )
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_Add);
 
+    // Use the spatial hash if either the scene or the object requests it.
+    pSceneObject->mWorldProxyHashed = mpScene->getSpatialHash() || pSceneObject->getSpatialHash();
+
+    if ( pSceneObject->mWorldProxyHashed )
+        return mSpatialHash.createProxy( pSceneObject, pSceneObject->getAABB() );
+
     return CreateProxy( pSceneObject->getAABB(), static_cast<PhysicsProxy*>(pSceneObject) );
 }
 
@@ -72,6 +78,18 @@ void WorldQuery::remove( SceneObject* pSceneObject )
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_Remove);
 
+    // Is the proxy in the spatial hash?
+    if ( pSceneObject->mWorldProxyHashed )
+    {
+        // Yes, so destroy it and update the object moved into its slot.
+        SceneObject* pMovedSceneObject = mSpatialHash.destroyProxy( pSceneObject->getWorldProxy() );
+        if ( pMovedSceneObject != NULL )
+            pMovedSceneObject->mWorldProxyId = pSceneObject->getWorldProxy();
+
+        pSceneObject->mWorldProxyHashed = false;
+        return;
+    }
+
     DestroyProxy( pSceneObject->getWorldProxy() );
 }
 
@@ -82,6 +100,13 @@ bool WorldQuery::update( SceneObject* pSceneObject, const b2AABB& aabb, const b2
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_Update);
 
+    // Moving a spatial hash proxy only records the AABB.
+    if ( pSceneObject->mWorldProxyHashed )
+    {
+        mSpatialHash.moveProxy( pSceneObject->getWorldProxy(), aabb );
+        return true;
+    }
+
     return MoveProxy( pSceneObject->getWorldProxy(), aabb, displacement );
 }
 
@@ -249,7 +274,7 @@ U32 WorldQuery::aabbQueryAABB( const b2AABB& aabb )
     mIsRaycastQueryResult = false;
 
     // Query.
-    Query( this, aabb );
+    proxyQuery( aabb );
 
     // Inject always-in-scope.
     injectAlwaysInScope();
@@ -274,7 +299,7 @@ U32 WorldQuery::aabbQueryRay( const Vector2& point1, const Vector2& point2 )
     mCompareRay.p2 = point2;
     mCompareRay.maxFraction = 1.0f;
     mCompareTransform.SetIdentity();
-    RayCast( this, mCompareRay );
+    proxyRayCast( mCompareRay );
 
     // Inject always-in-scope.
     injectAlwaysInScope();
@@ -298,7 +323,7 @@ U32 WorldQuery::aabbQueryPoint( const Vector2& point )
     b2AABB aabb;
     aabb.lowerBound = point;
     aabb.upperBound = point;
-    Query( this, aabb );
+    proxyQuery( aabb );
 
     // Inject always-in-scope.
     injectAlwaysInScope();
@@ -325,7 +350,7 @@ U32 WorldQuery::aabbQueryCircle( const Vector2& centroid, const F32 radius )
     mCompareCircleShape.m_radius = radius;
     mCompareCircleShape.ComputeAABB( &aabb, mCompareTransform, 0 );
     mCheckCircle = true;
-    Query( this, aabb );
+    proxyQuery( aabb );
     mCheckCircle = false;
 
     // Inject always-in-scope.
@@ -356,7 +381,7 @@ U32 WorldQuery::oobbQueryAABB( const b2AABB& aabb )
     mCompareTransform.SetIdentity();
     mCheckOOBB = true;
     mCheckAABB = true;
-    Query( this, aabb );
+    proxyQuery( aabb );
     mCheckAABB = false;
     mCheckOOBB = false;
 
@@ -384,7 +409,7 @@ U32 WorldQuery::oobbQueryRay( const Vector2& point1, const Vector2& point2 )
     mCompareRay.maxFraction = 1.0f;
     mCompareTransform.SetIdentity();
     mCheckOOBB = true;
-    RayCast( this, mCompareRay );
+    proxyRayCast( mCompareRay );
     mCheckOOBB = false;
 
     // Inject always-in-scope.
@@ -413,7 +438,7 @@ U32 WorldQuery::oobbQueryPoint( const Vector2& point )
     mCompareTransform.SetIdentity();
     mCheckOOBB = true;
     mCheckPoint = true;
-    Query( this, aabb );
+    proxyQuery( aabb );
     mCheckPoint = false;
     mCheckOOBB = false;
 
@@ -443,7 +468,7 @@ U32 WorldQuery::oobbQueryCircle( const Vector2& centroid, const F32 radius )
     mCompareCircleShape.ComputeAABB( &aabb, mCompareTransform, 0 );
     mCheckOOBB = true;
     mCheckCircle = true;
-    Query( this, aabb );
+    proxyQuery( aabb );
     mCheckCircle = false;
     mCheckOOBB = false;
 
@@ -527,6 +552,254 @@ U32 WorldQuery::anyQueryCircle( const Vector2& centroid, const F32 radius )
 
 //-----------------------------------------------------------------------------
 
+void WorldQuery::regionQuery( const Vector<WorldQueryRegion>& regions )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(WorldQuery_RegionQuery);
+
+    // Fetch region count.
+    const U32 regionCount = regions.size();
+
+    // Clear the region results.
+    for ( U32 n = 0; n < regionCount; ++n )
+    {
+        regions[n].mpResults->clear();
+    }
+
+    // Cluster the regions so that overlapping or neighbouring regions share a single tree query.
+    // A region joins a cluster when the combined bounds are no larger than the two apart.
+    mRegionClusters.clear();
+    mRegionClusterIndices.setSize( regionCount );
+    for ( U32 n = 0; n < regionCount; ++n )
+    {
+        // Fetch region AABB.
+        const b2AABB& regionAABB = regions[n].mAABB;
+        const F32 regionPerimeter = regionAABB.GetPerimeter();
+
+        U32 clusterIndex = 0;
+        for ( ; clusterIndex < (U32)mRegionClusters.size(); ++clusterIndex )
+        {
+            b2AABB& clusterAABB = mRegionClusters[clusterIndex];
+
+            b2AABB combinedAABB;
+            combinedAABB.Combine( clusterAABB, regionAABB );
+
+            if ( combinedAABB.GetPerimeter() <= clusterAABB.GetPerimeter() + regionPerimeter )
+            {
+                clusterAABB = combinedAABB;
+                break;
+            }
+        }
+
+        // Start a new cluster if the region did not join one.
+        if ( clusterIndex == (U32)mRegionClusters.size() )
+            mRegionClusters.push_back( regionAABB );
+
+        mRegionClusterIndices[n] = clusterIndex;
+    }
+
+    // Fetch the region shapes.
+    mRegionShapes.setSize( regionCount );
+    for ( U32 n = 0; n < regionCount; ++n )
+    {
+        const b2AABB& regionAABB = regions[n].mAABB;
+        b2Vec2 verts[4];
+        verts[0].Set( regionAABB.lowerBound.x, regionAABB.lowerBound.y );
+        verts[1].Set( regionAABB.upperBound.x, regionAABB.lowerBound.y );
+        verts[2].Set( regionAABB.upperBound.x, regionAABB.upperBound.y );
+        verts[3].Set( regionAABB.lowerBound.x, regionAABB.upperBound.y );
+        mRegionShapes[n].Set( verts, 4 );
+    }
+
+    RegionQueryCallback callback;
+    callback.mpWorldQuery = this;
+    callback.mpRegions = &regions;
+    callback.mpRegionShapes = &mRegionShapes;
+    callback.mpClusterRegions = &mClusterRegions;
+
+    // Query each cluster once.
+    for ( U32 clusterIndex = 0; clusterIndex < (U32)mRegionClusters.size(); ++clusterIndex )
+    {
+        // Gather the regions in the cluster.
+        mClusterRegions.clear();
+        for ( U32 n = 0; n < regionCount; ++n )
+        {
+            if ( mRegionClusterIndices[n] == clusterIndex )
+                mClusterRegions.push_back( n );
+        }
+
+        // Each scene object is only tested once per cluster.
+        // Always-in-scope objects are tagged up front as they are injected into every region afterwards.
+        mMasterQueryKey++;
+        for( typeSceneObjectVector::iterator itr = mAlwaysInScopeSet.begin(); itr != mAlwaysInScopeSet.end(); ++itr )
+            (*itr)->setWorldQueryKey( mMasterQueryKey );
+
+        // Query the render proxies then the collision fixtures, as "anyQueryAABB()" does.
+        Query( &callback, mRegionClusters[clusterIndex] );
+        mSpatialHash.query( &callback, mRegionClusters[clusterIndex] );
+        mpScene->getWorld()->QueryAABB( &callback, mRegionClusters[clusterIndex] );
+    }
+
+    // Inject always-in-scope.
+    for ( U32 n = 0; n < regionCount; ++n )
+    {
+        // Fetch region.
+        const WorldQueryRegion& region = regions[n];
+        const WorldQueryFilter& queryFilter = region.mQueryFilter;
+
+        // Skip if filtering always-in-scope.
+        if ( queryFilter.mAlwaysInScopeFilter )
+            continue;
+
+        for( typeSceneObjectVector::iterator itr = mAlwaysInScopeSet.begin(); itr != mAlwaysInScopeSet.end(); ++itr )
+        {
+            // Fetch scene object.
+            SceneObject* pSceneObject = (*itr);
+
+            // Enabled filter.
+            if ( queryFilter.mEnabledFilter && !pSceneObject->isEnabled() )
+                continue;
+
+            // Visible filter.
+            if ( queryFilter.mVisibleFilter && !pSceneObject->getVisible() )
+                continue;
+
+            // Picking allowed filter.
+            if ( queryFilter.mPickingAllowedFilter && !pSceneObject->getPickingAllowed() )
+                continue;
+
+            // Compare masks and report.
+            if ( (queryFilter.mSceneLayerMask & pSceneObject->getSceneLayerMask()) != 0 && (queryFilter.mSceneGroupMask & pSceneObject->getSceneGroupMask()) != 0 )
+                region.mpResults->push_back( pSceneObject );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+bool WorldQuery::RegionQueryCallback::ReportFixture( b2Fixture* fixture )
+{
+    // If not the correct proxy then ignore.
+    PhysicsProxy* pPhysicsProxy = static_cast<PhysicsProxy*>(fixture->GetBody()->GetUserData());
+    if ( pPhysicsProxy->getPhysicsProxyType() != PhysicsProxy::PHYSIC_PROXY_SCENEOBJECT )
+        return true;
+
+    return QuerySceneObject( static_cast<SceneObject*>(pPhysicsProxy) );
+}
+
+//-----------------------------------------------------------------------------
+
+bool WorldQuery::RegionQueryCallback::QueryCallback( S32 proxyId )
+{
+    // If not the correct proxy then ignore.
+    PhysicsProxy* pPhysicsProxy = static_cast<PhysicsProxy*>(mpWorldQuery->GetUserData( proxyId ));
+    if ( pPhysicsProxy->getPhysicsProxyType() != PhysicsProxy::PHYSIC_PROXY_SCENEOBJECT )
+        return true;
+
+    return QuerySceneObject( static_cast<SceneObject*>(pPhysicsProxy) );
+}
+
+//-----------------------------------------------------------------------------
+
+bool WorldQuery::RegionQueryCallback::QuerySceneObject( SceneObject* pSceneObject )
+{
+    // Ignore if already tested in this cluster.
+    if ( pSceneObject->getWorldQueryKey() == mpWorldQuery->mMasterQueryKey )
+        return true;
+
+    // Tag with world query key.
+    pSceneObject->setWorldQueryKey( mpWorldQuery->mMasterQueryKey );
+
+    // Fetch the scene object AABB, masks and body.
+    const b2AABB& aabb = pSceneObject->getAABB();
+    const U32 sceneLayerMask = pSceneObject->getSceneLayerMask();
+    const U32 sceneGroupMask = pSceneObject->getSceneGroupMask();
+    const b2Body* pBody = pSceneObject->getBody();
+
+    // The render OOBB is only fetched if a region needs it.
+    b2PolygonShape oobb;
+    bool oobbFetched = false;
+
+    b2Transform identityTransform;
+    identityTransform.SetIdentity();
+
+    // Report to every region in the cluster the scene object overlaps.
+    const U32 clusterRegionCount = mpClusterRegions->size();
+    for ( U32 n = 0; n < clusterRegionCount; ++n )
+    {
+        // Fetch region.
+        const U32 regionIndex = (*mpClusterRegions)[n];
+        const WorldQueryRegion& region = (*mpRegions)[regionIndex];
+        const b2PolygonShape& regionShape = (*mpRegionShapes)[regionIndex];
+        const WorldQueryFilter& queryFilter = region.mQueryFilter;
+
+        // Enabled filter.
+        if ( queryFilter.mEnabledFilter && !pSceneObject->isEnabled() )
+            continue;
+
+        // Visible filter.
+        if ( queryFilter.mVisibleFilter && !pSceneObject->getVisible() )
+            continue;
+
+        // Picking allowed filter.
+        if ( queryFilter.mPickingAllowedFilter && !pSceneObject->getPickingAllowed() )
+            continue;
+
+        // Compare masks.
+        if ( (queryFilter.mSceneLayerMask & sceneLayerMask) == 0 || (queryFilter.mSceneGroupMask & sceneGroupMask) == 0 )
+            continue;
+
+        // Check the render OOBB.
+        bool overlapping = false;
+        if ( b2TestOverlap( region.mAABB, aabb ) )
+        {
+            if ( !oobbFetched )
+            {
+                oobb.Set( pSceneObject->getRenderOOBB(), 4 );
+                oobbFetched = true;
+            }
+
+            overlapping = b2TestOverlap( &regionShape, 0, &oobb, 0, identityTransform, identityTransform );
+        }
+
+        // Check the collision fixtures.
+        if ( !overlapping && pBody != NULL )
+        {
+            for ( const b2Fixture* pFixture = pBody->GetFixtureList(); pFixture != NULL && !overlapping; pFixture = pFixture->GetNext() )
+            {
+                overlapping = b2TestOverlap( region.mAABB, pFixture->GetAABB( 0 ) ) &&
+                    b2TestOverlap( &regionShape, 0, pFixture->GetShape(), 0, identityTransform, pBody->GetTransform() );
+            }
+        }
+
+        // Report.
+        if ( overlapping )
+            region.mpResults->push_back( pSceneObject );
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQuery::proxyQuery( const b2AABB& aabb )
+{
+    // Query the dynamic tree then the spatial hash.
+    Query( this, aabb );
+    mSpatialHash.query( this, aabb );
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQuery::proxyRayCast( const b2RayCastInput& input )
+{
+    // Ray-cast the dynamic tree then the spatial hash.
+    RayCast( this, input );
+    mSpatialHash.rayCast( this, input );
+}
+
+//-----------------------------------------------------------------------------
+
 void WorldQuery::clearQuery( void )
 {
     // Debug Profiling.
@@ -700,16 +973,20 @@ F32 WorldQuery::ReportFixture( b2Fixture* fixture, const b2Vec2& point, const b2
 
 bool WorldQuery::QueryCallback( S32 proxyId )
 {    
-    // Debug Profiling.
-    PROFILE_SCOPE(WorldQuery_QueryCallback);
-
     // If not the correct proxy then ignore.
     PhysicsProxy* pPhysicsProxy = static_cast<PhysicsProxy*>(GetUserData( proxyId ));
     if ( pPhysicsProxy->getPhysicsProxyType() != PhysicsProxy::PHYSIC_PROXY_SCENEOBJECT )
         return true;
 
-    // Fetch scene object.
-    SceneObject* pSceneObject = static_cast<SceneObject*>(pPhysicsProxy);
+    return QuerySceneObject( static_cast<SceneObject*>(pPhysicsProxy) );
+}
+
+//-----------------------------------------------------------------------------
+
+bool WorldQuery::QuerySceneObject( SceneObject* pSceneObject )
+{    
+    // Debug Profiling.
+    PROFILE_SCOPE(WorldQuery_QueryCallback);
 
     // Ignore if already tagged with the world query key.
     if ( pSceneObject->getWorldQueryKey() == mMasterQueryKey )
@@ -792,16 +1069,20 @@ bool WorldQuery::QueryCallback( S32 proxyId )
 
 F32 WorldQuery::RayCastCallback( const b2RayCastInput& input, S32 proxyId )
 {
-    // Debug Profiling.
-    PROFILE_SCOPE(WorldQuery_RayCastCallback);
-
     // If not the correct proxy then ignore.
     PhysicsProxy* pPhysicsProxy = static_cast<PhysicsProxy*>(GetUserData( proxyId ));
     if ( pPhysicsProxy->getPhysicsProxyType() != PhysicsProxy::PHYSIC_PROXY_SCENEOBJECT )
         return 1.0f;
 
-    // Fetch scene object.
-    SceneObject* pSceneObject = static_cast<SceneObject*>(pPhysicsProxy);
+    return RayCastSceneObject( input, static_cast<SceneObject*>(pPhysicsProxy) );
+}
+
+//-----------------------------------------------------------------------------
+
+F32 WorldQuery::RayCastSceneObject( const b2RayCastInput& input, SceneObject* pSceneObject )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(WorldQuery_RayCastCallback);
 
     // Ignore if already tagged with the world query key.
     if ( pSceneObject->getWorldQueryKey() == mMasterQueryKey )
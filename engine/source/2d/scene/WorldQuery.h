@@ -31,12 +31,26 @@
 #include "2d/scene/WorldQueryResult.h"
 #endif
 
+#ifndef _SPATIAL_HASH_H_
+#include "2d/scene/SpatialHash.h"
+#endif
+
 ///-----------------------------------------------------------------------------
 
 class Scene;
 
 ///-----------------------------------------------------------------------------
 
+/// A region whose candidates are gathered by a shared region query.
+struct WorldQueryRegion
+{
+    b2AABB                  mAABB;
+    WorldQueryFilter        mQueryFilter;
+    typeSceneObjectVector*  mpResults;
+};
+
+///-----------------------------------------------------------------------------
+
 class WorldQuery :
     protected b2DynamicTree,
     public b2QueryCallback,
@@ -52,6 +66,11 @@ public:
     void            remove( SceneObject* pSceneObject );
     bool            update( SceneObject* pSceneObject, const b2AABB& aabb, const b2Vec2& displacement );
 
+    /// Spatial hash.
+    inline void     setSpatialHashCellSize( const F32 cellSize ) { mSpatialHash.setCellSize( cellSize ); }
+    inline F32      getSpatialHashCellSize( void ) const { return mSpatialHash.getCellSize(); }
+    inline U32      getSpatialHashProxyCount( void ) const { return mSpatialHash.getProxyCount(); }
+
     /// Always in scope.
     void            addAlwaysInScope( SceneObject* pSceneObject );
     void            removeAlwaysInScope( SceneObject* pSceneObject );
@@ -80,6 +99,9 @@ public:
     U32             anyQueryPoint( const Vector2& point );
     U32             anyQueryCircle( const Vector2& centroid, const F32 radius );
 
+    /// Region queries.
+    void            regionQuery( const Vector<WorldQueryRegion>& regions );
+
     /// Filtering.
     inline void     setQueryFilter( const WorldQueryFilter& queryFilter ) { mQueryFilter = queryFilter; }
    
@@ -96,13 +118,30 @@ public:
     virtual F32     ReportFixture( b2Fixture* fixture, const b2Vec2& point, const b2Vec2& normal, F32 fraction );
     bool            QueryCallback( S32 proxyId );
     F32             RayCastCallback( const b2RayCastInput& input, S32 proxyId );
+    bool            QuerySceneObject( SceneObject* pSceneObject );
+    F32             RayCastSceneObject( const b2RayCastInput& input, SceneObject* pSceneObject );
 
 private:
+    struct RegionQueryCallback : public b2QueryCallback
+    {
+        WorldQuery*                         mpWorldQuery;
+        const Vector<WorldQueryRegion>*     mpRegions;
+        const Vector<b2PolygonShape>*       mpRegionShapes;
+        const Vector<U32>*                  mpClusterRegions;
+
+        virtual bool ReportFixture( b2Fixture* fixture );
+        bool QueryCallback( S32 proxyId );
+        bool QuerySceneObject( SceneObject* pSceneObject );
+    };
+
+    void            proxyQuery( const b2AABB& aabb );
+    void            proxyRayCast( const b2RayCastInput& input );
     void            injectAlwaysInScope( void );
     static S32      QSORT_CALLBACK rayCastFractionSort(const void* a, const void* b);
 
 private:
     Scene*                      mpScene;
+    SpatialHash                 mSpatialHash;
     WorldQueryFilter            mQueryFilter;
     b2PolygonShape              mComparePolygonShape;
     b2CircleShape               mCompareCircleShape;
@@ -118,6 +157,10 @@ private:
     bool                        mIsRaycastQueryResult;
     typeSceneObjectVector       mAlwaysInScopeSet;
     U32                         mMasterQueryKey;
+    Vector<b2AABB>              mRegionClusters;
+    Vector<U32>                 mRegionClusterIndices;
+    Vector<U32>                 mClusterRegions;
+    Vector<b2PolygonShape>      mRegionShapes;
 };
 
 #endif // _WORLD_QUERY_H_
\ No newline at end of file
@@ -65,6 +65,7 @@ public:
     virtual void preIntegrate( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
     virtual void integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
     virtual void interpolateObject( const F32 timeDelta );
+    virtual bool hasCustomIntegration( void ) const { return true; }
 
     virtual bool canPrepareRender( void ) const { return true; }
     virtual bool shouldRender( void ) const { return true; }
@@ -183,9 +183,10 @@ void ImageFont::sceneRender( const SceneRenderState* pSceneRenderState, const Sc
         return;
 
     // Fetch render OOBB.
-    const Vector2& renderOOBB0 = mRenderOOBB[0];
-    const Vector2& renderOOBB1 = mRenderOOBB[1];
-    const Vector2& renderOOBB3 = mRenderOOBB[3];
+    const b2Vec2* pRenderOOBB = getRenderOOBB();
+    const Vector2& renderOOBB0 = pRenderOOBB[0];
+    const Vector2& renderOOBB1 = pRenderOOBB[1];
+    const Vector2& renderOOBB3 = pRenderOOBB[3];
 
     Vector2 characterOOBB0;
     Vector2 characterOOBB1;
@@ -249,7 +250,7 @@ void ImageFont::sceneRender( const SceneRenderState* pSceneRenderState, const Sc
         const U32 characterFrameIndex = character - 32;
 
         // Fetch current frame area.
-        const ImageAsset::FrameArea::TexelArea& texelFrameArea = mImageAsset->getImageFrameArea( characterFrameIndex ).mTexelArea;
+        const ImageAsset::FrameArea::TexelArea texelFrameArea = mImageAsset->getImageFrameArea( characterFrameIndex ).mTexelArea;
 
         // Fetch lower/upper texture coordinates.
         const Vector2& texLower = texelFrameArea.mTexelLower;
@@ -93,6 +93,7 @@ ParticlePlayer::ParticlePlayer() :
                     mParticleInterpolation( false ),
                     mCameraIdleDistance( 0.0f ),
                     mCameraIdle( false ),
+                    mAnimationSynchronized( false ),
                     mWaitingForParticles( false ),
                     mWaitingForDelete( false )
 {
@@ -128,6 +129,7 @@ void ParticlePlayer::initPersistFields()
     addProtectedField( "SizeScale", TypeF32, Offset(mSizeScale, ParticlePlayer), &defaultProtectedSetFn, &defaultProtectedGetFn, &writeSizeScale, "" );
     addProtectedField( "ForceScale", TypeF32, Offset(mForceScale, ParticlePlayer), &defaultProtectedSetFn, &defaultProtectedGetFn, &writeForceScale, "" );
     addProtectedField( "TimeScale", TypeF32, Offset(mTimeScale, ParticlePlayer), &defaultProtectedSetFn, &defaultProtectedGetFn, &writeTimeScale, "" );
+    addProtectedField( "AnimationSynchronized", TypeBool, Offset(mAnimationSynchronized, ParticlePlayer), &defaultProtectedSetFn, &defaultProtectedGetFn, &writeAnimationSynchronized, "" );
 }
 
 //------------------------------------------------------------------------------
@@ -151,6 +153,7 @@ void ParticlePlayer::copyTo(SimObject* object)
    pParticlePlayer->setSizeScale( getSizeScale() );
    pParticlePlayer->setForceScale( getForceScale() );
    pParticlePlayer->setTimeScale( getTimeScale() );
+   pParticlePlayer->setAnimationSynchronized( getAnimationSynchronized() );
 }
 
 //------------------------------------------------------------------------------
@@ -632,7 +635,7 @@ void ParticlePlayer::sceneRender( const SceneRenderState* pSceneRenderState, con
             const ImageFrameProviderCore& frameProvider = pParticleNode->mFrameProvider;
 
             // Fetch the frame area.
-            const ImageAsset::FrameArea::TexelArea& texelFrameArea = frameProvider.getProviderImageFrameArea().mTexelArea;
+            const ImageAsset::FrameArea::TexelArea texelFrameArea = frameProvider.getProviderImageFrameArea().mTexelArea;
 
             // Frame texture.
             TextureHandle& frameTexture = frameProvider.getProviderTexture();
@@ -1282,6 +1285,16 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
 
         // Play it.
         frameProvider.playAnimation( animationAsset );
+
+        // Are particle animations synchronized?
+        if ( mAnimationSynchronized )
+        {
+            // Yes, so drive the particle animation from the scene clocks at the player time scale.
+            // The particle keeps its start time as its phase so it still animates from when it was emitted.
+            frameProvider.setAnimationTimeScale( mTimeScale );
+            frameProvider.setAnimationClockSet( &getScene()->getAnimationClocks() );
+            frameProvider.setAnimationSynchronized( true, true );
+        }
     }
 
 
@@ -1385,8 +1398,8 @@ void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSyste
     // **********************************************************************************************************************
 
 
-    // Is the emitter in static mode?
-    if ( !pParticleAssetEmitter->isStaticFrameProvider() )
+    // Is the emitter in static mode or is a shared clock driving the animation?
+    if ( !pParticleAssetEmitter->isStaticFrameProvider() && !pParticleNode->mFrameProvider.isAnimationClocked() )
     {
         // No, so update animation.
         pParticleNode->mFrameProvider.updateAnimation( elapsedTime );
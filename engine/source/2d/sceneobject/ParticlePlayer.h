@@ -127,6 +127,7 @@ private:
     F32                         mSizeScale;
     F32                         mForceScale;
     F32                         mTimeScale;
+    bool                        mAnimationSynchronized;
 
     bool                        mWaitingForParticles;
     bool                        mWaitingForDelete;
@@ -142,6 +143,7 @@ public:
     virtual void preIntegrate( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
     void integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
     void interpolateObject( const F32 timeDelta );
+    virtual bool hasCustomIntegration( void ) const { return true; }
 
     virtual bool validRender( void ) const { return mParticleAsset.notNull() && mParticleAsset->isAssetValid(); }
     virtual bool shouldRender( void ) const { return true; }
@@ -169,6 +171,9 @@ public:
     inline void setTimeScale( const F32 scale ) { mTimeScale = scale; }
     inline F32 getTimeScale( void  ) const { return mTimeScale; }
 
+    inline void setAnimationSynchronized( const bool synchronized ) { mAnimationSynchronized = synchronized; }
+    inline bool getAnimationSynchronized( void ) const { return mAnimationSynchronized; }
+
     inline const U32 getEmitterCount( void ) const { return (U32)mEmitters.size(); }
 
     void setEmitterPaused( const bool paused, const U32 emitterIndex );
@@ -205,6 +210,7 @@ protected:
     static bool     writeSizeScale( void* obj, StringTableEntry pFieldName )                { return !mIsOne( static_cast<ParticlePlayer*>( obj )->getSizeScale() ); }
     static bool     writeForceScale( void* obj, StringTableEntry pFieldName )               { return !mIsOne( static_cast<ParticlePlayer*>( obj )->getForceScale() ); }
     static bool     writeTimeScale( void* obj, StringTableEntry pFieldName )                { return !mIsOne( static_cast<ParticlePlayer*>( obj )->getTimeScale() ); }
+    static bool     writeAnimationSynchronized( void* obj, StringTableEntry pFieldName )    { return static_cast<ParticlePlayer*>( obj )->getAnimationSynchronized(); }
 
 private:
     void initializeParticleAsset( void );
@@ -102,6 +102,24 @@ ConsoleMethod(ParticlePlayer, getForceScale, F32, 2, 2,     "() Gets the scale f
 {
     return object->getForceScale();
 }
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(ParticlePlayer, setAnimationSynchronized, void, 3, 3, "(synchronized?) Sets whether cycling particle animations are driven by the shared scene animation clocks.\n"
+                                                                    "Synchronized particles are not integrated individually but keep animating while the player is paused or idle.\n"
+                                                                    "@param synchronized Whether cycling particle animations are driven by the shared scene animation clocks.\n"
+                                                                    "@return No return value.")
+{
+    object->setAnimationSynchronized( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(ParticlePlayer, getAnimationSynchronized, bool, 2, 2, "() Gets whether cycling particle animations are driven by the shared scene animation clocks.\n"
+                                                                    "@return Whether cycling particle animations are driven by the shared scene animation clocks.")
+{
+    return object->getAnimationSynchronized();
+}
 //-----------------------------------------------------------------------------
 
 ConsoleMethod(ParticlePlayer, play, bool, 2, 3, "([resetParticles]) Starts the particle player playing.\n"
@@ -60,6 +60,10 @@
 #include "2d/sceneobject/SceneObjectRotateToEvent.h"
 #endif
 
+#ifndef _SCENE_POOL_H_
+#include "2d/scene/ScenePool.h"
+#endif
+
 #ifndef _RENDER_PROXY_H_
 #include "2d/core/RenderProxy.h"
 #endif
@@ -104,6 +108,7 @@ static StringTableEntry edgeTypeName            = StringTable->insert( "Edge" );
 SceneObject::SceneObject() :
     /// Scene.
     mpScene(NULL),
+    mSceneObjectIndex(-1),
     mpTargetScene(NULL),
 
     /// Lifetime.
@@ -121,12 +126,16 @@ SceneObject::SceneObject() :
 
     /// Area.
     mWorldProxyId(-1),
+    mWorldProxyHashed(false),
+    mSpatialHash(false),
 
     /// Position / Angle.
     mPreTickPosition( 0.0f, 0.0f ),
     mPreTickAngle( 0.0f ),
     mRenderPosition( 0.0f, 0.0f ),
     mRenderAngle( 0.0f ),
+    mRenderTransformPending( false ),
+    mRenderInterpolation( 0.0f ),
     mSpatialDirty( true ),
 
     /// Body.
@@ -176,6 +185,10 @@ SceneObject::SceneObject() :
     mBeingSafeDeleted(false),
     mSafeDeleteReady(true),
 
+    /// Pooling.
+    mpScenePool(NULL),
+    mPooled(false),
+
     /// Miscellaneous.
     mBatchIsolated(false),
     mSerialiseKey(0),
@@ -300,7 +313,7 @@ void SceneObject::initPersistFields()
     addProtectedField("GravityScale", TypeF32, NULL, &setGravityScale, &getGravityScale, &writeGravityScale, "");
 
     /// Render visibility.
-    addField("Visible", TypeBool, Offset(mVisible, SceneObject), &writeVisible, "");
+    addProtectedField("Visible", TypeBool, Offset(mVisible, SceneObject), &setVisible, &defaultProtectedGetFn, &writeVisible, "");
 
     /// Render blending.
     addField("BlendMode", TypeBool, Offset(mBlendMode, SceneObject), &writeBlendMode, "");
@@ -317,11 +330,12 @@ void SceneObject::initPersistFields()
     addField("UseInputEvents", TypeBool, Offset(mUseInputEvents, SceneObject), &writeUseInputEvents, "");
 
     addField("PickingAllowed", TypeBool, Offset(mPickingAllowed, SceneObject), &writePickingAllowed, "");
+    addProtectedField("SpatialHash", TypeBool, Offset(mSpatialHash, SceneObject), &setSpatialHash, &defaultProtectedGetFn, &writeSpatialHash, "Whether the object is indexed by the scenes spatial hash rather than its dynamic tree.");
 
     // Script callbacks.
-    addField("UpdateCallback", TypeBool, Offset(mUpdateCallback, SceneObject), &writeUpdateCallback, "");
+    addProtectedField("UpdateCallback", TypeBool, Offset(mUpdateCallback, SceneObject), &setUpdateCallback, &defaultProtectedGetFn, &writeUpdateCallback, "");
     addField("CollisionCallback", TypeBool, Offset(mCollisionCallback, SceneObject), &writeCollisionCallback, "");
-    addField("SleepingCallback", TypeBool, Offset(mSleepingCallback, SceneObject), &writeSleepingCallback, "");
+    addProtectedField("SleepingCallback", TypeBool, Offset(mSleepingCallback, SceneObject), &setSleepingCallback, &defaultProtectedGetFn, &writeSleepingCallback, "");
 
     /// Scene.
     addProtectedField("scene", TypeSimObjectPtr, Offset(mpScene, SceneObject), &setScene, &defaultProtectedGetFn, &writeScene, "");
@@ -355,6 +369,10 @@ void SceneObject::onRemove()
     // Detach Any GUI Control.
     detachGui();
 
+    // Remove from any pool.
+    if ( mpScenePool )
+        mpScenePool->onPooledObjectRemoved( this );
+
     // Remove from Scene.
     if ( getScene() )
         getScene()->removeFromScene( this );
@@ -500,6 +518,7 @@ void SceneObject::resetTickSpatials( const bool resize )
     // Set coincident pre-tick, current & render.
     mPreTickPosition = mRenderPosition = getPosition();
     mPreTickAngle = mRenderAngle = getAngle();
+    setPreTickSpatials();
 
     // Fetch body transform.
     b2Transform bodyXform = getTransform();
@@ -523,9 +542,7 @@ void SceneObject::resetTickSpatials( const bool resize )
         if ( resize )
         {
             // Yes, so we need to recreate a proxy.
-            pWorldQuery->remove( this );
-            mWorldProxyId = pWorldQuery->add( this );
-
+            refreshWorldProxy();
         }
         else
         {
@@ -535,7 +552,35 @@ void SceneObject::resetTickSpatials( const bool resize )
     }
 
     // Flag spatial changed.
-    mSpatialDirty = true;
+    setSpatialDirty( true );
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObject::setSpatialHash( const bool spatialHash )
+{
+    // Finish if no change.
+    if ( mSpatialHash == spatialHash )
+        return;
+
+    mSpatialHash = spatialHash;
+
+    // Move the world proxy to the new index.
+    refreshWorldProxy();
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObject::refreshWorldProxy( void )
+{
+    // Finish if not in a scene.
+    if ( mpScene == NULL || mWorldProxyId == -1 )
+        return;
+
+    // Recreate the world proxy.
+    WorldQuery* pWorldQuery = mpScene->getWorldQuery();
+    pWorldQuery->remove( this );
+    mWorldProxyId = pWorldQuery->add( this );
 }
 
 //-----------------------------------------------------------------------------
@@ -550,11 +595,12 @@ void SceneObject::preIntegrate( const F32 totalTime, const F32 elapsedTime, Debu
         return;
 
     // Reset spatial changed.
-    mSpatialDirty = false;
+    setSpatialDirty( false );
 
     mPreTickPosition = mRenderPosition = getPosition();
     mPreTickAngle    = mRenderAngle = getAngle();
     mPreTickAABB     = mCurrentAABB;
+    setPreTickSpatials();
 
     // Calculate render OOBB.
     CoreMath::mCalculateOOBB( getLocalSizedOOBB(), getTransform(), mRenderOOBB );
@@ -575,21 +621,24 @@ void SceneObject::integrateObject( const F32 totalTime, const F32 elapsedTime, D
             mPreTickPosition.x != position.x ||
             mPreTickPosition.y != position.y )
     {
-        // Yes, so flag spatial dirty.
-        mSpatialDirty = true;
-
-        // Calculate current AABB.
+        // Yes, so calculate current AABB.
         CoreMath::mCalculateAABB( getLocalSizedOOBB(), getTransform(), &mCurrentAABB );
 
-        // Calculate tick AABB.
-        b2AABB tickAABB;
-        tickAABB.Combine( mPreTickAABB, mCurrentAABB );
+        // Are we being integrated on the job pool?
+        if ( mpScene->getIsTickInParallel() )
+        {
+            // Yes, so flag spatial dirty and leave the shared updates for the scene to commit.
+            mSpatialDirty = true;
+            mpScene->getTickState().setFlag( mSceneObjectIndex, SceneTickState::TICK_SPATIAL_DIRTY | SceneTickState::TICK_DEFERRED_UPDATE, true );
+        }
+        else
+        {
+            // No, so flag spatial dirty.
+            setSpatialDirty( true );
 
-        // Calculate tick displacement.
-        b2Vec2 tickDisplacement = position - mPreTickPosition;
-            
-        // Update world proxy.
-        mpScene->getWorldQuery()->update( this, tickAABB, tickDisplacement );
+            // Update world proxy.
+            updateTickProxy();
+        }
     }
 
     // Update Lifetime.
@@ -614,6 +663,21 @@ void SceneObject::integrateObject( const F32 totalTime, const F32 elapsedTime, D
 
 //-----------------------------------------------------------------------------
 
+void SceneObject::updateTickProxy( void )
+{
+    // Calculate tick AABB.
+    b2AABB tickAABB;
+    tickAABB.Combine( mPreTickAABB, mCurrentAABB );
+
+    // Calculate tick displacement.
+    b2Vec2 tickDisplacement = getPosition() - mPreTickPosition;
+
+    // Update world proxy.
+    mpScene->getWorldQuery()->update( this, tickAABB, tickDisplacement );
+}
+
+//-----------------------------------------------------------------------------
+
 void SceneObject::postIntegrate(const F32 totalTime, const F32 elapsedTime, DebugStats *pDebugStats)
 {
     // Debug Profiling.
@@ -663,40 +727,11 @@ void SceneObject::interpolateObject( const F32 timeDelta )
     // Debug Profiling.
     PROFILE_SCOPE(SceneObject_InterpolateObject);
 
+    // Defer the render transform until it is first queried this frame.
     if ( mSpatialDirty )
     {
-        // Debug Profiling.
-        PROFILE_SCOPE(SceneObject_InterpolatePositionAngle);
-
-        if ( timeDelta < 1.0f )
-        {
-            // Calculate render position.
-            const b2Vec2 position = getPosition();
-            b2Vec2 positionDelta = position - mPreTickPosition;
-            positionDelta *= timeDelta;
-            mRenderPosition = position - positionDelta;
-
-            // Calculate render angle.
-            const F32 angle = getAngle();
-
-            F32 relativeAngle = angle - mPreTickAngle;
-            if ( relativeAngle > b2_pi )
-                relativeAngle -= b2_pi2;
-            else if ( relativeAngle < -b2_pi )
-                relativeAngle += b2_pi2;
-            mRenderAngle = angle - (relativeAngle * timeDelta);
-        }
-        else
-        {
-            mRenderPosition = mPreTickPosition;
-            mRenderAngle    = mPreTickAngle;
-        }
-     
-        // Calculate render transform.
-        b2Transform renderXF( mRenderPosition, b2Rot(mRenderAngle) );
-
-        // Calculate render OOBB.
-        CoreMath::mCalculateOOBB( getLocalSizedOOBB(), renderXF, mRenderOOBB );
+        mRenderInterpolation = timeDelta;
+        mRenderTransformPending = true;
     }
 
     // Update Any Attached GUI.
@@ -715,6 +750,47 @@ void SceneObject::interpolateObject( const F32 timeDelta )
 
 //-----------------------------------------------------------------------------
 
+void SceneObject::calculateRenderTransform( void ) const
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneObject_CalculateRenderTransform);
+
+    if ( mRenderInterpolation < 1.0f )
+    {
+        // Calculate render position.
+        const b2Vec2 position = getPosition();
+        b2Vec2 positionDelta = position - mPreTickPosition;
+        positionDelta *= mRenderInterpolation;
+        mRenderPosition = position - positionDelta;
+
+        // Calculate render angle.
+        const F32 angle = getAngle();
+
+        F32 relativeAngle = angle - mPreTickAngle;
+        if ( relativeAngle > b2_pi )
+            relativeAngle -= b2_pi2;
+        else if ( relativeAngle < -b2_pi )
+            relativeAngle += b2_pi2;
+        mRenderAngle = angle - (relativeAngle * mRenderInterpolation);
+    }
+    else
+    {
+        mRenderPosition = mPreTickPosition;
+        mRenderAngle    = mPreTickAngle;
+    }
+
+    // Calculate render transform.
+    b2Transform renderXF( mRenderPosition, b2Rot(mRenderAngle) );
+
+    // Calculate render OOBB.
+    CoreMath::mCalculateOOBB( getLocalSizedOOBB(), renderXF, mRenderOOBB );
+
+    // Flag render transform as calculated.
+    mRenderTransformPending = false;
+}
+
+//-----------------------------------------------------------------------------
+
 void SceneObject::sceneRenderFallback( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer )
 {
     // Debug Profiling.
@@ -775,13 +851,13 @@ void SceneObject::sceneRenderOverlay( const SceneRenderState* sceneRenderState )
     // OOBB debug draw.
     if ( debugMask & Scene::SCENE_DEBUG_OOBB )
     {
-        pScene->mDebugDraw.DrawOOBB( mRenderOOBB, ColorF(0.9f, 0.9f, 1.0f) );
+        pScene->mDebugDraw.DrawOOBB( getRenderOOBB(), ColorF(0.9f, 0.9f, 1.0f) );
     }
 
     // Asleep debug draw.
     if ( !getAwake() && debugMask & Scene::SCENE_DEBUG_SLEEP )
     {
-        pScene->mDebugDraw.DrawAsleep( mRenderOOBB, ColorF( 0.0f, 1.0f, 0.0f ) );
+        pScene->mDebugDraw.DrawAsleep( getRenderOOBB(), ColorF( 0.0f, 1.0f, 0.0f ) );
     }
 
     // Collision Shapes.
@@ -831,6 +907,109 @@ void SceneObject::setEnabled( const bool enabled )
     {
         mpBody->SetActive( enabled );
     }
+
+    // Update tick state.
+    updateTickState();
+}
+
+//-----------------------------------------------------------------------------
+
+U32 SceneObject::getTickFlags( void ) const
+{
+    U32 tickFlags = SceneTickState::TICK_NONE;
+
+    if ( isEnabled() )
+        tickFlags |= SceneTickState::TICK_ENABLED;
+
+    if ( mVisible )
+        tickFlags |= SceneTickState::TICK_VISIBLE;
+
+    if ( mBeingSafeDeleted )
+        tickFlags |= SceneTickState::TICK_BEING_DELETED;
+
+    if ( mPooled )
+        tickFlags |= SceneTickState::TICK_POOLED;
+
+    if ( hasCustomIntegration() )
+        tickFlags |= SceneTickState::TICK_CUSTOM_INTEGRATION;
+
+    if ( hasThreadSafeIntegration() )
+        tickFlags |= SceneTickState::TICK_THREAD_SAFE;
+
+    if ( mSpatialDirty )
+        tickFlags |= SceneTickState::TICK_SPATIAL_DIRTY;
+
+    // Lifetime and attachments are updated during integration regardless of movement.
+    if ( mLifetimeActive || mpAttachedGui != NULL || mpAttachedCamera != NULL )
+        tickFlags |= SceneTickState::TICK_INTEGRATE;
+
+    // Attachments are updated during interpolation regardless of movement.
+    if ( mpAttachedGui != NULL || mpAttachedCamera != NULL )
+        tickFlags |= SceneTickState::TICK_ATTACHED;
+
+    // Components and script callbacks are updated during post-integration.
+    if ( mUpdateCallback || mSleepingCallback || hasComponents() )
+        tickFlags |= SceneTickState::TICK_POST_INTEGRATE;
+
+    return tickFlags;
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObject::updateTickState( void )
+{
+    // Finish if not in a scene.
+    if ( !mpScene )
+        return;
+
+    // Fetch tick flags.
+    const U32 tickFlags = getTickFlags();
+
+    // Update the scene tick state.
+    mpScene->getTickState().setFlags( mSceneObjectIndex, tickFlags );
+
+    // Queue for interpolation if required.
+    if ( tickFlags & (SceneTickState::TICK_SPATIAL_DIRTY | SceneTickState::TICK_ATTACHED | SceneTickState::TICK_CUSTOM_INTEGRATION) )
+        mpScene->queueInterpolation( this );
+}
+
+//-----------------------------------------------------------------------------
+
+bool SceneObject::addComponent( SimComponent* pComponent )
+{
+    // Call parent.
+    const bool status = Parent::addComponent( pComponent );
+
+    // Update tick state.
+    updateTickState();
+
+    return status;
+}
+
+//-----------------------------------------------------------------------------
+
+bool SceneObject::removeComponent( SimComponent* pComponent )
+{
+    // Call parent.
+    const bool status = Parent::removeComponent( pComponent );
+
+    // Update tick state.
+    updateTickState();
+
+    return status;
+}
+
+//-----------------------------------------------------------------------------
+
+bool SceneObject::clearComponents( void )
+{
+    // Call parent.
+    const bool status = Parent::clearComponents();
+
+    // Update tick state.
+    updateTickState();
+
+    return status;
 }
 
 //-----------------------------------------------------------------------------
@@ -841,6 +1020,7 @@ void SceneObject::setLifetime( const F32 lifetime )
     PROFILE_SCOPE(SceneObject_setLifetime);
 
     // Usage Flag.
+    const bool lifetimeActive = mLifetimeActive;
     mLifetimeActive = mGreaterThanZero( lifetime );
 
     // Is life active?
@@ -854,6 +1034,10 @@ void SceneObject::setLifetime( const F32 lifetime )
         // No, so reset it to be safe.
         mLifetime = 0.0f;
     }
+
+    // Update tick state if the lifetime usage changed.
+    if ( mLifetimeActive != lifetimeActive )
+        updateTickState();
 }
 
 //-----------------------------------------------------------------------------
@@ -2694,7 +2878,9 @@ void SceneObject::attachGui( GuiControl* pGuiControl, SceneWindow* pSceneWindow,
         // Add it to the scene-window.
         mpAttachedGuiSceneWindow->addObject( mpAttachedGui );
     }
-    
+
+    // Update tick state.
+    updateTickState();
 }
 
 //-----------------------------------------------------------------------------
@@ -2716,6 +2902,9 @@ void SceneObject::detachGui( void )
         mpAttachedGuiSceneWindow->registerReference( (SimObject**)&mpAttachedGuiSceneWindow );
         mpAttachedGuiSceneWindow = NULL;
     }
+
+    // Update tick state.
+    updateTickState();
 }
 
 //-----------------------------------------------------------------------------
@@ -2877,6 +3066,7 @@ void SceneObject::copyTo( SimObject* obj )
 
     /// Misc.
     pSceneObject->setBatchIsolated( getBatchIsolated() );
+    pSceneObject->setSpatialHash( getSpatialHash() );
    
     /// Debug mode.
     setDebugOn( getDebugMask() );
@@ -3142,6 +3332,10 @@ S32 SceneObject::copyEdgeCollisionShapeTo( SceneObject* pSceneObject, const b2Fi
 
 void SceneObject::safeDelete( void )
 {
+    // Return pooled objects to their pool instead of deleting them.
+    if ( mpScenePool && mpScenePool->release( this ) )
+        return;
+
     // Are we in a scene?
     if ( getScene() )
     {
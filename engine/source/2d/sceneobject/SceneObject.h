@@ -88,6 +88,10 @@ const S32 INVALID_COLLISION_SHAPE_INDEX = -1;
 
 //-----------------------------------------------------------------------------
 
+class ScenePool;
+
+//-----------------------------------------------------------------------------
+
 extern EnumTable bodyTypeTable;
 extern EnumTable srcBlendFactorTable;
 extern EnumTable dstBlendFactorTable;
@@ -111,10 +115,12 @@ public:
     friend class DebugDraw;
     friend class SceneObjectMoveToEvent;
     friend class SceneObjectRotateToEvent;
+    friend class ScenePool;
 
 protected:
     /// Scene.
     SimObjectPtr<Scene>  mpScene;
+    S32                     mSceneObjectIndex;
 
     /// Target Scene.
     /// NOTE:   Unfortunately this is required as the scene can be set via a field which
@@ -142,14 +148,18 @@ protected:
     b2AABB                  mPreTickAABB;
     b2AABB                  mCurrentAABB;
     Vector2                 mLocalSizeOOBB[4];
-    Vector2                 mRenderOOBB[4];
+    mutable Vector2         mRenderOOBB[4];
     S32                     mWorldProxyId;
+    bool                    mWorldProxyHashed;
+    bool                    mSpatialHash;
 
     /// Position / Angle.
     Vector2                 mPreTickPosition;
     F32                     mPreTickAngle;
-    Vector2                 mRenderPosition;
-    F32                     mRenderAngle;
+    mutable Vector2         mRenderPosition;
+    mutable F32             mRenderAngle;
+    mutable bool            mRenderTransformPending;
+    F32                     mRenderInterpolation;
     bool                    mSpatialDirty;
 
     /// Body.
@@ -206,6 +216,10 @@ protected:
     bool                    mBeingSafeDeleted;
     bool                    mSafeDeleteReady;
 
+    /// Pooling.
+    ScenePool*              mpScenePool;
+    bool                    mPooled;
+
     /// Destroy notifications.
     typeDestroyNotificationVector mDestroyNotifyList;
 
@@ -231,6 +245,9 @@ protected:
     /// Ticking.
     void                    resetTickSpatials( const bool resize = false );
     inline bool             getSpatialDirty( void ) const { return mSpatialDirty; }
+    inline void             setSpatialDirty( const bool status )        { mSpatialDirty = status; if ( mpScene ) { mpScene->getTickState().setFlag( mSceneObjectIndex, SceneTickState::TICK_SPATIAL_DIRTY, status ); if ( status ) mpScene->queueInterpolation( this ); } }
+    inline void             setPreTickSpatials( void )                  { mRenderTransformPending = false; if ( mpScene ) mpScene->getTickState().setPreTick( mSceneObjectIndex, mPreTickPosition, mPreTickAngle ); }
+    void                    calculateRenderTransform( void ) const;
 
     /// Contact processing.
     void                    initializeContactGathering( void );
@@ -256,6 +273,17 @@ public:
     virtual void            interpolateObject( const F32 timeDelta );
     inline bool             getIsEditorTickAllowed( void ) const { return mEditorTickAllowed; }
 
+    /// Types overriding any of the integration stages above must return true here otherwise
+    /// the scene ticks them directly from its packed tick state, bypassing the overrides.
+    virtual bool            hasCustomIntegration( void ) const          { return false; }
+
+    /// Types whose integration stages only touch their own state may return true here so a parallel
+    /// scene can integrate them on the job pool. Anything that calls into script must return false.
+    virtual bool            hasThreadSafeIntegration( void ) const      { return !hasCustomIntegration(); }
+    void                    updateTickProxy( void );
+    U32                     getTickFlags( void ) const;
+    void                    updateTickState( void );
+
     /// Render batching.
     inline void             setBatchIsolated( const bool batchIsolated ) { mBatchIsolated = batchIsolated; }
     virtual bool            getBatchIsolated( void ) { return mBatchIsolated; }
@@ -282,6 +310,11 @@ public:
     /// Enabled.
     virtual void            setEnabled( const bool enabled );
 
+    /// Components.
+    virtual bool            addComponent( SimComponent* pComponent );
+    virtual bool            removeComponent( SimComponent* pComponent );
+    virtual bool            clearComponents( void );
+
     /// Lifetime.
     void                    setLifetime( const F32 lifetime );
     inline F32              getLifetime( void ) const                   { return mLifetime; }
@@ -315,13 +348,16 @@ public:
     inline b2AABB           getAABB( void ) const                       { return mCurrentAABB; }
     inline RectF            getAABBRectangle( void ) const              { const b2Vec2 size = mCurrentAABB.upperBound-mCurrentAABB.lowerBound; return RectF( mCurrentAABB.lowerBound.x, mCurrentAABB.lowerBound.y, size.x, size.y ); }
     inline S32              getWorldProxy( void ) const                 { return mWorldProxyId; }
+    void                    setSpatialHash( const bool spatialHash );
+    inline bool             getSpatialHash( void ) const                { return mSpatialHash; }
+    void                    refreshWorldProxy( void );
 
     /// Position / Angle.
     virtual void            setPosition( const Vector2& position );
     inline Vector2          getPosition(void) const                     { if ( mpScene ) return mpBody->GetPosition(); else return mBodyDefinition.position; }
-    inline Vector2          getRenderPosition(void) const               { return mRenderPosition; }
-    inline F32              getRenderAngle(void) const                  { return mRenderAngle; }
-    inline const b2Vec2*    getRenderOOBB(void) const                   { return mRenderOOBB; }
+    inline Vector2          getRenderPosition(void) const               { if ( mRenderTransformPending ) calculateRenderTransform(); return mRenderPosition; }
+    inline F32              getRenderAngle(void) const                  { if ( mRenderTransformPending ) calculateRenderTransform(); return mRenderAngle; }
+    inline const b2Vec2*    getRenderOOBB(void) const                   { if ( mRenderTransformPending ) calculateRenderTransform(); return mRenderOOBB; }
     inline const b2Vec2*    getLocalSizedOOBB( void ) const             { return mLocalSizeOOBB; }
     virtual void            setAngle( const F32 radians );
     inline F32              getAngle(void) const                        { if ( mpScene ) return mpBody->GetAngle(); else return mBodyDefinition.angle; }
@@ -475,7 +511,7 @@ public:
     Vector2                 getEdgeCollisionShapeAdjacentEnd( const U32 shapeIndex ) const;
 
     /// Render visibility.
-    inline void             setVisible( const bool status )             { mVisible = status; }
+    inline void             setVisible( const bool status )             { mVisible = status; updateTickState(); }
     inline bool             getVisible(void) const                      { return mVisible; }
 
     /// Render blending.
@@ -506,11 +542,11 @@ public:
     virtual void            onInputEvent( StringTableEntry name, const GuiEvent& event, const Vector2& worldMousePoint );
 
     // Script callbacks.
-    inline void             setUpdateCallback( bool status )            { mUpdateCallback = status; }
+    inline void             setUpdateCallback( bool status )            { mUpdateCallback = status; updateTickState(); }
     inline bool             getUpdateCallback( void ) const             { return mUpdateCallback; }
     inline void             setCollisionCallback( const bool status )   { mCollisionCallback = status; }
     inline bool             getCollisionCallback(void) const            { return mCollisionCallback; }
-    inline void             setSleepingCallback( bool status )          { mSleepingCallback = status; }
+    inline void             setSleepingCallback( bool status )          { mSleepingCallback = status; updateTickState(); }
     inline bool             getSleepingCallback( void ) const           { return mSleepingCallback; }
 
     /// Debug mode.
@@ -519,8 +555,8 @@ public:
     inline U32              getDebugMask( void ) const                  { return mDebugMask; }
 
     /// Camera mounting.
-    inline void             addCameraMountReference( SceneWindow* pAttachedCamera ) { mpAttachedCamera = pAttachedCamera; }
-    inline void             removeCameraMountReference( void )          { mpAttachedCamera = NULL; }
+    inline void             addCameraMountReference( SceneWindow* pAttachedCamera ) { mpAttachedCamera = pAttachedCamera; updateTickState(); }
+    inline void             removeCameraMountReference( void )          { mpAttachedCamera = NULL; updateTickState(); }
     inline void             dismountCamera( void )                      { if ( mpAttachedCamera ) mpAttachedCamera->dismountMe( this ); }
 
     // GUI attachment.
@@ -543,6 +579,10 @@ public:
     inline bool             isBeingDeleted( void ) const                { return mBeingSafeDeleted; }
     virtual void            safeDelete( void );
 
+    /// Pooling.
+    inline ScenePool*       getScenePool( void ) const                  { return mpScenePool; }
+    inline bool             getIsPooled( void ) const                   { return mPooled; }
+
     /// Destroy notifications.
     void                    addDestroyNotification( SceneObject* pSceneObject );
     void                    removeDestroyNotification( SceneObject* pSceneObject );
@@ -686,6 +726,7 @@ protected:
     static bool             writeGravityScale( void* obj, StringTableEntry pFieldName ) { return mNotEqual(static_cast<SceneObject*>(obj)->getGravityScale(), 1.0f); }
 
     /// Render visibility.
+    static bool             setVisible(void* obj, const char* data)     { static_cast<SceneObject*>(obj)->setVisible(dAtob(data)); return false; }
     static bool             writeVisible( void* obj, StringTableEntry pFieldName ) { return static_cast<SceneObject*>(obj)->getVisible() == false; }
 
     /// Render blending.
@@ -702,10 +743,16 @@ protected:
     /// Input events.
     static bool             writeUseInputEvents( void* obj, StringTableEntry pFieldName ) { return static_cast<SceneObject*>(obj)->getUseInputEvents() == true; }
 
+    /// Area.
+    static bool             setSpatialHash(void* obj, const char* data) { static_cast<SceneObject*>(obj)->setSpatialHash(dAtob(data)); return false; }
+    static bool             writeSpatialHash( void* obj, StringTableEntry pFieldName ) { return static_cast<SceneObject*>(obj)->getSpatialHash() == true; }
+
     /// Picking.
     static bool             writePickingAllowed( void* obj, StringTableEntry pFieldName ) { return static_cast<SceneObject*>(obj)->getPickingAllowed() == false; }    
 
     /// Script callbacks.
+    static bool             setUpdateCallback(void* obj, const char* data) { static_cast<SceneObject*>(obj)->setUpdateCallback(dAtob(data)); return false; }
+    static bool             setSleepingCallback(void* obj, const char* data) { static_cast<SceneObject*>(obj)->setSleepingCallback(dAtob(data)); return false; }
     static bool             writeUpdateCallback( void* obj, StringTableEntry pFieldName ) { return static_cast<SceneObject*>(obj)->getUpdateCallback() == true; }
     static bool             writeCollisionCallback( void* obj, StringTableEntry pFieldName ) { return static_cast<SceneObject*>(obj)->getCollisionCallback() == true; }
     static bool             writeSleepingCallback( void* obj, StringTableEntry pFieldName ) { return static_cast<SceneObject*>(obj)->getSleepingCallback() == true; }
@@ -3772,6 +3772,27 @@ ConsoleMethod(SceneObject, getPickingAllowed, bool, 2, 2,   "() - Gets whether p
 
 //-----------------------------------------------------------------------------
 
+ConsoleMethod(SceneObject, setSpatialHash, void, 3, 3,      "(bool spatialHash) - Sets whether the object is indexed by the scenes spatial hash rather than its dynamic tree.\n"
+                                                            "The spatial hash suits large numbers of small, fast-moving objects that do not need the tree.\n"
+                                                            "@param spatialHash Whether the object is indexed by the spatial hash or not.\n"
+                                                            "@return No return Value.")
+{
+    // Fetch flag.
+    const bool spatialHash = dAtob(argv[2]);
+
+    object->setSpatialHash( spatialHash );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(SceneObject, getSpatialHash, bool, 2, 2,      "() - Gets whether the object is indexed by the scenes spatial hash rather than its dynamic tree.\n"
+                                                            "@return Whether the object is indexed by the spatial hash or not.")
+{
+    return object->getSpatialHash();
+}
+
+//-----------------------------------------------------------------------------
+
 ConsoleMethod(SceneObject, safeDelete, void, 2, 2, "() - Safely deletes object.\n"
                                                                  "@return No return Value.")
 {
@@ -253,7 +253,7 @@ void Scroller::sceneRender( const SceneRenderState* pSceneRenderState, const Sce
         return;
 
     // Fetch texture and texture area.
-    const ImageAsset::FrameArea::TexelArea& frameTexelArea = getProviderImageFrameArea().mTexelArea;
+    const ImageAsset::FrameArea::TexelArea frameTexelArea = getProviderImageFrameArea().mTexelArea;
     TextureHandle& texture = getProviderTexture();
 
     // Calculate render offset.
@@ -287,9 +287,10 @@ void Scroller::sceneRender( const SceneRenderState* pSceneRenderState, const Sce
     baseSplitRegion.mTexSplitUpperY2 = baseSplitRegion.mTexSplitLowerY1;
 
     // Fetch render area.
-    const Vector2& renderOOBB0 = mRenderOOBB[0];
-    const Vector2& renderOOBB1 = mRenderOOBB[1];
-    const Vector2& renderOOBB3 = mRenderOOBB[3];
+    const b2Vec2* pRenderOOBB = getRenderOOBB();
+    const Vector2& renderOOBB0 = pRenderOOBB[0];
+    const Vector2& renderOOBB1 = pRenderOOBB[1];
+    const Vector2& renderOOBB3 = pRenderOOBB[3];
 
     // Calculate region dimensions.
     const F32 regionWidth = (renderOOBB1.x - renderOOBB0.x) / mRepeatX;
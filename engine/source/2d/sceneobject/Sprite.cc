@@ -86,13 +86,16 @@ void Sprite::initPersistFields()
 
 void Sprite::sceneRender( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer )
 {
+    // Fetch render OOBB.
+    const b2Vec2* pRenderOOBB = getRenderOOBB();
+
     // Let the parent render.
     ImageFrameProvider::render(
         getFlipX(), getFlipY(),
-        mRenderOOBB[0],
-        mRenderOOBB[1],
-        mRenderOOBB[2],
-        mRenderOOBB[3],
+        pRenderOOBB[0],
+        pRenderOOBB[1],
+        pRenderOOBB[2],
+        pRenderOOBB[3],
         pBatchRenderer );
 }
 
@@ -54,6 +54,26 @@
 #include "console/consoleTypes.h"
 #endif
 
+#ifndef _STRINGUNIT_H_
+#include "string/stringUnit.h"
+#endif
+
+#ifndef _MODULE_MANAGER_H
+#include "module/moduleManager.h"
+#endif
+
+#ifndef _TEXTURE_MANAGER_H_
+#include "graphics/TextureManager.h"
+#endif
+
+#ifndef _TEXTURE_CACHE_H_
+#include "graphics/TextureCache.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_JOBPOOL_H_
+#include "platform/threads/jobPool.h"
+#endif
+
 // Script bindings.
 #include "assetManager_ScriptBinding.h"
 
@@ -67,6 +87,39 @@ AssetManager AssetDatabase;
 
 //-----------------------------------------------------------------------------
 
+struct AsyncAcquireRequest
+{
+    struct LoadItem
+    {
+        StringTableEntry    mAssetId;
+        U32                 mFirstTexture;
+        U32                 mTextureCount;
+    };
+
+    U32                                 mRequestId;
+    Vector<StringTableEntry>            mRequestedAssetIds;
+    Vector<LoadItem>                    mLoadOrder;
+    Vector<StringTableEntry>            mTextureFiles;
+    Vector<bool>                        mTexturesPrefetched;
+    U32                                 mStartedTextures;
+    U32                                 mAcquiredCount;
+    AssetManager::AsyncAcquireCallback  mCallback;
+    void*                               mpUserData;
+};
+
+//-----------------------------------------------------------------------------
+
+static void startAsyncAcquireTexture( AsyncAcquireRequest* pRequest )
+{
+    const U32 index = pRequest->mStartedTextures++;
+
+    // Only the bitmap is prefetched so the asset loads its texture with its own settings.
+    // A bitmap that fails to start is decoded when the asset is acquired.
+    pRequest->mTexturesPrefetched[index] = TextureManager::prefetchBitmap( pRequest->mTextureFiles[index] );
+}
+
+//-----------------------------------------------------------------------------
+
 AssetManager::AssetManager() :
     mLoadedInternalAssetsCount( 0 ),
     mLoadedExternalAssetsCount( 0 ),
@@ -76,7 +129,16 @@ AssetManager::AssetManager() :
     mMaxLoadedPrivateAssetsCount( 0 ),
     mAcquiredReferenceCount( 0 ),
     mEchoInfo( false ),
-    mIgnoreAutoUnload( false )
+    mIgnoreAutoUnload( false ),
+    mManifestCacheFile( StringTable->EmptyString ),
+    mManifestCacheLoaded( false ),
+    mDeclaredScanTime( 0 ),
+    mReferencedScanTime( 0 ),
+    mManifestCacheLoadTime( 0 ),
+    mManifestFilesParsed( 0 ),
+    mManifestFilesCached( 0 ),
+    mNextAsyncAcquireRequestId( 1 ),
+    mAsyncAcquireBudget( 4.0f )
 {
 }
 
@@ -95,6 +157,15 @@ bool AssetManager::onAdd()
 
 void AssetManager::onRemove()
 {
+    // Cancel any asynchronous acquisitions.
+    while ( mAsyncAcquireRequests.size() > 0 )
+    {
+        cancelAsyncAcquire( mAsyncAcquireRequests.last()->mRequestId );
+    }
+
+    // Save any changes to the manifest cache.
+    saveManifestCache();
+
     // Do we have an asset tags manifest?
     if ( !mAssetTagsManifest.isNull() )
     {
@@ -115,6 +186,8 @@ void AssetManager::initPersistFields()
 
     addField( "EchoInfo", TypeBool, Offset(mEchoInfo, AssetManager), "Whether the asset manager echos extra information to the console or not." );
     addField( "IgnoreAutoUnload", TypeBool, Offset(mIgnoreAutoUnload, AssetManager), "Whether the asset manager should ignore unloading of auto-unload assets or not." );
+    addField( "ManifestCacheFile", TypeString, Offset(mManifestCacheFile, AssetManager), "The file used to cache parsed asset declarations and references between runs.  No caching is done if empty." );
+    addField( "AsyncAcquireBudget", TypeF32, Offset(mAsyncAcquireBudget, AssetManager), "The time in milliseconds spent acquiring assets asynchronously each frame." );
 }
 
 //-----------------------------------------------------------------------------
@@ -127,6 +200,8 @@ bool AssetManager::compileReferencedAssets( ModuleDefinition* pModuleDefinition
     // Sanity!
     AssertFatal( pModuleDefinition != NULL, "Cannot add declared assets using a NULL module definition" );
 
+    const U32 startTime = Platform::getRealMilliseconds();
+
     // Clear referenced assets.
     mReferencedAssets.clear();
 
@@ -152,6 +227,9 @@ bool AssetManager::compileReferencedAssets( ModuleDefinition* pModuleDefinition
         }
     }  
 
+    // Accumulate the time spent scanning.
+    mReferencedScanTime += Platform::getRealMilliseconds() - startTime;
+
     return true;
 }
 
@@ -173,6 +251,8 @@ bool AssetManager::addModuleDeclaredAssets( ModuleDefinition* pModuleDefinition
         return false;
     }
 
+    const U32 startTime = Platform::getRealMilliseconds();
+
     // Iterate the module definition children.
     for( SimSet::iterator itr = pModuleDefinition->begin(); itr != pModuleDefinition->end(); ++itr )
     {
@@ -195,6 +275,9 @@ bool AssetManager::addModuleDeclaredAssets( ModuleDefinition* pModuleDefinition
         }
     }  
 
+    // Accumulate the time spent scanning.
+    mDeclaredScanTime += Platform::getRealMilliseconds() - startTime;
+
     return true;
 }
 
@@ -1003,6 +1086,303 @@ void AssetManager::purgeAssets( void )
 
 //-----------------------------------------------------------------------------
 
+U32 AssetManager::acquireAssetsAsync( const Vector<StringTableEntry>& assetIds, AsyncAcquireCallback callback, void* pUserData )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_AcquireAssetsAsync);
+
+    // Resolve the load order with dependencies ahead of the assets that depend on them.
+    Vector<StringTableEntry> loadOrder;
+    Vector<StringTableEntry> visiting;
+    for ( S32 index = 0; index < assetIds.size(); ++index )
+    {
+        resolveAssetLoadOrder( assetIds[index], loadOrder, visiting );
+    }
+
+    // Create the request.
+    AsyncAcquireRequest* pRequest = new AsyncAcquireRequest();
+    pRequest->mRequestId = mNextAsyncAcquireRequestId++;
+    pRequest->mStartedTextures = 0;
+    pRequest->mAcquiredCount = 0;
+    pRequest->mCallback = callback;
+    pRequest->mpUserData = pUserData;
+
+    // Keep the requested assets that exist.
+    for ( S32 index = 0; index < assetIds.size(); ++index )
+    {
+        if ( findAsset( assetIds[index] ) != NULL )
+            pRequest->mRequestedAssetIds.push_back( assetIds[index] );
+    }
+
+    // Prefetch the loose files of each asset in load order.
+    for ( S32 index = 0; index < loadOrder.size(); ++index )
+    {
+        prefetchAssetLooseFiles( pRequest, loadOrder[index] );
+    }
+
+    // Start decoding the textures on the job pool.
+    // Without workers each decode would run here so they are started in the budgeted processing instead.
+    if ( JobPool::Instance != NULL && JobPool::Instance->getWorkerCount() > 0 )
+    {
+        while ( pRequest->mStartedTextures < (U32)pRequest->mTextureFiles.size() )
+            startAsyncAcquireTexture( pRequest );
+    }
+
+    // Info.
+    if ( mEchoInfo )
+    {
+        Con::printf( "Asset Manager: Started asynchronous acquisition %d of %d asset(s) (%d texture(s) queued).",
+            pRequest->mRequestId, pRequest->mLoadOrder.size(), pRequest->mTextureFiles.size() );
+    }
+
+    mAsyncAcquireRequests.push_back( pRequest );
+
+    return pRequest->mRequestId;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::processAsyncAcquisitions( void )
+{
+    // Finish if nothing to process.
+    if ( mAsyncAcquireRequests.size() == 0 )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_ProcessAsyncAcquisitions);
+
+    const U32 startTime = Platform::getRealMilliseconds();
+    const U32 budget = (U32)getMax( mAsyncAcquireBudget, 0.0f );
+    bool madeProgress = false;
+
+    // Requests are processed in the order they were made.
+    while ( mAsyncAcquireRequests.size() > 0 )
+    {
+        AsyncAcquireRequest* pRequest = mAsyncAcquireRequests.first();
+
+        // Acquire assets in load order.
+        while ( pRequest->mAcquiredCount < (U32)pRequest->mLoadOrder.size() )
+        {
+            // Finish if the budget is spent.
+            // At least one asset is acquired each frame so progress is always made.
+            if ( madeProgress && (Platform::getRealMilliseconds() - startTime) >= budget )
+                return;
+
+            const AsyncAcquireRequest::LoadItem& loadItem = pRequest->mLoadOrder[pRequest->mAcquiredCount];
+
+            // Start the asset's deferred textures one at a time as each may decode synchronously.
+            if ( pRequest->mStartedTextures < loadItem.mFirstTexture + loadItem.mTextureCount )
+            {
+                startAsyncAcquireTexture( pRequest );
+                madeProgress = true;
+                continue;
+            }
+
+            // Wait if the asset's textures are still decoding.
+            for ( U32 textureIndex = 0; textureIndex < loadItem.mTextureCount; ++textureIndex )
+            {
+                if ( TextureManager::isBitmapPrefetchPending( pRequest->mTextureFiles[loadItem.mFirstTexture + textureIndex] ) )
+                    return;
+            }
+
+            // Acquire the asset.
+            // The textures are already resident so this only reads and registers the asset.
+            if ( acquireAsset<AssetBase>( loadItem.mAssetId ) == NULL )
+            {
+                // Warn.
+                Con::warnf( "Asset Manager: Asynchronous acquisition %d failed to acquire asset Id '%s'.", pRequest->mRequestId, loadItem.mAssetId );
+            }
+
+            pRequest->mAcquiredCount++;
+            madeProgress = true;
+        }
+
+        // Remove the request before notifying in case the callback makes another.
+        mAsyncAcquireRequests.pop_front();
+
+        // Release the dependency references.
+        releaseAsyncAcquire( pRequest, false );
+
+        // Info.
+        if ( mEchoInfo )
+        {
+            Con::printf( "Asset Manager: Finished asynchronous acquisition %d.", pRequest->mRequestId );
+        }
+
+        // Notify.
+        if ( pRequest->mCallback != NULL )
+            pRequest->mCallback( pRequest->mRequestId, pRequest->mpUserData );
+
+        if ( isMethod( "onAsyncAcquireComplete" ) )
+            Con::executef( this, 2, "onAsyncAcquireComplete", Con::getIntArg( pRequest->mRequestId ) );
+
+        delete pRequest;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+F32 AssetManager::getAsyncAcquireProgress( const U32 requestId ) const
+{
+    for ( S32 index = 0; index < mAsyncAcquireRequests.size(); ++index )
+    {
+        const AsyncAcquireRequest* pRequest = mAsyncAcquireRequests[index];
+
+        if ( pRequest->mRequestId != requestId )
+            continue;
+
+        // Count decoded textures and acquired assets equally.
+        U32 completed = pRequest->mAcquiredCount;
+        for ( U32 textureIndex = 0; textureIndex < pRequest->mStartedTextures; ++textureIndex )
+        {
+            if ( !TextureManager::isBitmapPrefetchPending( pRequest->mTextureFiles[textureIndex] ) )
+                completed++;
+        }
+
+        const U32 total = pRequest->mLoadOrder.size() + pRequest->mTextureFiles.size();
+        return total == 0 ? 1.0f : (F32)completed / (F32)total;
+    }
+
+    // Unknown requests are complete.
+    return 1.0f;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetManager::cancelAsyncAcquire( const U32 requestId )
+{
+    for ( S32 index = 0; index < mAsyncAcquireRequests.size(); ++index )
+    {
+        AsyncAcquireRequest* pRequest = mAsyncAcquireRequests[index];
+
+        if ( pRequest->mRequestId != requestId )
+            continue;
+
+        mAsyncAcquireRequests.erase( index );
+
+        // Release everything acquired so far.
+        releaseAsyncAcquire( pRequest, true );
+
+        delete pRequest;
+        return true;
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::resolveAssetLoadOrder( StringTableEntry assetId, Vector<StringTableEntry>& loadOrder, Vector<StringTableEntry>& visiting )
+{
+    // Finish if already resolved.
+    for ( S32 index = 0; index < loadOrder.size(); ++index )
+    {
+        if ( loadOrder[index] == assetId )
+            return;
+    }
+
+    // Finish if the asset is already being resolved.
+    for ( S32 index = 0; index < visiting.size(); ++index )
+    {
+        if ( visiting[index] == assetId )
+        {
+            // Warn.
+            Con::warnf( "Asset Manager: Found a cyclic dependency on asset Id '%s'.", assetId );
+            return;
+        }
+    }
+
+    // Warn if the asset does not exist.
+    if ( findAsset( assetId ) == NULL )
+    {
+        Con::warnf( "Asset Manager: Cannot acquire asset Id '%s' asynchronously as it does not exist.", assetId );
+        return;
+    }
+
+    visiting.push_back( assetId );
+
+    // Resolve dependencies first.
+    typeAssetDependsOnHash::iterator assetDependenciesItr = mAssetDependsOn.find( assetId );
+    while( assetDependenciesItr != mAssetDependsOn.end() && assetDependenciesItr->key == assetId )
+    {
+        resolveAssetLoadOrder( assetDependenciesItr->value, loadOrder, visiting );
+        assetDependenciesItr++;
+    }
+
+    visiting.pop_back();
+
+    loadOrder.push_back( assetId );
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::prefetchAssetLooseFiles( AsyncAcquireRequest* pRequest, StringTableEntry assetId )
+{
+    AssetDefinition* pAssetDefinition = findAsset( assetId );
+
+    AsyncAcquireRequest::LoadItem loadItem;
+    loadItem.mAssetId = assetId;
+    loadItem.mFirstTexture = pRequest->mTextureFiles.size();
+    loadItem.mTextureCount = 0;
+
+    // Queue the loose images of unloaded assets for decoding.
+    if ( pAssetDefinition->mpAssetBase == NULL )
+    {
+        for ( S32 index = 0; index < pAssetDefinition->mAssetLooseFiles.size(); ++index )
+        {
+            StringTableEntry looseFile = pAssetDefinition->mAssetLooseFiles[index];
+
+            // Skip anything that is not a decodable image.
+            if ( !TextureCache::canCache( looseFile ) )
+                continue;
+
+            pRequest->mTextureFiles.push_back( looseFile );
+            pRequest->mTexturesPrefetched.push_back( false );
+            loadItem.mTextureCount++;
+        }
+    }
+
+    pRequest->mLoadOrder.push_back( loadItem );
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::releaseAsyncAcquire( AsyncAcquireRequest* pRequest, const bool releaseRequested )
+{
+    // Release the acquired assets.
+    // Requested assets are kept for the caller unless cancelled.
+    for ( U32 index = 0; index < pRequest->mAcquiredCount; ++index )
+    {
+        StringTableEntry assetId = pRequest->mLoadOrder[index].mAssetId;
+
+        bool requested = false;
+        for ( S32 requestedIndex = 0; requestedIndex < pRequest->mRequestedAssetIds.size(); ++requestedIndex )
+        {
+            if ( pRequest->mRequestedAssetIds[requestedIndex] == assetId )
+            {
+                requested = true;
+                break;
+            }
+        }
+
+        if ( requested && !releaseRequested )
+            continue;
+
+        AssetDefinition* pAssetDefinition = findAsset( assetId );
+        if ( pAssetDefinition != NULL && pAssetDefinition->mpAssetBase != NULL )
+            releaseAsset( assetId );
+    }
+
+    // Drop any prefetched bitmaps that were not used.
+    for ( U32 index = 0; index < pRequest->mStartedTextures; ++index )
+    {
+        if ( pRequest->mTexturesPrefetched[index] )
+            TextureManager::releasePrefetchedBitmap( pRequest->mTextureFiles[index] );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 bool AssetManager::deleteAsset( const char* pAssetId, const bool deleteLooseFiles, const bool deleteDependencies )
 {
     // Debug Profiling.
@@ -1546,6 +1926,36 @@ void AssetManager::dumpDeclaredAssets( void ) const
 
 //-----------------------------------------------------------------------------
 
+void AssetManager::dumpStartupMetrics( void ) const
+{
+    // Info.
+    Con::printSeparator();
+    Con::printf( "Asset Manager: Startup metrics:" );
+    Con::printf( "  Module scanning: %dms", ModuleDatabase.getScanModulesTime() );
+    Con::printf( "  Declared asset scanning: %dms", mDeclaredScanTime );
+    Con::printf( "  Referenced asset scanning: %dms", mReferencedScanTime );
+    Con::printf( "  Manifest cache load: %dms", mManifestCacheLoadTime );
+    Con::printf( "  Manifest files: %d parsed, %d cached", mManifestFilesParsed, mManifestFilesCached );
+    Con::printf( "  Declared assets: %d", mDeclaredAssets.size() );
+    Con::printSeparator();
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetManager::saveManifestCache( void )
+{
+    // Finish if caching is disabled or there are no changes.
+    if ( !mManifestCacheLoaded || !mManifestCache.isDirty() || mManifestCacheFile == NULL || *mManifestCacheFile == 0 )
+        return false;
+
+    char cacheFileBuffer[1024];
+    Con::expandPath( cacheFileBuffer, sizeof(cacheFileBuffer), mManifestCacheFile );
+
+    return mManifestCache.save( cacheFileBuffer );
+}
+
+//-----------------------------------------------------------------------------
+
 S32 AssetManager::findAllAssets( AssetQuery* pAssetQuery, const bool ignoreInternal, const bool ignorePrivate )
 {
     // Debug Profiling.
@@ -2353,6 +2763,9 @@ bool AssetManager::scanDeclaredAssets( const char* pPath, const char* pExtension
 
     TamlAssetDeclaredVisitor assetDeclaredVisitor;
 
+    // Fetch the manifest cache.
+    AssetManifestCache* pManifestCache = getManifestCache();
+
     // Iterate files.
     for ( Vector<Platform::FileInfo>::iterator fileItr = files.begin(); fileItr != files.end(); ++fileItr )
     {
@@ -2380,23 +2793,50 @@ bool AssetManager::scanDeclaredAssets( const char* pPath, const char* pExtension
         char assetFileBuffer[1024];
         dSprintf( assetFileBuffer, sizeof(assetFileBuffer), "%s/%s", fileInfo.pFullPath, fileInfo.pFileName );
 
-        // Parse the filename.
-        if ( !assetDeclaredVisitor.parse( assetFileBuffer ) )
-        {
-            // Warn.
-            Con::warnf( "Asset Manager: Failed to parse file containing asset declaration: '%s'.", assetFileBuffer );
-            continue;
-        }
-
         // Fetch asset definition.
         AssetDefinition& foundAssetDefinition = assetDeclaredVisitor.getAssetDefinition();
 
-        // Did we get an asset name?
-        if ( foundAssetDefinition.mAssetName == StringTable->EmptyString )
+        // Fetch the file stamp used to validate the manifest cache.
+        StringTableEntry assetFilePath = StringTable->insert( assetFileBuffer );
+        U32 fileSize = 0;
+        FileTime modifyTime;
+        const bool fileStamped = pManifestCache != NULL && AssetManifestCache::getFileStamp( assetFilePath, fileSize, modifyTime );
+
+        // Is the declaration cached?
+        const AssetManifestCache::DeclaredEntry* pCachedEntry = fileStamped ? pManifestCache->findDeclared( assetFilePath, fileSize, modifyTime ) : NULL;
+        if ( pCachedEntry != NULL )
         {
-            // No, so warn.
-            Con::warnf( "Asset Manager: Parsed file '%s' but did not encounter an asset.", assetFileBuffer );
-            continue;
+            // Yes, so use it rather than parsing the file.
+            foundAssetDefinition = pCachedEntry->mAssetDefinition;
+            assetDeclaredVisitor.getAssetDependencies() = pCachedEntry->mAssetDependencies;
+            assetDeclaredVisitor.getAssetLooseFiles() = pCachedEntry->mAssetLooseFiles;
+            mManifestFilesCached++;
+        }
+        else
+        {
+            // No, so parse the filename.
+            if ( !assetDeclaredVisitor.parse( assetFileBuffer ) )
+            {
+                // Warn.
+                Con::warnf( "Asset Manager: Failed to parse file containing asset declaration: '%s'.", assetFileBuffer );
+                continue;
+            }
+
+            mManifestFilesParsed++;
+
+            // Did we get an asset name?
+            if ( foundAssetDefinition.mAssetName == StringTable->EmptyString )
+            {
+                // No, so warn.
+                Con::warnf( "Asset Manager: Parsed file '%s' but did not encounter an asset.", assetFileBuffer );
+                continue;
+            }
+
+            // Cache the declaration.
+            if ( fileStamped )
+            {
+                pManifestCache->storeDeclared( assetFilePath, fileSize, modifyTime, foundAssetDefinition, assetDeclaredVisitor.getAssetDependencies(), assetDeclaredVisitor.getAssetLooseFiles() );
+            }
         }
 
         // Set module definition.
@@ -2544,6 +2984,11 @@ bool AssetManager::scanReferencedAssets( const char* pPath, const char* pExtensi
 
     TamlAssetReferencedVisitor assetReferencedVisitor;
 
+    // Fetch the manifest cache.
+    AssetManifestCache* pManifestCache = getManifestCache();
+
+    Vector<StringTableEntry> referencedAssetIds;
+
     // Iterate files.
     for ( Vector<Platform::FileInfo>::iterator fileItr = files.begin(); fileItr != files.end(); ++fileItr )
     {
@@ -2574,19 +3019,50 @@ bool AssetManager::scanReferencedAssets( const char* pPath, const char* pExtensi
         // Format reference file-path.
         typeReferenceFilePath referenceFilePath = StringTable->insert( assetFileBuffer );
 
-        // Parse the filename.
-        if ( !assetReferencedVisitor.parse( referenceFilePath ) )
+        // Fetch the file stamp used to validate the manifest cache.
+        U32 fileSize = 0;
+        FileTime modifyTime;
+        const bool fileStamped = pManifestCache != NULL && AssetManifestCache::getFileStamp( referenceFilePath, fileSize, modifyTime );
+
+        // Are the references cached?
+        const AssetManifestCache::ReferencedEntry* pCachedEntry = fileStamped ? pManifestCache->findReferenced( referenceFilePath, fileSize, modifyTime ) : NULL;
+        if ( pCachedEntry != NULL )
         {
-            // Warn.
-            Con::warnf( "Asset Manager: Failed to parse file containing asset references: '%s'.", referenceFilePath );
-            continue;
+            // Yes, so use them rather than parsing the file.
+            referencedAssetIds = pCachedEntry->mReferencedAssetIds;
+            mManifestFilesCached++;
         }
+        else
+        {
+            // No, so parse the filename.
+            if ( !assetReferencedVisitor.parse( referenceFilePath ) )
+            {
+                // Warn.
+                Con::warnf( "Asset Manager: Failed to parse file containing asset references: '%s'.", referenceFilePath );
+                continue;
+            }
+
+            mManifestFilesParsed++;
+
+            // Fetch usage map.
+            const TamlAssetReferencedVisitor::typeAssetReferencedHash& assetReferencedMap = assetReferencedVisitor.getAssetReferencedMap();
+
+            // Fetch the referenced asset Ids.
+            referencedAssetIds.clear();
+            for( TamlAssetReferencedVisitor::typeAssetReferencedHash::const_iterator usageItr = assetReferencedMap.begin(); usageItr != assetReferencedMap.end(); ++usageItr )
+            {
+                referencedAssetIds.push_back( usageItr->key );
+            }
 
-        // Fetch usage map.
-        const TamlAssetReferencedVisitor::typeAssetReferencedHash& assetReferencedMap = assetReferencedVisitor.getAssetReferencedMap();
+            // Cache the references.
+            if ( fileStamped )
+            {
+                pManifestCache->storeReferenced( referenceFilePath, fileSize, modifyTime, referencedAssetIds );
+            }
+        }
 
         // Do we have any asset references?
-        if ( assetReferencedMap.size() > 0 )
+        if ( referencedAssetIds.size() > 0 )
         {
             // Info.
             if ( mEchoInfo )
@@ -2595,10 +3071,10 @@ bool AssetManager::scanReferencedAssets( const char* pPath, const char* pExtensi
             }
 
             // Iterate usage.
-            for( TamlAssetReferencedVisitor::typeAssetReferencedHash::const_iterator usageItr = assetReferencedMap.begin(); usageItr != assetReferencedMap.end(); ++usageItr )
+            for( Vector<StringTableEntry>::iterator usageItr = referencedAssetIds.begin(); usageItr != referencedAssetIds.end(); ++usageItr )
             {
                 // Fetch asset name.
-                typeAssetId assetId = usageItr->key;
+                typeAssetId assetId = *usageItr;
 
                 // Info.
                 if ( mEchoInfo )
@@ -2625,6 +3101,37 @@ bool AssetManager::scanReferencedAssets( const char* pPath, const char* pExtensi
 
 //-----------------------------------------------------------------------------
 
+AssetManifestCache* AssetManager::getManifestCache( void )
+{
+    // Finish if caching is disabled.
+    if ( mManifestCacheFile == NULL || *mManifestCacheFile == 0 )
+        return NULL;
+
+    // Load the cache the first time it is needed.
+    if ( !mManifestCacheLoaded )
+    {
+        const U32 startTime = Platform::getRealMilliseconds();
+
+        char cacheFileBuffer[1024];
+        Con::expandPath( cacheFileBuffer, sizeof(cacheFileBuffer), mManifestCacheFile );
+        mManifestCache.load( cacheFileBuffer );
+        mManifestCacheLoaded = true;
+
+        mManifestCacheLoadTime += Platform::getRealMilliseconds() - startTime;
+
+        // Info.
+        if ( mEchoInfo )
+        {
+            Con::printf( "Asset Manager: Loaded manifest cache '%s' with %d declared and %d referenced file(s).",
+                cacheFileBuffer, mManifestCache.getDeclaredCount(), mManifestCache.getReferencedCount() );
+        }
+    }
+
+    return &mManifestCache;
+}
+
+//-----------------------------------------------------------------------------
+
 AssetDefinition* AssetManager::findAsset( const char* pAssetId )
 {
     // Debug Profiling.
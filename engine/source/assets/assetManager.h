@@ -55,6 +55,10 @@
 #include "assets/assetQuery.h"
 #endif
 
+#ifndef _ASSET_MANIFEST_CACHE_H_
+#include "assets/assetManifestCache.h"
+#endif
+
 #ifndef _ASSET_FIELD_TYPES_H_
 #include "assets/assetFieldTypes.h"
 #endif
@@ -66,6 +70,7 @@
 
 class AssetPtrCallback;
 class AssetPtrBase;
+struct AsyncAcquireRequest;
 
 //-----------------------------------------------------------------------------
 
@@ -111,6 +116,27 @@ private:
     U32                                 mMaxLoadedPrivateAssetsCount;
     Taml                                mTaml;
 
+    /// Manifest cache.
+    AssetManifestCache                  mManifestCache;
+    StringTableEntry                    mManifestCacheFile;
+    bool                                mManifestCacheLoaded;
+
+    /// Startup metrics.
+    U32                                 mDeclaredScanTime;
+    U32                                 mReferencedScanTime;
+    U32                                 mManifestCacheLoadTime;
+    U32                                 mManifestFilesParsed;
+    U32                                 mManifestFilesCached;
+
+    /// Asynchronous acquisition.
+    Vector<AsyncAcquireRequest*>        mAsyncAcquireRequests;
+    U32                                 mNextAsyncAcquireRequestId;
+    F32                                 mAsyncAcquireBudget;
+
+public:
+    /// Called once all assets in an asynchronous acquisition are acquired.
+    typedef void (*AsyncAcquireCallback)( const U32 requestId, void* pUserData );
+
 public:
     AssetManager();
     virtual ~AssetManager() {}
@@ -322,6 +348,17 @@ public:
     bool releaseAsset( const char* pAssetId );
     void purgeAssets( void );
 
+    /// Asynchronous asset acquisition.
+    /// Dependencies are acquired before the assets that depend on them and loose image files are
+    /// decoded on the job pool ahead of time. Without job pool workers the decodes are spread over
+    /// the budgeted processing instead. The requested assets stay acquired once complete and
+    /// must be released by the caller.
+    U32 acquireAssetsAsync( const Vector<StringTableEntry>& assetIds, AsyncAcquireCallback callback = NULL, void* pUserData = NULL );
+    void processAsyncAcquisitions( void );
+    F32 getAsyncAcquireProgress( const U32 requestId ) const;
+    bool cancelAsyncAcquire( const U32 requestId );
+    inline U32 getAsyncAcquireCount( void ) const { return (U32)mAsyncAcquireRequests.size(); }
+
     /// Asset deletion.
     bool deleteAsset( const char* pAssetId, const bool deleteLooseFiles, const bool deleteDependencies );
 
@@ -347,6 +384,10 @@ public:
     inline U32 getMaxLoadedExternalAssetCount( void ) const { return mMaxLoadedExternalAssetsCount; }
     inline U32 getMaxLoadedPrivateAssetCount( void ) const { return mMaxLoadedPrivateAssetsCount; }
     void dumpDeclaredAssets( void ) const;
+    void dumpStartupMetrics( void ) const;
+
+    /// Manifest cache.
+    bool saveManifestCache( void );
 
     /// Total acquired asset references.
     inline void acquireAcquiredReferenceCount( void ) { mAcquiredReferenceCount++; }
@@ -373,6 +414,7 @@ public:
 private:
     bool scanDeclaredAssets( const char* pPath, const char* pExtension, const bool recurse, ModuleDefinition* pModuleDefinition );
     bool scanReferencedAssets( const char* pPath, const char* pExtension, const bool recurse );
+    AssetManifestCache* getManifestCache( void );
     AssetDefinition* findAsset( const char* pAssetId );
     void addReferencedAsset( StringTableEntry assetId, StringTableEntry referenceFilePath );
     void renameAssetReferences( StringTableEntry assetIdFrom, StringTableEntry assetIdTo );
@@ -381,6 +423,9 @@ private:
     void removeAssetDependencies( const char* pAssetId );
     void removeAssetLooseFiles( const char* pAssetId );
     void unloadAsset( AssetDefinition* pAssetDefinition );
+    void resolveAssetLoadOrder( StringTableEntry assetId, Vector<StringTableEntry>& loadOrder, Vector<StringTableEntry>& visiting );
+    void prefetchAssetLooseFiles( AsyncAcquireRequest* pRequest, StringTableEntry assetId );
+    void releaseAsyncAcquire( AsyncAcquireRequest* pRequest, const bool releaseRequested );
 
     /// Module callbacks.
     virtual void onModulePreLoad( ModuleDefinition* pModuleDefinition );
@@ -331,6 +331,54 @@ ConsoleMethod( AssetManager, purgeAssets, void, 2, 2,           "() - Purge all
 
 //-----------------------------------------------------------------------------
 
+ConsoleMethod( AssetManager, acquireAssetsAsync, S32, 3, 3,    "(assetIds) - Acquire the specified asset Id(s) asynchronously along with their dependencies.\n"
+                                                                "The assets are acquired over several frames and 'onAsyncAcquireComplete(requestId)' is called on the asset manager when done.\n"
+                                                                "The asset(s) should be released using 'releaseAsset' once complete.\n"
+                                                                "@param assetIds The space-separated asset Id(s) to acquire.\n"
+                                                                "@return The asynchronous acquisition request Id.")
+{
+    // Fetch element count.
+    const U32 elementCount = StringUnit::getUnitCount( argv[2], " \t\n" );
+
+    // Fetch asset Ids.
+    Vector<StringTableEntry> assetIds;
+    for ( U32 index = 0; index < elementCount; ++index )
+    {
+        assetIds.push_back( StringTable->insert( StringUnit::getUnit( argv[2], index, " \t\n" ) ) );
+    }
+
+    // Acquire assets.
+    return object->acquireAssetsAsync( assetIds );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod( AssetManager, getAsyncAcquireProgress, F32, 3, 3, "(requestId) - Gets the progress of an asynchronous acquisition.\n"
+                                                                "@param requestId The asynchronous acquisition request Id.\n"
+                                                                "@return The progress from zero to one.  Unknown or completed requests return one.")
+{
+    return object->getAsyncAcquireProgress( dAtoi( argv[2] ) );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod( AssetManager, cancelAsyncAcquire, bool, 3, 3,    "(requestId) - Cancels an asynchronous acquisition and releases any assets it acquired.\n"
+                                                                "@param requestId The asynchronous acquisition request Id.\n"
+                                                                "@return Whether the request was cancelled or not.")
+{
+    return object->cancelAsyncAcquire( dAtoi( argv[2] ) );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod( AssetManager, getAsyncAcquireCount, S32, 2, 2,  "() - Gets the number of pending asynchronous acquisitions.\n"
+                                                                "@return The number of pending asynchronous acquisitions.")
+{
+    return object->getAsyncAcquireCount();
+}
+
+//-----------------------------------------------------------------------------
+
 ConsoleMethod( AssetManager, deleteAsset, bool, 5, 5,   "(assetId, deleteLooseFiles, deleteDependencies) Deletes the specified asset Id and optionally its loose files and asset dependencies.\n"
                                                         "@param assetId The selected asset Id.\n"
                                                         "@param deleteLooseFiles Whether to delete an assets loose files or not.\n"
@@ -848,3 +896,20 @@ ConsoleMethod( AssetManager, dumpDeclaredAssets, void, 2, 2,     "() - Dumps a b
 {
     return object->dumpDeclaredAssets();
 }
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod( AssetManager, dumpStartupMetrics, void, 2, 2,     "() - Dumps a breakdown of the time spent scanning modules and assets.\n"
+                                                                "@return No return value.")
+{
+    return object->dumpStartupMetrics();
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod( AssetManager, saveManifestCache, bool, 2, 2,      "() - Saves any changes to the manifest cache specified by 'ManifestCacheFile'.\n"
+                                                                "The manifest cache is also saved when the asset manager is removed.\n"
+                                                                "@return Whether the manifest cache was saved or not.")
+{
+    return object->saveManifestCache();
+}
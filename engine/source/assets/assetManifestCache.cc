@@ -0,0 +1,361 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "assets/assetManifestCache.h"
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+AssetManifestCache::AssetManifestCache() :
+    mDirty( false )
+{
+}
+
+//-----------------------------------------------------------------------------
+
+AssetManifestCache::~AssetManifestCache()
+{
+    clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManifestCache::clear( void )
+{
+    // Delete declared entries.
+    for( typeDeclaredHash::iterator entryItr = mDeclaredEntries.begin(); entryItr != mDeclaredEntries.end(); ++entryItr )
+    {
+        delete entryItr->value;
+    }
+    mDeclaredEntries.clear();
+
+    // Delete referenced entries.
+    for( typeReferencedHash::iterator entryItr = mReferencedEntries.begin(); entryItr != mReferencedEntries.end(); ++entryItr )
+    {
+        delete entryItr->value;
+    }
+    mReferencedEntries.clear();
+
+    mDirty = false;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetManifestCache::load( const char* pCacheFilePath )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManifestCache_Load);
+
+    // Sanity!
+    AssertFatal( pCacheFilePath != NULL, "AssetManifestCache::load() - Cannot load a NULL cache file." );
+
+    clear();
+
+    FileStream stream;
+    if ( !stream.open( pCacheFilePath, FileStream::Read ) )
+        return false;
+
+    // Ignore the cache if it is not the current version.
+    U32 tag = 0;
+    U32 version = 0;
+    stream.read( &tag );
+    stream.read( &version );
+    if ( tag != CacheFileTag || version != FileVersion )
+    {
+        stream.close();
+        return false;
+    }
+
+    // Read declared entries.
+    U32 declaredCount = 0;
+    stream.read( &declaredCount );
+    for ( U32 index = 0; index < declaredCount && stream.getStatus() == Stream::Ok; ++index )
+    {
+        StringTableEntry filePath = readString( stream );
+
+        DeclaredEntry* pEntry = new DeclaredEntry();
+        stream.read( &pEntry->mFileSize );
+        stream.read( sizeof(FileTime), &pEntry->mModifyTime );
+
+        AssetDefinition& assetDefinition = pEntry->mAssetDefinition;
+        assetDefinition.mAssetBaseFilePath = filePath;
+        assetDefinition.mAssetName = readString( stream );
+        assetDefinition.mAssetDescription = readString( stream );
+        assetDefinition.mAssetCategory = readString( stream );
+        assetDefinition.mAssetType = readString( stream );
+        stream.read( &assetDefinition.mAssetAutoUnload );
+        stream.read( &assetDefinition.mAssetInternal );
+        readStringVector( stream, pEntry->mAssetDependencies );
+        readStringVector( stream, pEntry->mAssetLooseFiles );
+
+        mDeclaredEntries.insert( filePath, pEntry );
+    }
+
+    // Read referenced entries.
+    U32 referencedCount = 0;
+    stream.read( &referencedCount );
+    for ( U32 index = 0; index < referencedCount && stream.getStatus() == Stream::Ok; ++index )
+    {
+        StringTableEntry filePath = readString( stream );
+
+        ReferencedEntry* pEntry = new ReferencedEntry();
+        stream.read( &pEntry->mFileSize );
+        stream.read( sizeof(FileTime), &pEntry->mModifyTime );
+        readStringVector( stream, pEntry->mReferencedAssetIds );
+
+        mReferencedEntries.insert( filePath, pEntry );
+    }
+
+    // The tag is repeated at the end to detect a truncated file.
+    U32 endTag = 0;
+    stream.read( &endTag );
+
+    const bool loaded = endTag == CacheFileTag && stream.getStatus() != Stream::IOError;
+    stream.close();
+
+    // Discard a truncated cache.
+    if ( !loaded )
+    {
+        Con::warnf( "AssetManifestCache::load() - Discarding invalid cache file '%s'.", pCacheFilePath );
+        clear();
+        return false;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetManifestCache::save( const char* pCacheFilePath )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManifestCache_Save);
+
+    // Sanity!
+    AssertFatal( pCacheFilePath != NULL, "AssetManifestCache::save() - Cannot save a NULL cache file." );
+
+    FileStream stream;
+    if ( !Platform::createPath( pCacheFilePath ) || !stream.open( pCacheFilePath, FileStream::Write ) )
+    {
+        // Warn.
+        Con::warnf( "AssetManifestCache::save() - Could not open cache file '%s' for writing.", pCacheFilePath );
+        return false;
+    }
+
+    stream.write( U32(CacheFileTag) );
+    stream.write( U32(FileVersion) );
+
+    // Write declared entries.
+    // Entries for files that no longer exist are dropped.
+    Vector<StringTableEntry> filePaths;
+    for( typeDeclaredHash::iterator entryItr = mDeclaredEntries.begin(); entryItr != mDeclaredEntries.end(); ++entryItr )
+    {
+        if ( Platform::isFile( entryItr->key ) )
+            filePaths.push_back( entryItr->key );
+    }
+
+    stream.write( U32(filePaths.size()) );
+    for ( S32 index = 0; index < filePaths.size(); ++index )
+    {
+        const DeclaredEntry* pEntry = mDeclaredEntries.find( filePaths[index] )->value;
+        const AssetDefinition& assetDefinition = pEntry->mAssetDefinition;
+
+        stream.writeLongString( 1023, filePaths[index] );
+        stream.write( pEntry->mFileSize );
+        stream.write( sizeof(FileTime), &pEntry->mModifyTime );
+        stream.writeLongString( 1023, assetDefinition.mAssetName );
+        stream.writeLongString( 1023, assetDefinition.mAssetDescription );
+        stream.writeLongString( 1023, assetDefinition.mAssetCategory );
+        stream.writeLongString( 1023, assetDefinition.mAssetType );
+        stream.write( assetDefinition.mAssetAutoUnload );
+        stream.write( assetDefinition.mAssetInternal );
+        writeStringVector( stream, pEntry->mAssetDependencies );
+        writeStringVector( stream, pEntry->mAssetLooseFiles );
+    }
+
+    // Write referenced entries.
+    filePaths.clear();
+    for( typeReferencedHash::iterator entryItr = mReferencedEntries.begin(); entryItr != mReferencedEntries.end(); ++entryItr )
+    {
+        if ( Platform::isFile( entryItr->key ) )
+            filePaths.push_back( entryItr->key );
+    }
+
+    stream.write( U32(filePaths.size()) );
+    for ( S32 index = 0; index < filePaths.size(); ++index )
+    {
+        const ReferencedEntry* pEntry = mReferencedEntries.find( filePaths[index] )->value;
+
+        stream.writeLongString( 1023, filePaths[index] );
+        stream.write( pEntry->mFileSize );
+        stream.write( sizeof(FileTime), &pEntry->mModifyTime );
+        writeStringVector( stream, pEntry->mReferencedAssetIds );
+    }
+
+    stream.write( U32(CacheFileTag) );
+
+    const bool saved = stream.getStatus() == Stream::Ok;
+    stream.close();
+
+    if ( saved )
+        mDirty = false;
+
+    return saved;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetManifestCache::getFileStamp( const char* pFilePath, U32& fileSize, FileTime& modifyTime )
+{
+    const S32 size = Platform::getFileSize( pFilePath );
+    if ( size < 0 || !Platform::getFileTimes( pFilePath, NULL, &modifyTime ) )
+        return false;
+
+    fileSize = (U32)size;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+const AssetManifestCache::DeclaredEntry* AssetManifestCache::findDeclared( StringTableEntry filePath, const U32 fileSize, const FileTime& modifyTime ) const
+{
+    typeDeclaredHash::const_iterator entryItr = mDeclaredEntries.find( filePath );
+    if ( entryItr == mDeclaredEntries.end() )
+        return NULL;
+
+    // Ignore the entry if the file has changed.
+    const DeclaredEntry* pEntry = entryItr->value;
+    if ( pEntry->mFileSize != fileSize || Platform::compareFileTimes( pEntry->mModifyTime, modifyTime ) != 0 )
+        return NULL;
+
+    return pEntry;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManifestCache::storeDeclared( StringTableEntry filePath, const U32 fileSize, const FileTime& modifyTime, const AssetDefinition& assetDefinition, const Vector<StringTableEntry>& assetDependencies, const Vector<StringTableEntry>& assetLooseFiles )
+{
+    // Reuse any existing entry.
+    typeDeclaredHash::iterator entryItr = mDeclaredEntries.find( filePath );
+    DeclaredEntry* pEntry = entryItr == mDeclaredEntries.end() ? NULL : entryItr->value;
+    if ( pEntry == NULL )
+    {
+        pEntry = new DeclaredEntry();
+        mDeclaredEntries.insert( filePath, pEntry );
+    }
+
+    pEntry->mFileSize = fileSize;
+    pEntry->mModifyTime = modifyTime;
+
+    // Only the persisted state is cached.
+    AssetDefinition& cachedDefinition = pEntry->mAssetDefinition;
+    cachedDefinition.reset();
+    cachedDefinition.mAssetBaseFilePath = filePath;
+    cachedDefinition.mAssetName = assetDefinition.mAssetName;
+    cachedDefinition.mAssetDescription = assetDefinition.mAssetDescription;
+    cachedDefinition.mAssetCategory = assetDefinition.mAssetCategory;
+    cachedDefinition.mAssetType = assetDefinition.mAssetType;
+    cachedDefinition.mAssetAutoUnload = assetDefinition.mAssetAutoUnload;
+    cachedDefinition.mAssetInternal = assetDefinition.mAssetInternal;
+
+    pEntry->mAssetDependencies = assetDependencies;
+    pEntry->mAssetLooseFiles = assetLooseFiles;
+
+    mDirty = true;
+}
+
+//-----------------------------------------------------------------------------
+
+const AssetManifestCache::ReferencedEntry* AssetManifestCache::findReferenced( StringTableEntry filePath, const U32 fileSize, const FileTime& modifyTime ) const
+{
+    typeReferencedHash::const_iterator entryItr = mReferencedEntries.find( filePath );
+    if ( entryItr == mReferencedEntries.end() )
+        return NULL;
+
+    // Ignore the entry if the file has changed.
+    const ReferencedEntry* pEntry = entryItr->value;
+    if ( pEntry->mFileSize != fileSize || Platform::compareFileTimes( pEntry->mModifyTime, modifyTime ) != 0 )
+        return NULL;
+
+    return pEntry;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManifestCache::storeReferenced( StringTableEntry filePath, const U32 fileSize, const FileTime& modifyTime, const Vector<StringTableEntry>& referencedAssetIds )
+{
+    // Reuse any existing entry.
+    typeReferencedHash::iterator entryItr = mReferencedEntries.find( filePath );
+    ReferencedEntry* pEntry = entryItr == mReferencedEntries.end() ? NULL : entryItr->value;
+    if ( pEntry == NULL )
+    {
+        pEntry = new ReferencedEntry();
+        mReferencedEntries.insert( filePath, pEntry );
+    }
+
+    pEntry->mFileSize = fileSize;
+    pEntry->mModifyTime = modifyTime;
+    pEntry->mReferencedAssetIds = referencedAssetIds;
+
+    mDirty = true;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManifestCache::writeStringVector( Stream& stream, const Vector<StringTableEntry>& strings )
+{
+    stream.write( U32(strings.size()) );
+    for ( S32 index = 0; index < strings.size(); ++index )
+    {
+        stream.writeLongString( 1023, strings[index] );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManifestCache::readStringVector( Stream& stream, Vector<StringTableEntry>& strings )
+{
+    U32 count = 0;
+    stream.read( &count );
+
+    strings.clear();
+    for ( U32 index = 0; index < count && stream.getStatus() == Stream::Ok; ++index )
+    {
+        strings.push_back( readString( stream ) );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+StringTableEntry AssetManifestCache::readString( Stream& stream )
+{
+    char buffer[1024];
+    buffer[0] = 0;
+    stream.readLongString( 1023, buffer );
+    return StringTable->insert( buffer );
+}
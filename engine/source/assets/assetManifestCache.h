@@ -0,0 +1,110 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _ASSET_MANIFEST_CACHE_H_
+#define _ASSET_MANIFEST_CACHE_H_
+
+#ifndef _ASSET_DEFINITION_H_
+#include "assets/assetDefinition.h"
+#endif
+
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class Stream;
+
+//-----------------------------------------------------------------------------
+
+/// Persisted results of parsing declared and referenced asset files.
+/// Each entry is validated against the size and modification time of its file
+/// so only files that changed since the cache was written need parsing again.
+class AssetManifestCache
+{
+public:
+    struct DeclaredEntry
+    {
+        U32                         mFileSize;
+        FileTime                    mModifyTime;
+        AssetDefinition             mAssetDefinition;
+        Vector<StringTableEntry>    mAssetDependencies;
+        Vector<StringTableEntry>    mAssetLooseFiles;
+    };
+
+    struct ReferencedEntry
+    {
+        U32                         mFileSize;
+        FileTime                    mModifyTime;
+        Vector<StringTableEntry>    mReferencedAssetIds;
+    };
+
+private:
+    typedef HashMap<StringTableEntry, DeclaredEntry*> typeDeclaredHash;
+    typedef HashMap<StringTableEntry, ReferencedEntry*> typeReferencedHash;
+
+    enum
+    {
+        CacheFileTag = 0x464d4341,  ///< "ACMF"
+        FileVersion = 1,
+    };
+
+    typeDeclaredHash        mDeclaredEntries;
+    typeReferencedHash      mReferencedEntries;
+    bool                    mDirty;
+
+public:
+    AssetManifestCache();
+    virtual ~AssetManifestCache();
+
+    bool load( const char* pCacheFilePath );
+    bool save( const char* pCacheFilePath );
+    void clear( void );
+    inline bool isDirty( void ) const { return mDirty; }
+    inline U32 getDeclaredCount( void ) const { return (U32)mDeclaredEntries.size(); }
+    inline U32 getReferencedCount( void ) const { return (U32)mReferencedEntries.size(); }
+
+    /// Fetch the current size and modification time of a file.
+    static bool getFileStamp( const char* pFilePath, U32& fileSize, FileTime& modifyTime );
+
+    /// Declared assets.
+    /// Finding returns NULL if there is no entry or the file has changed.
+    const DeclaredEntry* findDeclared( StringTableEntry filePath, const U32 fileSize, const FileTime& modifyTime ) const;
+    void storeDeclared( StringTableEntry filePath, const U32 fileSize, const FileTime& modifyTime, const AssetDefinition& assetDefinition, const Vector<StringTableEntry>& assetDependencies, const Vector<StringTableEntry>& assetLooseFiles );
+
+    /// Referenced assets.
+    /// Finding returns NULL if there is no entry or the file has changed.
+    const ReferencedEntry* findReferenced( StringTableEntry filePath, const U32 fileSize, const FileTime& modifyTime ) const;
+    void storeReferenced( StringTableEntry filePath, const U32 fileSize, const FileTime& modifyTime, const Vector<StringTableEntry>& referencedAssetIds );
+
+private:
+    static void writeStringVector( Stream& stream, const Vector<StringTableEntry>& strings );
+    static void readStringVector( Stream& stream, Vector<StringTableEntry>& strings );
+    static StringTableEntry readString( Stream& stream );
+};
+
+#endif // _ASSET_MANIFEST_CACHE_H_
@@ -174,6 +174,9 @@ class Vector
 
    void merge(const Vector& p);
 
+   /// Exchange the elements with another vector without copying them.
+   void swap(Vector& p);
+
    /// @}
 };
 
@@ -634,6 +637,21 @@ template<class T> inline void Vector<T>::merge(const Vector& p)
    dMemcpy( &mArray[oldsize], p.address(), p.size() * sizeof(T) );
 }
 
+template<class T> inline void Vector<T>::swap(Vector& p)
+{
+   const U32 elementCount = mElementCount;
+   const U32 arraySize = mArraySize;
+   T* array = mArray;
+
+   mElementCount = p.mElementCount;
+   mArraySize = p.mArraySize;
+   mArray = p.mArray;
+
+   p.mElementCount = elementCount;
+   p.mArraySize = arraySize;
+   p.mArray = array;
+}
+
 //-----------------------------------------------------------------------------
 /// Template for vectors of pointers.
 template <class T>
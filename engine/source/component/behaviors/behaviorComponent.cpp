@@ -26,6 +26,8 @@
 
 #include "component/behaviors/behaviorComponent.h"
 #include "component/behaviors/behaviorTemplate.h"
+#include "platform/Tickable.h"
+#include "debug/profiler.h"
 
 #ifndef _ASSET_FIELD_TYPES_H_
 #include "assets/assetFieldTypes.h"
@@ -50,6 +52,36 @@
 
 //-----------------------------------------------------------------------------
 
+Vector<BehaviorComponent::QueuedRaise> BehaviorComponent::smQueuedRaises;
+Vector<BehaviorComponent::QueuedRaise> BehaviorComponent::smDispatchingRaises;
+S32 BehaviorComponent::smDispatchIndex = -1;
+bool BehaviorComponent::smDispatchPosted = false;
+
+//-----------------------------------------------------------------------------
+
+// Needed to be able to directly call execute on a Namespace::Entry
+extern ExprEvalState gEvalState;
+
+static const char* executeBehaviorMethod( BehaviorInstance* pBehavior, Namespace::Entry* pMethod, S32 argc, const char** argv )
+{
+    // Set %this to the behavior.
+    argv[1] = pBehavior->getIdString();
+
+    // Change the current console object, execute, restore object.
+    pBehavior->pushScriptCallbackGuard();
+    SimObject* pSaveObject = gEvalState.thisObject;
+    gEvalState.thisObject = pBehavior;
+
+    const char* pResult = pMethod->execute( argc, argv, &gEvalState );
+
+    gEvalState.thisObject = pSaveObject;
+    pBehavior->popScriptCallbackGuard();
+
+    return pResult;
+}
+
+//-----------------------------------------------------------------------------
+
 BehaviorComponent::BehaviorComponent() :
     mMasterBehaviorId( 1 ),
     mpBehaviorFieldNames( NULL )
@@ -224,6 +256,9 @@ bool BehaviorComponent::removeBehavior( BehaviorInstance *bi, bool deleteBehavio
             // Destroy any output connections.
             destroyBehaviorOutputConnections( bi );
 
+            // Cancel any queued raises.
+            cancelQueuedRaises( bi );
+
             if ( deleteBehavior && bi->isProperlyAdded() )
             {
                 bi->deleteObject();
@@ -654,7 +689,7 @@ bool BehaviorComponent::disconnect( BehaviorInstance* pOutputBehavior, BehaviorI
 
 //-----------------------------------------------------------------------------
 
-bool BehaviorComponent::raise( BehaviorInstance* pOutputBehavior, StringTableEntry pOutputName )
+bool BehaviorComponent::validateRaise( BehaviorInstance* pOutputBehavior, StringTableEntry pOutputName )
 {
     // Sanity!
     AssertFatal( pOutputBehavior != NULL, "Output behavior cannot be NULL." );
@@ -685,6 +720,20 @@ bool BehaviorComponent::raise( BehaviorInstance* pOutputBehavior, StringTableEnt
         return false;
     }
 
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool BehaviorComponent::raise( BehaviorInstance* pOutputBehavior, StringTableEntry pOutputName )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(BehaviorComponent_Raise);
+
+    // Finish if the output cannot be raised.
+    if ( !validateRaise( pOutputBehavior, pOutputName ) )
+        return false;
+
     // Execute a callback for the output.
     // NOTE: This callback should not delete behaviors otherwise strange things can happen!
     Con::executef( this, 2, pOutputName, pOutputBehavior->getIdString() );
@@ -706,6 +755,9 @@ bool BehaviorComponent::raise( BehaviorInstance* pOutputBehavior, StringTableEnt
     // Fetch port connection(s).
     typePortConnectionVector* pPortConnections = outputItr->value;
 
+    // Input callback arguments.
+    const char* argv[4];
+
     // Process output connection(s).
     for ( typePortConnectionVector::iterator connectionItr = pPortConnections->begin(); connectionItr != pPortConnections->end(); ++connectionItr )
     {
@@ -732,9 +784,19 @@ bool BehaviorComponent::raise( BehaviorInstance* pOutputBehavior, StringTableEnt
             return false;
         }
 #endif
+        // Fetch the input method.
+        Namespace::Entry* pInputMethod = pInputBehavior->findBehaviorMethod( pInputName );
+
+        // Skip if the input behavior does not implement the input.
+        if ( pInputMethod == NULL )
+            continue;
+
         // Execute a callback for the input.
         // NOTE: This callback should not delete behaviors otherwise strange things can happen!
-        Con::executef( pInputBehavior, 3, pInputName, pOutputBehavior->getIdString(), pOutputName );
+        argv[0] = pInputName;
+        argv[2] = pOutputBehavior->getIdString();
+        argv[3] = pOutputName;
+        executeBehaviorMethod( pInputBehavior, pInputMethod, 4, argv );
     }
 
     return true;
@@ -742,6 +804,102 @@ bool BehaviorComponent::raise( BehaviorInstance* pOutputBehavior, StringTableEnt
 
 //-----------------------------------------------------------------------------
 
+bool BehaviorComponent::queueRaise( BehaviorInstance* pOutputBehavior, StringTableEntry pOutputName )
+{
+    // Finish if the output cannot be raised.
+    if ( !validateRaise( pOutputBehavior, pOutputName ) )
+        return false;
+
+    // Finish if the output is already queued.
+    for ( S32 queuedIndex = pOutputBehavior->getQueuedRaise(); queuedIndex != -1; queuedIndex = smQueuedRaises[queuedIndex].mNextQueuedRaise )
+    {
+        if ( smQueuedRaises[queuedIndex].mOutputName == pOutputName )
+            return true;
+    }
+
+    // Queue the raise.
+    QueuedRaise queuedRaise;
+    queuedRaise.mpOutputBehavior = pOutputBehavior;
+    queuedRaise.mOutputName = pOutputName;
+    queuedRaise.mNextQueuedRaise = pOutputBehavior->getQueuedRaise();
+    pOutputBehavior->setQueuedRaise( smQueuedRaises.size() );
+    smQueuedRaises.push_back( queuedRaise );
+
+    // Scenes dispatch the queued raises after they integrate but make sure
+    // they are dispatched by the next tick even if no scene is ticking.
+    if ( !smDispatchPosted )
+    {
+        smDispatchPosted = true;
+        Sim::postEvent( Sim::getRootGroup(), new BehaviorComponentDispatchEvent(), Sim::getCurrentTime() + Tickable::smTickMs );
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void BehaviorComponent::dispatchQueuedRaises( void )
+{
+    // Finish if nothing is queued or we're already dispatching.
+    if ( smQueuedRaises.size() == 0 || smDispatchIndex != -1 )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(BehaviorComponent_DispatchQueuedRaises);
+
+    // Take the queued raises.
+    // NOTE: Raises queued during the dispatch are dispatched next time.
+    smDispatchingRaises.swap( smQueuedRaises );
+
+    // Release the behaviors so they can be queued again.
+    const S32 raiseCount = smDispatchingRaises.size();
+    for ( S32 index = 0; index < raiseCount; ++index )
+    {
+        BehaviorInstance* pOutputBehavior = smDispatchingRaises[index].mpOutputBehavior;
+        if ( pOutputBehavior != NULL )
+            pOutputBehavior->setQueuedRaise( -1 );
+    }
+
+    // Dispatch the raises.
+    for ( smDispatchIndex = 0; smDispatchIndex < raiseCount; ++smDispatchIndex )
+    {
+        const QueuedRaise& queuedRaise = smDispatchingRaises[smDispatchIndex];
+
+        // Skip if cancelled.
+        if ( queuedRaise.mpOutputBehavior == NULL )
+            continue;
+
+        queuedRaise.mpOutputBehavior->getBehaviorOwner()->raise( queuedRaise.mpOutputBehavior, queuedRaise.mOutputName );
+    }
+
+    smDispatchIndex = -1;
+    smDispatchingRaises.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void BehaviorComponent::cancelQueuedRaises( BehaviorInstance* pOutputBehavior )
+{
+    // Cancel the queued raises.
+    for ( S32 queuedIndex = pOutputBehavior->getQueuedRaise(); queuedIndex != -1; queuedIndex = smQueuedRaises[queuedIndex].mNextQueuedRaise )
+    {
+        smQueuedRaises[queuedIndex].mpOutputBehavior = NULL;
+    }
+    pOutputBehavior->setQueuedRaise( -1 );
+
+    // Cancel any raises still to be dispatched.
+    if ( smDispatchIndex == -1 )
+        return;
+
+    for ( S32 index = smDispatchIndex + 1; index < smDispatchingRaises.size(); ++index )
+    {
+        if ( smDispatchingRaises[index].mpOutputBehavior == pOutputBehavior )
+            smDispatchingRaises[index].mpOutputBehavior = NULL;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 U32 BehaviorComponent::getBehaviorConnectionCount( BehaviorInstance* pOutputBehavior, StringTableEntry pOutputName )
 {
     // Sanity!
@@ -925,10 +1083,11 @@ bool BehaviorComponent::handlesConsoleMethod( const char *fname, S32 *routingId
    if( dStricmp( fname, "delete" ) == 0 )
       return Parent::handlesConsoleMethod( fname, routingId );
 
+   StringTableEntry methodName = StringTable->insert( fname );
    for( SimSet::iterator nItr = mBehaviors.begin(); nItr != mBehaviors.end(); nItr++ )
    {
-      SimObject *pComponent = dynamic_cast<SimObject *>(*nItr);
-      if( pComponent != NULL && pComponent->isMethod( fname ) )
+      BehaviorInstance *pBehavior = static_cast<BehaviorInstance *>(*nItr);
+      if( pBehavior->findBehaviorMethod( methodName ) != NULL )
       {
          *routingId = -2; // -2 denotes method on component
          return true;
@@ -941,9 +1100,6 @@ bool BehaviorComponent::handlesConsoleMethod( const char *fname, S32 *routingId
 
 //-----------------------------------------------------------------------------
 
-// Needed to be able to directly call execute on a Namespace::Entry
-extern ExprEvalState gEvalState;
-
 const char *BehaviorComponent::callOnBehaviors( U32 argc, const char *argv[] )
 {   
     if( mBehaviors.empty() )   
@@ -960,6 +1116,7 @@ const char *BehaviorComponent::callOnBehaviors( U32 argc, const char *argv[] )
     }
 
     // Walk backwards through the list just as with components
+    StringTableEntry cbName = StringTable->insert(argv[0]);
     const char* result = "";
     bool handled = false;
     for( SimSet::iterator i = (mBehaviors.end()-1); i >= mBehaviors.begin(); i-- )
@@ -968,14 +1125,8 @@ const char *BehaviorComponent::callOnBehaviors( U32 argc, const char *argv[] )
         AssertFatal( pBehavior, "BehaviorComponent::callOnBehaviors - Bad behavior instance in list." );
         AssertFatal( pBehavior->getId() > 0, "Invalid id for behavior component" );
 
-        // Use the BehaviorInstance's namespace
-        Namespace *pNamespace = pBehavior->getNamespace();
-        if(!pNamespace)
-            continue;
-
-        // Lookup the Callback Namespace entry and then splice callback
-        const char *cbName = StringTable->insert(argv[0]);
-        Namespace::Entry *pNSEntry = pNamespace->lookup(cbName);
+        // Lookup the Callback Namespace entry (cached by the template) and then splice callback
+        Namespace::Entry *pNSEntry = pBehavior->findBehaviorMethod(cbName);
         if( pNSEntry )
         {
             // Set %this to our BehaviorInstance's Object ID
@@ -1023,20 +1174,15 @@ const char *BehaviorComponent::_callMethod( U32 argc, const char *argv[], bool c
         dStrcpy( argPtrs[i], argv[i] );
     }
 
+    StringTableEntry cbName = StringTable->insert(argv[0]);
     for( SimSet::iterator i = mBehaviors.begin(); i != mBehaviors.end(); i++ )
     {
         BehaviorInstance *pBehavior = dynamic_cast<BehaviorInstance *>( *i );
         AssertFatal( pBehavior, "BehaviorComponent::_callMethod - Bad behavior instance in list." );
         AssertFatal( pBehavior->getId() > 0, "Invalid id for behavior component" );
 
-        // Use the BehaviorInstance's namespace
-        Namespace *pNamespace = pBehavior->getNamespace();
-        if(!pNamespace)
-            continue;
-
-        // Lookup the Callback Namespace entry and then splice callback
-        const char *cbName = StringTable->insert(argv[0]);
-        Namespace::Entry *pNSEntry = pNamespace->lookup(cbName);
+        // Lookup the Callback Namespace entry (cached by the template) and then splice callback
+        Namespace::Entry *pNSEntry = pBehavior->findBehaviorMethod(cbName);
         if( pNSEntry )
         {
             // Set %this to our BehaviorInstance's Object ID
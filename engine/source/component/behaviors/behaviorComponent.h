@@ -36,6 +36,7 @@
 class BehaviorComponent : public DynamicConsoleMethodComponent
 {
     friend class BehaviorInterface;
+    friend class BehaviorComponentDispatchEvent;
     typedef DynamicConsoleMethodComponent Parent;
 
 private:
@@ -47,6 +48,19 @@ private:
 
     Vector<StringTableEntry>* mpBehaviorFieldNames;
 
+    /// A raise queued for dispatch.
+    struct QueuedRaise
+    {
+        BehaviorInstance*   mpOutputBehavior;
+        StringTableEntry    mOutputName;
+        S32                 mNextQueuedRaise;   ///< The previous raise queued for the same behavior.
+    };
+
+    /// Queued raises.
+    static Vector<QueuedRaise> smQueuedRaises;
+    static Vector<QueuedRaise> smDispatchingRaises;
+    static S32 smDispatchIndex;
+    static bool smDispatchPosted;
 
 public:
     /// A behavior port connection.
@@ -87,6 +101,8 @@ protected:
 private:
     void destroyBehaviorOutputConnections( BehaviorInstance* pOutputBehavior );
     void destroyBehaviorInputConnections( BehaviorInstance* pInputBehavior );
+    bool validateRaise( BehaviorInstance* pOutputBehavior, StringTableEntry pOutputName );
+    static void cancelQueuedRaises( BehaviorInstance* pOutputBehavior );
     
   
 public:
@@ -114,10 +130,15 @@ public:
     bool connect( BehaviorInstance* pOutputBehavior, BehaviorInstance* pInputBehavior, StringTableEntry pOutputName, StringTableEntry pInputName );
     bool disconnect( BehaviorInstance* pOutputBehavior, BehaviorInstance* pInputBehavior, StringTableEntry pOutputName, StringTableEntry pInputName );
     bool raise( BehaviorInstance* pOutputBehavior, StringTableEntry pOutputName );
+    bool queueRaise( BehaviorInstance* pOutputBehavior, StringTableEntry pOutputName );
     U32 getBehaviorConnectionCount( BehaviorInstance* pOutputBehavior, StringTableEntry pOutputName );
     const BehaviorPortConnection* getBehaviorConnection( BehaviorInstance* pOutputBehavior, StringTableEntry pOutputName, const U32 connectionIndex );
     const typePortConnectionVector* getBehaviorConnections( BehaviorInstance* pOutputBehavior, StringTableEntry pOutputName );
 
+    /// Queued raise dispatch.
+    static void dispatchQueuedRaises( void );
+    static inline U32 getQueuedRaiseCount( void ) { return (U32)smQueuedRaises.size(); }
+
     /// DynamicConsoleMethodComponent Overrides
     virtual bool handlesConsoleMethod( const char *fname, S32 *routingId );
     virtual const char* callOnBehaviors( U32 argc, const char *argv[] );
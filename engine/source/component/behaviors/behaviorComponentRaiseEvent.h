@@ -60,8 +60,8 @@ public:
             return;
         }
 
-        // Raise output signal.
-        pBehaviorComponent->raise( mpOutputBehavior, mpOutputName );
+        // Queue the output signal for the next dispatch.
+        pBehaviorComponent->queueRaise( mpOutputBehavior, mpOutputName );
     }
 
 private:
@@ -69,4 +69,20 @@ private:
     StringTableEntry                mpOutputName;
 };
 
+//-----------------------------------------------------------------------------
+
+class BehaviorComponentDispatchEvent : public SimEvent
+{
+public:
+    BehaviorComponentDispatchEvent() {}
+    virtual ~BehaviorComponentDispatchEvent() {}
+
+    virtual void process(SimObject *object)
+    {
+        // Dispatch any raises not already dispatched by a scene.
+        BehaviorComponent::smDispatchPosted = false;
+        BehaviorComponent::dispatchQueuedRaises();
+    }
+};
+
 #endif // _BEHAVIORCOMPONENT_RAISEEVENT_H_
\ No newline at end of file
@@ -240,7 +240,7 @@ ConsoleMethod( BehaviorComponent, disconnect, bool, 6, 6,   "(outputBehavior, in
 ConsoleMethod( BehaviorComponent, raise, bool, 4, 5,    "(outputBehavior, outputName, [deltaTime]) - Raise a signal on the behavior output on the specified behavior.\n"
                                                         "@param outputBehavior The behavior that owns the output.\n"
                                                         "@param outputName The output name owned by the output behavior.\n"
-                                                        "@param [deltaTime] Optional time-delta (ms) when the raise should occur.\n"
+                                                        "@param [deltaTime] Optional time-delta (ms) when the raise should occur.  Delayed raises are queued and dispatched together once per tick, raising an output only once however many times it was queued.\n"
                                                         "@return (bool success) Whether the signal raise was successful or not.\n")
 {
     // Find output behavior.
@@ -264,6 +264,10 @@ ConsoleMethod( BehaviorComponent, raise, bool, 4, 5,    "(outputBehavior, output
     // Fetch time delta.
     const U32 timeDelta = U32( dAtoi(argv[4]) );
 
+    // Queue the raise directly if no delay.
+    if ( timeDelta == 0 )
+        return object->queueRaise( pOutputBehavior, pOutputName );
+
     // Schedule raise event.
     BehaviorComponentRaiseEvent* pEvent = new BehaviorComponentRaiseEvent( pOutputBehavior, pOutputName );
     Sim::postEvent( object, pEvent, Sim::getCurrentTime() + timeDelta );
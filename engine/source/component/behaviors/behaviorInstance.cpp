@@ -38,7 +38,8 @@ IMPLEMENT_CONOBJECT(BehaviorInstance);
 BehaviorInstance::BehaviorInstance( BehaviorTemplate* pTemplate ) :
     mTemplate( pTemplate ),
     mBehaviorOwner( NULL ),
-    mBehaviorId( 0 )
+    mBehaviorId( 0 ),
+    mQueuedRaise( -1 )
 {
     if ( pTemplate != NULL )
     {
@@ -91,6 +92,17 @@ void BehaviorInstance::initPersistFields()
 
 //-----------------------------------------------------------------------------
 
+Namespace::Entry* BehaviorInstance::findBehaviorMethod( StringTableEntry methodName )
+{
+    // Use the template method cache if the instance uses the template namespace.
+    if ( mTemplate != NULL && mNameSpace != NULL && mNameSpace == mTemplate->getBehaviorNamespace() )
+        return mTemplate->findBehaviorMethod( methodName );
+
+    return mNameSpace != NULL ? mNameSpace->lookup( methodName ) : NULL;
+}
+
+//-----------------------------------------------------------------------------
+
 const char* BehaviorInstance::getTemplateName( void )
 {
     return mTemplate ? mTemplate->getName() : NULL;
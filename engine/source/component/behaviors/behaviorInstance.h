@@ -34,6 +34,10 @@
 #include "component/simComponent.h"
 #endif
 
+#ifndef _CONSOLE_NAMESPACE_H
+#include "console/consoleNamespace.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 class BehaviorTemplate;
@@ -65,12 +69,20 @@ public:
     inline void setBehaviorId( const U32 id ) { mBehaviorId = id; }
     inline U32 getBehaviorId( void ) const { return mBehaviorId; }
 
+    /// Methods.
+    Namespace::Entry* findBehaviorMethod( StringTableEntry methodName );
+
+    /// Queued raises.
+    inline void setQueuedRaise( const S32 queuedRaise ) { mQueuedRaise = queuedRaise; }
+    inline S32 getQueuedRaise( void ) const { return mQueuedRaise; }
+
     DECLARE_CONOBJECT(BehaviorInstance);
 
 protected:
     BehaviorTemplate*   mTemplate;
     BehaviorComponent*  mBehaviorOwner;
     U32                 mBehaviorId;
+    S32                 mQueuedRaise;
 
     // Set "Owner" via the field does nothing.
     static bool setOwner( void* obj, const char* data ) { return true; }
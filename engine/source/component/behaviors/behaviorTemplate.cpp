@@ -40,7 +40,9 @@ IMPLEMENT_CONOBJECT(BehaviorTemplate);
 BehaviorTemplate::BehaviorTemplate() :
     mFriendlyName( StringTable->EmptyString ),
     mDescription( StringTable->EmptyString ),
-    mBehaviorType( StringTable->EmptyString )
+    mBehaviorType( StringTable->EmptyString ),
+    mpMethodNamespace( NULL ),
+    mMethodCacheSequence( 0 )
 {
 }
 
@@ -156,3 +158,45 @@ bool BehaviorTemplate::addBehaviorInput( const char* name, const char* label, co
 
     return true;
 }
+
+//-----------------------------------------------------------------------------
+
+Namespace* BehaviorTemplate::getBehaviorNamespace( void )
+{
+    // Flush the method cache if any namespace has changed.
+    if ( mMethodCacheSequence != Namespace::mCacheSequence || mpMethodNamespace == NULL )
+    {
+        mMethodCache.clear();
+        mMethodCacheSequence = Namespace::mCacheSequence;
+
+        // Behavior instances use the namespace named after the template.
+        StringTableEntry templateName = getName();
+        mpMethodNamespace = templateName != NULL ? Namespace::global()->find( templateName ) : NULL;
+    }
+
+    return mpMethodNamespace;
+}
+
+//-----------------------------------------------------------------------------
+
+Namespace::Entry* BehaviorTemplate::findBehaviorMethod( StringTableEntry methodName )
+{
+    // Fetch the namespace.
+    Namespace* pNamespace = getBehaviorNamespace();
+
+    // Finish if no namespace.
+    if ( pNamespace == NULL )
+        return NULL;
+
+    // Is the method cached?
+    typeMethodHash::iterator methodItr = mMethodCache.find( methodName );
+    if ( methodItr != mMethodCache.end() )
+        return methodItr->value;
+
+    // No, so look it up and cache it.
+    // NOTE: Methods that don't exist are cached too.
+    Namespace::Entry* pEntry = pNamespace->lookup( methodName );
+    mMethodCache.insert( methodName, pEntry );
+
+    return pEntry;
+}
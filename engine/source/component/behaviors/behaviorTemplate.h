@@ -31,6 +31,10 @@
 #include "behaviorInstance.h"
 #endif
 
+#ifndef _CONSOLE_NAMESPACE_H
+#include "console/consoleNamespace.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 #define BEHAVIORTEMPLATE_ASSET_FIELDTYPE    "Asset"
@@ -167,6 +171,11 @@ public:
         return false;
     }
 
+    /// Methods.
+    /// NOTE: Lookups are cached until any namespace changes.
+    Namespace* getBehaviorNamespace( void );
+    Namespace::Entry* findBehaviorMethod( StringTableEntry methodName );
+
     DECLARE_CONOBJECT(BehaviorTemplate);
 
 protected:
@@ -178,6 +187,12 @@ protected:
     Vector<BehaviorPortInput> mPortInputs;
     Vector<BehaviorPortOutput> mPortOutputs;
 
+    /// Method cache.
+    typedef HashMap<StringTableEntry, Namespace::Entry*> typeMethodHash;
+    typeMethodHash mMethodCache;
+    Namespace* mpMethodNamespace;
+    U32 mMethodCacheSequence;
+
 
     static bool setDescription(void* obj, const char* data) { static_cast<BehaviorTemplate *>(obj)->mDescription = data ? StringTable->insert(data) : StringTable->EmptyString; return false; }
     static const char* getDescription(void* obj, const char* data) { return static_cast<BehaviorTemplate *>(obj)->mDescription; }
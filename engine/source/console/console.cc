@@ -22,6 +22,7 @@
 #include "platform/platform.h"
 #include "platform/platformTLS.h"
 #include "platform/threads/thread.h"
+#include "platform/threads/jobPool.h"
 #include "console/console.h"
 #include "console/consoleInternal.h"
 #include "console/consoleObject.h"
@@ -954,6 +955,8 @@ void addCommand(const char *name,BoolCallback cb,const char *usage, S32 minArgs,
 
 const char *evaluate(const char* string, bool echo, const char *fileName)
 {
+   AssertNotJobWorker( "Con::evaluate()" );
+
    if (echo)
       Con::printf("%s%s", getVariable( "$Con::Prompt" ), string);
 
@@ -967,6 +970,8 @@ const char *evaluate(const char* string, bool echo, const char *fileName)
 //------------------------------------------------------------------------------
 const char *evaluatef(const char* string, ...)
 {
+   AssertNotJobWorker( "Con::evaluatef()" );
+
    const char * result = NULL;
    char * buffer = new char[4096];
    if (buffer != NULL)
@@ -988,6 +993,8 @@ const char *evaluatef(const char* string, ...)
 
 const char *execute(S32 argc, const char *argv[])
 {
+   AssertNotJobWorker( "Con::execute()" );
+
 #ifdef TORQUE_MULTITHREAD
    if(isMainThread())
    {
@@ -1029,6 +1036,8 @@ const char *execute(S32 argc, const char *argv[])
 //------------------------------------------------------------------------------
 const char *execute(SimObject *object, S32 argc, const char *argv[],bool thisCallOnly)
 {
+   AssertNotJobWorker( "Con::execute()" );
+
    static char idBuf[16];
    if(argc < 2)
       return "";
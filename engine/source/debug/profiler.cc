@@ -29,14 +29,14 @@
 #include "collection/vector.h"
 #include "io/fileStream.h"
 #include "platform/threads/thread.h"
+#include "platform/threads/jobPool.h"
 
 #ifdef TORQUE_ENABLE_PROFILER
 ProfilerRootData *ProfilerRootData::sRootList = NULL;
 Profiler *gProfiler = NULL;
 
-#ifdef TORQUE_MULTITHREAD
+// Only the main thread is profiled as job pool workers run profiled code too.
 U32 gMainThread = 0;
-#endif
 
 #if defined(TORQUE_SUPPORTS_VC_INLINE_X86_ASM)
 // platform specific get hires times...
@@ -190,9 +190,7 @@ Profiler::Profiler()
    mDumpToFile      = false;
    mDumpFileName[0] = '\0';
 
-#ifdef TORQUE_MULTITHREAD
    gMainThread = ThreadManager::getCurrentThreadId();
-#endif
 }
 
 Profiler::~Profiler()
@@ -274,11 +272,9 @@ void Profiler::validate()
 
 void Profiler::hashPush(ProfilerRootData *root)
 {
-#ifdef TORQUE_MULTITHREAD
    // Ignore non-main-thread profiler activity.
    if(! ThreadManager::isCurrentThread(gMainThread) )
       return;
-#endif
 
    mStackDepth++;
    AssertFatal(mStackDepth <= (S32)mMaxStackDepth,
@@ -370,11 +366,9 @@ void Profiler::dumpToFile(const char* fileName)
 
 void Profiler::hashPop()
 {
-#ifdef TORQUE_MULTITHREAD
    // Ignore non-main-thread profiler activity.
    if(! ThreadManager::isCurrentThread(gMainThread) )
       return;
-#endif
 
    mStackDepth--;
    AssertFatal(mStackDepth >= 0, "Stack underflow in profiler.  You may have mismatched PROFILE_START and PROFILE_ENDs");
@@ -535,6 +529,15 @@ void Profiler::dump()
       char depthBuffer[MaxStackDepth * 2 + 1];
       depthBuffer[0] = 0;
       profilerDataDumpRecurse(mCurrentProfilerData, depthBuffer, 0, totalTime);
+
+      // Worker threads are not profiled so report the job pool utilisation alongside.
+      if (JobPool::Instance)
+      {
+         Con::printf("");
+         JobPool::Instance->dumpMetrics();
+         JobPool::Instance->resetMetrics();
+      }
+
       mEnabled = enableSave;
       mStackDepth--;
    }
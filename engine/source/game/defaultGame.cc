@@ -58,6 +58,7 @@
 #include "platform/nativeDialogs/msgBox.h"
 #include "platform/nativeDialogs/fileDialog.h"
 #include "memory/safeDelete.h"
+#include "assets/assetManager.h"
 
 #include <stdio.h>
 
@@ -81,6 +82,10 @@
 #include "2d/core/particleSystem.h"
 #endif
 
+#ifndef _PLATFORM_THREADS_JOBPOOL_H_
+#include "platform/threads/jobPool.h"
+#endif
+
 #ifdef TORQUE_OS_IOS
 #include "platformiOS/iOSProfiler.h"
 #endif
@@ -163,6 +168,9 @@ bool initializeLibraries()
 
     // Initialize the particle system.
     ParticleSystem::Init();
+
+    // Initialize the job pool.
+    JobPool::Init();
     
 #if defined(TORQUE_OS_IOS) && defined(_USE_STORE_KIT)
     storeInit();
@@ -182,6 +190,9 @@ void shutdownLibraries()
     TelnetDebugger::destroy();
     TelnetConsole::destroy();
 
+    // Destroy the job pool.
+    JobPool::destroy();
+
     Sim::shutdown();
     Platform::shutdown();
 
@@ -633,6 +644,15 @@ iPhoneProfilerStart("SERVER_PROC");
 #ifdef TORQUE_OS_IOS_PROFILE	   
 iPhoneProfilerStart("GL_RENDER");
 #endif
+      // Upload any textures decoded in the background.
+      TextureManager::processAsyncLoads();
+
+      // Acquire assets requested asynchronously.
+      AssetDatabase.processAsyncAcquisitions();
+
+      // Evict textures to stay within the residency budget.
+      TextureManager::processResidency();
+
       bool preRenderOnly = false;
       if(gFrameSkip && gFrameCount % gFrameSkip)
          preRenderOnly = true;
@@ -0,0 +1,630 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "graphics/TextureAtlas.h"
+
+#ifndef _TEXTURE_MANAGER_H_
+#include "graphics/TextureManager.h"
+#endif
+
+#ifndef _GBITMAP_H_
+#include "graphics/gBitmap.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+Vector<TextureAtlas::Page*> TextureAtlas::smPages;
+U32 TextureAtlas::smImagesPacked = 0;
+U32 TextureAtlas::smImagesShared = 0;
+U32 TextureAtlas::smImagesTooLarge = 0;
+U32 TextureAtlas::smImagesUnsupported = 0;
+U32 TextureAtlas::smPageRepacks = 0;
+
+//-----------------------------------------------------------------------------
+
+TextureHandle& TextureAtlas::Entry::getTexture( void ) const
+{
+    return mpPage->mTexture;
+}
+
+//-----------------------------------------------------------------------------
+
+TextureAtlas::Entry* TextureAtlas::acquire( const char* pTextureKey, const GLuint filter, const U32 maxImageSize, EntryMovedCallback callback, void* userData, GBitmap** ppUnpackedBitmap )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TextureAtlas_Acquire);
+
+    // Reset the unpacked bitmap.
+    if ( ppUnpackedBitmap != NULL )
+        *ppUnpackedBitmap = NULL;
+
+    // Finish if texture key is invalid.
+    if ( pTextureKey == NULL || *pTextureKey == 0 )
+        return NULL;
+
+    // Fetch texture key.
+    StringTableEntry textureKey = StringTable->insert( pTextureKey );
+
+    Entry::Owner owner;
+    owner.mCallback = callback;
+    owner.mUserData = userData;
+
+    // Is the image already packed with this filter?
+    for ( S32 pageIndex = 0; pageIndex < smPages.size(); ++pageIndex )
+    {
+        Page* pPage = smPages[pageIndex];
+
+        if ( pPage->mFilter != filter )
+            continue;
+
+        for ( S32 entryIndex = 0; entryIndex < pPage->mEntries.size(); ++entryIndex )
+        {
+            Entry* pEntry = pPage->mEntries[entryIndex];
+
+            if ( pEntry->mTextureKey != textureKey )
+                continue;
+
+            // Yes, so share it.
+            pEntry->mOwners.push_back( owner );
+            smImagesShared++;
+            return pEntry;
+        }
+    }
+
+    // Finish if the texture has already been loaded on its own.
+    if ( TextureDictionary::find( textureKey, TextureHandle::BitmapTexture, true ) != NULL )
+        return NULL;
+
+    // Load the bitmap unless it was prefetched.
+    GBitmap* pBitmap = TextureManager::takePrefetchedBitmap( textureKey );
+    if ( pBitmap == NULL )
+        pBitmap = TextureManager::loadBitmap( textureKey );
+
+    // Finish if the bitmap could not be loaded.
+    if ( pBitmap == NULL )
+        return NULL;
+
+    const U32 width = pBitmap->getWidth();
+    const U32 height = pBitmap->getHeight();
+    const U32 paddedWidth = width + Padding * 2;
+    const U32 paddedHeight = height + Padding * 2;
+
+    // Is the image suitable for packing?
+    const bool tooLarge = width > maxImageSize || height > maxImageSize || paddedWidth > PageSize || paddedHeight > PageSize;
+    if ( tooLarge || !isSupportedFormat( pBitmap ) )
+    {
+        // No, so adjust metrics.
+        if ( tooLarge )
+            smImagesTooLarge++;
+        else
+            smImagesUnsupported++;
+
+        // Hand the bitmap back so it is not decoded again when loaded normally.
+        if ( ppUnpackedBitmap != NULL )
+            *ppUnpackedBitmap = pBitmap;
+        else
+            delete pBitmap;
+
+        return NULL;
+    }
+
+    // Find a page with room for the image.
+    Page* pPage = NULL;
+    Point2I position;
+    for ( S32 pageIndex = 0; pageIndex < smPages.size(); ++pageIndex )
+    {
+        if ( smPages[pageIndex]->mFilter == filter && allocate( smPages[pageIndex], paddedWidth, paddedHeight, position ) )
+        {
+            pPage = smPages[pageIndex];
+            break;
+        }
+    }
+
+    // Create a page if none had room.
+    if ( pPage == NULL )
+    {
+        pPage = createPage( filter );
+        const bool allocated = allocate( pPage, paddedWidth, paddedHeight, position );
+
+        // Sanity!
+        AssertFatal( allocated, "TextureAtlas::acquire() - Could not allocate the image in an empty page." );
+    }
+
+    // Copy the image into the page.
+    copyImage( pPage->mTexture.getBitmap(), position, pBitmap, Point2I( 0, 0 ), width, height );
+    uploadRegion( pPage, position, paddedWidth, paddedHeight );
+    delete pBitmap;
+
+    // Create the entry.
+    Entry* pEntry = new Entry();
+    pEntry->mTextureKey = textureKey;
+    pEntry->mpPage = pPage;
+    pEntry->mOffset.set( position.x + Padding, position.y + Padding );
+    pEntry->mWidth = width;
+    pEntry->mHeight = height;
+    pEntry->mOwners.push_back( owner );
+    pPage->mEntries.push_back( pEntry );
+    pPage->mUsedArea += paddedWidth * paddedHeight;
+
+    smImagesPacked++;
+
+    return pEntry;
+}
+
+//-----------------------------------------------------------------------------
+
+void TextureAtlas::release( Entry* pEntry, void* userData )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TextureAtlas_Release);
+
+    // Remove the owner.
+    for ( S32 ownerIndex = 0; ownerIndex < pEntry->mOwners.size(); ++ownerIndex )
+    {
+        if ( pEntry->mOwners[ownerIndex].mUserData == userData )
+        {
+            pEntry->mOwners.erase_fast( ownerIndex );
+            break;
+        }
+    }
+
+    // Finish if the image is still in use.
+    if ( pEntry->mOwners.size() > 0 )
+        return;
+
+    // Remove the entry from its page.
+    Page* pPage = pEntry->mpPage;
+    for ( S32 entryIndex = 0; entryIndex < pPage->mEntries.size(); ++entryIndex )
+    {
+        if ( pPage->mEntries[entryIndex] == pEntry )
+        {
+            pPage->mEntries.erase_fast( entryIndex );
+            break;
+        }
+    }
+    pPage->mUsedArea -= (pEntry->mWidth + Padding * 2) * (pEntry->mHeight + Padding * 2);
+    delete pEntry;
+
+    // Delete the page if it is empty.
+    if ( pPage->mEntries.size() == 0 )
+    {
+        deletePage( pPage );
+        return;
+    }
+
+    // Repack the page once most of its allocated area is unused.
+    // Each repack halves the allocated area so repacking is amortized across releases.
+    if ( pPage->mUsedArea * 2 < pPage->mAllocatedArea )
+        repackPage( pPage );
+}
+
+//-----------------------------------------------------------------------------
+
+void TextureAtlas::destroy( void )
+{
+    while ( smPages.size() > 0 )
+    {
+        Page* pPage = smPages.last();
+
+        for ( S32 entryIndex = 0; entryIndex < pPage->mEntries.size(); ++entryIndex )
+        {
+            delete pPage->mEntries[entryIndex];
+        }
+
+        deletePage( pPage );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TextureAtlas::Page* TextureAtlas::createPage( const GLuint filter )
+{
+    // Create a cleared page bitmap.
+    GBitmap* pBitmap = new GBitmap( PageSize, PageSize, false, GBitmap::RGBA );
+    dMemset( pBitmap->getWritableBits(), 0, pBitmap->byteSize );
+
+    // Create the page keeping the bitmap for packing.
+    Page* pPage = new Page();
+    pPage->mTexture.set( TextureManager::getUniqueTextureKey(), pBitmap, TextureHandle::BitmapKeepTexture, true );
+    pPage->mTexture.setFilter( filter );
+    pPage->mFilter = filter;
+    pPage->mUsedArea = 0;
+    resetSkyline( pPage );
+
+    smPages.push_back( pPage );
+
+    return pPage;
+}
+
+//-----------------------------------------------------------------------------
+
+void TextureAtlas::deletePage( Page* pPage )
+{
+    for ( S32 pageIndex = 0; pageIndex < smPages.size(); ++pageIndex )
+    {
+        if ( smPages[pageIndex] == pPage )
+        {
+            smPages.erase( pageIndex );
+            break;
+        }
+    }
+
+    delete pPage;
+}
+
+//-----------------------------------------------------------------------------
+
+void TextureAtlas::resetSkyline( Page* pPage )
+{
+    SkylineNode node;
+    node.mX = 0;
+    node.mY = 0;
+    node.mWidth = PageSize;
+
+    pPage->mSkyline.clear();
+    pPage->mSkyline.push_back( node );
+    pPage->mAllocatedArea = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+bool TextureAtlas::allocate( Page* pPage, const U32 width, const U32 height, Point2I& position )
+{
+    S32 bestIndex = -1;
+    S32 bestTop = S32_MAX;
+    S32 bestWidth = S32_MAX;
+
+    // Find the node giving the lowest top edge, preferring the narrowest node.
+    for ( S32 nodeIndex = 0; nodeIndex < pPage->mSkyline.size(); ++nodeIndex )
+    {
+        const S32 y = fitSkyline( pPage, nodeIndex, width, height );
+
+        if ( y < 0 )
+            continue;
+
+        const S32 top = y + (S32)height;
+        const S32 nodeWidth = pPage->mSkyline[nodeIndex].mWidth;
+
+        if ( top < bestTop || (top == bestTop && nodeWidth < bestWidth) )
+        {
+            bestIndex = nodeIndex;
+            bestTop = top;
+            bestWidth = nodeWidth;
+            position.set( pPage->mSkyline[nodeIndex].mX, y );
+        }
+    }
+
+    // Finish if the image does not fit.
+    if ( bestIndex == -1 )
+        return false;
+
+    addSkylineLevel( pPage, bestIndex, position, width, height );
+    pPage->mAllocatedArea += width * height;
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+S32 TextureAtlas::fitSkyline( Page* pPage, const S32 nodeIndex, const S32 width, const S32 height )
+{
+    const Vector<SkylineNode>& skyline = pPage->mSkyline;
+
+    // Finish if the image would pass the right-hand side.
+    if ( skyline[nodeIndex].mX + width > PageSize )
+        return -1;
+
+    // Rest the image on the highest node it spans.
+    S32 y = skyline[nodeIndex].mY;
+    S32 widthLeft = width;
+    for ( S32 index = nodeIndex; widthLeft > 0; ++index )
+    {
+        y = getMax( y, skyline[index].mY );
+
+        // Finish if the image would pass the top.
+        if ( y + height > PageSize )
+            return -1;
+
+        widthLeft -= skyline[index].mWidth;
+    }
+
+    return y;
+}
+
+//-----------------------------------------------------------------------------
+
+void TextureAtlas::addSkylineLevel( Page* pPage, const S32 nodeIndex, const Point2I& position, const S32 width, const S32 height )
+{
+    Vector<SkylineNode>& skyline = pPage->mSkyline;
+
+    // Insert the new level.
+    skyline.insert( nodeIndex );
+    skyline[nodeIndex].mX = position.x;
+    skyline[nodeIndex].mY = position.y + height;
+    skyline[nodeIndex].mWidth = width;
+
+    // Shrink or remove the nodes now covered by the new level.
+    for ( S32 index = nodeIndex + 1; index < skyline.size(); ++index )
+    {
+        const S32 previousRight = skyline[index-1].mX + skyline[index-1].mWidth;
+
+        if ( skyline[index].mX >= previousRight )
+            break;
+
+        const S32 shrink = previousRight - skyline[index].mX;
+        skyline[index].mX += shrink;
+        skyline[index].mWidth -= shrink;
+
+        if ( skyline[index].mWidth > 0 )
+            break;
+
+        skyline.erase( index );
+        --index;
+    }
+
+    // Merge neighbouring nodes at the same level.
+    for ( S32 index = 0; index < skyline.size() - 1; ++index )
+    {
+        if ( skyline[index].mY == skyline[index+1].mY )
+        {
+            skyline[index].mWidth += skyline[index+1].mWidth;
+            skyline.erase( index + 1 );
+            --index;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TextureAtlas::copyImage( GBitmap* pPageBitmap, const Point2I& position, const GBitmap* pBitmap, const Point2I& sourcePosition, const U32 width, const U32 height )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TextureAtlas_CopyImage);
+
+    const GBitmap::BitmapFormat format = pBitmap->getFormat();
+    const U32 bytesPerPixel = pBitmap->bytesPerPixel;
+
+    // Copy the image and its gutter, clamping the gutter to the image edges.
+    for ( S32 y = -Padding; y < (S32)height + Padding; ++y )
+    {
+        const S32 sourceY = sourcePosition.y + mClamp( y, 0, (S32)height - 1 );
+        U8* pDest = pPageBitmap->getAddress( position.x, position.y + Padding + y );
+
+        for ( S32 x = -Padding; x < (S32)width + Padding; ++x, pDest += 4 )
+        {
+            const S32 sourceX = sourcePosition.x + mClamp( x, 0, (S32)width - 1 );
+            const U8* pSource = pBitmap->getAddress( sourceX, sourceY );
+
+            // Expand the texel to RGBA as the equivalent GL format would.
+            switch( format )
+            {
+                case GBitmap::RGBA:
+                    pDest[0] = pSource[0]; pDest[1] = pSource[1]; pDest[2] = pSource[2]; pDest[3] = pSource[3];
+                    break;
+
+                case GBitmap::RGB:
+                    pDest[0] = pSource[0]; pDest[1] = pSource[1]; pDest[2] = pSource[2]; pDest[3] = 0xFF;
+                    break;
+
+                case GBitmap::Alpha:
+                    pDest[0] = 0xFF; pDest[1] = 0xFF; pDest[2] = 0xFF; pDest[3] = pSource[0];
+                    break;
+
+                case GBitmap::Luminance:
+                    pDest[0] = pSource[0]; pDest[1] = pSource[0]; pDest[2] = pSource[0]; pDest[3] = 0xFF;
+                    break;
+
+                case GBitmap::Intensity:
+                    pDest[0] = pSource[0]; pDest[1] = pSource[0]; pDest[2] = pSource[0]; pDest[3] = pSource[0];
+                    break;
+
+                default:
+                    // Sanity!
+                    AssertFatal( false, avar("TextureAtlas::copyImage() - Unsupported format %d with %d bytes-per-pixel.", format, bytesPerPixel) );
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TextureAtlas::uploadRegion( Page* pPage, const Point2I& position, const U32 width, const U32 height )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TextureAtlas_UploadRegion);
+
+    // Finish if there is no texture to update.
+    // The whole page is uploaded when the texture is next created.
+    TextureObject* pTextureObject = (TextureObject*)pPage->mTexture;
+    if ( pTextureObject == NULL || pTextureObject->getGLTextureName() == 0 )
+        return;
+
+    // Upload the whole page if sub-image updates are disabled.
+    if ( TextureManager::mDisableTextureSubImageUpdates )
+    {
+        pPage->mTexture.refresh();
+        return;
+    }
+
+    // Gather the region into a contiguous block.
+    const GBitmap* pPageBitmap = pPage->mTexture.getBitmap();
+    const U32 rowBytes = width * 4;
+    U8* pRegion = new U8[rowBytes * height];
+    for ( U32 y = 0; y < height; ++y )
+    {
+        dMemcpy( pRegion + y * rowBytes, pPageBitmap->getAddress( position.x, position.y + y ), rowBytes );
+    }
+
+    // Upload the region.
+    glBindTexture( GL_TEXTURE_2D, pTextureObject->getGLTextureName() );
+    glTexSubImage2D( GL_TEXTURE_2D, 0, position.x, position.y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pRegion );
+
+    delete [] pRegion;
+}
+
+//-----------------------------------------------------------------------------
+
+static S32 QSORT_CALLBACK compareEntryHeight( const void* a, const void* b )
+{
+    const TextureAtlas::Entry* pEntryA = *(const TextureAtlas::Entry**)a;
+    const TextureAtlas::Entry* pEntryB = *(const TextureAtlas::Entry**)b;
+
+    return (S32)pEntryB->getHeight() - (S32)pEntryA->getHeight();
+}
+
+//-----------------------------------------------------------------------------
+
+void TextureAtlas::repackPage( Page* pPage )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TextureAtlas_RepackPage);
+
+    // Take a copy of the page to repack from.
+    GBitmap* pPageBitmap = pPage->mTexture.getBitmap();
+    const GBitmap sourceBitmap( *pPageBitmap );
+
+    // Pack the tallest images first.
+    Vector<Entry*> entries( pPage->mEntries );
+    dQsort( entries.address(), entries.size(), sizeof(Entry*), compareEntryHeight );
+
+    // Clear the page.
+    dMemset( pPageBitmap->getWritableBits(), 0, pPageBitmap->byteSize );
+    resetSkyline( pPage );
+    pPage->mEntries.clear();
+    pPage->mUsedArea = 0;
+
+    for ( S32 entryIndex = 0; entryIndex < entries.size(); ++entryIndex )
+    {
+        Entry* pEntry = entries[entryIndex];
+        const U32 paddedWidth = pEntry->mWidth + Padding * 2;
+        const U32 paddedHeight = pEntry->mHeight + Padding * 2;
+
+        // Place the image back in the page or, failing that, any other page.
+        Page* pTargetPage = pPage;
+        Point2I position;
+        if ( !allocate( pPage, paddedWidth, paddedHeight, position ) )
+        {
+            pTargetPage = NULL;
+            for ( S32 pageIndex = 0; pageIndex < smPages.size(); ++pageIndex )
+            {
+                Page* pOtherPage = smPages[pageIndex];
+                if ( pOtherPage != pPage && pOtherPage->mFilter == pPage->mFilter && allocate( pOtherPage, paddedWidth, paddedHeight, position ) )
+                {
+                    pTargetPage = pOtherPage;
+                    break;
+                }
+            }
+
+            if ( pTargetPage == NULL )
+            {
+                pTargetPage = createPage( pPage->mFilter );
+                allocate( pTargetPage, paddedWidth, paddedHeight, position );
+            }
+        }
+
+        // Copy the image from its previous position.
+        copyImage( pTargetPage->mTexture.getBitmap(), position, &sourceBitmap, pEntry->mOffset, pEntry->mWidth, pEntry->mHeight );
+
+        if ( pTargetPage != pPage )
+            uploadRegion( pTargetPage, position, paddedWidth, paddedHeight );
+
+        pEntry->mpPage = pTargetPage;
+        pEntry->mOffset.set( position.x + Padding, position.y + Padding );
+        pTargetPage->mEntries.push_back( pEntry );
+        pTargetPage->mUsedArea += paddedWidth * paddedHeight;
+    }
+
+    // Upload the page.
+    TextureObject* pTextureObject = (TextureObject*)pPage->mTexture;
+    if ( pTextureObject != NULL && pTextureObject->getGLTextureName() != 0 )
+        pPage->mTexture.refresh();
+
+    smPageRepacks++;
+
+    // Notify the owners that their images have moved.
+    for ( S32 entryIndex = 0; entryIndex < entries.size(); ++entryIndex )
+    {
+        Entry* pEntry = entries[entryIndex];
+
+        for ( S32 ownerIndex = 0; ownerIndex < pEntry->mOwners.size(); ++ownerIndex )
+        {
+            const Entry::Owner& owner = pEntry->mOwners[ownerIndex];
+            owner.mCallback( pEntry, owner.mUserData );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+bool TextureAtlas::isSupportedFormat( const GBitmap* pBitmap )
+{
+    // Forced 16-bit bitmaps cannot share a page.
+    if ( pBitmap->mForce16Bit )
+        return false;
+
+    switch( pBitmap->getFormat() )
+    {
+        case GBitmap::RGBA:
+        case GBitmap::RGB:
+        case GBitmap::Alpha:
+        case GBitmap::Luminance:
+        case GBitmap::Intensity:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TextureAtlas::dumpMetrics( void )
+{
+    U32 imageCount = 0;
+    for ( S32 pageIndex = 0; pageIndex < smPages.size(); ++pageIndex )
+    {
+        imageCount += smPages[pageIndex]->mEntries.size();
+    }
+
+    Con::printf( "Texture Atlas: Pages: %d, Images: %d, Packed: %d, Shared: %d, Rejected (TooLarge): %d, Rejected (Format): %d, Repacks: %d",
+        smPages.size(), imageCount, smImagesPacked, smImagesShared, smImagesTooLarge, smImagesUnsupported, smPageRepacks );
+
+    const F32 pageArea = (F32)(PageSize * PageSize);
+    for ( S32 pageIndex = 0; pageIndex < smPages.size(); ++pageIndex )
+    {
+        Page* pPage = smPages[pageIndex];
+
+        Con::printf( "AtlasPage: %s, Filter: %s, Images: %d, Used: %g%%, Allocated: %g%%",
+            pPage->mTexture.getTextureKey(),
+            pPage->mFilter == GL_NEAREST ? "NEAREST" : "BILINEAR",
+            pPage->mEntries.size(),
+            100.0f * (F32)pPage->mUsedArea / pageArea,
+            100.0f * (F32)pPage->mAllocatedArea / pageArea );
+    }
+}
@@ -0,0 +1,148 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _TEXTURE_ATLAS_H_
+#define _TEXTURE_ATLAS_H_
+
+#ifndef _TEXTURE_HANDLE_H_
+#include "graphics/TextureHandle.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _MPOINT_H_
+#include "math/mPoint.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class GBitmap;
+
+//-----------------------------------------------------------------------------
+
+/// Packs small bitmaps into shared page textures so that they can be rendered in the same batch.
+/// Pages are packed with a skyline bottom-left packer. Each image is surrounded by a gutter
+/// of its own edge texels so filtering never samples a neighbouring image.
+/// An image is shared by everyone acquiring the same texture key and filter. When images are
+/// released and a page becomes sparse, its remaining images are repacked and their owners are
+/// notified so that they can recalculate their texel areas.
+class TextureAtlas
+{
+private:
+    struct Page;
+
+public:
+    enum
+    {
+        PageSize = 1024,
+        DefaultMaxImageSize = 256,
+        Padding = 1,
+    };
+
+    class Entry;
+
+    /// Called when an entry has been moved within its page.
+    typedef void (*EntryMovedCallback)( Entry* pEntry, void* userData );
+
+    /// A packed image.
+    class Entry
+    {
+        friend class TextureAtlas;
+
+    private:
+        struct Owner
+        {
+            EntryMovedCallback  mCallback;
+            void*               mUserData;
+        };
+
+        StringTableEntry    mTextureKey;
+        Page*               mpPage;
+        Point2I             mOffset;
+        U32                 mWidth;
+        U32                 mHeight;
+        Vector<Owner>       mOwners;
+
+    public:
+        Entry() : mTextureKey( NULL ), mpPage( NULL ), mOffset( 0, 0 ), mWidth( 0 ), mHeight( 0 ) {}
+
+        inline StringTableEntry getTextureKey( void ) const                 { return mTextureKey; }
+        inline const Point2I& getOffset( void ) const                       { return mOffset; }
+        inline U32 getWidth( void ) const                                   { return mWidth; }
+        inline U32 getHeight( void ) const                                  { return mHeight; }
+        TextureHandle& getTexture( void ) const;
+    };
+
+private:
+    struct SkylineNode
+    {
+        S32 mX;
+        S32 mY;
+        S32 mWidth;
+    };
+
+    struct Page
+    {
+        TextureHandle           mTexture;
+        GLuint                  mFilter;
+        Vector<SkylineNode>     mSkyline;
+        Vector<Entry*>          mEntries;
+        U32                     mUsedArea;
+        U32                     mAllocatedArea;
+    };
+
+    static Vector<Page*> smPages;
+
+    /// Metrics.
+    static U32 smImagesPacked;
+    static U32 smImagesShared;
+    static U32 smImagesTooLarge;
+    static U32 smImagesUnsupported;
+    static U32 smPageRepacks;
+
+private:
+    static Page* createPage( const GLuint filter );
+    static void deletePage( Page* pPage );
+    static void resetSkyline( Page* pPage );
+    static bool allocate( Page* pPage, const U32 width, const U32 height, Point2I& position );
+    static S32 fitSkyline( Page* pPage, const S32 nodeIndex, const S32 width, const S32 height );
+    static void addSkylineLevel( Page* pPage, const S32 nodeIndex, const Point2I& position, const S32 width, const S32 height );
+    static void copyImage( GBitmap* pPageBitmap, const Point2I& position, const GBitmap* pBitmap, const Point2I& sourcePosition, const U32 width, const U32 height );
+    static void uploadRegion( Page* pPage, const Point2I& position, const U32 width, const U32 height );
+    static void repackPage( Page* pPage );
+    static bool isSupportedFormat( const GBitmap* pBitmap );
+
+public:
+    /// Pack the texture into an atlas page.
+    /// Returns NULL if the texture is too large or in an unsupported format in which case
+    /// the decoded bitmap is returned in "ppUnpackedBitmap" so it can be loaded normally without decoding it again.
+    /// The caller owns any returned bitmap.
+    static Entry* acquire( const char* pTextureKey, const GLuint filter, const U32 maxImageSize, EntryMovedCallback callback, void* userData, GBitmap** ppUnpackedBitmap = NULL );
+    static void release( Entry* pEntry, void* userData );
+    static void destroy( void );
+
+    static void dumpMetrics( void );
+};
+
+#endif // _TEXTURE_ATLAS_H_
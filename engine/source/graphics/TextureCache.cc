@@ -0,0 +1,473 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "graphics/TextureCache.h"
+
+#ifndef _GBITMAP_H_
+#include "graphics/gBitmap.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+#ifndef _MEMSTREAM_H_
+#include "io/memstream.h"
+#endif
+
+#ifndef _CRC_H_
+#include "algorithm/crc.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _CONSOLETYPES_H_
+#include "console/consoleTypes.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_MUTEX_H_
+#include "platform/threads/mutex.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_JOBPOOL_H_
+#include "platform/threads/jobPool.h"
+#endif
+
+#include "memory/safeDelete.h"
+#include "zlib.h"
+
+//-----------------------------------------------------------------------------
+
+static const U32 CacheFileTag = makeFourCCTag( 'C', 'T', 'E', 'X' );
+static const U32 CacheFileCompressed = BIT(0);
+
+//-----------------------------------------------------------------------------
+
+bool TextureCache::smEnabled = false;
+bool TextureCache::smCompress = true;
+StringTableEntry TextureCache::smCacheDirectory = NULL;
+Mutex* TextureCache::smpMetricsLock = NULL;
+U32 TextureCache::smHits = 0;
+U32 TextureCache::smMisses = 0;
+U32 TextureCache::smWrites = 0;
+U32 TextureCache::smFailures = 0;
+U32 TextureCache::smHitTime = 0;
+U32 TextureCache::smMissTime = 0;
+
+//-----------------------------------------------------------------------------
+
+void TextureCache::create( void )
+{
+    smCacheDirectory = StringTable->EmptyString;
+
+    Con::addVariable( "$pref::OpenGL::textureCache", TypeBool, &smEnabled );
+    Con::addVariable( "$pref::OpenGL::textureCacheCompress", TypeBool, &smCompress );
+    Con::addVariable( "$pref::OpenGL::textureCacheDirectory", TypeString, &smCacheDirectory );
+
+    smpMetricsLock = new Mutex();
+}
+
+//-----------------------------------------------------------------------------
+
+void TextureCache::destroy( void )
+{
+    SAFE_DELETE( smpMetricsLock );
+
+    // Reset metrics.
+    smHits = 0;
+    smMisses = 0;
+    smWrites = 0;
+    smFailures = 0;
+    smHitTime = 0;
+    smMissTime = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+bool TextureCache::canCache( const char* pFilePath )
+{
+    const char* pExtension = dStrrchr( pFilePath, '.' );
+    if ( pExtension == NULL )
+        return false;
+
+#if !defined(USE_APPLE_OPTIMIZED_PNGS)
+    // Apple optimized PNGs must be read by the platform.
+    if ( dStricmp( pExtension, ".png" ) == 0 )
+        return true;
+#endif
+
+    return dStricmp( pExtension, ".jpg" ) == 0 || dStricmp( pExtension, ".jpeg" ) == 0;
+}
+
+//-----------------------------------------------------------------------------
+
+GBitmap* TextureCache::loadBitmap( const char* pFilePath )
+{
+    // Sanity!
+    AssertFatal( canCache( pFilePath ), "TextureCache::loadBitmap() - Unsupported file type." );
+
+    const U32 startTime = Platform::getRealMilliseconds();
+
+    // Fetch the source file size and modification time.
+    // Files that are not on disk are left to the resource manager.
+    FileTime sourceModifyTime;
+    const S32 sourceSize = Platform::getFileSize( pFilePath );
+    if ( sourceSize <= 0 || !Platform::getFileTimes( pFilePath, NULL, &sourceModifyTime ) )
+        return NULL;
+
+    // Fetch the cache file.
+    const U32 sourcePathCRC = calculateCRC( pFilePath, dStrlen(pFilePath) );
+    const U32 sourceTime = calculateCRC( &sourceModifyTime, sizeof(sourceModifyTime) );
+    char cacheFilePath[1024];
+    getCacheFilePath( sourcePathCRC, sourceSize, cacheFilePath, sizeof(cacheFilePath) );
+
+    // Use the cached bitmap if present.
+    GBitmap* pBitmap = readCacheFile( cacheFilePath, sourcePathCRC, sourceSize, sourceTime );
+    if ( pBitmap != NULL )
+    {
+        // Adjust metrics.
+        addMetric( smHits, 1 );
+        addMetric( smHitTime, Platform::getRealMilliseconds() - startTime );
+
+        return pBitmap;
+    }
+
+    // Read the source file.
+    U8* pSourceBuffer = NULL;
+    U32 sourceBufferSize = 0;
+    if ( !readSourceFile( pFilePath, pSourceBuffer, sourceBufferSize ) )
+        return NULL;
+
+    // Decode the source file.
+    pBitmap = new GBitmap();
+    MemStream stream( sourceBufferSize, pSourceBuffer, true, false );
+    const char* pExtension = dStrrchr( pFilePath, '.' );
+    const bool decoded = dStricmp( pExtension, ".png" ) == 0 ? pBitmap->readPNG( stream ) : pBitmap->readJPEG( stream );
+    delete [] pSourceBuffer;
+
+    if ( !decoded )
+    {
+        delete pBitmap;
+        addMetric( smFailures, 1 );
+        return NULL;
+    }
+
+    // Cache the bitmap.
+    if ( writeCacheFile( cacheFilePath, pBitmap, sourcePathCRC, sourceSize, sourceTime ) )
+        addMetric( smWrites, 1 );
+    else
+        addMetric( smFailures, 1 );
+
+    // Adjust metrics.
+    addMetric( smMisses, 1 );
+    addMetric( smMissTime, Platform::getRealMilliseconds() - startTime );
+
+    return pBitmap;
+}
+
+//-----------------------------------------------------------------------------
+
+bool TextureCache::readSourceFile( const char* pFilePath, U8*& pBuffer, U32& bufferSize )
+{
+    FileStream stream;
+    if ( !stream.open( pFilePath, FileStream::Read ) )
+        return false;
+
+    bufferSize = stream.getStreamSize();
+    pBuffer = new U8[bufferSize];
+
+    if ( !stream.read( bufferSize, pBuffer ) )
+    {
+        SAFE_DELETE_ARRAY( pBuffer );
+        return false;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+GBitmap* TextureCache::readCacheFile( const char* pCacheFilePath, const U32 sourcePathCRC, const U32 sourceSize, const U32 sourceTime )
+{
+    // Finish if not cached.
+    U32 mappingSize = 0;
+    U8* pMapping = (U8*)Platform::mapFile( pCacheFilePath, mappingSize );
+    if ( pMapping == NULL )
+        return NULL;
+
+    // Read the header.
+    U32 tag, version, pathCRC, size, time, flags, rawSize, storedSize;
+    MemStream stream( mappingSize, pMapping, true, false );
+    stream.read( &tag );
+    stream.read( &version );
+    stream.read( &pathCRC );
+    stream.read( &size );
+    stream.read( &time );
+    stream.read( &flags );
+    stream.read( &rawSize );
+    stream.read( &storedSize );
+
+    // Finish if the cache file is for another version or source or is truncated.
+    const U32 headerSize = stream.getPosition();
+    if ( stream.getStatus() != Stream::Ok || tag != CacheFileTag || version != FileVersion ||
+        pathCRC != sourcePathCRC || size != sourceSize || time != sourceTime || storedSize > mappingSize - headerSize )
+    {
+        Platform::unmapFile( pMapping, mappingSize );
+        return NULL;
+    }
+
+    // Decompress the texels.
+    // Uncompressed texels are read straight from the mapping.
+    const U8* pStored = pMapping + headerSize;
+    U8* pRaw = NULL;
+    bool valid = true;
+    if ( flags & CacheFileCompressed )
+    {
+        pRaw = new U8[rawSize];
+        uLongf destinationSize = rawSize;
+        valid = uncompress( (Bytef*)pRaw, &destinationSize, (const Bytef*)pStored, storedSize ) == Z_OK && destinationSize == rawSize;
+    }
+    else
+    {
+        valid = storedSize == rawSize;
+    }
+
+    // Read the bitmap.
+    GBitmap* pBitmap = NULL;
+    if ( valid )
+    {
+        pBitmap = new GBitmap();
+        MemStream memStream( rawSize, pRaw != NULL ? pRaw : (U8*)pStored, true, false );
+        if ( !pBitmap->read( memStream ) )
+        {
+            SAFE_DELETE( pBitmap );
+        }
+    }
+
+    delete [] pRaw;
+    Platform::unmapFile( pMapping, mappingSize );
+
+    if ( pBitmap == NULL )
+        addMetric( smFailures, 1 );
+
+    return pBitmap;
+}
+
+//-----------------------------------------------------------------------------
+
+bool TextureCache::writeCacheFile( const char* pCacheFilePath, const GBitmap* pBitmap, const U32 sourcePathCRC, const U32 sourceSize, const U32 sourceTime )
+{
+    // Finish if the bitmap needs a palette.
+    if ( pBitmap->getFormat() == GBitmap::Palettized )
+        return false;
+
+    // Serialize the bitmap.
+    const U32 rawSize = (6 + GBitmap::c_maxMipLevels) * sizeof(U32) + pBitmap->byteSize;
+    U8* pRaw = new U8[rawSize];
+    MemStream memStream( rawSize, pRaw, false, true );
+    if ( !pBitmap->write( memStream ) || memStream.getPosition() != rawSize )
+    {
+        delete [] pRaw;
+        return false;
+    }
+
+    // Compress the texels if configured to.
+    U8* pStored = pRaw;
+    U32 storedSize = rawSize;
+    U32 flags = 0;
+    if ( smCompress )
+    {
+        uLongf compressedSize = compressBound( rawSize );
+        U8* pCompressed = new U8[compressedSize];
+
+        // Keep the compressed texels only if they are smaller.
+        if ( compress2( (Bytef*)pCompressed, &compressedSize, (const Bytef*)pRaw, rawSize, Z_BEST_SPEED ) == Z_OK && compressedSize < rawSize )
+        {
+            pStored = pCompressed;
+            storedSize = (U32)compressedSize;
+            flags |= CacheFileCompressed;
+        }
+        else
+        {
+            delete [] pCompressed;
+        }
+    }
+
+    // Write to a temporary file and rename it so that concurrent loads never read a partial file.
+    char temporaryFilePath[1024];
+    dSprintf( temporaryFilePath, sizeof(temporaryFilePath), "%s.%u.tmp", pCacheFilePath, ThreadManager::getCurrentThreadId() );
+
+    bool written = false;
+    FileStream stream;
+    if ( Platform::createPath( temporaryFilePath ) && stream.open( temporaryFilePath, FileStream::Write ) )
+    {
+        stream.write( CacheFileTag );
+        stream.write( U32(FileVersion) );
+        stream.write( sourcePathCRC );
+        stream.write( sourceSize );
+        stream.write( sourceTime );
+        stream.write( flags );
+        stream.write( rawSize );
+        stream.write( storedSize );
+        stream.write( storedSize, pStored );
+        written = stream.getStatus() == Stream::Ok;
+        stream.close();
+
+        // Replace any existing cache file.
+        if ( written )
+        {
+            Platform::fileDelete( pCacheFilePath );
+            written = Platform::fileRename( temporaryFilePath, pCacheFilePath );
+        }
+
+        if ( !written )
+            Platform::fileDelete( temporaryFilePath );
+    }
+
+    if ( pStored != pRaw )
+        delete [] pStored;
+    delete [] pRaw;
+
+    return written;
+}
+
+//-----------------------------------------------------------------------------
+
+void TextureCache::getCacheFilePath( const U32 sourcePathCRC, const U32 sourceSize, char* pBuffer, const U32 bufferSize )
+{
+    dSprintf( pBuffer, bufferSize, "%s/%08x%08x.ctex", smCacheDirectory, sourcePathCRC, sourceSize );
+}
+
+//-----------------------------------------------------------------------------
+
+void TextureCache::addMetric( U32& metric, const U32 value )
+{
+    if ( smpMetricsLock != NULL )
+        smpMetricsLock->lock();
+
+    metric += value;
+
+    if ( smpMetricsLock != NULL )
+        smpMetricsLock->unlock();
+}
+
+//-----------------------------------------------------------------------------
+
+void TextureCache::warmJob( void* pContext, const U32 start, const U32 end )
+{
+    const Vector<StringTableEntry>& filePaths = *(const Vector<StringTableEntry>*)pContext;
+
+    for ( U32 index = start; index < end; ++index )
+    {
+        delete loadBitmap( filePaths[index] );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+U32 TextureCache::warm( const char* pPath )
+{
+    // Finish if there is nowhere to cache to.
+    if ( smCacheDirectory == NULL || *smCacheDirectory == 0 )
+    {
+        Con::warnf( "TextureCache::warm() - No texture cache directory has been set." );
+        return 0;
+    }
+
+    // Find the files.
+    Vector<Platform::FileInfo> files;
+    if ( !Platform::dumpPath( pPath, files ) )
+    {
+        Con::warnf( "TextureCache::warm() - Could not search path '%s'.", pPath );
+        return 0;
+    }
+
+    // Gather the images.
+    Vector<StringTableEntry> filePaths;
+    char filePathBuffer[1024];
+    for ( S32 index = 0; index < files.size(); ++index )
+    {
+        dSprintf( filePathBuffer, sizeof(filePathBuffer), "%s/%s", files[index].pFullPath, files[index].pFileName );
+
+        if ( canCache( filePathBuffer ) )
+            filePaths.push_back( StringTable->insert( filePathBuffer ) );
+    }
+
+    const U32 startHits = smHits;
+    const U32 startWrites = smWrites;
+
+    // Decode the images across the job pool.
+    if ( JobPool::Instance != NULL )
+        JobPool::Instance->parallelFor( warmJob, &filePaths, filePaths.size(), 4 );
+    else
+        warmJob( &filePaths, 0, filePaths.size() );
+
+    // Info.
+    Con::printf( "Texture Cache: Warmed %d images from '%s', AlreadyCached: %d, Written: %d",
+        filePaths.size(), pPath, smHits - startHits, smWrites - startWrites );
+
+    return filePaths.size();
+}
+
+//-----------------------------------------------------------------------------
+
+void TextureCache::dumpMetrics( void )
+{
+    const U32 lookups = smHits + smMisses;
+
+    Con::printf( "Texture Cache: Enabled: %s, Directory: %s, Hits: %d (%gms avg), Misses: %d (%gms avg), HitRate: %g%%, Writes: %d, Failures: %d",
+        isEnabled() ? "YES" : "NO",
+        smCacheDirectory == NULL ? "" : smCacheDirectory,
+        smHits,
+        smHits == 0 ? 0.0f : F32(smHitTime) / F32(smHits),
+        smMisses,
+        smMisses == 0 ? 0.0f : F32(smMissTime) / F32(smMisses),
+        lookups == 0 ? 0.0f : 100.0f * F32(smHits) / F32(lookups),
+        smWrites,
+        smFailures );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleFunction( warmTextureCache, S32, 2, 2, "(path) Decodes every PNG and JPEG image below the path into the texture cache.\n"
+                                               "This is intended to be run offline so that the cache can be shipped.\n"
+                                               "@param path The path to search.\n"
+                                               "@return The number of images found.")
+{
+    char pathBuffer[1024];
+    Con::expandPath( pathBuffer, sizeof(pathBuffer), argv[1] );
+
+    return TextureCache::warm( pathBuffer );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleFunction( dumpTextureCacheMetrics, void, 1, 1, "() Dump the texture cache metrics." )
+{
+    TextureCache::dumpMetrics();
+}
@@ -0,0 +1,93 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _TEXTURE_CACHE_H_
+#define _TEXTURE_CACHE_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class GBitmap;
+class Mutex;
+
+//-----------------------------------------------------------------------------
+
+/// Disk cache of decoded texture bitmaps.
+/// PNG and JPEG files are decoded once and their texels are stored, optionally zlib-compressed,
+/// in a ".ctex" file named after the CRC of the source path and the size of the source file so
+/// that later loads map the texels directly rather than running the image decoders.  The cache
+/// file records the size and modification time of the source file, so changing the source file
+/// replaces the entry without the source file being read on a hit.
+/// Loading is thread-safe so it can be used by asynchronous texture loads.
+class TextureCache
+{
+public:
+    enum
+    {
+        FileVersion = 2,
+    };
+
+private:
+    static bool                 smEnabled;
+    static bool                 smCompress;
+    static StringTableEntry     smCacheDirectory;
+
+    /// Metrics.
+    static Mutex*               smpMetricsLock;
+    static U32                  smHits;
+    static U32                  smMisses;
+    static U32                  smWrites;
+    static U32                  smFailures;
+    static U32                  smHitTime;
+    static U32                  smMissTime;
+
+private:
+    static bool readSourceFile( const char* pFilePath, U8*& pBuffer, U32& bufferSize );
+    static GBitmap* readCacheFile( const char* pCacheFilePath, const U32 sourcePathCRC, const U32 sourceSize, const U32 sourceTime );
+    static bool writeCacheFile( const char* pCacheFilePath, const GBitmap* pBitmap, const U32 sourcePathCRC, const U32 sourceSize, const U32 sourceTime );
+    static void getCacheFilePath( const U32 sourcePathCRC, const U32 sourceSize, char* pBuffer, const U32 bufferSize );
+    static void warmJob( void* pContext, const U32 start, const U32 end );
+    static void addMetric( U32& metric, const U32 value );
+
+public:
+    static void create( void );
+    static void destroy( void );
+
+    static bool isEnabled( void ) { return smEnabled && smCacheDirectory != NULL && *smCacheDirectory != 0; }
+
+    /// Whether the file is a format the cache can decode.
+    static bool canCache( const char* pFilePath );
+
+    /// Load the bitmap from the cache, decoding and caching it first if necessary.
+    /// Returns NULL if the file cannot be read from disk or decoded.
+    static GBitmap* loadBitmap( const char* pFilePath );
+
+    /// Cache every image below the path.
+    static U32 warm( const char* pPath );
+
+    static void dumpMetrics( void );
+};
+
+#endif // _TEXTURE_CACHE_H_
@@ -52,12 +52,12 @@ TextureHandle::TextureHandle( const char* pTextureKey, GBitmap* bmp, TextureHand
 
 //-----------------------------------------------------------------------------
 
-bool TextureHandle::set( const char* pTextureKey, TextureHandleType type, bool clampToEdge, bool force16Bit ) 
+bool TextureHandle::set( const char* pTextureKey, TextureHandleType type, bool clampToEdge, bool force16Bit, const U32 uploadFlags, GBitmap* pDecodedBitmap ) 
 {
     // Sanity!
     AssertISV( type != TextureHandle::InvalidTexture, "Invalid texture type." );
 
-    TextureObject* newObject = TextureManager::loadTexture(pTextureKey, type, clampToEdge, false, force16Bit );
+    TextureObject* newObject = TextureManager::loadTexture(pTextureKey, type, clampToEdge, false, force16Bit, uploadFlags, pDecodedBitmap );
     if (newObject != object)
     {
         unlock();
@@ -86,8 +86,37 @@ bool TextureHandle::set( const char* pTextureKey, GBitmap *bmp, TextureHandleTyp
 
 //-----------------------------------------------------------------------------
 
+bool TextureHandle::setAsync( const char* pTextureKey, TextureHandleType type, bool clampToEdge, bool force16Bit, void (*callback)(TextureObject*, const bool, void*), void* userData, const U32 uploadFlags )
+{
+    // Sanity!
+    AssertISV( type != TextureHandle::InvalidTexture, "Invalid texture type." );
+
+    TextureObject* newObject = TextureManager::loadTextureAsync(pTextureKey, type, clampToEdge, force16Bit, callback, userData, uploadFlags );
+    if (newObject != object)
+    {
+        unlock();
+        object = newObject;
+        lock();
+    }
+    return (object != NULL);
+}
+
+//-----------------------------------------------------------------------------
+
 void TextureHandle::refresh( void )
 {
+    // Finish if the texture is still loading as it is uploaded once loaded.
+    if ( isPending() )
+        return;
+
+    // Finish if the texture is evicted as it is uploaded when restored.
+    if ( object == NULL || object->mGLTextureName == 0 )
+        return;
+
+    // Finish if a discarded bitmap cannot be reloaded.
+    if ( TextureManager::getResidentBitmap( object ) == NULL )
+        return;
+
     TextureManager::refresh(object);
 }
 
@@ -116,21 +145,35 @@ U32 TextureHandle::getHeight( void ) const
 
 GBitmap* TextureHandle::getBitmap( void )
 {
-    return (object ? object->mpBitmap : NULL);
+    // Reload the bitmap if it was discarded or evicted.
+    return (object ? TextureManager::getResidentBitmap( object ) : NULL);
 }
 
 //-----------------------------------------------------------------------------
 
 const GBitmap* TextureHandle::getBitmap( void ) const
 {
-    return (object ? object->mpBitmap: NULL);
+    // Reload the bitmap if it was discarded or evicted.
+    return (object ? TextureManager::getResidentBitmap( object ) : NULL);
+}
+
+//-----------------------------------------------------------------------------
+
+bool TextureHandle::isPending( void ) const
+{
+    return object != NULL && object->mLoadPending;
 }
 
 //-----------------------------------------------------------------------------
 
 U32 TextureHandle::getGLName( void ) const
 {
-    return object == NULL ? 0 : object->mGLTextureName;
+    if ( object == NULL )
+        return 0;
+
+    // Render the placeholder until the texture has been uploaded.
+    // Binding the texture also restores it if it was evicted.
+    return object->mLoadPending ? TextureManager::getPlaceholderGLName() : TextureManager::getResidentGLName( object );
 }
 
 //-----------------------------------------------------------------------------
@@ -151,7 +194,68 @@ void TextureHandle::setFilter( const GLuint filter )
     // Set texture state.
     glBindTexture( GL_TEXTURE_2D, object->mGLTextureName );
     glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter );
-    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, TextureManager::getMinFilter( object ) );
+}
+
+//-----------------------------------------------------------------------------
+
+void TextureHandle::setResidencyPriority( const ResidencyPriority priority )
+{
+    // Finish if no object.
+    if ( object == NULL )
+        return;
+
+    object->mResidencyPriority = priority;
+}
+
+//-----------------------------------------------------------------------------
+
+TextureHandle::ResidencyPriority TextureHandle::getResidencyPriority( void ) const
+{
+    return object == NULL ? ResidencyNormal : object->mResidencyPriority;
+}
+
+//-----------------------------------------------------------------------------
+
+void TextureHandle::setBitmapPolicy( const BitmapPolicy policy )
+{
+    // Finish if no object.
+    if ( object == NULL )
+        return;
+
+    TextureManager::setBitmapPolicy( object, policy );
+}
+
+//-----------------------------------------------------------------------------
+
+TextureHandle::BitmapPolicy TextureHandle::getBitmapPolicy( void ) const
+{
+    return object == NULL ? BitmapPolicyDefault : object->mBitmapPolicy;
+}
+
+//-----------------------------------------------------------------------------
+
+void TextureHandle::setUploadFlags( const U32 uploadFlags )
+{
+    // Finish if no object.
+    if ( object == NULL )
+        return;
+
+    TextureManager::setUploadFlags( object, uploadFlags );
+}
+
+//-----------------------------------------------------------------------------
+
+U32 TextureHandle::getUploadFlags( void ) const
+{
+    return object == NULL ? UploadDefault : object->mUploadFlags;
+}
+
+//-----------------------------------------------------------------------------
+
+bool TextureHandle::getPremultipliedAlpha( void ) const
+{
+    return object != NULL && (object->mUploadFlags & UploadPremultiplyAlpha) != 0;
 }
 
 //-----------------------------------------------------------------------------
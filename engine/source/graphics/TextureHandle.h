@@ -123,6 +123,35 @@ public:
         BitmapKeepTexture = 200,
     };
 
+    /// Residency priority used when the texture manager evicts textures to stay within its budget.
+    /// Lower priorities are evicted first and pinned textures are never evicted.
+    enum ResidencyPriority
+    {
+        ResidencyLow = 0,
+        ResidencyNormal,
+        ResidencyHigh,
+        ResidencyPinned,
+    };
+
+    /// Whether the bitmap of a kept texture loaded from file is retained once uploaded.
+    /// Discarded bitmaps are reloaded from the file when needed again.  Bitmaps for textures
+    /// created from memory are always kept.
+    enum BitmapPolicy
+    {
+        BitmapPolicyDefault = 0,    ///< Use "$pref::OpenGL::discardTextureBitmaps".
+        BitmapPolicyKeep,
+        BitmapPolicyDiscard,
+    };
+
+    /// Processing applied to a bitmap when it is prepared for upload.
+    /// The bitmap kept by the texture is never modified.
+    enum UploadFlags
+    {
+        UploadDefault           = 0,
+        UploadMipmaps           = BIT(0),   ///< Generate a box-filtered mipmap chain.
+        UploadPremultiplyAlpha  = BIT(1),   ///< Multiply the color channels by alpha.
+    };
+
 public:
     TextureHandle() : object( NULL ) {}
 
@@ -152,10 +181,16 @@ public:
         return *this;
     }
 
-    bool set(const char* pTextureKey, TextureHandleType type = BitmapTexture, bool clampToEdge = false, bool force16Bit = false );
+    /// A bitmap already decoded from the texture file can be passed to avoid decoding it again.
+    /// The handle takes ownership of it and the texture stays reloadable from the file.
+    bool set(const char* pTextureKey, TextureHandleType type = BitmapTexture, bool clampToEdge = false, bool force16Bit = false, const U32 uploadFlags = UploadDefault, GBitmap* pDecodedBitmap = NULL );
 
     bool set(const char* pTextureKey, GBitmap *bmp, TextureHandleType type, bool clampToEdge = false);
 
+    /// Load the texture on the job pool.  The handle renders a placeholder until the texture is uploaded.
+    /// The bitmap is also prepared for upload on the job pool.
+    bool setAsync(const char* pTextureKey, TextureHandleType type = BitmapTexture, bool clampToEdge = false, bool force16Bit = false, void (*callback)(TextureObject*, const bool, void*) = NULL, void* userData = NULL, const U32 uploadFlags = UploadDefault );
+
     bool operator==( const TextureHandle& handle ) const { return handle.object == object; }
 
     bool operator!=( const TextureHandle& handle ) const { return handle.object != object; }
@@ -164,6 +199,17 @@ public:
 
     void setFilter( const GLuint filter );
 
+    void setResidencyPriority( const ResidencyPriority priority );
+    ResidencyPriority getResidencyPriority( void ) const;
+
+    void setBitmapPolicy( const BitmapPolicy policy );
+    BitmapPolicy getBitmapPolicy( void ) const;
+
+    /// Changing the upload flags of an uploaded texture uploads it again when next bound.
+    void setUploadFlags( const U32 uploadFlags );
+    U32 getUploadFlags( void ) const;
+    bool getPremultipliedAlpha( void ) const;
+
     void clear( void ) { unlock(); }
 
     void refresh( void );
@@ -171,6 +217,7 @@ public:
     operator TextureObject*() { return object; }
     inline bool NotNull( void ) const { return object != NULL; }
     inline bool IsNull( void ) const { return object == NULL; }
+    bool isPending( void ) const;
     const char* getTextureKey( void ) const;
     U32 getWidth( void ) const;
     U32 getHeight( void ) const;
@@ -21,6 +21,8 @@
 //-----------------------------------------------------------------------------
 
 #include "graphics/TextureManager.h"
+#include "graphics/TextureAtlas.h"
+#include "graphics/TextureCache.h"
 
 #include "platform/platformAssert.h"
 #include "platform/platformGL.h"
@@ -33,6 +35,9 @@
 #include "console/consoleTypes.h"
 #include "memory/safeDelete.h"
 #include "math/mMath.h"
+#include "io/fileStream.h"
+#include "platform/threads/jobPool.h"
+#include "debug/profiler.h"
 
 //---------------------------------------------------------------------------------------------------------------------
 
@@ -47,6 +52,26 @@ S32 TextureManager::mBitmapResidentSize = 0;
 S32 TextureManager::mTextureResidentSize = 0;
 S32 TextureManager::mTextureResidentWasteSize = 0;
 S32 TextureManager::mTextureResidentCount = 0;
+F32 TextureManager::mTextureUploadBudget = 2.0f;
+TextureObject* TextureManager::mpPlaceholderTexture = NULL;
+U32 TextureManager::mAsyncLoadsCompleted = 0;
+U32 TextureManager::mAsyncDecodeTime = 0;
+U32 TextureManager::mAsyncUploadTime = 0;
+U32 TextureManager::mFrameIndex = 0;
+F32 TextureManager::mTextureResidencyBudget = 0.0f;
+S32 TextureManager::mTextureEvictionAge = 120;
+bool TextureManager::mEvictBitmaps = false;
+U32 TextureManager::mTexturesEvicted = 0;
+U32 TextureManager::mTexturesRestored = 0;
+U32 TextureManager::mTextureBytesEvicted = 0;
+U32 TextureManager::mBitmapBytesEvicted = 0;
+bool TextureManager::mDiscardBitmaps = false;
+U32 TextureManager::mBitmapsDiscarded = 0;
+U32 TextureManager::mBitmapsReloaded = 0;
+U32 TextureManager::mBitmapBytesDiscarded = 0;
+
+// Bound to a preference so PNG decoding never reads the console from a worker thread.
+extern bool sgForcePalletedPNGsTo16Bit;
 
 //---------------------------------------------------------------------------------------------------------------------
 
@@ -114,6 +139,113 @@ static Vector<EventCallbackEntry> sgEventCallbacks(__FILE__, __LINE__);
 
 //--------------------------------------------------------------------------------------------------------------------
 
+struct LoadCallbackEntry
+{
+    TextureManager::TextureLoadCallback callback;
+    void *                              userData;
+};
+
+/// An asynchronous texture load.
+/// Only the file path and bitmaps are touched by the decode job, everything else belongs to the main thread.
+struct AsyncTextureRequest
+{
+    AsyncTextureRequest() :
+        mpTextureObject( NULL ),
+        mForce16Bit( false ),
+        mUploadFlags( TextureHandle::UploadDefault ),
+        mCancelled( false ),
+        mpBitmap( NULL ),
+        mpPaddedBitmap( NULL ),
+        mTooLarge( false ),
+        mDecodeTime( 0 )
+    {
+        mFilePath[0] = 0;
+        VECTOR_SET_ASSOCIATION( mCallbacks );
+    }
+
+    ~AsyncTextureRequest()
+    {
+        if ( mpPaddedBitmap != mpBitmap )
+            delete mpPaddedBitmap;
+
+        delete mpBitmap;
+    }
+
+    JobCounter                  mCounter;
+    TextureObject*              mpTextureObject;
+    Vector<LoadCallbackEntry>   mCallbacks;
+    char                        mFilePath[1024];
+    bool                        mForce16Bit;
+    U32                         mUploadFlags;
+    bool                        mCancelled;
+
+    /// Decode results.
+    GBitmap*                    mpBitmap;
+    GBitmap*                    mpPaddedBitmap;
+    bool                        mTooLarge;
+    U32                         mDecodeTime;
+};
+
+static Vector<AsyncTextureRequest*> sgAsyncTextureRequests(__FILE__, __LINE__);
+
+//--------------------------------------------------------------------------------------------------------------------
+
+static S32 findAsyncTextureRequest( TextureObject* pTextureObject )
+{
+    for (S32 i = 0; i < sgAsyncTextureRequests.size(); i++)
+    {
+        if (sgAsyncTextureRequests[i]->mpTextureObject == pTextureObject)
+            return i;
+    }
+
+    return -1;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+/// A bitmap decoded ahead of its texture being loaded.
+/// Only the file path and bitmap are touched by the decode job, everything else belongs to the main thread.
+struct PrefetchBitmapRequest
+{
+    PrefetchBitmapRequest() :
+        mTextureKey( StringTable->EmptyString ),
+        mReferenceCount( 0 ),
+        mpBitmap( NULL )
+    {
+        mFilePath[0] = 0;
+    }
+
+    ~PrefetchBitmapRequest()
+    {
+        delete mpBitmap;
+    }
+
+    JobCounter                  mCounter;
+    StringTableEntry            mTextureKey;
+    U32                         mReferenceCount;
+    char                        mFilePath[1024];
+
+    /// Decode result.
+    GBitmap*                    mpBitmap;
+};
+
+static Vector<PrefetchBitmapRequest*> sgPrefetchBitmapRequests(__FILE__, __LINE__);
+
+//--------------------------------------------------------------------------------------------------------------------
+
+static S32 findPrefetchBitmapRequest( StringTableEntry textureKey )
+{
+    for (S32 i = 0; i < sgPrefetchBitmapRequests.size(); i++)
+    {
+        if (sgPrefetchBitmapRequests[i]->mTextureKey == textureKey)
+            return i;
+    }
+
+    return -1;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
 U32 TextureManager::registerEventCallback(TextureEventCallback callback, void *userData)
 {
     sgEventCallbacks.increment();
@@ -155,10 +287,17 @@ void TextureManager::create()
     AssertISV(mManagerState == NotInitialized, "TextureManager::create() - already created!");
 
     TextureDictionary::create();
+    TextureCache::create();
 
     Con::addVariable("$pref::OpenGL::force16BitTexture", TypeBool, &TextureManager::mForce16BitTexture);
     Con::addVariable("$pref::OpenGL::allowTextureCompression", TypeBool, &TextureManager::mAllowTextureCompression);
     Con::addVariable("$pref::OpenGL::disableTextureSubImageUpdates", TypeBool, &TextureManager::mDisableTextureSubImageUpdates);
+    Con::addVariable("$pref::OpenGL::textureUploadBudget", TypeF32, &TextureManager::mTextureUploadBudget);
+    Con::addVariable("$pref::OpenGL::textureResidencyBudget", TypeF32, &TextureManager::mTextureResidencyBudget);
+    Con::addVariable("$pref::OpenGL::textureEvictionAge", TypeS32, &TextureManager::mTextureEvictionAge);
+    Con::addVariable("$pref::OpenGL::textureEvictBitmaps", TypeBool, &TextureManager::mEvictBitmaps);
+    Con::addVariable("$pref::OpenGL::discardTextureBitmaps", TypeBool, &TextureManager::mDiscardBitmaps);
+    Con::addVariable("$pref::iPhone::ForcePalletedPNGsTo16Bit", TypeBool, &sgForcePalletedPNGsTo16Bit);
 
     // Flag as alive.
     mManagerState = Alive;
@@ -170,8 +309,44 @@ void TextureManager::destroy()
 {
     AssertISV(mManagerState != NotInitialized, "TextureManager::destroy - nothing to destroy!");
 
+    // Discard any asynchronous loads.
+    for (S32 i = 0; i < sgAsyncTextureRequests.size(); i++)
+    {
+        AsyncTextureRequest* pRequest = sgAsyncTextureRequests[i];
+
+        // Wait for the decode if the job pool is still running it.
+        if ( JobPool::Instance != NULL )
+            JobPool::Instance->wait( pRequest->mCounter );
+
+        if ( pRequest->mpTextureObject != NULL )
+            pRequest->mpTextureObject->mLoadPending = false;
+
+        delete pRequest;
+    }
+    sgAsyncTextureRequests.clear();
+
+    // Discard any prefetched bitmaps.
+    for (S32 i = 0; i < sgPrefetchBitmapRequests.size(); i++)
+    {
+        PrefetchBitmapRequest* pRequest = sgPrefetchBitmapRequests[i];
+
+        // Wait for the decode if the job pool is still running it.
+        if ( JobPool::Instance != NULL )
+            JobPool::Instance->wait( pRequest->mCounter );
+
+        delete pRequest;
+    }
+    sgPrefetchBitmapRequests.clear();
+
+    // The placeholder is freed with the dictionary.
+    mpPlaceholderTexture = NULL;
+
+    // Destroy the atlas pages.
+    TextureAtlas::destroy();
+
     // Destroy the texture dictionary.
     TextureDictionary::destroy();
+    TextureCache::destroy();
 
     // Reset state.
     mBitmapResidentSize = 0;
@@ -179,6 +354,17 @@ void TextureManager::destroy()
     mTextureResidentWasteSize = 0;
     mTextureResidentCount = 0;
     mMasterTextureKeyIndex = 0;
+    mAsyncLoadsCompleted = 0;
+    mAsyncDecodeTime = 0;
+    mAsyncUploadTime = 0;
+    mFrameIndex = 0;
+    mTexturesEvicted = 0;
+    mTexturesRestored = 0;
+    mTextureBytesEvicted = 0;
+    mBitmapBytesEvicted = 0;
+    mBitmapsDiscarded = 0;
+    mBitmapsReloaded = 0;
+    mBitmapBytesDiscarded = 0;
 
     // Flag as not initialized.
     mManagerState = NotInitialized;
@@ -203,6 +389,13 @@ void TextureManager::killManager()
     TextureObject* probe = TextureDictionary::TextureObjectChain;
     while (probe) 
     {
+        // Skip textures still loading asynchronously or evicted.
+        if ( probe->mLoadPending || probe->mEvicted )
+        {
+            probe = probe->next;
+            continue;
+        }
+
         if (probe->mGLTextureName != 0)
         {
             deleteNames.push_back(probe->mGLTextureName);
@@ -241,6 +434,14 @@ void TextureManager::resurrectManager( void )
     TextureObject* probe = TextureDictionary::TextureObjectChain;
     while (probe) 
     {
+        // Skip textures still loading asynchronously as they are uploaded when the load completes.
+        // Evicted textures are restored when next bound.
+        if ( probe->mLoadPending || probe->mEvicted )
+        {
+            probe = probe->next;
+            continue;
+        }
+
         switch( probe->mHandleType )
         {
             case TextureHandle::BitmapTexture:
@@ -255,7 +456,7 @@ void TextureManager::resurrectManager( void )
                     AssertISV(pBitmap != NULL, "Error resurrecting the texture cache.\n""Possible cause: a bitmap was deleted during the course of gameplay.");
 
                     // Register texture.
-                    TextureObject* pTextureObject = registerTexture(probe->mTextureKey, pBitmap, probe->mHandleType, probe->mClamp);
+                    TextureObject* pTextureObject = registerTexture(probe->mTextureKey, pBitmap, probe->mHandleType, probe->mClamp, probe->mUploadFlags);
 
                     // Sanity!
                     AssertFatal(pTextureObject == probe, "A new texture was returned during resurrection.");
@@ -264,6 +465,25 @@ void TextureManager::resurrectManager( void )
 
             case TextureHandle::BitmapKeepTexture:
                 {
+                    // Was the bitmap discarded?
+                    if ( probe->mpBitmap == NULL && probe->mBitmapReloadable )
+                    {
+                        // Yes, so reload the bitmap.
+                        GBitmap* pBitmap = loadBitmap( probe->mTextureKey );
+
+                        // Sanity!
+                        AssertISV(pBitmap != NULL, "Error resurrecting the texture cache.\n""Possible cause: a bitmap was deleted during the course of gameplay.");
+
+                        pBitmap->mForce16Bit = probe->mForce16Bit;
+
+                        // Register texture.
+                        TextureObject* pTextureObject = registerFileTexture(probe->mTextureKey, pBitmap, probe->mHandleType, probe->mClamp, probe->mUploadFlags);
+
+                        // Sanity!
+                        AssertFatal(pTextureObject == probe, "A new texture was returned during resurrection.");
+                        break;
+                    }
+
                     // Sanity!
                     AssertISV( probe->mpBitmap != NULL, "Encountered no bitmap for a texture that should keep it." );
 
@@ -359,10 +579,94 @@ GBitmap* TextureManager::createPowerOfTwoBitmap(GBitmap* pBitmap)
     return pReturn;
 }
 
+//--------------------------------------------------------------------------------------------------------------------
+
+GBitmap* TextureManager::createUploadBitmap( GBitmap* pBitmap, const U32 uploadFlags )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TextureManager_CreateUploadBitmap);
+
+    // Pad the bitmap.
+    GBitmap* pUploadBitmap = createPowerOfTwoBitmap( pBitmap );
+
+    // Finish if there's no further processing.
+    if ( uploadFlags == TextureHandle::UploadDefault )
+        return pUploadBitmap;
+
+    // Finish if the format cannot be processed.
+    const GBitmap::BitmapFormat format = pBitmap->getFormat();
+    if ( format != GBitmap::RGBA && format != GBitmap::RGB )
+        return pUploadBitmap;
+
+    // Only bitmaps with alpha need premultiplying.
+    const bool premultiply = (uploadFlags & TextureHandle::UploadPremultiplyAlpha) && format == GBitmap::RGBA;
+
+    // Copy the bitmap so the source is untouched.
+    if ( pUploadBitmap == pBitmap )
+        pUploadBitmap = new GBitmap( *pBitmap );
+
+    // Premultiply before generating the mipmaps so they are filtered with premultiplied colors.
+    if ( premultiply )
+        pUploadBitmap->premultiplyAlpha();
+
+    // Generate the mipmaps if the chain fits in the bitmap.
+    if ( uploadFlags & TextureHandle::UploadMipmaps )
+    {
+        if ( getMax( pUploadBitmap->getWidth(), pUploadBitmap->getHeight() ) < (1U << GBitmap::c_maxMipLevels) )
+            pUploadBitmap->extrudeMipLevels();
+        else
+            Con::warnf( "TextureManager::createUploadBitmap() - Cannot generate mipmaps for a %dx%d bitmap.", pUploadBitmap->getWidth(), pUploadBitmap->getHeight() );
+    }
+
+    return pUploadBitmap;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+GLint TextureManager::getMinFilter( TextureObject* pTextureObject )
+{
+    // Use the filter as-is if there are no mipmaps.
+    if ( pTextureObject->mMipLevels == 1 )
+        return pTextureObject->mFilter;
+
+    return pTextureObject->mFilter == GL_NEAREST ? GL_NEAREST_MIPMAP_NEAREST : GL_LINEAR_MIPMAP_LINEAR;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::setUploadFlags( TextureObject* pTextureObject, const U32 uploadFlags )
+{
+    // Finish if no change.
+    if ( pTextureObject->mUploadFlags == uploadFlags )
+        return;
+
+    pTextureObject->mUploadFlags = uploadFlags;
+
+    // Finish if the texture has not been uploaded.
+    // Pending asynchronous loads check the flags when they finish.
+    if ( pTextureObject->mGLTextureName == 0 )
+        return;
+
+    // Can the texture be uploaded again?
+    if ( pTextureObject->mpBitmap == NULL && !pTextureObject->mBitmapReloadable )
+    {
+        // No, so warn.
+        Con::warnf( "TextureManager::setUploadFlags() - Cannot upload texture '%s' again as it has no bitmap.", pTextureObject->mTextureKey );
+        return;
+    }
+
+    // Evict the texture so it is uploaded again when next bound.
+    evictTexture( pTextureObject );
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 
 void TextureManager::freeTexture( TextureObject* pTextureObject )
 {
+    // Cancel any asynchronous load.
+    if ( pTextureObject->mLoadPending )
+        cancelAsyncLoad( pTextureObject );
+
     if((mDGLRender || mManagerState == Resurrecting) && pTextureObject->mGLTextureName)
     {
         glDeleteTextures(1, (const GLuint*)&pTextureObject->mGLTextureName);
@@ -586,7 +890,7 @@ U16* TextureManager::create16BitBitmap( GBitmap *pDL, U8 *in_source8, GBitmap::B
 
 //-----------------------------------------------------------------------------
 
-void TextureManager::refresh( TextureObject* pTextureObject )
+void TextureManager::refresh( TextureObject* pTextureObject, GBitmap* pPaddedBitmap )
 {
     // Finish if refresh not appropriate.
     if (!(mDGLRender || mManagerState == Resurrecting))
@@ -597,8 +901,13 @@ void TextureManager::refresh( TextureObject* pTextureObject )
     AssertISV( pTextureObject->mpBitmap != 0, "Refreshing texture but no bitmap available." );
 
     // Fetch bitmaps.
+    // Asynchronous loads have already prepared the bitmap on the job pool.
     GBitmap* pSourceBitmap = pTextureObject->mpBitmap;
-    GBitmap* pNewBitmap = createPowerOfTwoBitmap(pSourceBitmap);
+    GBitmap* pNewBitmap = pPaddedBitmap != NULL ? pPaddedBitmap : createUploadBitmap(pSourceBitmap, pTextureObject->mUploadFlags);
+
+    // Fetch the mip level count.
+    const U32 mipLevels = (pTextureObject->mUploadFlags & TextureHandle::UploadMipmaps) ? pNewBitmap->getNumMipLevels() : 1;
+    pTextureObject->mMipLevels = mipLevels;
 
     // Fetch source/dest formats.
     U32 sourceFormat, destFormat, byteFormat, texelSize;
@@ -634,43 +943,48 @@ void TextureManager::refresh( TextureObject* pTextureObject )
     // Are we forcing to 16-bit?
     if( pSourceBitmap->mForce16Bit )
     {
-        // Yes, so generate a 16-bit texture.
-        GLint GLformat;
-        GLint GLdata_type;
-
-        U16* pBitmap16 = create16BitBitmap( pNewBitmap, pNewBitmap->getWritableBits(), pNewBitmap->getFormat(), 
-                                                &GLformat, &GLdata_type,
-                                                pNewBitmap->getWidth(), pNewBitmap->getHeight() );
-
-        glTexImage2D(GL_TEXTURE_2D, 
-                        0,
-                        GLformat,
-                        pNewBitmap->getWidth(), pNewBitmap->getHeight(), 
-                        0,
-                        GLformat, 
-                        GLdata_type,
-                        pBitmap16
-                    );
-
-        //copy new texture_data into pBits
-        delete [] pBitmap16;
+        // Yes, so generate a 16-bit texture for each mip level.
+        for ( U32 mipLevel = 0; mipLevel < mipLevels; ++mipLevel )
+        {
+            GLint GLformat;
+            GLint GLdata_type;
+
+            U16* pBitmap16 = create16BitBitmap( pNewBitmap, pNewBitmap->getWritableBits(mipLevel), pNewBitmap->getFormat(), 
+                                                    &GLformat, &GLdata_type,
+                                                    pNewBitmap->getWidth(mipLevel), pNewBitmap->getHeight(mipLevel) );
+
+            glTexImage2D(GL_TEXTURE_2D, 
+                            mipLevel,
+                            GLformat,
+                            pNewBitmap->getWidth(mipLevel), pNewBitmap->getHeight(mipLevel), 
+                            0,
+                            GLformat, 
+                            GLdata_type,
+                            pBitmap16
+                        );
+
+            //copy new texture_data into pBits
+            delete [] pBitmap16;
+        }
     }
     else
     {
-        // No, so upload as-is.
-        glTexImage2D(GL_TEXTURE_2D,
-            0,
-            destFormat,
-            pNewBitmap->getWidth(), pNewBitmap->getHeight(),
-            0,
-            sourceFormat,
-            byteFormat,
-            pNewBitmap->getBits());
+        // No, so upload each mip level as-is.
+        for ( U32 mipLevel = 0; mipLevel < mipLevels; ++mipLevel )
+        {
+            glTexImage2D(GL_TEXTURE_2D,
+                mipLevel,
+                destFormat,
+                pNewBitmap->getWidth(mipLevel), pNewBitmap->getHeight(mipLevel),
+                0,
+                sourceFormat,
+                byteFormat,
+                pNewBitmap->getBits(mipLevel));
+        }
     }
 
-    const GLuint filter = pTextureObject->getFilter();
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, pTextureObject->getFilter());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, getMinFilter(pTextureObject));
 
     GLenum glClamp;
     if ( pTextureObject->getClamp() )
@@ -701,6 +1015,13 @@ void TextureManager::refresh( const char *textureName )
     if ( pTextureObject == NULL )
         return;
 
+    // Finish the load if it is still pending as that reads the latest bitmap.
+    if ( pTextureObject->mLoadPending )
+    {
+        completeAsyncLoad( pTextureObject );
+        return;
+    }
+
     // Finish if the texture object is a kept bitmap.
     if ( pTextureObject->getHandleType() == TextureHandle::BitmapKeepTexture )
         return;
@@ -713,7 +1034,7 @@ void TextureManager::refresh( const char *textureName )
         return;
 
     // Register texture.
-    TextureObject* pNewTextureObject = registerTexture(pTextureObject->mTextureKey, pBitmap, pTextureObject->mHandleType, pTextureObject->mClamp);
+    TextureObject* pNewTextureObject = registerTexture(pTextureObject->mTextureKey, pBitmap, pTextureObject->mHandleType, pTextureObject->mClamp, pTextureObject->mUploadFlags);
 
     // Sanity!
     AssertFatal(pNewTextureObject == pTextureObject, "A new texture was returned during refresh.");
@@ -721,11 +1042,17 @@ void TextureManager::refresh( const char *textureName )
 
 //--------------------------------------------------------------------------------------------------------------------
 
-void TextureManager::createGLName( TextureObject* pTextureObject )
+void TextureManager::createGLName( TextureObject* pTextureObject, GBitmap* pPaddedBitmap )
 {
     // Finish if not appropriate.
     if (!(mDGLRender || mManagerState == Resurrecting))
+    {
+        // Release any padded bitmap we were handed.
+        if ( pPaddedBitmap != pTextureObject->mpBitmap )
+            delete pPaddedBitmap;
+
         return;
+    }
 
     // Sanity!
     AssertISV( pTextureObject->mHandleType != TextureHandle::InvalidTexture, "Invalid texture type." );
@@ -734,6 +1061,7 @@ void TextureManager::createGLName( TextureObject* pTextureObject )
 
     // Generate texture name.
     glGenTextures(1, &pTextureObject->mGLTextureName);
+    pTextureObject->mEvicted = false;
 
     // Fetch source/dest formats.
     U32 sourceFormat, destFormat, byteFormat, texelSize;
@@ -742,17 +1070,21 @@ void TextureManager::createGLName( TextureObject* pTextureObject )
     // Adjust metrics.
     mTextureResidentCount++;
     pTextureObject->mTextureResidentSize = pTextureObject->mTextureWidth * pTextureObject->mTextureHeight * texelSize;
+
+    // A mipmap chain adds a third.
+    if ( pTextureObject->mUploadFlags & TextureHandle::UploadMipmaps )
+        pTextureObject->mTextureResidentSize += pTextureObject->mTextureResidentSize / 3;
     mTextureResidentSize += pTextureObject->mTextureResidentSize;
     pTextureObject->mTextureResidentWasteSize = ((pTextureObject->mTextureWidth * pTextureObject->mTextureHeight)-(pTextureObject->mBitmapWidth * pTextureObject->mBitmapHeight)) * texelSize;
     mTextureResidentWasteSize += pTextureObject->mTextureResidentWasteSize;
 
     // Refresh the texture.
-    refresh( pTextureObject );
+    refresh( pTextureObject, pPaddedBitmap );
 }
 
 //--------------------------------------------------------------------------------------------------------------------
 
-TextureObject* TextureManager::registerTexture(const char* pTextureKey, GBitmap* pNewBitmap, TextureHandle::TextureHandleType type, bool clampToEdge)
+TextureObject* TextureManager::registerTexture(const char* pTextureKey, GBitmap* pNewBitmap, TextureHandle::TextureHandleType type, bool clampToEdge, const U32 uploadFlags, GBitmap* pPaddedBitmap)
 {
     // Sanity!
     AssertISV( type != TextureHandle::InvalidTexture, "Invalid texture type." );
@@ -817,11 +1149,15 @@ TextureObject* TextureManager::registerTexture(const char* pTextureKey, GBitmap*
     pTextureObject->mTextureWidth      = getNextPow2(pNewBitmap->getWidth());
     pTextureObject->mTextureHeight     = getNextPow2(pNewBitmap->getHeight());
     pTextureObject->mClamp             = clampToEdge;
+    pTextureObject->mForce16Bit        = pNewBitmap->mForce16Bit;
+    pTextureObject->mUploadFlags       = uploadFlags;
+    pTextureObject->mBitmapReloadable  = false;
+    pTextureObject->mLastBoundFrame    = mFrameIndex;
 
     // Generate a GL texture name if one is not ready.
     if( pTextureObject->mGLTextureName == 0) 
     {
-        createGLName(pTextureObject);
+        createGLName(pTextureObject, pPaddedBitmap);
     }
 
     // Delete bitmap if we're not keeping it.
@@ -836,7 +1172,7 @@ TextureObject* TextureManager::registerTexture(const char* pTextureKey, GBitmap*
 
 //--------------------------------------------------------------------------------------------------------------------
 
-TextureObject *TextureManager::loadTexture(const char* pTextureKey, TextureHandle::TextureHandleType type, bool clampToEdge, bool checkOnly, bool force16Bit )
+TextureObject *TextureManager::loadTexture(const char* pTextureKey, TextureHandle::TextureHandleType type, bool clampToEdge, bool checkOnly, bool force16Bit, const U32 uploadFlags, GBitmap* pDecodedBitmap )
 {
     // Sanity!
     AssertISV( type != TextureHandle::InvalidTexture, "Invalid texture type." );
@@ -850,6 +1186,43 @@ TextureObject *TextureManager::loadTexture(const char* pTextureKey, TextureHandl
 
     TextureObject *ret = TextureDictionary::find(textureKey, type, clampToEdge);
 
+    // Use any prefetched bitmap.
+    if ( ret == NULL && pDecodedBitmap == NULL )
+        pDecodedBitmap = takePrefetchedBitmap( textureKey );
+
+    // Use any bitmap already decoded from the file.
+    if ( pDecodedBitmap != NULL )
+    {
+        if ( ret == NULL )
+        {
+            pDecodedBitmap->mForce16Bit = force16Bit;
+            return registerFileTexture(textureKey, pDecodedBitmap, type, clampToEdge, uploadFlags);
+        }
+
+        // The texture is already registered so the bitmap is not needed.
+        delete pDecodedBitmap;
+    }
+
+    // Finish any asynchronous load now the texture is needed immediately.
+    if ( ret != NULL && ret->mLoadPending )
+        completeAsyncLoad( ret );
+
+    // Retry a failed asynchronous load.
+    if ( ret != NULL && ret->mLoadFailed )
+    {
+        GBitmap* pBitmap = loadBitmap(textureKey);
+
+        if(!pBitmap)
+        {
+            Con::warnf("Could not locate texture: %s", textureKey);
+            return NULL;
+        }
+
+        ret->mLoadFailed = false;
+        pBitmap->mForce16Bit = force16Bit;
+        return registerFileTexture(textureKey, pBitmap, type, clampToEdge, uploadFlags);
+    }
+
     GBitmap *bmp = NULL;
 
     if( ret == NULL )
@@ -861,7 +1234,7 @@ TextureObject *TextureManager::loadTexture(const char* pTextureKey, TextureHandl
         if(bmp)
         {
             bmp->mForce16Bit = force16Bit;
-            return registerTexture(textureKey, bmp, type, clampToEdge);
+            return registerFileTexture(textureKey, bmp, type, clampToEdge, uploadFlags);
         }
     }
 
@@ -883,7 +1256,23 @@ TextureObject *TextureManager::loadTexture(const char* pTextureKey, TextureHandl
     }
     bmp->mForce16Bit = force16Bit;
 
-    return registerTexture(textureKey, bmp, type, clampToEdge);
+    return registerFileTexture(textureKey, bmp, type, clampToEdge, uploadFlags);
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+TextureObject* TextureManager::registerFileTexture( StringTableEntry textureKey, GBitmap* pNewBitmap, TextureHandle::TextureHandleType type, bool clampToEdge, const U32 uploadFlags )
+{
+    // Register texture.
+    TextureObject* pTextureObject = registerTexture( textureKey, pNewBitmap, type, clampToEdge, uploadFlags );
+
+    // Flag the bitmap as reloadable from the file.
+    pTextureObject->mBitmapReloadable = true;
+
+    // Discard the bitmap if appropriate.
+    applyBitmapPolicy( pTextureObject );
+
+    return pTextureObject;
 }
 
 //--------------------------------------------------------------------------------------------------------------------
@@ -906,7 +1295,13 @@ GBitmap *TextureManager::loadBitmap( const char* pTextureKey, bool recurse, bool
 #endif
         dStrcpy(fileNameBuffer + len, extArray[i]);
 
-        bmp = (GBitmap*)ResourceManager->loadInstance(fileNameBuffer);
+        // Use the texture cache if enabled.
+        // Files it cannot find on disk are loaded by the resource manager.
+        if ( TextureCache::isEnabled() && TextureCache::canCache( fileNameBuffer ) )
+            bmp = TextureCache::loadBitmap( fileNameBuffer );
+
+        if ( bmp == NULL )
+            bmp = (GBitmap*)ResourceManager->loadInstance(fileNameBuffer);
 
         if ( bmp != NULL && (bmp->getWidth() > MaximumProductSupportedTextureWidth || bmp->getHeight() > MaximumProductSupportedTextureHeight) )
         {
@@ -921,6 +1316,816 @@ GBitmap *TextureManager::loadBitmap( const char* pTextureKey, bool recurse, bool
 
 //--------------------------------------------------------------------------------------------------------------------
 
+static bool canDecodeAsync( const char* pFileName )
+{
+    const char* pExtension = dStrrchr( pFileName, '.' );
+    if ( pExtension == NULL )
+        return false;
+
+#if !defined(USE_APPLE_OPTIMIZED_PNGS)
+    // Apple optimized PNGs must be read by the platform.
+    if ( dStricmp( pExtension, ".png" ) == 0 )
+        return true;
+#endif
+
+    return dStricmp( pExtension, ".jpg" ) == 0 || dStricmp( pExtension, ".jpeg" ) == 0;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+static bool findAsyncDecodeFile( StringTableEntry textureKey, char* pFileNameBuffer, const U32 bufferSize )
+{
+    Platform::makeFullPathName( textureKey, pFileNameBuffer, bufferSize );
+    const U32 length = dStrlen(pFileNameBuffer);
+
+    // Only loose PNG and JPEG files can be decoded on the job pool.
+    for (U32 i = 0; i < EXT_ARRAY_SIZE; i++)
+    {
+        dStrcpy(pFileNameBuffer + length, extArray[i]);
+
+        ResourceObject* pResourceObject = ResourceManager->find( pFileNameBuffer );
+        if ( pResourceObject == NULL )
+            continue;
+
+        return (pResourceObject->flags & ResourceObject::File) && canDecodeAsync( pFileNameBuffer );
+    }
+
+    return false;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+GBitmap* TextureManager::decodeBitmap( const char* pFilePath )
+{
+    // Use the texture cache if enabled.
+    if ( TextureCache::isEnabled() )
+        return TextureCache::loadBitmap( pFilePath );
+
+    // Open the file.
+    FileStream stream;
+    if ( !stream.open( pFilePath, FileStream::Read ) )
+        return NULL;
+
+    // Decode the bitmap.
+    GBitmap* pBitmap = new GBitmap();
+    const char* pExtension = dStrrchr( pFilePath, '.' );
+    const bool decoded = dStricmp( pExtension, ".png" ) == 0 ? pBitmap->readPNG( stream ) : pBitmap->readJPEG( stream );
+    stream.close();
+
+    if ( !decoded )
+    {
+        delete pBitmap;
+        return NULL;
+    }
+
+    return pBitmap;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::decodeTextureJob( void* pContext, const U32 start, const U32 end )
+{
+    AsyncTextureRequest* pRequest = (AsyncTextureRequest*)pContext;
+
+    const U32 startTime = Platform::getRealMilliseconds();
+
+    // Read and decode the bitmap.
+    GBitmap* pBitmap = decodeBitmap( pRequest->mFilePath );
+
+    // Reject bitmaps that are too large.
+    // The main thread reports this as the console is not thread-safe.
+    if ( pBitmap != NULL && (pBitmap->getWidth() > MaximumProductSupportedTextureWidth || pBitmap->getHeight() > MaximumProductSupportedTextureHeight) )
+    {
+        delete pBitmap;
+        pBitmap = NULL;
+        pRequest->mTooLarge = true;
+    }
+
+    // Prepare the bitmap for upload.
+    if ( pBitmap != NULL )
+    {
+        pBitmap->mForce16Bit = pRequest->mForce16Bit;
+        pRequest->mpPaddedBitmap = createUploadBitmap( pBitmap, pRequest->mUploadFlags );
+    }
+
+    pRequest->mpBitmap = pBitmap;
+    pRequest->mDecodeTime = Platform::getRealMilliseconds() - startTime;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+TextureObject* TextureManager::loadTextureAsync( const char* pTextureKey, TextureHandle::TextureHandleType type, bool clampToEdge, bool force16Bit, TextureLoadCallback callback, void *userData, const U32 uploadFlags )
+{
+    // Sanity!
+    AssertISV( type != TextureHandle::InvalidTexture, "Invalid texture type." );
+
+    // Finish if texture key is invalid.
+    if( pTextureKey == NULL || *pTextureKey == 0)
+        return NULL;
+
+    // Fetch texture key.
+    StringTableEntry textureKey = StringTable->insert(pTextureKey);
+
+    TextureObject* pTextureObject = TextureDictionary::find(textureKey, type, clampToEdge);
+
+    // Is the texture already loading?
+    if ( pTextureObject != NULL && pTextureObject->mLoadPending )
+    {
+        // Yes, so add the callback to the existing load.
+        if ( callback != NULL )
+        {
+            AsyncTextureRequest* pRequest = sgAsyncTextureRequests[findAsyncTextureRequest( pTextureObject )];
+            pRequest->mCallbacks.increment();
+            pRequest->mCallbacks.last().callback = callback;
+            pRequest->mCallbacks.last().userData = userData;
+        }
+
+        return pTextureObject;
+    }
+
+    // Find the file to decode.
+    // A prefetched bitmap is used as-is so is not decoded again.
+    bool decodeAsync = false;
+    char fileNameBuffer[1024];
+    if ( pTextureObject == NULL && JobPool::Instance != NULL && findPrefetchBitmapRequest( textureKey ) == -1 )
+        decodeAsync = findAsyncDecodeFile( textureKey, fileNameBuffer, sizeof(fileNameBuffer) );
+
+    // Load synchronously if the texture exists or cannot be decoded on the job pool.
+    if ( !decodeAsync )
+    {
+        pTextureObject = loadTexture( textureKey, type, clampToEdge, false, force16Bit, uploadFlags );
+
+        if ( callback != NULL )
+            callback( pTextureObject, pTextureObject != NULL, userData );
+
+        return pTextureObject;
+    }
+
+    // Create the placeholder texture.
+    createPlaceholderTexture();
+
+    // Create a pending texture object.
+    pTextureObject = new TextureObject();
+    pTextureObject->mTextureKey = textureKey;
+    pTextureObject->mHandleType = type;
+    pTextureObject->mClamp = clampToEdge;
+    pTextureObject->mUploadFlags = uploadFlags;
+    pTextureObject->mLoadPending = true;
+    TextureDictionary::insert(pTextureObject);
+
+    // Queue the decode.
+    AsyncTextureRequest* pRequest = new AsyncTextureRequest();
+    pRequest->mpTextureObject = pTextureObject;
+    pRequest->mForce16Bit = force16Bit;
+    pRequest->mUploadFlags = uploadFlags;
+    dStrcpy( pRequest->mFilePath, fileNameBuffer );
+    if ( callback != NULL )
+    {
+        pRequest->mCallbacks.increment();
+        pRequest->mCallbacks.last().callback = callback;
+        pRequest->mCallbacks.last().userData = userData;
+    }
+    sgAsyncTextureRequests.push_back( pRequest );
+
+    JobPool::Instance->submit( decodeTextureJob, pRequest, 0, 1, pRequest->mCounter );
+
+    return pTextureObject;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::decodePrefetchBitmapJob( void* pContext, const U32 start, const U32 end )
+{
+    PrefetchBitmapRequest* pRequest = (PrefetchBitmapRequest*)pContext;
+
+    // Read and decode the bitmap.
+    GBitmap* pBitmap = decodeBitmap( pRequest->mFilePath );
+
+    // Discard bitmaps that are too large.
+    // The texture load reports this when it decodes the file itself.
+    if ( pBitmap != NULL && (pBitmap->getWidth() > MaximumProductSupportedTextureWidth || pBitmap->getHeight() > MaximumProductSupportedTextureHeight) )
+    {
+        delete pBitmap;
+        pBitmap = NULL;
+    }
+
+    pRequest->mpBitmap = pBitmap;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+bool TextureManager::prefetchBitmap( const char* pTextureKey )
+{
+    // Finish if texture key is invalid.
+    if( pTextureKey == NULL || *pTextureKey == 0)
+        return false;
+
+    // Fetch texture key.
+    StringTableEntry textureKey = StringTable->insert(pTextureKey);
+
+    // Is the bitmap already being prefetched?
+    const S32 requestIndex = findPrefetchBitmapRequest( textureKey );
+    if ( requestIndex != -1 )
+    {
+        // Yes, so reference it.
+        sgPrefetchBitmapRequests[requestIndex]->mReferenceCount++;
+        return true;
+    }
+
+    // Finish if the texture is already loaded with any settings.
+    if ( TextureDictionary::find( textureKey ) != NULL )
+        return false;
+
+    // Finish if the file cannot be decoded on the job pool.
+    char fileNameBuffer[1024];
+    if ( JobPool::Instance == NULL || !findAsyncDecodeFile( textureKey, fileNameBuffer, sizeof(fileNameBuffer) ) )
+        return false;
+
+    // Queue the decode.
+    PrefetchBitmapRequest* pRequest = new PrefetchBitmapRequest();
+    pRequest->mTextureKey = textureKey;
+    pRequest->mReferenceCount = 1;
+    dStrcpy( pRequest->mFilePath, fileNameBuffer );
+    sgPrefetchBitmapRequests.push_back( pRequest );
+
+    JobPool::Instance->submit( decodePrefetchBitmapJob, pRequest, 0, 1, pRequest->mCounter );
+
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+bool TextureManager::isBitmapPrefetchPending( const char* pTextureKey )
+{
+    const S32 requestIndex = findPrefetchBitmapRequest( StringTable->insert(pTextureKey) );
+
+    return requestIndex != -1 && !sgPrefetchBitmapRequests[requestIndex]->mCounter.isComplete();
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::releasePrefetchedBitmap( const char* pTextureKey )
+{
+    // Finish if the bitmap was already used or was never prefetched.
+    const S32 requestIndex = findPrefetchBitmapRequest( StringTable->insert(pTextureKey) );
+    if ( requestIndex == -1 )
+        return;
+
+    // Finish if the bitmap is still referenced.
+    PrefetchBitmapRequest* pRequest = sgPrefetchBitmapRequests[requestIndex];
+    if ( --pRequest->mReferenceCount > 0 )
+        return;
+
+    sgPrefetchBitmapRequests.erase( requestIndex );
+
+    // Wait for the decode if the job pool is still running it.
+    if ( JobPool::Instance != NULL )
+        JobPool::Instance->wait( pRequest->mCounter );
+
+    delete pRequest;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+GBitmap* TextureManager::takePrefetchedBitmap( StringTableEntry textureKey )
+{
+    // Finish if the bitmap was not prefetched.
+    const S32 requestIndex = findPrefetchBitmapRequest( textureKey );
+    if ( requestIndex == -1 )
+        return NULL;
+
+    PrefetchBitmapRequest* pRequest = sgPrefetchBitmapRequests[requestIndex];
+    sgPrefetchBitmapRequests.erase( requestIndex );
+
+    // Wait for the decode if the job pool is still running it.
+    if ( JobPool::Instance != NULL )
+        JobPool::Instance->wait( pRequest->mCounter );
+
+    // Take the bitmap.
+    GBitmap* pBitmap = pRequest->mpBitmap;
+    pRequest->mpBitmap = NULL;
+    delete pRequest;
+
+    return pBitmap;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::processAsyncLoads( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TextureManager_ProcessAsyncLoads);
+
+    // Finish if nothing is loading.
+    if ( sgAsyncTextureRequests.size() == 0 )
+        return;
+
+    const U32 startTime = Platform::getRealMilliseconds();
+    U32 uploadCount = 0;
+
+    // Upload decoded textures in the order they were requested.
+    S32 i = 0;
+    while ( i < sgAsyncTextureRequests.size() )
+    {
+        AsyncTextureRequest* pRequest = sgAsyncTextureRequests[i];
+
+        // Skip if still decoding.
+        if ( !pRequest->mCounter.isComplete() )
+        {
+            i++;
+            continue;
+        }
+
+        // Discard cancelled loads.
+        if ( pRequest->mCancelled )
+        {
+            sgAsyncTextureRequests.erase( i );
+            delete pRequest;
+            continue;
+        }
+
+        // Finish if the upload budget is spent.
+        // At least one texture is uploaded each frame so loading always progresses.
+        if ( uploadCount > 0 && F32(Platform::getRealMilliseconds() - startTime) >= mTextureUploadBudget )
+            break;
+
+        sgAsyncTextureRequests.erase( i );
+        finishAsyncLoad( pRequest );
+        uploadCount++;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::completeAsyncLoad( TextureObject* pTextureObject )
+{
+    // Find the load.
+    const S32 requestIndex = findAsyncTextureRequest( pTextureObject );
+
+    // Sanity!
+    AssertFatal( requestIndex != -1, "TextureManager::completeAsyncLoad() - Could not find the pending load." );
+
+    AsyncTextureRequest* pRequest = sgAsyncTextureRequests[requestIndex];
+    sgAsyncTextureRequests.erase( requestIndex );
+
+    // Wait for the decode.
+    if ( JobPool::Instance != NULL )
+        JobPool::Instance->wait( pRequest->mCounter );
+
+    finishAsyncLoad( pRequest );
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::finishAsyncLoad( AsyncTextureRequest* pRequest )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TextureManager_FinishAsyncLoad);
+
+    TextureObject* pTextureObject = pRequest->mpTextureObject;
+    StringTableEntry textureKey = pTextureObject->mTextureKey;
+    const bool success = pRequest->mpBitmap != NULL;
+
+    pTextureObject->mLoadPending = false;
+
+    if ( success )
+    {
+        const U32 startTime = Platform::getRealMilliseconds();
+
+        // Prepare the bitmap again if the upload flags changed while loading.
+        if ( pTextureObject->mUploadFlags != pRequest->mUploadFlags )
+        {
+            if ( pRequest->mpPaddedBitmap != pRequest->mpBitmap )
+                delete pRequest->mpPaddedBitmap;
+
+            pRequest->mpPaddedBitmap = NULL;
+        }
+
+        // Upload the texture taking ownership of the bitmaps.
+        TextureObject* pNewTextureObject = registerTexture( textureKey, pRequest->mpBitmap, pTextureObject->mHandleType, pTextureObject->mClamp, pTextureObject->mUploadFlags, pRequest->mpPaddedBitmap );
+        pRequest->mpBitmap = NULL;
+        pRequest->mpPaddedBitmap = NULL;
+
+        // Sanity!
+        AssertFatal( pNewTextureObject == pTextureObject, "A new texture was returned during an asynchronous load." );
+
+        pTextureObject->mBitmapReloadable = true;
+        applyBitmapPolicy( pTextureObject );
+
+        // Adjust metrics.
+        mAsyncLoadsCompleted++;
+        mAsyncDecodeTime += pRequest->mDecodeTime;
+        mAsyncUploadTime += Platform::getRealMilliseconds() - startTime;
+    }
+    else
+    {
+        pTextureObject->mLoadFailed = true;
+
+        // Warn.
+        if ( pRequest->mTooLarge )
+            Con::warnf( "TextureManager::finishAsyncLoad() - Cannot load bitmap '%s' as its dimensions exceed the maximum product-supported texture dimension.", pRequest->mFilePath );
+        else
+            Con::warnf( "TextureManager::finishAsyncLoad() - Could not load texture: %s", textureKey );
+    }
+
+    // Keep the texture alive in case a callback releases it.
+    pTextureObject->mRefCount++;
+
+    // Notify the requesters.
+    for (S32 i = 0; i < pRequest->mCallbacks.size(); i++)
+    {
+        (pRequest->mCallbacks[i].callback)( pTextureObject, success, pRequest->mCallbacks[i].userData );
+    }
+
+    // Notify script.
+    if ( Con::isFunction( "onAsyncTextureLoaded" ) )
+        Con::executef( 3, "onAsyncTextureLoaded", textureKey, success ? "1" : "0" );
+
+    if ( --pTextureObject->mRefCount == 0 )
+        freeTexture( pTextureObject );
+
+    delete pRequest;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::cancelAsyncLoad( TextureObject* pTextureObject )
+{
+    // Find the load.
+    const S32 requestIndex = findAsyncTextureRequest( pTextureObject );
+
+    // Sanity!
+    AssertFatal( requestIndex != -1, "TextureManager::cancelAsyncLoad() - Could not find the pending load." );
+
+    AsyncTextureRequest* pRequest = sgAsyncTextureRequests[requestIndex];
+    pTextureObject->mLoadPending = false;
+
+    // Delete the load if it is not decoding.
+    if ( JobPool::Instance == NULL || pRequest->mCounter.isComplete() )
+    {
+        sgAsyncTextureRequests.erase( requestIndex );
+        delete pRequest;
+        return;
+    }
+
+    // Detach the load so it is discarded once decoded.
+    pRequest->mpTextureObject = NULL;
+    pRequest->mCallbacks.clear();
+    pRequest->mCancelled = true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::cancelAsyncCallbacks( void *userData )
+{
+    for (S32 i = 0; i < sgAsyncTextureRequests.size(); i++)
+    {
+        Vector<LoadCallbackEntry>& callbacks = sgAsyncTextureRequests[i]->mCallbacks;
+
+        for (S32 j = 0; j < callbacks.size(); )
+        {
+            if ( callbacks[j].userData == userData )
+                callbacks.erase( j );
+            else
+                j++;
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+U32 TextureManager::getAsyncQueueDepth( void )
+{
+    U32 queueDepth = 0;
+
+    for (S32 i = 0; i < sgAsyncTextureRequests.size(); i++)
+    {
+        if ( !sgAsyncTextureRequests[i]->mCancelled )
+            queueDepth++;
+    }
+
+    return queueDepth;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::createPlaceholderTexture( void )
+{
+    // Finish if already created.
+    if ( mpPlaceholderTexture != NULL )
+        return;
+
+    // Generate a small grey checker.
+    GBitmap* pBitmap = new GBitmap( 8, 8, false, GBitmap::RGBA );
+    for ( U32 y = 0; y < 8; y++ )
+    {
+        for ( U32 x = 0; x < 8; x++ )
+        {
+            U8* pPixel = pBitmap->getAddress( x, y );
+            const U8 shade = ((x >> 2) ^ (y >> 2)) & 1 ? 0xA0 : 0x60;
+            pPixel[0] = shade;
+            pPixel[1] = shade;
+            pPixel[2] = shade;
+            pPixel[3] = 0xFF;
+        }
+    }
+
+    // Register the texture and keep it resident.
+    mpPlaceholderTexture = registerTexture( getUniqueTextureKey(), pBitmap, TextureHandle::BitmapKeepTexture, false );
+    mpPlaceholderTexture->mRefCount++;
+    mpPlaceholderTexture->mResidencyPriority = TextureHandle::ResidencyPinned;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+ConsoleFunction( getAsyncTextureQueueDepth, S32, 1, 1, "() Gets the number of textures waiting to be decoded or uploaded.\n"
+                                                        "@return The number of pending asynchronous texture loads.")
+{
+    return TextureManager::getAsyncQueueDepth();
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+ConsoleFunction( dumpAsyncTextureMetrics, void, 1, 1, "() Dump the asynchronous texture loading metrics." )
+{
+    TextureManager::dumpAsyncMetrics();
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::dumpAsyncMetrics( void )
+{
+    Con::printf( "Asynchronous Texture Loads: QueueDepth: %d, Completed: %d, DecodeTime: %dms (%gms avg), UploadTime: %dms (%gms avg), UploadBudget: %gms",
+        getAsyncQueueDepth(),
+        mAsyncLoadsCompleted,
+        mAsyncDecodeTime,
+        mAsyncLoadsCompleted == 0 ? 0.0f : F32(mAsyncDecodeTime) / F32(mAsyncLoadsCompleted),
+        mAsyncUploadTime,
+        mAsyncLoadsCompleted == 0 ? 0.0f : F32(mAsyncUploadTime) / F32(mAsyncLoadsCompleted),
+        mTextureUploadBudget );
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+static S32 QSORT_CALLBACK compareEvictionOrder( const void* a, const void* b )
+{
+    const TextureObject* pTextureA = *(const TextureObject**)a;
+    const TextureObject* pTextureB = *(const TextureObject**)b;
+
+    // Evict lower priorities first.
+    if ( pTextureA->getResidencyPriority() != pTextureB->getResidencyPriority() )
+        return S32(pTextureA->getResidencyPriority()) - S32(pTextureB->getResidencyPriority());
+
+    // Evict the least recently bound first.
+    if ( pTextureA->getLastBoundFrame() != pTextureB->getLastBoundFrame() )
+        return pTextureA->getLastBoundFrame() < pTextureB->getLastBoundFrame() ? -1 : 1;
+
+    return 0;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::processResidency( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TextureManager_ProcessResidency);
+
+    // Advance the frame.
+    mFrameIndex++;
+
+    // Finish if there is no budget or eviction is not appropriate.
+    if ( mTextureResidencyBudget <= 0.0f || !mDGLRender || mManagerState != Alive )
+        return;
+
+    // Finish if within the budget.
+    const S32 budgetSize = S32(mTextureResidencyBudget * 1024.0f * 1024.0f);
+    if ( mTextureResidentSize <= budgetSize )
+        return;
+
+    // Gather the textures that can be evicted.
+    Vector<TextureObject*> candidates;
+    const U32 evictionAge = (U32)getMax( mTextureEvictionAge, 1 );
+    TextureObject* pProbe = TextureDictionary::TextureObjectChain;
+    while ( pProbe != NULL )
+    {
+        // Only textures that can be uploaded again are evicted.
+        if ( pProbe->mGLTextureName != 0 &&
+            !pProbe->mLoadPending &&
+            (pProbe->mpBitmap != NULL || pProbe->mBitmapReloadable) &&
+            pProbe->mResidencyPriority != TextureHandle::ResidencyPinned &&
+            mFrameIndex - pProbe->mLastBoundFrame >= evictionAge )
+        {
+            candidates.push_back( pProbe );
+        }
+
+        pProbe = pProbe->next;
+    }
+
+    // Finish if nothing can be evicted.
+    if ( candidates.size() == 0 )
+        return;
+
+    // Evict the lowest priority and least recently bound textures until within the budget.
+    dQsort( candidates.address(), candidates.size(), sizeof(TextureObject*), compareEvictionOrder );
+    for ( S32 i = 0; i < candidates.size() && mTextureResidentSize > budgetSize; i++ )
+    {
+        evictTexture( candidates[i] );
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::evictTexture( TextureObject* pTextureObject )
+{
+    // Sanity!
+    AssertFatal( pTextureObject->mGLTextureName != 0, "TextureManager::evictTexture() - Texture is not resident." );
+
+    // Delete the texture.
+    glDeleteTextures( 1, (const GLuint*)&pTextureObject->mGLTextureName );
+    pTextureObject->mGLTextureName = 0;
+    pTextureObject->mEvicted = true;
+
+    // Adjust metrics.
+    mTexturesEvicted++;
+    mTextureBytesEvicted += pTextureObject->mTextureResidentSize;
+    mTextureResidentCount--;
+    mTextureResidentSize -= pTextureObject->mTextureResidentSize;
+    pTextureObject->mTextureResidentSize = 0;
+    mTextureResidentWasteSize -= pTextureObject->mTextureResidentWasteSize;
+    pTextureObject->mTextureResidentWasteSize = 0;
+
+    // Delete any kept bitmap that can be reloaded if configured to.
+    if ( mEvictBitmaps && pTextureObject->mBitmapReloadable && pTextureObject->mpBitmap != NULL )
+    {
+        SAFE_DELETE( pTextureObject->mpBitmap );
+
+        // Adjust metrics.
+        mBitmapBytesEvicted += pTextureObject->mBitmapResidentSize;
+        mBitmapResidentSize -= pTextureObject->mBitmapResidentSize;
+        pTextureObject->mBitmapResidentSize = 0;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::restoreTexture( TextureObject* pTextureObject )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TextureManager_RestoreTexture);
+
+    // Finish if restoring is not appropriate.
+    // Resurrection restores all textures itself.
+    if ( !mDGLRender || mManagerState != Alive )
+        return;
+
+    mTexturesRestored++;
+
+    // Upload any bitmap that was kept.
+    if ( pTextureObject->mpBitmap != NULL )
+    {
+        createGLName( pTextureObject );
+        return;
+    }
+
+    // Reload the bitmap.
+    GBitmap* pBitmap = loadBitmap( pTextureObject->mTextureKey );
+
+    // Did the bitmap load?
+    if ( pBitmap == NULL )
+    {
+        // No, so warn and stop trying to restore it.
+        Con::warnf( "TextureManager::restoreTexture() - Could not restore evicted texture: %s", pTextureObject->mTextureKey );
+        pTextureObject->mEvicted = false;
+        return;
+    }
+
+    pBitmap->mForce16Bit = pTextureObject->mForce16Bit;
+
+    // Register texture.
+    TextureObject* pNewTextureObject = registerFileTexture( pTextureObject->mTextureKey, pBitmap, pTextureObject->mHandleType, pTextureObject->mClamp, pTextureObject->mUploadFlags );
+
+    // Sanity!
+    AssertFatal( pNewTextureObject == pTextureObject, "A new texture was returned while restoring an evicted texture." );
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::setBitmapPolicy( TextureObject* pTextureObject, const TextureHandle::BitmapPolicy policy )
+{
+    pTextureObject->mBitmapPolicy = policy;
+
+    // Discard the bitmap if appropriate.
+    applyBitmapPolicy( pTextureObject );
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::applyBitmapPolicy( TextureObject* pTextureObject )
+{
+    // Finish if there is no bitmap that can be reloaded from file.
+    if ( pTextureObject->mpBitmap == NULL || !pTextureObject->mBitmapReloadable )
+        return;
+
+    // Finish if the texture has not been uploaded.
+    if ( pTextureObject->mGLTextureName == 0 )
+        return;
+
+    // Finish if the bitmap is to be kept.
+    const TextureHandle::BitmapPolicy policy = pTextureObject->mBitmapPolicy;
+    if ( policy == TextureHandle::BitmapPolicyKeep || (policy == TextureHandle::BitmapPolicyDefault && !mDiscardBitmaps) )
+        return;
+
+    discardBitmap( pTextureObject );
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::discardBitmap( TextureObject* pTextureObject )
+{
+    SAFE_DELETE( pTextureObject->mpBitmap );
+
+    // Adjust metrics.
+    mBitmapsDiscarded++;
+    mBitmapBytesDiscarded += pTextureObject->mBitmapResidentSize;
+    mBitmapResidentSize -= pTextureObject->mBitmapResidentSize;
+    pTextureObject->mBitmapResidentSize = 0;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+GBitmap* TextureManager::getResidentBitmap( TextureObject* pTextureObject )
+{
+    // Finish if the bitmap is resident or was never kept.
+    if ( pTextureObject->mpBitmap != NULL || !pTextureObject->mBitmapReloadable || pTextureObject->mHandleType != TextureHandle::BitmapKeepTexture )
+        return pTextureObject->mpBitmap;
+
+    // Reload the bitmap.
+    // It is kept from now on as the caller needs it.
+    GBitmap* pBitmap = loadBitmap( pTextureObject->mTextureKey );
+
+    // Did the bitmap load?
+    if ( pBitmap == NULL )
+    {
+        // No, so warn.
+        Con::warnf( "TextureManager::getResidentBitmap() - Could not reload bitmap: %s", pTextureObject->mTextureKey );
+        return NULL;
+    }
+
+    pBitmap->mForce16Bit = pTextureObject->mForce16Bit;
+    pTextureObject->mpBitmap = pBitmap;
+
+    // Adjust metrics.
+    mBitmapsReloaded++;
+    pTextureObject->mBitmapResidentSize = pBitmap->byteSize;
+    mBitmapResidentSize += pTextureObject->mBitmapResidentSize;
+
+    return pBitmap;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::dumpResidencyMetrics( void )
+{
+    Con::printf( "Texture Residency: Budget: %gMB, EvictionAge: %d frames, Evicted: %d, Restored: %d, TextureBytesEvicted: %d, BitmapBytesEvicted: %d",
+        mTextureResidencyBudget,
+        mTextureEvictionAge,
+        mTexturesEvicted,
+        mTexturesRestored,
+        mTextureBytesEvicted,
+        mBitmapBytesEvicted );
+    Con::printf( "Texture Bitmaps: DiscardByDefault: %s, Discarded: %d, Reloaded: %d, BitmapBytesDiscarded: %d",
+        mDiscardBitmaps ? "YES" : "NO",
+        mBitmapsDiscarded,
+        mBitmapsReloaded,
+        mBitmapBytesDiscarded );
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+ConsoleFunction( getTextureEvictionCount, S32, 1, 1, "() Gets the number of textures evicted to stay within the texture residency budget.\n"
+                                                      "@return The number of texture evictions.")
+{
+    return TextureManager::getTexturesEvicted();
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+ConsoleFunction( getTextureEvictionBytes, S32, 1, 1, "() Gets the texture memory freed by evicting textures.\n"
+                                                      "@return The number of texture bytes evicted.")
+{
+    return TextureManager::getTextureBytesEvicted();
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+ConsoleFunction( getBitmapEvictionBytes, S32, 1, 1, "() Gets the bitmap memory freed by evicting textures.\n"
+                                                     "@return The number of bitmap bytes evicted.")
+{
+    return TextureManager::getBitmapBytesEvicted();
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
 ConsoleFunction( dumpTextureManagerMetrics, void, 1, 1, "() Dump the texture manager metrics." )
 {
     return TextureManager::dumpMetrics();
@@ -983,6 +2188,10 @@ void TextureManager::dumpMetrics( void )
         mTextureResidentWasteSize,
         mBitmapResidentSize,
         getResidentFraction() );
+    dumpAsyncMetrics();
+    dumpResidencyMetrics();
+    TextureCache::dumpMetrics();
+    TextureAtlas::dumpMetrics();
 
     Con::printBlankLine();
     Con::printSeparator();
@@ -45,10 +45,13 @@
 #define MaximumProductSupportedTextureWidth 5120//2048
 #define MaximumProductSupportedTextureHeight MaximumProductSupportedTextureWidth
 
+struct AsyncTextureRequest;
+
 class TextureManager
 {
    friend class TextureHandle;
    friend class TextureDictionary;
+   friend class TextureAtlas;
 
 public:
     /// Texture manager event codes.
@@ -61,6 +64,9 @@ public:
 
     typedef void (*TextureEventCallback)(const TextureEventCode eventCode, void *userData);
 
+    /// Called on the main thread once an asynchronous texture load has completed or failed.
+    typedef void (*TextureLoadCallback)(TextureObject* pTextureObject, const bool success, void *userData);
+
     /// Textrue manager state.
     enum ManagerState
     {
@@ -81,6 +87,29 @@ private:
     static bool mAllowTextureCompression;
     static bool mDisableTextureSubImageUpdates;
 
+    /// Asynchronous loading.
+    static F32 mTextureUploadBudget;
+    static TextureObject* mpPlaceholderTexture;
+    static U32 mAsyncLoadsCompleted;
+    static U32 mAsyncDecodeTime;
+    static U32 mAsyncUploadTime;
+
+    /// Residency.
+    static U32 mFrameIndex;
+    static F32 mTextureResidencyBudget;
+    static S32 mTextureEvictionAge;
+    static bool mEvictBitmaps;
+    static U32 mTexturesEvicted;
+    static U32 mTexturesRestored;
+    static U32 mTextureBytesEvicted;
+    static U32 mBitmapBytesEvicted;
+
+    /// Bitmap retention.
+    static bool mDiscardBitmaps;
+    static U32 mBitmapsDiscarded;
+    static U32 mBitmapsReloaded;
+    static U32 mBitmapBytesDiscarded;
+
 public:
     static bool mDGLRender;
     static GLenum mTextureCompressionHint;
@@ -106,20 +135,89 @@ public:
 
     static void dumpMetrics( void );
 
+    /// Asynchronous loading.
+    /// The file is read, decoded and padded on the job pool while the handle renders a placeholder.
+    /// Textures are uploaded by "processAsyncLoads()" which must be called once per frame on the main thread.
+    static TextureObject* loadTextureAsync( const char *textureName, TextureHandle::TextureHandleType type, bool clampToEdge, bool force16Bit = false, TextureLoadCallback callback = NULL, void *userData = NULL, const U32 uploadFlags = TextureHandle::UploadDefault );
+    static void processAsyncLoads( void );
+    static void cancelAsyncCallbacks( void *userData );
+    static U32 getAsyncQueueDepth( void );
+    static GLuint getPlaceholderGLName( void ) { return mpPlaceholderTexture == NULL ? 0 : mpPlaceholderTexture->mGLTextureName; }
+    static void dumpAsyncMetrics( void );
+
+    /// Bitmap prefetching.
+    /// The bitmap is decoded on the job pool before the texture is needed and is used by the
+    /// next load of the texture, whatever its settings.  Prefetches are reference counted and
+    /// any bitmap still unused once the last reference is released is discarded.
+    static bool prefetchBitmap( const char* pTextureKey );
+    static bool isBitmapPrefetchPending( const char* pTextureKey );
+    static void releasePrefetchedBitmap( const char* pTextureKey );
+
+    /// Residency.
+    /// Textures not bound for a while are evicted, lowest priority first, when the resident
+    /// texture memory exceeds the budget.  Evicted textures are restored when next bound.
+    static void processResidency( void );
+    static GLuint getResidentGLName( TextureObject* pTextureObject );
+    static U32 getFrameIndex( void ) { return mFrameIndex; }
+    static U32 getTexturesEvicted( void ) { return mTexturesEvicted; }
+    static U32 getTextureBytesEvicted( void ) { return mTextureBytesEvicted; }
+    static U32 getBitmapBytesEvicted( void ) { return mBitmapBytesEvicted; }
+    static void dumpResidencyMetrics( void );
+
+    /// Bitmap retention.
+    /// Bitmaps of kept textures loaded from file can be discarded once uploaded and are
+    /// reloaded from the file if requested or if the texture needs uploading again.
+    static void setBitmapPolicy( TextureObject* pTextureObject, const TextureHandle::BitmapPolicy policy );
+    static GBitmap* getResidentBitmap( TextureObject* pTextureObject );
+    static U32 getBitmapBytesDiscarded( void ) { return mBitmapBytesDiscarded; }
+
+    /// Upload processing.
+    /// Mipmaps and premultiplied alpha are applied to a padded copy of the bitmap so the kept bitmap is untouched.
+    static void setUploadFlags( TextureObject* pTextureObject, const U32 uploadFlags );
+    static GLint getMinFilter( TextureObject* pTextureObject );
+
 private:
     static void postTextureEvent(const TextureEventCode eventCode);
 
-    static void createGLName( TextureObject* pTextureObject );
-    static TextureObject* registerTexture(const char *textureName, GBitmap* pNewBitmap, TextureHandle::TextureHandleType type, bool clampToEdge);
-    static TextureObject* loadTexture(const char *textureName, TextureHandle::TextureHandleType type, bool clampToEdge, bool checkOnly = false, bool force16Bit = false );
+    static void createGLName( TextureObject* pTextureObject, GBitmap* pPaddedBitmap = NULL );
+    static TextureObject* registerTexture(const char *textureName, GBitmap* pNewBitmap, TextureHandle::TextureHandleType type, bool clampToEdge, const U32 uploadFlags = TextureHandle::UploadDefault, GBitmap* pPaddedBitmap = NULL);
+    static TextureObject* loadTexture(const char *textureName, TextureHandle::TextureHandleType type, bool clampToEdge, bool checkOnly = false, bool force16Bit = false, const U32 uploadFlags = TextureHandle::UploadDefault, GBitmap* pDecodedBitmap = NULL );
     static void freeTexture( TextureObject* pTextureObject );
-    static void refresh(TextureObject* pTextureObject);
+    static void refresh(TextureObject* pTextureObject, GBitmap* pPaddedBitmap = NULL);
+    static void completeAsyncLoad( TextureObject* pTextureObject );
+    static void finishAsyncLoad( AsyncTextureRequest* pRequest );
+    static void cancelAsyncLoad( TextureObject* pTextureObject );
+    static void createPlaceholderTexture( void );
+    static void evictTexture( TextureObject* pTextureObject );
+    static void restoreTexture( TextureObject* pTextureObject );
+    static TextureObject* registerFileTexture( StringTableEntry textureKey, GBitmap* pNewBitmap, TextureHandle::TextureHandleType type, bool clampToEdge, const U32 uploadFlags );
+    static void applyBitmapPolicy( TextureObject* pTextureObject );
+    static void discardBitmap( TextureObject* pTextureObject );
 
     static GBitmap* loadBitmap(const char *textureName, bool recurse = true, bool nocompression = false);
     static GBitmap* createPowerOfTwoBitmap( GBitmap* pBitmap );
+    static GBitmap* createUploadBitmap( GBitmap* pBitmap, const U32 uploadFlags );
+    static GBitmap* decodeBitmap( const char* pFilePath );
+    static void decodeTextureJob( void* pContext, const U32 start, const U32 end );
+    static void decodePrefetchBitmapJob( void* pContext, const U32 start, const U32 end );
+    static GBitmap* takePrefetchedBitmap( StringTableEntry textureKey );
     static U16* create16BitBitmap( GBitmap *pDL, U8 *in_source8, GBitmap::BitmapFormat alpha_info, GLint *GLformat, GLint *GLdata_type, U32 width, U32 height );
     static void getSourceDestByteFormat(GBitmap *pBitmap, U32 *sourceFormat, U32 *destFormat, U32 *byteFormat, U32* texelSize);
     static F32 getResidentFraction( void );
 };
 
+//--------------------------------------------------------------------------------------------------------------------
+
+inline GLuint TextureManager::getResidentGLName( TextureObject* pTextureObject )
+{
+    // Flag the texture as used this frame.
+    pTextureObject->mLastBoundFrame = mFrameIndex;
+
+    // Restore the texture if it was evicted.
+    if ( pTextureObject->mEvicted )
+        restoreTexture( pTextureObject );
+
+    return pTextureObject->mGLTextureName;
+}
+
 #endif // _TEXTURE_MANAGER_H_
\ No newline at end of file
@@ -71,6 +71,18 @@ private:
     U32                 mBitmapHeight;
     GLuint              mFilter;
     bool                mClamp;
+    bool                mLoadPending;
+    bool                mLoadFailed;
+    bool                mForce16Bit;
+    U32                 mUploadFlags;
+    U32                 mMipLevels;
+
+    /// Residency.
+    U32                 mLastBoundFrame;
+    bool                mEvicted;
+    bool                mBitmapReloadable;
+    TextureHandle::ResidencyPriority mResidencyPriority;
+    TextureHandle::BitmapPolicy mBitmapPolicy;
 
     TextureHandle::TextureHandleType mHandleType;
 
@@ -90,6 +102,16 @@ public:
         mBitmapHeight( 0 ),
         mFilter( GL_NEAREST ),
         mClamp( false ),
+        mLoadPending( false ),
+        mLoadFailed( false ),
+        mForce16Bit( false ),
+        mUploadFlags( TextureHandle::UploadDefault ),
+        mMipLevels( 1 ),
+        mLastBoundFrame( 0 ),
+        mEvicted( false ),
+        mBitmapReloadable( false ),
+        mResidencyPriority( TextureHandle::ResidencyNormal ),
+        mBitmapPolicy( TextureHandle::BitmapPolicyDefault ),
         mHandleType( TextureHandle::InvalidTexture )
     {
     }
@@ -103,6 +125,13 @@ public:
     inline U32 getBitmapHeight( void ) { return mBitmapHeight; }
     inline GLuint getFilter( void ) { return mFilter; }
     inline bool getClamp( void ) { return mClamp; }
+    inline U32 getUploadFlags( void ) const { return mUploadFlags; }
+    inline bool isLoadPending( void ) const { return mLoadPending; }
+    inline bool isLoadFailed( void ) const { return mLoadFailed; }
+    inline bool isEvicted( void ) const { return mEvicted; }
+    inline U32 getLastBoundFrame( void ) const { return mLastBoundFrame; }
+    inline TextureHandle::ResidencyPriority getResidencyPriority( void ) const { return mResidencyPriority; }
+    inline TextureHandle::BitmapPolicy getBitmapPolicy( void ) const { return mBitmapPolicy; }
     
     inline S32 getTextureResidentSize( void ) const { return mTextureResidentSize; }
     inline S32 getBitmapResidentSize( void ) const { return mBitmapResidentSize; }
@@ -92,7 +92,7 @@ void dglDrawBitmapStretchSR(TextureObject* texture,
    glDisable(GL_LIGHTING);
 
    glEnable(GL_TEXTURE_2D);
-   glBindTexture(GL_TEXTURE_2D, texture->getGLTextureName());
+   glBindTexture(GL_TEXTURE_2D, TextureManager::getResidentGLName(texture));
    //glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
 
    if (bSilhouette)
@@ -489,7 +489,7 @@ U32 dglDrawTextN(GFont*          font,
       {
          if(currentPt)
          {
-            glBindTexture(GL_TEXTURE_2D, lastTexture->getGLTextureName());
+            glBindTexture(GL_TEXTURE_2D, TextureManager::getResidentGLName(lastTexture));
 
             //Luma:	More optimal rendering
             for (S32 i=0; i<currentPt; i+=4) 
@@ -537,7 +537,7 @@ U32 dglDrawTextN(GFont*          font,
    if(currentPt)
    {
        //Luma:	More optimal rendering
-       glBindTexture(GL_TEXTURE_2D, lastTexture->getGLTextureName());
+       glBindTexture(GL_TEXTURE_2D, TextureManager::getResidentGLName(lastTexture));
        for (S32 i=0; i<currentPt; i+=4) 
        {
             glDrawArrays(GL_TRIANGLE_STRIP, i, 4);
@@ -704,7 +704,7 @@ U32 dglDrawTextN(GFont*          font,
       {
          if(currentPt)
          {
-            glBindTexture(GL_TEXTURE_2D, lastTexture->getGLTextureName());
+            glBindTexture(GL_TEXTURE_2D, TextureManager::getResidentGLName(lastTexture));
             glDrawArrays( GL_QUADS, 0, currentPt );
             currentPt = 0;
          }
@@ -747,7 +747,7 @@ U32 dglDrawTextN(GFont*          font,
    }
    if(currentPt)
    {
-      glBindTexture(GL_TEXTURE_2D, lastTexture->getGLTextureName());
+      glBindTexture(GL_TEXTURE_2D, TextureManager::getResidentGLName(lastTexture));
       glDrawArrays( GL_QUADS, 0, currentPt );
    }
 
@@ -512,6 +512,29 @@ void GBitmap::extrudeMipLevelsDetail()
    ((U8*)getWritableBits(numMipLevels - 1))[2] = 0x80;
 }
 
+//--------------------------------------------------------------------------
+void GBitmap::premultiplyAlpha()
+{
+   AssertFatal(getFormat() == GBitmap::RGBA, "GBitmap::premultiplyAlpha: only handles RGBA.");
+
+   // Scale the color channels of every mip level by alpha.
+   // The rounding divides by 255 exactly so opaque texels are unchanged.
+   U8* pTexel = getWritableBits(0);
+   U8* pTexelEnd = pTexel + byteSize;
+   for ( ; pTexel < pTexelEnd; pTexel += 4)
+   {
+      const U32 alpha = pTexel[3];
+      if (alpha == 255)
+         continue;
+
+      for (U32 channel = 0; channel < 3; channel++)
+      {
+         const U32 value = pTexel[channel] * alpha + 128;
+         pTexel[channel] = U8((value + (value >> 8)) >> 8);
+      }
+   }
+}
+
 //--------------------------------------------------------------------------
 void bitmapConvertRGB_to_5551_c(U8 *src, U32 pixels)
 {
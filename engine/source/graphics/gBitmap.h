@@ -99,6 +99,7 @@ class GBitmap: public ResourceInstance
 
    void extrudeMipLevels(bool clearBorders = false);
    void extrudeMipLevelsDetail();
+   void premultiplyAlpha();
 
    GBitmap *createPowerOfTwoBitmap();
 
@@ -55,6 +55,35 @@ void BitStream::sendPacketStream(const NetAddress *addr)
    Net::sendto(addr, gPacketStream.getBuffer(), gPacketStream.getPosition());
 }
 
+// Bits are stored least significant first so any value up to 32 bits wide
+// lands in at most five consecutive bytes.  These gather and scatter those
+// bytes through a 64-bit word, independent of the host byte order.
+
+static inline U64 loadBits(const U8 *ptr, S32 byteCount)
+{
+   U64 bits = 0;
+   for(S32 i = 0; i < byteCount; i++)
+      bits |= U64(ptr[i]) << (i << 3);
+   return bits;
+}
+
+static inline void storeBits(U8 *ptr, U64 bits, S32 bitCount)
+{
+   // Store the whole bytes.
+   for(; bitCount >= 8; bitCount -= 8)
+   {
+      *ptr++ = U8(bits);
+      bits >>= 8;
+   }
+
+   // Merge the partial byte, keeping the bits above it.
+   if(bitCount)
+   {
+      const U8 mask = U8((1 << bitCount) - 1);
+      *ptr = (*ptr & ~mask) | (U8(bits) & mask);
+   }
+}
+
 // FIXMEFIXMEFIXME MATH
 
 inline bool IsEqual(F32 a, F32 b) { return a == b; }
@@ -123,9 +152,23 @@ class HuffmanProcessor
    Vector<HuffNode> m_huffNodes;
    Vector<HuffLeaf> m_huffLeaves;
 
+   // Decoding looks up the next DecodeTableBits bits of the stream at once.
+   // Short codes resolve straight to a leaf, longer ones to the node reached
+   // after those bits, which is then walked a bit at a time.
+   enum {
+      DecodeTableBits = 10,
+      DecodeTableSize = 1 << DecodeTableBits
+   };
+   struct HuffDecode {
+      S16 index;     // Leaf (negative) or node, as with HuffNode::index0/1.
+      U8  numBits;   // Bits consumed to reach it.
+   };
+   HuffDecode m_decodeTable[DecodeTableSize];
+
    S16 determineIndex(HuffWrap&);
 
    void generateCodes(BitStream&, S32, S32);
+   void buildDecodeTable();
 
   public:
    HuffmanProcessor() : m_tablesBuilt(false) { }
@@ -212,18 +255,37 @@ void BitStream::writeBits(S32 bitCount, const void *bitPtr)
       return;
    }
 
-   // [tom, 8/17/2006] This is probably a lot lamer then it needs to be. However,
-   // at least it doesnt clobber data or overrun the buffer like the old code did.
    const U8 *ptr = (U8 *)bitPtr;
+   U8 *dstPtr = dataPtr + (bitNum >> 3);
+   const S32 shift = bitNum & 0x7;
+   bitNum += bitCount;
 
-   for(S32 srcBitNum = 0;srcBitNum < bitCount;srcBitNum++)
+   // Byte aligned writes are a straight copy.
+   if(shift == 0)
    {
-      if((*(ptr + (srcBitNum >> 3)) & (1 << (srcBitNum & 0x7))) != 0)
-         *(dataPtr + (bitNum >> 3)) |= (1 << (bitNum & 0x7));
-      else
-         *(dataPtr + (bitNum >> 3)) &= ~(1 << (bitNum & 0x7));
-      bitNum++;
+      const S32 byteCount = bitCount >> 3;
+      dMemcpy(dstPtr, ptr, byteCount);
+      if(bitCount & 0x7)
+         storeBits(dstPtr + byteCount, ptr[byteCount], bitCount & 0x7);
+      return;
    }
+
+   // Otherwise merge the source in a word at a time, keeping the bits
+   // already written to the first byte.
+   U64 accumulator = *dstPtr & ((1 << shift) - 1);
+   while(bitCount >= 32)
+   {
+      accumulator |= loadBits(ptr, 4) << shift;
+      storeBits(dstPtr, accumulator, 32);
+      accumulator >>= 32;
+      ptr += 4;
+      dstPtr += 4;
+      bitCount -= 32;
+   }
+
+   if(bitCount)
+      accumulator |= (loadBits(ptr, (bitCount + 7) >> 3) & ((U64(1) << bitCount) - 1)) << shift;
+   storeBits(dstPtr, accumulator, shift + bitCount);
 }
 
 void BitStream::setBit(S32 bitCount, bool set)
@@ -266,23 +328,36 @@ void BitStream::readBits(S32 bitCount, void *bitPtr)
       AssertWarn(false, "Out of range read");
       return;
    }
-   U8 *stPtr = dataPtr + (bitNum >> 3);
-   S32 byteCount = (bitCount + 7) >> 3;
-
+   const U8 *srcPtr = dataPtr + (bitNum >> 3);
    U8 *ptr = (U8 *) bitPtr;
+   const S32 shift = bitNum & 0x7;
+   bitNum += bitCount;
 
-   S32 downShift = bitNum & 0x7;
-   S32 upShift = 8 - downShift;
+   // Byte aligned reads are a straight copy.
+   if(shift == 0)
+   {
+      const S32 byteCount = bitCount >> 3;
+      dMemcpy(ptr, srcPtr, byteCount);
+      if(bitCount & 0x7)
+         ptr[byteCount] = srcPtr[byteCount] & ((1 << (bitCount & 0x7)) - 1);
+      return;
+   }
 
-   U8 curB = *stPtr;
-   while(byteCount--)
+   // Otherwise gather a word at a time.  Only the bytes holding the bits
+   // being read are touched so we never read past the end of the buffer.
+   while(bitCount >= 32)
    {
-      U8 nextB = *++stPtr;
-      *ptr++ = (curB >> downShift) | (nextB << upShift);
-      curB = nextB;
+      storeBits(ptr, loadBits(srcPtr, 5) >> shift, 32);
+      srcPtr += 4;
+      ptr += 4;
+      bitCount -= 32;
    }
 
-   bitNum += bitCount;
+   if(bitCount)
+   {
+      const U64 bits = loadBits(srcPtr, (shift + bitCount + 7) >> 3) >> shift;
+      storeBits(ptr, bits & ((U64(1) << bitCount) - 1), (bitCount + 7) & ~0x7);
+   }
 }
 
 bool BitStream::_read(U32 size, void *dataPtr)
@@ -299,14 +374,23 @@ bool BitStream::_write(U32 size, const void *dataPtr)
 
 S32 BitStream::readInt(S32 bitCount)
 {
-   S32 ret = 0;
-   readBits(bitCount, &ret);
-   ret = convertLEndianToHost(ret);
+   if(!bitCount)
+      return 0;
+   if(bitCount + bitNum > maxReadBitNum)
+   {
+      error = true;
+      AssertWarn(false, "Out of range read");
+      return 0;
+   }
+
+   // Gather the bytes holding the value in one go.
+   const S32 shift = bitNum & 0x7;
+   const U32 ret = U32(loadBits(dataPtr + (bitNum >> 3), (shift + bitCount + 7) >> 3) >> shift);
+   bitNum += bitCount;
+
    if(bitCount == 32)
-      return ret;
-   else
-      ret &= (1 << bitCount) - 1;
-   return ret;
+      return S32(ret);
+   return S32(ret & ((U32(1) << bitCount) - 1));
 }
 
 void BitStream::writeInt(S32 val, S32 bitCount)
@@ -351,6 +435,236 @@ S32 BitStream::readSignedInt(S32 bitCount)
       return readInt(bitCount - 1);
 }
 
+//----------------------------------------------------------------------------
+
+void BitStream::writeInts(const S32 *values, U32 count, S32 bitCount)
+{
+   AssertFatal(bitCount >= 0 && bitCount <= 32, "BitStream::writeInts() - Invalid bit count.");
+
+   if(!count || !bitCount)
+      return;
+
+   const S32 totalBits = S32(count) * bitCount;
+   if(totalBits + bitNum > maxWriteBitNum)
+   {
+      error = true;
+      AssertFatal(false, "Out of range write");
+      return;
+   }
+
+   const U32 mask = bitCount == 32 ? 0xFFFFFFFF : (U32(1) << bitCount) - 1;
+   U8 *dstPtr = dataPtr + (bitNum >> 3);
+   S32 accumulatedBits = bitNum & 0x7;
+   bitNum += totalBits;
+
+   // Keep the bits already written to the first byte.
+   U64 accumulator = accumulatedBits ? (*dstPtr & ((1 << accumulatedBits) - 1)) : 0;
+
+   // Pack the values and flush a word whenever one is full.
+   for(U32 i = 0; i < count; i++)
+   {
+      accumulator |= U64(U32(values[i]) & mask) << accumulatedBits;
+      accumulatedBits += bitCount;
+
+      if(accumulatedBits >= 32)
+      {
+         storeBits(dstPtr, accumulator, 32);
+         dstPtr += 4;
+         accumulator >>= 32;
+         accumulatedBits -= 32;
+      }
+   }
+
+   storeBits(dstPtr, accumulator, accumulatedBits);
+}
+
+void BitStream::readInts(S32 *values, U32 count, S32 bitCount)
+{
+   AssertFatal(bitCount >= 0 && bitCount <= 32, "BitStream::readInts() - Invalid bit count.");
+
+   if(!count)
+      return;
+
+   if(!bitCount)
+   {
+      dMemset(values, 0, count * sizeof(S32));
+      return;
+   }
+
+   const S32 totalBits = S32(count) * bitCount;
+   if(totalBits + bitNum > maxReadBitNum)
+   {
+      error = true;
+      AssertWarn(false, "Out of range read");
+      dMemset(values, 0, count * sizeof(S32));
+      return;
+   }
+
+   const U32 mask = bitCount == 32 ? 0xFFFFFFFF : (U32(1) << bitCount) - 1;
+   const U8 *srcPtr = dataPtr + (bitNum >> 3);
+   const U8 *endPtr = dataPtr + ((bitNum + totalBits + 7) >> 3);
+   U64 accumulator = 0;
+   S32 accumulatedBits = 0;
+
+   // Drop the bits already read from the first byte.
+   if(bitNum & 0x7)
+   {
+      accumulator = *srcPtr++ >> (bitNum & 0x7);
+      accumulatedBits = 8 - (bitNum & 0x7);
+   }
+   bitNum += totalBits;
+
+   // Refill a word at a time, falling back to bytes at the end of the data.
+   for(U32 i = 0; i < count; i++)
+   {
+      while(accumulatedBits < bitCount)
+      {
+         if(endPtr - srcPtr >= 4)
+         {
+            accumulator |= loadBits(srcPtr, 4) << accumulatedBits;
+            srcPtr += 4;
+            accumulatedBits += 32;
+         }
+         else
+         {
+            accumulator |= U64(*srcPtr++) << accumulatedBits;
+            accumulatedBits += 8;
+         }
+      }
+
+      values[i] = S32(U32(accumulator) & mask);
+      accumulator >>= bitCount;
+      accumulatedBits -= bitCount;
+   }
+}
+
+void BitStream::writeSignedInts(const S32 *values, U32 count, S32 bitCount)
+{
+   // Pack the sign flag below the magnitude, matching writeSignedInt().
+   S32 packed[BatchSize];
+   while(count)
+   {
+      const U32 batchCount = getMin(count, U32(BatchSize));
+      for(U32 i = 0; i < batchCount; i++)
+         packed[i] = values[i] < 0 ? ((-values[i]) << 1) | 1 : values[i] << 1;
+
+      writeInts(packed, batchCount, bitCount);
+      values += batchCount;
+      count -= batchCount;
+   }
+}
+
+void BitStream::readSignedInts(S32 *values, U32 count, S32 bitCount)
+{
+   readInts(values, count, bitCount);
+
+   for(U32 i = 0; i < count; i++)
+   {
+      const S32 magnitude = S32(U32(values[i]) >> 1);
+      values[i] = (values[i] & 1) ? -magnitude : magnitude;
+   }
+}
+
+void BitStream::writeFloats(const F32 *values, U32 count, S32 bitCount)
+{
+   const F32 scale = F32((1 << bitCount) - 1);
+   S32 packed[BatchSize];
+   while(count)
+   {
+      const U32 batchCount = getMin(count, U32(BatchSize));
+      for(U32 i = 0; i < batchCount; i++)
+         packed[i] = S32(values[i] * scale);
+
+      writeInts(packed, batchCount, bitCount);
+      values += batchCount;
+      count -= batchCount;
+   }
+}
+
+void BitStream::readFloats(F32 *values, U32 count, S32 bitCount)
+{
+   const F32 scale = F32((1 << bitCount) - 1);
+   S32 packed[BatchSize];
+   while(count)
+   {
+      const U32 batchCount = getMin(count, U32(BatchSize));
+      readInts(packed, batchCount, bitCount);
+      for(U32 i = 0; i < batchCount; i++)
+         values[i] = packed[i] / scale;
+
+      values += batchCount;
+      count -= batchCount;
+   }
+}
+
+void BitStream::writeSignedFloats(const F32 *values, U32 count, S32 bitCount)
+{
+   const F32 scale = F32((1 << bitCount) - 1);
+   S32 packed[BatchSize];
+   while(count)
+   {
+      const U32 batchCount = getMin(count, U32(BatchSize));
+      for(U32 i = 0; i < batchCount; i++)
+         packed[i] = S32(((values[i] + 1) * .5) * scale);
+
+      writeInts(packed, batchCount, bitCount);
+      values += batchCount;
+      count -= batchCount;
+   }
+}
+
+void BitStream::readSignedFloats(F32 *values, U32 count, S32 bitCount)
+{
+   const F32 scale = F32((1 << bitCount) - 1);
+   S32 packed[BatchSize];
+   while(count)
+   {
+      const U32 batchCount = getMin(count, U32(BatchSize));
+      readInts(packed, batchCount, bitCount);
+      for(U32 i = 0; i < batchCount; i++)
+         values[i] = packed[i] * 2 / scale - 1.0f;
+
+      values += batchCount;
+      count -= batchCount;
+   }
+}
+
+void BitStream::writeRangedF32s(const F32 *values, U32 count, F32 min, F32 max, U32 numBits)
+{
+   const F32 range = max - min;
+   const F32 scale = F32((1 << numBits) - 1);
+   S32 packed[BatchSize];
+   while(count)
+   {
+      const U32 batchCount = getMin(count, U32(BatchSize));
+      for(U32 i = 0; i < batchCount; i++)
+         packed[i] = S32(((mClampF(values[i], min, max) - min) / range) * scale);
+
+      writeInts(packed, batchCount, numBits);
+      values += batchCount;
+      count -= batchCount;
+   }
+}
+
+void BitStream::readRangedF32s(F32 *values, U32 count, F32 min, F32 max, U32 numBits)
+{
+   const F32 range = max - min;
+   const F32 scale = F32((1 << numBits) - 1);
+   S32 packed[BatchSize];
+   while(count)
+   {
+      const U32 batchCount = getMin(count, U32(BatchSize));
+      readInts(packed, batchCount, numBits);
+      for(U32 i = 0; i < batchCount; i++)
+         values[i] = min + (F32(packed[i]) / scale) * range;
+
+      values += batchCount;
+      count -= batchCount;
+   }
+}
+
+//----------------------------------------------------------------------------
+
 void BitStream::writeNormalVector(const Point3F& vec, S32 bitCount)
 {
    F32 phi   = mAtan(vec.x, vec.y) / (F32)M_PI;
@@ -695,6 +1009,8 @@ void HuffmanProcessor::buildTables()
    BitStream bs(&code, 4);
 
    generateCodes(bs, 0, 0);
+
+   buildDecodeTable();
 }
 
 void HuffmanProcessor::generateCodes(BitStream& rBS, S32 index, S32 depth)
@@ -703,7 +1019,11 @@ void HuffmanProcessor::generateCodes(BitStream& rBS, S32 index, S32 depth)
       // leaf node, copy the code in, and back out...
       HuffLeaf& rLeaf = m_huffLeaves[-(index + 1)];
 
+      // Keep the code in host order without the bits left over from other branches.
       dMemcpy(&rLeaf.code, rBS.dataPtr, sizeof(rLeaf.code));
+      rLeaf.code = convertLEndianToHost(rLeaf.code);
+      if (depth < 32)
+         rLeaf.code &= (1 << depth) - 1;
       rLeaf.numBits = depth;
    } else {
       HuffNode& rNode = m_huffNodes[index];
@@ -721,6 +1041,25 @@ void HuffmanProcessor::generateCodes(BitStream& rBS, S32 index, S32 depth)
    }
 }
 
+void HuffmanProcessor::buildDecodeTable()
+{
+   for (U32 i = 0; i < DecodeTableSize; i++) {
+      // Walk the tree using the entry's bits, lowest first as they are read.
+      S32 index   = 0;
+      U8  numBits = 0;
+      while (index >= 0 && numBits < DecodeTableBits) {
+         if ((i >> numBits) & 1)
+            index = m_huffNodes[index].index1;
+         else
+            index = m_huffNodes[index].index0;
+         numBits++;
+      }
+
+      m_decodeTable[i].index   = S16(index);
+      m_decodeTable[i].numBits = numBits;
+   }
+}
+
 S16 HuffmanProcessor::determineIndex(HuffWrap& rWrap)
 {
    if (rWrap.pLeaf != NULL) {
@@ -741,20 +1080,33 @@ bool HuffmanProcessor::readHuffBuffer(BitStream* pStream, char* out_pBuffer)
 
    if (pStream->readFlag()) {
       S32 len = pStream->readInt(8);
+      const S32 endByte = (pStream->maxReadBitNum + 7) >> 3;
       for (S32 i = 0; i < len; i++) {
-         S32 index = 0;
-         while (true) {
-            if (index >= 0) {
-               if (pStream->readFlag() == true) {
-                  index = m_huffNodes[index].index1;
-               } else {
-                  index = m_huffNodes[index].index0;
-               }
+         // Peek the next table bits, stopping at the end of the buffer.
+         const S32 bitNum    = pStream->bitNum;
+         const S32 shift     = bitNum & 0x7;
+         const S32 byteCount = getMin((shift + DecodeTableBits + 7) >> 3, endByte - (bitNum >> 3));
+         const U32 peek      = U32(loadBits(pStream->dataPtr + (bitNum >> 3), byteCount) >> shift) & (DecodeTableSize - 1);
+
+         const HuffDecode& rDecode = m_decodeTable[peek];
+         if (bitNum + rDecode.numBits > pStream->maxReadBitNum) {
+            pStream->error = true;
+            AssertWarn(false, "Out of range read");
+            out_pBuffer[i] = '\0';
+            return false;
+         }
+         pStream->bitNum += rDecode.numBits;
+
+         // Finish any code longer than the table a bit at a time.
+         S32 index = rDecode.index;
+         while (index >= 0) {
+            if (pStream->readFlag() == true) {
+               index = m_huffNodes[index].index1;
             } else {
-               out_pBuffer[i] = m_huffLeaves[-(index+1)].symbol;
-               break;
+               index = m_huffNodes[index].index0;
             }
          }
+         out_pBuffer[i] = m_huffLeaves[-(index+1)].symbol;
       }
       out_pBuffer[len] = '\0';
       return true;
@@ -796,10 +1148,28 @@ bool HuffmanProcessor::writeHuffBuffer(BitStream* pStream, const char* out_pBuff
    } else {
       pStream->writeFlag(true);
       pStream->writeInt(len, 8);
+
+      // Pack the codes a word at a time and write them in one go.  The
+      // compressed string is shorter than the raw one so it fits in 256 bytes.
+      U8  packed[256 + 4];
+      U8* pPacked         = packed;
+      U64 accumulator     = 0;
+      S32 accumulatedBits = 0;
       for (i = 0; i < len; i++) {
-         HuffLeaf& rLeaf = m_huffLeaves[((unsigned char)out_pBuffer[i])];
-         pStream->writeBits(rLeaf.numBits, &rLeaf.code);
+         const HuffLeaf& rLeaf = m_huffLeaves[((unsigned char)out_pBuffer[i])];
+         accumulator |= U64(rLeaf.code) << accumulatedBits;
+         accumulatedBits += rLeaf.numBits;
+
+         if (accumulatedBits >= 32) {
+            storeBits(pPacked, accumulator, 32);
+            pPacked += 4;
+            accumulator >>= 32;
+            accumulatedBits -= 32;
+         }
       }
+      storeBits(pPacked, accumulator, (accumulatedBits + 7) & ~0x7);
+
+      pStream->writeBits(numBits, packed);
    }
 
    return true;
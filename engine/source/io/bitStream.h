@@ -62,6 +62,11 @@ protected:
 
    friend class HuffmanProcessor;
 public:
+   enum
+   {
+      BatchSize = 64,   ///< Values converted per pass by the batch float and signed writers.
+   };
+
    static BitStream *getPacketStream(U32 writeSize = 0);
    static void sendPacketStream(const NetAddress *addr);
 
@@ -151,6 +156,20 @@ public:
    /// Reads a ranged floating point value written with writeRangedF32.
    F32 readRangedF32( F32 min, F32 max, U32 numBits );
 
+   /// Batch versions of the above.  These pack every value through a single
+   /// 64-bit accumulator and are bit-for-bit compatible with the single value
+   /// calls, so a batch may be read back one value at a time and vice versa.
+   virtual void writeInts(const S32 *values, U32 count, S32 bitCount);
+   void readInts(S32 *values, U32 count, S32 bitCount);
+   void writeSignedInts(const S32 *values, U32 count, S32 bitCount);
+   void readSignedInts(S32 *values, U32 count, S32 bitCount);
+   void writeFloats(const F32 *values, U32 count, S32 bitCount);
+   void readFloats(F32 *values, U32 count, S32 bitCount);
+   void writeSignedFloats(const F32 *values, U32 count, S32 bitCount);
+   void readSignedFloats(F32 *values, U32 count, S32 bitCount);
+   void writeRangedF32s(const F32 *values, U32 count, F32 min, F32 max, U32 numBits);
+   void readRangedF32s(F32 *values, U32 count, F32 min, F32 max, U32 numBits);
+
    void writeClassId(U32 classId, U32 classType, U32 classGroup);
    S32 readClassId(U32 classType, U32 classGroup); // returns -1 if the class type is out of range
 
@@ -191,6 +210,7 @@ public:
    bool testBit(S32 bitCount);
 
    bool isFull() { return bitNum > (bufSize << 3); }
+   S32  getBitSpaceAvailable() { return (bufSize << 3) - bitNum; }
    bool isValid() { return !error; }
 
    bool _read (const U32 size,void* d);
@@ -250,6 +270,12 @@ public:
       return BitStream::writeFlag(val);
    }
 
+   virtual void writeInts(const S32 *values, U32 count, S32 bitCount)
+   {
+      validate(((count * bitCount) >> 3) + 1);
+      BitStream::writeInts(values, count, bitCount);
+   }
+
    const U32 getCRC()
    {
       // This could be kinda inefficient - BJG
@@ -0,0 +1,129 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "platform/platform.h"
+#include "io/growableMemStream.h"
+#include "math/mMathFn.h"
+
+//-----------------------------------------------------------------------------
+
+GrowableMemStream::GrowableMemStream( const U32 initialCapacity ) :
+   mPosition( 0 )
+{
+   VECTOR_SET_ASSOCIATION( mBuffer );
+
+   if ( initialCapacity > 0 )
+      mBuffer.reserve( initialCapacity );
+
+   setStatus( Ok );
+}
+
+//-----------------------------------------------------------------------------
+
+GrowableMemStream::~GrowableMemStream()
+{
+   setStatus( Closed );
+}
+
+//-----------------------------------------------------------------------------
+
+void GrowableMemStream::clear( void )
+{
+   mBuffer.clear();
+   mPosition = 0;
+   setStatus( Ok );
+}
+
+//-----------------------------------------------------------------------------
+
+bool GrowableMemStream::hasCapability( const Capability cap ) const
+{
+   // Closed streams can't do anything.
+   if ( getStatus() == Closed )
+      return false;
+
+   return ( U32(cap) & U32(StreamRead | StreamWrite | StreamPosition) ) != 0;
+}
+
+//-----------------------------------------------------------------------------
+
+bool GrowableMemStream::setPosition( const U32 newPosition )
+{
+   // Positions past the end are not allowed.
+   if ( newPosition > (U32)mBuffer.size() )
+   {
+      setStatus( UnknownError );
+      return false;
+   }
+
+   mPosition = newPosition;
+   setStatus( mPosition == (U32)mBuffer.size() ? EOS : Ok );
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool GrowableMemStream::_read( const U32 numBytes, void* pBuffer )
+{
+   if ( numBytes == 0 )
+      return true;
+
+   // Copy what's available.
+   const U32 available = mBuffer.size() - mPosition;
+   const U32 actualBytes = numBytes < available ? numBytes : available;
+   dMemcpy( pBuffer, mBuffer.address() + mPosition, actualBytes );
+   mPosition += actualBytes;
+
+   if ( actualBytes < numBytes )
+   {
+      setStatus( EOS );
+      return false;
+   }
+
+   setStatus( Ok );
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool GrowableMemStream::_write( const U32 numBytes, const void* pBuffer )
+{
+   if ( numBytes == 0 )
+      return true;
+
+   // Grow the buffer if writing past the end.
+   const U32 endPosition = mPosition + numBytes;
+   if ( endPosition > (U32)mBuffer.size() )
+   {
+      // Grow geometrically to keep appends amortized.
+      if ( endPosition > mBuffer.capacity() )
+         mBuffer.reserve( getMax( endPosition, mBuffer.capacity() * 2 ) );
+
+      mBuffer.setSize( endPosition );
+   }
+
+   dMemcpy( mBuffer.address() + mPosition, pBuffer, numBytes );
+   mPosition = endPosition;
+
+   setStatus( Ok );
+   return true;
+}
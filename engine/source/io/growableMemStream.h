@@ -0,0 +1,67 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _GROWABLE_MEMSTREAM_H_
+#define _GROWABLE_MEMSTREAM_H_
+
+#ifndef _STREAM_H_
+#include "io/stream.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// A read/write memory stream whose buffer grows as it is written.
+/// Used to build a stream in memory before its final size is known.
+class GrowableMemStream : public Stream
+{
+   typedef Stream Parent;
+
+protected:
+   Vector<U8>  mBuffer;
+   U32         mPosition;
+
+public:
+   GrowableMemStream( const U32 initialCapacity = 0 );
+   virtual ~GrowableMemStream();
+
+   /// Buffer.
+   inline const U8* getBuffer( void ) const           { return mBuffer.address(); }
+   inline U8* getBuffer( void )                       { return mBuffer.address(); }
+   inline U32 getBufferSize( void ) const             { return mBuffer.size(); }
+   void clear( void );
+
+   // Mandatory overrides from Stream.
+   virtual bool hasCapability( const Capability cap ) const;
+   virtual U32  getPosition( void ) const             { return mPosition; }
+   virtual bool setPosition( const U32 newPosition );
+   virtual U32  getStreamSize( void )                 { return mBuffer.size(); }
+
+protected:
+   virtual bool _read( const U32 numBytes, void* pBuffer );
+   virtual bool _write( const U32 numBytes, const void* pBuffer );
+};
+
+#endif // _GROWABLE_MEMSTREAM_H_
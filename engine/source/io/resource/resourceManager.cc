@@ -30,6 +30,7 @@
 #include "memory/frameAllocator.h"
 
 #include "io/zip/zipArchive.h"
+#include "io/zip/mappedArchive.h"
 
 #include "io/resource/resourceManager.h"
 #include "string/findMatch.h"
@@ -52,6 +53,8 @@ ResourceObject::ResourceObject ()
   mInstance = NULL;
   mZipArchive = NULL;
   mCentralDir = NULL;
+  mMappedArchive = NULL;
+  mMappedEntry = -1;
 }
 
 void ResourceObject::destruct ()
@@ -66,6 +69,7 @@ void ResourceObject::destruct ()
       // [tom, 10/26/2006] We don't want to delete if it's a volume block since
       // the archive will be freed when the zip file resource object is freed.
       SAFE_DELETE(mZipArchive);
+      SAFE_DELETE(mMappedArchive);
    }
 }
 
@@ -354,6 +358,11 @@ bool ResManager::addVFSRoot(Zip::ZipArchive *vfs)
 bool ResManager::scanZip (ResourceObject * zipObject)
 {
    const char *zipPath = buildPath(zipObject->zipPath, zipObject->zipName);
+
+   // Use a memory-mapped archive if possible.
+   if(zipObject->mZipArchive == NULL && scanMappedZip(zipObject))
+      return true;
+
    if(zipObject->mZipArchive == NULL)
    {
       zipObject->mZipArchive = new Zip::ZipArchive;
@@ -364,62 +373,104 @@ bool ResManager::scanZip (ResourceObject * zipObject)
       }
    }
 
+   const char *zipFN = zipObject->mZipArchive->getFilename() ? zipObject->mZipArchive->getFilename() : "";
+
    for(U32 i = 0;i < zipObject->mZipArchive->numEntries();++i)
    {
       const Zip::CentralDir &dir = (*zipObject->mZipArchive)[i];
 
-      // FIXME [tom, 10/26/2006] This is pretty lame
-      char buf[1024];
-      dStrncpy(buf, dir.mFilename, sizeof(buf));
-      buf[sizeof(buf)-1] = 0;
-
-      // Iterate through the string and change any
-      // characters with \\ to /
-      char* scan = buf;
-      while (*scan != '\0')
-      {
-         if (*scan == '\\')
-            *scan = '/';
-         scan++;
-      }
+      ResourceObject *ro = createZipEntryResource(zipObject, zipFN, dir.mFilename);
+      if(ro == NULL)
+         continue;
 
-      const char *zipFN = zipObject->mZipArchive->getFilename() ? zipObject->mZipArchive->getFilename() : "";
+      ro->fileSize = dir.mUncompressedSize;
+      ro->compressedFileSize = dir.mCompressedSize;
+      ro->fileOffset = dir.mLocalHeadOffset;
+      ro->mZipArchive = zipObject->mZipArchive;
+      ro->mCentralDir = &dir;
+   }
 
-      FrameTemp<char> zipPath(dStrlen(zipFN) + dStrlen(buf) + 2);
-      dStrcpy(zipPath, zipFN);
+   return true;
+}
 
-      char* dot = dStrrchr(zipPath, '.');
-      if(dot)
+bool ResManager::scanMappedZip (ResourceObject * zipObject)
+{
+   if(zipObject->mMappedArchive == NULL)
+   {
+      zipObject->mMappedArchive = new Zip::MappedArchive;
+      if(! zipObject->mMappedArchive->openArchive(buildPath(zipObject->zipPath, zipObject->zipName)))
       {
-         dot -= 2;
-         dot[2] = '\0';
-         dStrcat(zipPath, "/");
+         SAFE_DELETE(zipObject->mMappedArchive);
+         return false;
       }
+   }
+
+   const char *zipFN = zipObject->mMappedArchive->getFilename();
 
-      dStrcat(zipPath, buf);
+   for(U32 i = 0;i < zipObject->mMappedArchive->numEntries();++i)
+   {
+      const Zip::MappedArchive::Entry &entry = (*zipObject->mMappedArchive)[i];
 
-      // Create file base name
-      char* pPathEnd = dStrrchr(zipPath, '/');
-      if(pPathEnd == NULL)
+      ResourceObject *ro = createZipEntryResource(zipObject, zipFN, entry.mFilename);
+      if(ro == NULL)
          continue;
 
-      pPathEnd[0] = '\0';
-      const char * path = StringTable->insert(zipPath);
-      const char * file = StringTable->insert(pPathEnd + 1);
-   
-      ResourceObject *ro = createZipResource(path, file, zipObject->zipPath, zipObject->zipName);
+      ro->fileSize = entry.mUncompressedSize;
+      ro->compressedFileSize = entry.mCompressedSize;
+      ro->fileOffset = entry.mLocalHeadOffset;
+      ro->mMappedArchive = zipObject->mMappedArchive;
+      ro->mMappedEntry = i;
+   }
 
-      ro->flags = ResourceObject::VolumeBlock;
-      ro->fileSize = dir.mUncompressedSize;
-      ro->compressedFileSize = dir.mCompressedSize;
-      ro->fileOffset = dir.mLocalHeadOffset;
-      ro->mZipArchive = zipObject->mZipArchive;
-      ro->mCentralDir = &dir;
+   return true;
+}
 
-      dictionary.pushBehind (ro, ResourceObject::File);
+ResourceObject* ResManager::createZipEntryResource (ResourceObject * zipObject, const char *archiveFilename, const char *entryFilename)
+{
+   // FIXME [tom, 10/26/2006] This is pretty lame
+   char buf[1024];
+   dStrncpy(buf, entryFilename, sizeof(buf));
+   buf[sizeof(buf)-1] = 0;
+
+   // Iterate through the string and change any
+   // characters with \\ to /
+   char* scan = buf;
+   while (*scan != '\0')
+   {
+      if (*scan == '\\')
+         *scan = '/';
+      scan++;
    }
 
-   return true;
+   FrameTemp<char> zipPath(dStrlen(archiveFilename) + dStrlen(buf) + 2);
+   dStrcpy(zipPath, archiveFilename);
+
+   char* dot = dStrrchr(zipPath, '.');
+   if(dot)
+   {
+      dot -= 2;
+      dot[2] = '\0';
+      dStrcat(zipPath, "/");
+   }
+
+   dStrcat(zipPath, buf);
+
+   // Create file base name
+   char* pPathEnd = dStrrchr(zipPath, '/');
+   if(pPathEnd == NULL)
+      return NULL;
+
+   pPathEnd[0] = '\0';
+   const char * path = StringTable->insert(zipPath);
+   const char * file = StringTable->insert(pPathEnd + 1);
+
+   ResourceObject *ro = createZipResource(path, file, zipObject->zipPath, zipObject->zipName);
+
+   ro->flags = ResourceObject::VolumeBlock;
+
+   dictionary.pushBehind (ro, ResourceObject::File);
+
+   return ro;
 }
 
 //------------------------------------------------------------------------------
@@ -986,6 +1037,10 @@ Stream * ResManager::openStream (ResourceObject * obj)
 
    if (obj->flags & ResourceObject::VolumeBlock)
    {
+      // Memory-mapped archive?
+      if (obj->mMappedArchive)
+         return obj->mMappedArchive->openFileForRead(obj->mMappedEntry);
+
       AssertFatal(obj->mZipArchive, "mZipArchive is NULL");
       AssertFatal(obj->mCentralDir, "mCentralDir is NULL");
 
@@ -1314,6 +1369,8 @@ ResourceObject * ResManager::createZipResource (StringTableEntry path, StringTab
    newRO->crc = InvalidCRC;
    newRO->mZipArchive = NULL;
    newRO->mCentralDir = NULL;
+   newRO->mMappedArchive = NULL;
+   newRO->mMappedEntry = -1;
 
    return newRO;
 }
@@ -50,6 +50,7 @@ namespace Zip
 {
    class ZipArchive;
    class CentralDir;
+   class MappedArchive;
 }
 
 extern ResManager *ResourceManager;
@@ -172,6 +173,9 @@ public:
    Zip::ZipArchive *mZipArchive; ///< The zip archive for reading from zips
    const Zip::CentralDir *mCentralDir; ///< The central directory for this file in the zip
 
+   Zip::MappedArchive *mMappedArchive; ///< The memory-mapped archive for reading from zips, used instead of mZipArchive when set
+   S32 mMappedEntry;                   ///< The entry for this file in the memory-mapped archive
+
    ResourceObject();
    ~ResourceObject() { unlink(); }
 
@@ -366,6 +370,12 @@ private:
    /// Scan a zip file for resources.
    bool scanZip(ResourceObject *zipObject);
 
+   /// Scan a memory-mapped zip file for resources.
+   bool scanMappedZip(ResourceObject *zipObject);
+
+   /// Create a ResourceObject for a file in a zip file.
+   ResourceObject* createZipEntryResource(ResourceObject *zipObject, const char *archiveFilename, const char *entryFilename);
+
    /// Create a ResourceObject from the given file.
    ResourceObject* createResource(StringTableEntry path, StringTableEntry file);
 
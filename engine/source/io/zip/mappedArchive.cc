@@ -0,0 +1,483 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "io/zip/mappedArchive.h"
+
+#include "io/stream.h"
+#include "console/console.h"
+#include "string/stringTable.h"
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+#include "zlib.h"
+
+namespace Zip
+{
+
+//-----------------------------------------------------------------------------
+// Zip Records
+//-----------------------------------------------------------------------------
+
+static const U32 LocalHeaderSignature = 0x04034b50;
+static const U32 CentralDirSignature = 0x02014b50;
+static const U32 EndOfCentralDirSignature = 0x06054b50;
+
+static const U32 LocalHeaderSize = 30;
+static const U32 CentralDirSize = 46;
+static const U32 EndOfCentralDirSize = 22;
+static const U32 MaxArchiveCommentSize = 0xffff;
+
+static const U16 EncryptedFlag = BIT(0);
+static const U16 StoredMethod = 0;
+static const U16 DeflatedMethod = 8;
+
+// Records are little-endian and unaligned.
+static inline U16 readU16(const U8 *p)
+{
+   return (U16)(p[0] | (p[1] << 8));
+}
+
+static inline U32 readU32(const U8 *p)
+{
+   return (U32)p[0] | ((U32)p[1] << 8) | ((U32)p[2] << 16) | ((U32)p[3] << 24);
+}
+
+//-----------------------------------------------------------------------------
+// Entry Stream
+//-----------------------------------------------------------------------------
+
+/// A read-only stream over an entry's data, optionally owning the buffer.
+/// Unlike MemStream, empty entries are allowed.
+class MappedEntryStream : public Stream
+{
+   const U8 *mpData;
+   U32 mSize;
+   U32 mPosition;
+   bool mOwnsData;
+
+public:
+   MappedEntryStream(const U8 *pData, const U32 size, const bool ownsData) :
+      mpData(pData),
+      mSize(size),
+      mPosition(0),
+      mOwnsData(ownsData)
+   {
+      setStatus(size > 0 ? Ok : EOS);
+   }
+
+   virtual ~MappedEntryStream()
+   {
+      if(mOwnsData)
+         delete [] mpData;
+
+      setStatus(Closed);
+   }
+
+   virtual bool hasCapability(const Capability cap) const
+   {
+      return getStatus() != Closed && (cap == StreamRead || cap == StreamPosition);
+   }
+
+   virtual U32 getPosition() const                    { return mPosition; }
+   virtual U32 getStreamSize()                        { return mSize; }
+
+   virtual bool setPosition(const U32 newPosition)
+   {
+      if(newPosition > mSize)
+      {
+         setStatus(UnknownError);
+         return false;
+      }
+
+      mPosition = newPosition;
+      setStatus(mPosition == mSize ? EOS : Ok);
+      return true;
+   }
+
+protected:
+   virtual bool _read(const U32 numBytes, void *pBuffer)
+   {
+      if(numBytes == 0)
+         return true;
+
+      // Copy what's available.
+      const U32 available = mSize - mPosition;
+      const U32 actualBytes = numBytes < available ? numBytes : available;
+      dMemcpy(pBuffer, mpData + mPosition, actualBytes);
+      mPosition += actualBytes;
+
+      if(actualBytes < numBytes)
+      {
+         setStatus(EOS);
+         return false;
+      }
+
+      setStatus(Ok);
+      return true;
+   }
+
+   virtual bool _write(const U32 numBytes, const void *pBuffer)
+   {
+      AssertWarn(false, "MappedEntryStream - Writing is disallowed on this stream");
+      setStatus(IllegalCall);
+      return false;
+   }
+};
+
+//-----------------------------------------------------------------------------
+// Constructor/Destructor
+//-----------------------------------------------------------------------------
+
+MappedArchive::MappedArchive() :
+   mFilename(NULL),
+   mpMapping(NULL),
+   mMappingSize(0),
+   mpFilenames(NULL),
+   mIndexMask(0)
+{
+   VECTOR_SET_ASSOCIATION(mEntries);
+   VECTOR_SET_ASSOCIATION(mIndex);
+}
+
+MappedArchive::~MappedArchive()
+{
+   closeArchive();
+}
+
+//-----------------------------------------------------------------------------
+// Public Methods
+//-----------------------------------------------------------------------------
+
+bool MappedArchive::openArchive(const char *filename)
+{
+   // Debug Profiling.
+   PROFILE_SCOPE(MappedArchive_OpenArchive);
+
+   closeArchive();
+
+   // Map the archive.
+   mpMapping = (U8 *)Platform::mapFile(filename, mMappingSize);
+   if(mpMapping == NULL)
+      return false;
+
+   mFilename = StringTable->insert(filename);
+
+   // Read the central directory.
+   if(! readCentralDirectory())
+   {
+      closeArchive();
+      return false;
+   }
+
+   buildIndex();
+
+   return true;
+}
+
+void MappedArchive::closeArchive()
+{
+   if(mpMapping != NULL)
+   {
+      Platform::unmapFile(mpMapping, mMappingSize);
+      mpMapping = NULL;
+      mMappingSize = 0;
+   }
+
+   delete [] mpFilenames;
+   mpFilenames = NULL;
+
+   mEntries.clear();
+   mIndex.clear();
+   mIndexMask = 0;
+   mFilename = NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+S32 MappedArchive::findEntry(const char *filename) const
+{
+   if(mIndex.empty() || filename == NULL)
+      return InvalidEntry;
+
+   // Probe the index.
+   const U32 hash = hashFilename(filename);
+   for(U32 slot = hash & mIndexMask;;slot = (slot + 1) & mIndexMask)
+   {
+      const S32 entryIndex = mIndex[slot];
+      if(entryIndex == InvalidEntry)
+         return InvalidEntry;
+
+      const Entry &entry = mEntries[entryIndex];
+      if(entry.mHash != hash)
+         continue;
+
+      // Compare ignoring case and slash direction.
+      const char *a = entry.mFilename;
+      const char *b = filename;
+      while(*a && *b)
+      {
+         const char ca = *a == '\\' ? '/' : dTolower(*a);
+         const char cb = *b == '\\' ? '/' : dTolower(*b);
+         if(ca != cb)
+            break;
+
+         a++;
+         b++;
+      }
+
+      if(*a == 0 && *b == 0)
+         return entryIndex;
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+Stream *MappedArchive::openFileForRead(const S32 entryIndex) const
+{
+   // Debug Profiling.
+   PROFILE_SCOPE(MappedArchive_OpenFileForRead);
+
+   if(entryIndex < 0 || entryIndex >= mEntries.size())
+      return NULL;
+
+   const Entry &entry = mEntries[entryIndex];
+
+   // Locate the entry data.
+   const U8 *pData = getEntryData(entry);
+   if(pData == NULL)
+   {
+      Con::errorf("MappedArchive::openFileForRead - %s: Could not locate the data for file %s", mFilename, entry.mFilename);
+      return NULL;
+   }
+
+   // Stored and empty entries are read directly from the mapping.
+   if(entry.mCompressMethod == StoredMethod || entry.mUncompressedSize == 0)
+      return new MappedEntryStream(pData, entry.mUncompressedSize, false);
+
+   // Deflated entries are inflated in a single pass.
+   U8 *pBuffer = new U8[entry.mUncompressedSize];
+
+   z_stream zs;
+   dMemset(&zs, 0, sizeof(zs));
+   zs.next_in = (Bytef *)pData;
+   zs.avail_in = entry.mCompressedSize;
+   zs.next_out = pBuffer;
+   zs.avail_out = entry.mUncompressedSize;
+
+   // Zip entries are raw deflate streams without a zlib header.
+   S32 status = inflateInit2(&zs, -MAX_WBITS);
+   if(status == Z_OK)
+   {
+      status = inflate(&zs, Z_FINISH);
+      inflateEnd(&zs);
+   }
+
+   if(status != Z_STREAM_END || zs.total_out != entry.mUncompressedSize)
+   {
+      Con::errorf("MappedArchive::openFileForRead - %s: Could not inflate file %s", mFilename, entry.mFilename);
+      delete [] pBuffer;
+      return NULL;
+   }
+
+   return new MappedEntryStream(pBuffer, entry.mUncompressedSize, true);
+}
+
+//-----------------------------------------------------------------------------
+// Protected Methods
+//-----------------------------------------------------------------------------
+
+U32 MappedArchive::hashFilename(const char *filename)
+{
+   // FNV-1a ignoring case and slash direction.
+   U32 hash = 2166136261u;
+   for(const char *scan = filename;*scan;++scan)
+   {
+      const char c = *scan == '\\' ? '/' : dTolower(*scan);
+      hash = (hash ^ (U8)c) * 16777619u;
+   }
+
+   return hash;
+}
+
+//-----------------------------------------------------------------------------
+
+const U8 *MappedArchive::getEntryData(const Entry &entry) const
+{
+   // The local header can have a different extra field to the central directory so it is read here.
+   if(entry.mLocalHeadOffset > mMappingSize || mMappingSize - entry.mLocalHeadOffset < LocalHeaderSize)
+      return NULL;
+
+   const U8 *pHeader = mpMapping + entry.mLocalHeadOffset;
+   if(readU32(pHeader) != LocalHeaderSignature)
+      return NULL;
+
+   const U32 dataOffset = entry.mLocalHeadOffset + LocalHeaderSize + readU16(pHeader + 26) + readU16(pHeader + 28);
+   if(dataOffset > mMappingSize || mMappingSize - dataOffset < entry.mCompressedSize)
+      return NULL;
+
+   return mpMapping + dataOffset;
+}
+
+//-----------------------------------------------------------------------------
+
+bool MappedArchive::readCentralDirectory()
+{
+   if(mMappingSize < EndOfCentralDirSize)
+      return false;
+
+   // Find the end of central directory record, searching back over any archive comment.
+   const U8 *pEOCD = NULL;
+   const U32 searchEnd = mMappingSize - EndOfCentralDirSize;
+   const U32 searchStart = searchEnd > MaxArchiveCommentSize ? searchEnd - MaxArchiveCommentSize : 0;
+   for(U32 offset = searchEnd + 1;offset > searchStart;--offset)
+   {
+      if(readU32(mpMapping + offset - 1) == EndOfCentralDirSignature)
+      {
+         pEOCD = mpMapping + offset - 1;
+         break;
+      }
+   }
+
+   if(pEOCD == NULL)
+      return false;
+
+   // Multi-disk archives are not supported.
+   const U16 diskNum = readU16(pEOCD + 4);
+   const U16 startCDDiskNum = readU16(pEOCD + 6);
+   const U16 numEntries = readU16(pEOCD + 10);
+   const U32 cdSize = readU32(pEOCD + 12);
+   const U32 cdOffset = readU32(pEOCD + 16);
+   if(diskNum != 0 || startCDDiskNum != 0 || numEntries != readU16(pEOCD + 8))
+      return false;
+
+   if(cdOffset > mMappingSize || mMappingSize - cdOffset < cdSize)
+      return false;
+
+   // Measure the filenames so they can share one allocation.
+   U32 filenamesSize = 0;
+   const U8 *pRecord = mpMapping + cdOffset;
+   const U8 *pRecordEnd = pRecord + cdSize;
+   for(U32 i = 0;i < numEntries;++i)
+   {
+      if(pRecordEnd - pRecord < (S32)CentralDirSize || readU32(pRecord) != CentralDirSignature)
+         return false;
+
+      const U32 recordSize = CentralDirSize + readU16(pRecord + 28) + readU16(pRecord + 30) + readU16(pRecord + 32);
+      if((U32)(pRecordEnd - pRecord) < recordSize)
+         return false;
+
+      filenamesSize += readU16(pRecord + 28) + 1;
+      pRecord += recordSize;
+   }
+
+   // Read the entries.
+   mpFilenames = new char[getMax(filenamesSize, (U32)1)];
+   mEntries.reserve(numEntries);
+
+   char *pFilename = mpFilenames;
+   pRecord = mpMapping + cdOffset;
+   for(U32 i = 0;i < numEntries;++i)
+   {
+      const U8 *pCD = pRecord;
+      const U16 flags = readU16(pCD + 8);
+      const U16 compressMethod = readU16(pCD + 10);
+      const U16 filenameLength = readU16(pCD + 28);
+      pRecord += CentralDirSize + filenameLength + readU16(pCD + 30) + readU16(pCD + 32);
+
+      // Copy the filename, normalizing slashes.
+      const char *pSourceFilename = (const char *)(pCD + CentralDirSize);
+      for(U32 n = 0;n < filenameLength;++n)
+         pFilename[n] = pSourceFilename[n] == '\\' ? '/' : pSourceFilename[n];
+      pFilename[filenameLength] = 0;
+
+      const char *filename = pFilename;
+      pFilename += filenameLength + 1;
+
+      // Skip directories.
+      if(filenameLength == 0 || filename[filenameLength - 1] == '/')
+         continue;
+
+      // Encrypted entries and other compression methods need ZipArchive.
+      if((flags & EncryptedFlag) || (compressMethod != StoredMethod && compressMethod != DeflatedMethod))
+      {
+         Con::warnf("MappedArchive::readCentralDirectory - %s: File %s is encrypted or uses an unsupported compression method", mFilename, filename);
+         return false;
+      }
+
+      mEntries.increment();
+      Entry &entry = mEntries.last();
+      entry.mFilename = filename;
+      entry.mHash = hashFilename(filename);
+      entry.mCompressMethod = compressMethod;
+      entry.mCRC32 = readU32(pCD + 16);
+      entry.mCompressedSize = readU32(pCD + 20);
+      entry.mUncompressedSize = readU32(pCD + 24);
+      entry.mLocalHeadOffset = readU32(pCD + 42);
+
+      // Stored entries must not be resized on read.
+      if(compressMethod == StoredMethod && entry.mCompressedSize != entry.mUncompressedSize)
+         return false;
+
+      // Deflated entries cannot claim more data than their compressed size can inflate to.
+      // The inflate buffer is allocated from this size so it must not be trusted blindly.
+      if(compressMethod == DeflatedMethod && (U64)entry.mUncompressedSize > (U64)entry.mCompressedSize * MaxDeflateRatio)
+      {
+         Con::warnf("MappedArchive::readCentralDirectory - %s: File %s has an invalid uncompressed size", mFilename, filename);
+         return false;
+      }
+   }
+
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void MappedArchive::buildIndex()
+{
+   // Size the index to the next power-of-two above twice the entry count.
+   U32 indexSize = 16;
+   while(indexSize < (U32)mEntries.size() * 2)
+      indexSize <<= 1;
+
+   mIndexMask = indexSize - 1;
+   mIndex.setSize(indexSize);
+   for(U32 slot = 0;slot < indexSize;++slot)
+      mIndex[slot] = InvalidEntry;
+
+   // Insert the entries.
+   // Later duplicates are ignored so the first entry for a filename wins.
+   for(S32 entryIndex = 0;entryIndex < mEntries.size();++entryIndex)
+   {
+      const Entry &entry = mEntries[entryIndex];
+      if(findEntry(entry.mFilename) != InvalidEntry)
+         continue;
+
+      U32 slot = entry.mHash & mIndexMask;
+      while(mIndex[slot] != InvalidEntry)
+         slot = (slot + 1) & mIndexMask;
+
+      mIndex[slot] = entryIndex;
+   }
+}
+
+} // end namespace Zip
@@ -0,0 +1,126 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _MAPPEDARCHIVE_H_
+#define _MAPPEDARCHIVE_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+class Stream;
+
+namespace Zip
+{
+
+/// @addtogroup zip_group
+// @{
+
+//-----------------------------------------------------------------------------
+/// @brief Read-only zip archive backed by a memory mapping of the whole file
+///
+/// MappedArchive only reads the central directory when it is opened and keeps
+/// a hash index from entry name to entry so lookups are O(1). No per-entry
+/// objects are allocated. The names, entries and index each use a single
+/// allocation.
+///
+/// Stored entries are opened as zero-copy streams over the mapping. Deflated
+/// entries are inflated into a buffer in a single pass when opened. Archives
+/// with encrypted entries, compression methods other than stored or deflated,
+/// or that span disks cannot be opened. Use ZipArchive for those.
+//-----------------------------------------------------------------------------
+class MappedArchive
+{
+public:
+   enum
+   {
+      InvalidEntry = -1,
+      MaxDeflateRatio = 1032        ///< Largest expansion deflate can produce.
+   };
+
+   struct Entry
+   {
+      const char* mFilename;        ///< Normalized filename, using forward slashes.
+      U32 mHash;                    ///< Case-insensitive hash of the filename.
+      U16 mCompressMethod;
+      U32 mCRC32;
+      U32 mCompressedSize;
+      U32 mUncompressedSize;
+      U32 mLocalHeadOffset;
+   };
+
+public:
+   MappedArchive();
+   virtual ~MappedArchive();
+
+   /// Map an archive and read its central directory.
+   bool openArchive(const char *filename);
+   void closeArchive();
+
+   inline bool isOpen() const                         { return mpMapping != NULL; }
+   inline const char *getFilename() const             { return mFilename; }
+
+   /// Entries.
+   inline U32 numEntries() const                      { return mEntries.size(); }
+   inline const Entry &operator[](const U32 idx) const { return mEntries[idx]; }
+
+   /// Find an entry by filename. Case-insensitive and accepts either slash.
+   S32 findEntry(const char *filename) const;
+
+   /// Open an entry for reading.
+   /// Close the stream by deleting it.
+   Stream *openFileForRead(const S32 entryIndex) const;
+
+   Stream *openFileForRead(const char *filename) const
+   {
+      return openFileForRead(findEntry(filename));
+   }
+
+protected:
+   static U32 hashFilename(const char *filename);
+   const U8 *getEntryData(const Entry &entry) const;
+   bool readCentralDirectory();
+   void buildIndex();
+
+protected:
+   const char *mFilename;
+
+   U8 *mpMapping;
+   U32 mMappingSize;
+
+   Vector<Entry> mEntries;
+   char *mpFilenames;
+
+   /// Open-addressed hash index of entry indices.
+   Vector<S32> mIndex;
+   U32 mIndexMask;
+};
+
+// @}
+
+} // end namespace Zip
+
+#endif // _MAPPEDARCHIVE_H_
@@ -70,7 +70,8 @@ S32 QSORT_CALLBACK moduleDefinitionVersionIdSort( const void* a, const void* b )
 ModuleManager::ModuleManager() :
     mEnforceDependencies(true),
     mEchoInfo(true),
-    mDatabaseLocks( 0 )
+    mDatabaseLocks( 0 ),
+    mScanModulesTime( 0 )
 {
     // Set module extension.
     dStrcpy( mModuleExtension, MODULE_MANAGER_MODULE_DEFINITION_EXTENSION );
@@ -169,6 +170,8 @@ bool ModuleManager::scanModules( const char* pPath, const bool rootOnly )
     // Sanity!
     AssertFatal( pPath != NULL, "Cannot scan module with NULL path." );
 
+    const U32 startTime = Platform::getRealMilliseconds();
+
     // Expand module location.
     char pathBuffer[1024];
     Con::expandPath( pathBuffer, sizeof(pathBuffer), pPath );
@@ -249,6 +252,9 @@ bool ModuleManager::scanModules( const char* pPath, const bool rootOnly )
         Con::printf( "Module Manager: Finished scanning '%s'.", pathBuffer );
     }
 
+    // Accumulate the time spent scanning.
+    mScanModulesTime += Platform::getRealMilliseconds() - startTime;
+
     return true;
 }
 
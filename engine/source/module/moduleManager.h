@@ -111,6 +111,7 @@ private:
     S32                         mDatabaseLocks;
     char                        mModuleExtension[256];
     Taml                        mTaml;
+    U32                         mScanModulesTime;
     SimSet                      mNotificationListeners;
 
     // Module definition entry.
@@ -151,6 +152,7 @@ public:
 
     /// Module discovery.
     bool scanModules( const char* pPath, const bool rootOnly = false );
+    inline U32 getScanModulesTime( void ) const { return mScanModulesTime; }
 
     /// Module unregister.
     bool unregisterModule( const char* pModuleId, const U32 versionId );
@@ -284,6 +284,9 @@ NetConnection::NetConnection()
    mGhostRefs = NULL;
    mGhostLookupTable = NULL;
    mLocalGhosts = NULL;
+   mGhostScheduleSequence = 0;
+   mGhostScheduleCameraPos.set(0,0,0);
+   mGhostScheduleVisibleDistance = 0;
 
    mGhostsActive = 0;
 
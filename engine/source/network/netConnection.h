@@ -778,6 +778,13 @@ protected:
 
     GhostInfo *mGhostRefs;           ///< Allocated array of ghostInfos. Null if ghostFrom is false.
     GhostInfo **mGhostLookupTable;   ///< Table indexed by object id to GhostInfo. Null if ghostFrom is false.
+    Vector<GhostInfo *> mGhostSchedule; ///< Heap of the ghosts waiting to be written, ordered by priority per bit.
+    ///
+    /// The heap is kept from one packet to the next; only ghosts whose priority
+    /// is re-evaluated move within it.
+    U32 mGhostScheduleSequence;        ///< Packets written since every scheduled priority was last re-evaluated.
+    Point3F mGhostScheduleCameraPos;   ///< Camera position when every scheduled priority was last re-evaluated.
+    F32 mGhostScheduleVisibleDistance; ///< Camera visible distance when every scheduled priority was last re-evaluated.
 
     /// The object around which we are scoping this connection.
     ///
@@ -862,6 +869,9 @@ public:
     /// Move a GhostInfo into the zero portion of the list (so that we know not to update it).
     void ghostPushToZero(GhostInfo *gi);
 
+    /// Remove a GhostInfo from the update schedule.
+    void ghostUnschedule(GhostInfo *gi);
+
     /// Move a GhostInfo from the zero portion of the list to the free portion.
     void ghostPushZeroToFree(GhostInfo *gi);
 
@@ -1037,6 +1047,11 @@ public:  // required for MSVC
     U32 flags;                             ///< Flags from GhostInfo::Flags
     F32 priority;                          ///< A float value indicating the priority of this object for
     ///  updates.
+    F32 updateBits;                        ///< Running average of the bits an update of this object takes;
+    ///  packets are filled by priority per bit.
+    F32 scheduleKey;                       ///< Priority per bit when last evaluated, offset by the packet
+    ///  sequence so that waiting ghosts age without being re-evaluated.
+    S32 scheduleIndex;                     ///< Position in the connection's update schedule, or -1 if not scheduled.
 
     /// @name References
     ///
@@ -1069,6 +1084,7 @@ public:  // required for MSVC
         KillingGhost      = BIT(6),
         ScopedEvent       = BIT(7),
         ScopeLocalAlways  = BIT(8),
+        PriorityDirty     = BIT(9),
     };
 };
 
@@ -1091,6 +1107,8 @@ inline void NetConnection::ghostPushToZero(GhostInfo *info)
 {
     AssertFatal(info->arrayIndex < mGhostZeroUpdateIndex, "Out of range arrayIndex.");
     AssertFatal(mGhostArray[info->arrayIndex] == info, "Invalid array object.");
+    if(info->scheduleIndex >= 0)
+        ghostUnschedule(info);
     mGhostZeroUpdateIndex--;
     if(info->arrayIndex != mGhostZeroUpdateIndex)
     {
@@ -151,6 +151,7 @@ void NetConnection::setGhostFrom(bool ghostFrom)
          mGhostRefs[i].obj = NULL;
          mGhostRefs[i].index = i;
          mGhostRefs[i].updateMask = 0;
+         mGhostRefs[i].scheduleIndex = -1;
       }
       mGhostLookupTable = new GhostInfo *[GhostLookupTableSize];
       for(i = 0; i < GhostLookupTableSize; i++)
@@ -201,6 +202,7 @@ void NetConnection::ghostPacketDropped(PacketNotify *notify)
          }
          else
             packRef->ghost->updateMask |= orFlags;
+         packRef->ghost->flags |= GhostInfo::PriorityDirty;
       }
 
       // if this packet was ghosting an object, set it
@@ -262,22 +264,88 @@ void NetConnection::ghostPacketReceived(PacketNotify *notify)
    }
 }
 
-struct UpdateQueueEntry
+/// Size assumed for a ghost update before one has been written.
+static const F32 GhostUpdateBitEstimate = 64.0f;
+
+/// Number of updates too large for the rest of the packet that are passed over
+/// looking for smaller ones before the packet is considered full.
+static const S32 MaxDeferredGhostUpdates = 8;
+
+/// Aging added to the score of every scheduled ghost for each packet it waits;
+/// the skip count priority of a typical update spread over its bits.
+static const F32 GhostSkipScore = 0.1f / GhostUpdateBitEstimate;
+
+/// Packets after which every scheduled priority is re-evaluated, so the
+/// sequence offset in the schedule keys stays small.
+static const U32 GhostScheduleRebaseInterval = 1024;
+
+/// Fraction of the visible distance the camera may move before every scheduled
+/// priority is re-evaluated.
+static const F32 GhostScheduleCameraTolerance = 0.125f;
+
+static void ghostHeapSiftDown(GhostInfo **heap, S32 count, S32 index)
 {
-   F32 priority;
-   GhostInfo *obj;
+   GhostInfo *ghost = heap[index];
+   const F32 key = ghost->scheduleKey;
 
-   UpdateQueueEntry(F32 in_priority, GhostInfo *in_obj)
-      { priority = in_priority; obj = in_obj; }
-};
+   for(;;)
+   {
+      S32 child = (index << 1) + 1;
+      if(child >= count)
+         break;
+      if(child + 1 < count && heap[child + 1]->scheduleKey > heap[child]->scheduleKey)
+         child++;
+      if(heap[child]->scheduleKey <= key)
+         break;
+      heap[index] = heap[child];
+      heap[index]->scheduleIndex = index;
+      index = child;
+   }
+   heap[index] = ghost;
+   ghost->scheduleIndex = index;
+}
 
-static S32 QSORT_CALLBACK UQECompare(const void *a,const void *b)
+static void ghostHeapSiftUp(GhostInfo **heap, S32 index)
 {
-   GhostInfo *ga = *((GhostInfo **) a);
-   GhostInfo *gb = *((GhostInfo **) b);
+   GhostInfo *ghost = heap[index];
+   const F32 key = ghost->scheduleKey;
 
-   F32 ret = ga->priority - gb->priority;
-   return (ret < 0) ? -1 : ((ret > 0) ? 1 : 0);
+   while(index > 0)
+   {
+      S32 parent = (index - 1) >> 1;
+      if(heap[parent]->scheduleKey >= key)
+         break;
+      heap[index] = heap[parent];
+      heap[index]->scheduleIndex = index;
+      index = parent;
+   }
+   heap[index] = ghost;
+   ghost->scheduleIndex = index;
+}
+
+static void ghostHeapPush(Vector<GhostInfo *> &heap, GhostInfo *ghost)
+{
+   heap.push_back(ghost);
+   ghostHeapSiftUp(heap.address(), heap.size() - 1);
+}
+
+void NetConnection::ghostUnschedule(GhostInfo *ghost)
+{
+   const S32 index = ghost->scheduleIndex;
+   AssertFatal(index >= 0 && index < mGhostSchedule.size() && mGhostSchedule[index] == ghost, "Ghost is not scheduled.");
+
+   ghost->scheduleIndex = -1;
+   GhostInfo *last = mGhostSchedule.last();
+   mGhostSchedule.pop_back();
+   if(last == ghost)
+      return;
+
+   // move the last ghost into the hole and restore the heap around it.
+   mGhostSchedule[index] = last;
+   last->scheduleIndex = index;
+   ghostHeapSiftUp(mGhostSchedule.address(), index);
+   if(mGhostSchedule[index] == last)
+      ghostHeapSiftDown(mGhostSchedule.address(), mGhostSchedule.size(), index);
 }
 
 void NetConnection::ghostWritePacket(BitStream *bstream, PacketNotify *notify)
@@ -302,8 +370,12 @@ void NetConnection::ghostWritePacket(BitStream *bstream, PacketNotify *notify)
    //    scope and if any have gone out.
    // 2. call scoped objects' priority functions if the flag set is nonzero
    //    A removed ghost is assumed to have a high priority
-   // 3. call updates based on sorted priority until the packet is
+   // 3. call updates in order of priority per bit until the packet is
    //    full.  set flags to zero for all updated objects
+   //
+   // Rather than sorting every ghost, the ones waiting for an update are
+   // kept in a heap from packet to packet and only as many as fit in the
+   // packet are popped off.
 
    CameraScopeQuery camInfo;
 
@@ -338,6 +410,23 @@ void NetConnection::ghostWritePacket(BitStream *bstream, PacketNotify *notify)
          detachObject(mGhostArray[i]);
    }
 
+   // priorities are only re-evaluated for ghosts that changed or have just
+   // become waiting for an update; the rest keep their place in the schedule
+   // and age together.  when the camera moves far enough to change how near
+   // things are, or the sequence offset grows large, everything is redone.
+   const Point3F cameraOffset = camInfo.pos - mGhostScheduleCameraPos;
+   const F32 cameraTolerance = camInfo.visibleDistance * GhostScheduleCameraTolerance;
+   const bool rescheduleAll = ++mGhostScheduleSequence >= GhostScheduleRebaseInterval ||
+                              camInfo.visibleDistance != mGhostScheduleVisibleDistance ||
+                              cameraOffset.lenSquared() > cameraTolerance * cameraTolerance;
+   if(rescheduleAll)
+   {
+      mGhostScheduleSequence = 0;
+      mGhostScheduleCameraPos = camInfo.pos;
+      mGhostScheduleVisibleDistance = camInfo.visibleDistance;
+   }
+   const F32 sequenceScore = F32(mGhostScheduleSequence) * GhostSkipScore;
+
    for(i = mGhostZeroUpdateIndex - 1; i >= 0; i--)
    {
       walk = mGhostArray[i];
@@ -354,20 +443,49 @@ void NetConnection::ghostWritePacket(BitStream *bstream, PacketNotify *notify)
       // or in the process of ghosting
       else if(!(walk->flags & (GhostInfo::KillingGhost | GhostInfo::Ghosting)))
       {
+         if(!rescheduleAll && walk->scheduleIndex >= 0 && !(walk->flags & GhostInfo::PriorityDirty))
+            continue;
+
          if(walk->flags & GhostInfo::KillGhost)
             walk->priority = 10000;
          else
             walk->priority = walk->obj->getUpdatePriority(&camInfo, walk->updateMask, walk->updateSkipCount);
+         walk->flags &= ~GhostInfo::PriorityDirty;
+         walk->scheduleKey = walk->priority / walk->updateBits - sequenceScore;
+
+         if(rescheduleAll)
+         {
+            // the whole heap is rebuilt below.
+            if(walk->scheduleIndex < 0)
+            {
+               walk->scheduleIndex = mGhostSchedule.size();
+               mGhostSchedule.push_back(walk);
+            }
+         }
+         else if(walk->scheduleIndex < 0)
+            ghostHeapPush(mGhostSchedule, walk);
+         else
+         {
+            const S32 index = walk->scheduleIndex;
+            ghostHeapSiftUp(mGhostSchedule.address(), index);
+            if(mGhostSchedule[index] == walk)
+               ghostHeapSiftDown(mGhostSchedule.address(), mGhostSchedule.size(), index);
+         }
       }
       else
+      {
          walk->priority = 0;
+         if(walk->scheduleIndex >= 0)
+            ghostUnschedule(walk);
+      }
    }
    GhostRef *updateList = NULL;
-   dQsort(mGhostArray, mGhostZeroUpdateIndex, sizeof(GhostInfo *), UQECompare);
 
-   // reset the array indices...
-   for(i = mGhostZeroUpdateIndex - 1; i >= 0; i--)
-      mGhostArray[i]->arrayIndex = i;
+   if(rescheduleAll)
+   {
+      for(i = (mGhostSchedule.size() >> 1) - 1; i >= 0; i--)
+         ghostHeapSiftDown(mGhostSchedule.address(), mGhostSchedule.size(), i);
+   }
 
    S32 sendSize = 1;
    while(maxIndex >>= 1)
@@ -379,13 +497,25 @@ void NetConnection::ghostWritePacket(BitStream *bstream, PacketNotify *notify)
    bstream->writeInt(sendSize - 3, GhostIndexBitSize);
 
    U32 count = 0;
-   //
-   for(i = mGhostZeroUpdateIndex - 1; i >= 0 && !bstream->isFull(); i--)
+   S32 deferred = 0;
+   GhostInfo *deferredGhosts[MaxDeferredGhostUpdates];
+   while(mGhostSchedule.size() && !bstream->isFull())
    {
-      GhostInfo *walk = mGhostArray[i];
-        if(walk->flags & (GhostInfo::KillingGhost | GhostInfo::Ghosting))
-           continue;
-        
+      GhostInfo *walk = mGhostSchedule[0];
+      ghostUnschedule(walk);
+
+      // leave updates that won't fit in the rest of the packet for the next
+      // one and try smaller ones instead.  they go back in the schedule
+      // afterwards and keep aging, so they'll come to the top.
+      if(count && walk->updateBits > (F32)bstream->getBitSpaceAvailable())
+      {
+         deferredGhosts[deferred] = walk;
+         if(++deferred == MaxDeferredGhostUpdates)
+            break;
+         continue;
+      }
+
+      const S32 startPos = bstream->getCurPos();
       bstream->writeFlag(true);
 
       bstream->writeInt(walk->index, sendSize);
@@ -450,9 +580,13 @@ void NetConnection::ghostWritePacket(BitStream *bstream, PacketNotify *notify)
          bstream->writeInt(walk->index ^ DebugChecksum, 32);
 #endif
       }
+      walk->updateBits += ((F32)(bstream->getCurPos() - startPos) - walk->updateBits) * 0.25f;
       walk->updateSkipCount = 0;
       count++;
    }
+   for(i = 0; i < deferred; i++)
+      ghostHeapPush(mGhostSchedule, deferredGhosts[i]);
+
    //Con::printf("Ghosts updated: %d (%d remain)", count, mGhostZeroUpdateIndex);
    // no more objects...
    bstream->writeFlag(false);
@@ -579,7 +713,7 @@ void NetConnection::setScopeObject(NetObject *obj)
 void NetConnection::detachObject(GhostInfo *info)
 {
    // mark it for ghost killin'
-   info->flags |= GhostInfo::KillGhost;
+   info->flags |= GhostInfo::KillGhost | GhostInfo::PriorityDirty;
 
    // if the mask is in the zero range, we've got to move it up...
    if(!info->updateMask)
@@ -716,6 +850,7 @@ void NetConnection::objectInScope(NetObject *obj)
    giptr->obj = obj;
    giptr->updateChain = NULL;
    giptr->updateSkipCount = 0;
+   giptr->updateBits = GhostUpdateBitEstimate;
 
    giptr->connection = this;
 
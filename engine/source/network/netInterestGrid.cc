@@ -0,0 +1,223 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "network/netInterestGrid.h"
+#include "network/netConnection.h"
+#include "network/netObject.h"
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+NetInterestGrid::NetInterestGrid(F32 cellSize)
+{
+   mFreeProxy = InvalidProxy;
+   mProxyCount = 0;
+   reset(cellSize);
+}
+
+void NetInterestGrid::reset(F32 cellSize)
+{
+   AssertFatal(cellSize > 0.0f, "NetInterestGrid::reset - Cell size must be greater than zero.");
+
+   clear();
+   mCellSize = cellSize;
+   mInverseCellSize = 1.0f / cellSize;
+}
+
+void NetInterestGrid::clear()
+{
+   mProxies.clear();
+   mFreeProxy = InvalidProxy;
+   mProxyCount = 0;
+   mMaxRadius = 0.0f;
+
+   for(U32 i = 0; i < BucketCount; i++)
+      mBuckets[i].clear();
+}
+
+//-----------------------------------------------------------------------------
+
+S32 NetInterestGrid::addObject(NetObject *obj, const Point2F &pos, F32 radius)
+{
+   AssertFatal(obj != NULL, "NetInterestGrid::addObject - Cannot add a NULL object.");
+
+   // Reuse a free proxy if there is one.
+   S32 proxyId = mFreeProxy;
+   if(proxyId != InvalidProxy)
+      mFreeProxy = mProxies[proxyId].bucketSlot;
+   else
+   {
+      proxyId = mProxies.size();
+      mProxies.increment();
+   }
+
+   Proxy &proxy = mProxies[proxyId];
+   proxy.obj = obj;
+   proxy.pos = pos;
+   proxy.radius = radius;
+   proxy.cellX = getCell(pos.x);
+   proxy.cellY = getCell(pos.y);
+   insertProxy(proxyId);
+
+   if(radius > mMaxRadius)
+      mMaxRadius = radius;
+
+   mProxyCount++;
+   return proxyId;
+}
+
+void NetInterestGrid::moveObject(S32 proxyId, const Point2F &pos, F32 radius)
+{
+   AssertFatal(proxyId >= 0 && proxyId < mProxies.size() && mProxies[proxyId].obj != NULL, "NetInterestGrid::moveObject - Invalid proxy.");
+
+   Proxy &proxy = mProxies[proxyId];
+   proxy.pos = pos;
+   proxy.radius = radius;
+
+   if(radius > mMaxRadius)
+      mMaxRadius = radius;
+
+   // Only rebucket the proxy if it changed cell.
+   const S32 cellX = getCell(pos.x);
+   const S32 cellY = getCell(pos.y);
+   if(cellX == proxy.cellX && cellY == proxy.cellY)
+      return;
+
+   unlinkProxy(proxyId);
+   proxy.cellX = cellX;
+   proxy.cellY = cellY;
+   insertProxy(proxyId);
+}
+
+void NetInterestGrid::removeObject(S32 proxyId)
+{
+   AssertFatal(proxyId >= 0 && proxyId < mProxies.size() && mProxies[proxyId].obj != NULL, "NetInterestGrid::removeObject - Invalid proxy.");
+
+   unlinkProxy(proxyId);
+
+   // Put the proxy on the free list.
+   Proxy &proxy = mProxies[proxyId];
+   proxy.obj = NULL;
+   proxy.bucketSlot = mFreeProxy;
+   mFreeProxy = proxyId;
+
+   mProxyCount--;
+}
+
+//-----------------------------------------------------------------------------
+
+void NetInterestGrid::insertProxy(S32 proxyId)
+{
+   Proxy &proxy = mProxies[proxyId];
+   Vector<S32> &bucket = mBuckets[getBucket(proxy.cellX, proxy.cellY)];
+   proxy.bucketSlot = bucket.size();
+   bucket.push_back(proxyId);
+}
+
+void NetInterestGrid::unlinkProxy(S32 proxyId)
+{
+   Proxy &proxy = mProxies[proxyId];
+   Vector<S32> &bucket = mBuckets[getBucket(proxy.cellX, proxy.cellY)];
+   AssertFatal(bucket[proxy.bucketSlot] == proxyId, "NetInterestGrid::unlinkProxy - Proxy is not in its bucket.");
+
+   // Move the last proxy in the bucket into the slot.
+   bucket.erase_fast(proxy.bucketSlot);
+   if(proxy.bucketSlot < bucket.size())
+      mProxies[bucket[proxy.bucketSlot]].bucketSlot = proxy.bucketSlot;
+}
+
+bool NetInterestGrid::isInRange(const Proxy &proxy, const Point2F &center, F32 distance) const
+{
+   const F32 range = distance + proxy.radius;
+   const F32 dx = proxy.pos.x - center.x;
+   const F32 dy = proxy.pos.y - center.y;
+   return dx * dx + dy * dy <= range * range;
+}
+
+//-----------------------------------------------------------------------------
+
+void NetInterestGrid::findObjects(const Point2F &center, F32 distance, Vector<NetObject *> &results, U32 maxResults) const
+{
+   PROFILE_SCOPE(NetInterestGrid_FindObjects);
+
+   if(!mProxyCount || !maxResults)
+      return;
+
+   U32 found = 0;
+
+   // Widen the search so that objects centered outside it but reaching into it are found.
+   const F32 reach = distance + mMaxRadius;
+   const S32 lowerX = getCell(center.x - reach);
+   const S32 lowerY = getCell(center.y - reach);
+   const S32 upperX = getCell(center.x + reach);
+   const S32 upperY = getCell(center.y + reach);
+
+   // If the search covers more cells than there are buckets, it's cheaper to walk the proxies.
+   const F64 cellCount = F64(upperX - lowerX + 1) * F64(upperY - lowerY + 1);
+   if(cellCount > (F64)BucketCount)
+   {
+      for(S32 i = 0; i < mProxies.size(); i++)
+      {
+         const Proxy &proxy = mProxies[i];
+         if(proxy.obj && isInRange(proxy, center, distance))
+         {
+            results.push_back(proxy.obj);
+            if(++found == maxResults)
+               return;
+         }
+      }
+      return;
+   }
+
+   for(S32 cellY = lowerY; cellY <= upperY; cellY++)
+   {
+      for(S32 cellX = lowerX; cellX <= upperX; cellX++)
+      {
+         const Vector<S32> &bucket = mBuckets[getBucket(cellX, cellY)];
+         for(S32 i = 0; i < bucket.size(); i++)
+         {
+            // Buckets are shared between cells so check the proxy is in this one.
+            const Proxy &proxy = mProxies[bucket[i]];
+            if(proxy.cellX != cellX || proxy.cellY != cellY || !isInRange(proxy, center, distance))
+               continue;
+
+            results.push_back(proxy.obj);
+            if(++found == maxResults)
+               return;
+         }
+      }
+   }
+}
+
+U32 NetInterestGrid::scopeObjects(NetConnection *cr, const Point2F &center, F32 distance, U32 maxObjects) const
+{
+   PROFILE_SCOPE(NetInterestGrid_ScopeObjects);
+
+   static Vector<NetObject *> objects;
+   objects.clear();
+   findObjects(center, distance, objects, maxObjects);
+
+   for(S32 i = 0; i < objects.size(); i++)
+      cr->objectInScope(objects[i]);
+
+   return objects.size();
+}
@@ -0,0 +1,121 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _NETINTERESTGRID_H_
+#define _NETINTERESTGRID_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+#ifndef _TVECTOR_H_
+#include "collection/vector.h"
+#endif
+#ifndef _MPOINT_H_
+#include "math/mPoint.h"
+#endif
+#ifndef _MMATHFN_H_
+#include "math/mMathFn.h"
+#endif
+
+class NetObject;
+class NetConnection;
+
+//-----------------------------------------------------------------------------
+/// Spatial index used to decide which objects are of interest to a connection.
+///
+/// Objects are entered with a position and radius and bucketed by the grid cell
+/// their position falls in.  A scope object queries the cells around its camera
+/// to build the visibility set for its connection (see scopeObjects()) instead of
+/// testing every ghostable object against every connection.
+///
+/// Proxy ids are stable for the lifetime of the proxy; moving an object only
+/// touches the buckets when it crosses into another cell.
+class NetInterestGrid
+{
+public:
+   enum Constants
+   {
+      DefaultCellSize = 32,
+      BucketCount = 1024,         ///< Must be a power of two.
+      InvalidProxy = -1,
+   };
+
+   NetInterestGrid(F32 cellSize = (F32)DefaultCellSize);
+
+   /// Remove all proxies and set the cell size.
+   void reset(F32 cellSize);
+   void clear();
+
+   /// @name Proxies
+   /// @{
+
+   /// Enter an object.  Returns the proxy id used to move and remove it.
+   S32  addObject(NetObject *obj, const Point2F &pos, F32 radius);
+   void moveObject(S32 proxyId, const Point2F &pos, F32 radius);
+   void removeObject(S32 proxyId);
+   U32  getObjectCount() const { return mProxyCount; }
+   /// @}
+
+   /// @name Queries
+   /// @{
+
+   /// Find the objects whose bounding circle is within distance of the center.
+   ///
+   /// @param  results     The objects found are appended here.
+   /// @param  maxResults  Stop after this many objects have been found.
+   void findObjects(const Point2F &center, F32 distance, Vector<NetObject *> &results, U32 maxResults = U32_MAX) const;
+
+   /// Scope the objects within distance of the center on a connection.
+   ///
+   /// @returns The number of objects scoped.
+   U32  scopeObjects(NetConnection *cr, const Point2F &center, F32 distance, U32 maxObjects = U32_MAX) const;
+   /// @}
+
+private:
+   struct Proxy
+   {
+      NetObject *obj;
+      Point2F pos;
+      F32 radius;
+      S32 cellX;
+      S32 cellY;
+      S32 bucketSlot;         ///< Index in the bucket, or the next free proxy when unused.
+   };
+
+   S32  getCell(F32 value) const { return (S32)mFloor(value * mInverseCellSize); }
+   U32  getBucket(S32 cellX, S32 cellY) const { return ((U32)cellX * 73856093U ^ (U32)cellY * 19349663U) & (BucketCount - 1); }
+   void insertProxy(S32 proxyId);
+   void unlinkProxy(S32 proxyId);
+   bool isInRange(const Proxy &proxy, const Point2F &center, F32 distance) const;
+
+   F32 mCellSize;
+   F32 mInverseCellSize;
+   F32 mMaxRadius;               ///< Largest radius entered; queries are widened by it.
+
+   Vector<Proxy> mProxies;
+   S32 mFreeProxy;
+   U32 mProxyCount;
+
+   Vector<S32> mBuckets[BucketCount];
+};
+
+#endif
@@ -130,6 +130,7 @@ void NetObject::collapseDirtyList()
             }
             else
                walk->updateMask |= orMask;
+            walk->flags |= GhostInfo::PriorityDirty;
          }
       }
       obj = next;
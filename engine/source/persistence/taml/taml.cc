@@ -221,6 +221,36 @@ SimObject* Taml::read( const char* pFilename )
     // Expand the file-name into the file-path buffer.
     Con::expandPath( mFilePathBuffer, sizeof(mFilePathBuffer), pFilename );
 
+    // Get the file auto-format mode.
+    const TamlFormatMode formatMode = getFileAutoFormatMode( mFilePathBuffer );
+
+    // Is the file binary?
+    if ( formatMode == BinaryFormat )
+    {
+        // Yes, so map the file.
+        U32 mappedSize = 0;
+        void* pMapping = Platform::mapFile( mFilePathBuffer, mappedSize );
+
+        // Did we map the file?
+        if ( pMapping != NULL )
+        {
+            // Yes, so read object from the mapping.
+            SimObject* pSimObject = read( (const U8*)pMapping, mappedSize );
+
+            // Unmap file.
+            Platform::unmapFile( pMapping, mappedSize );
+
+            // Did we generate an object?
+            if ( pSimObject == NULL )
+            {
+                // No, so warn.
+                Con::warnf( "Taml::read() - Failed to load an object from the file '%s'.", mFilePathBuffer );
+            }
+
+            return pSimObject;
+        }
+    }
+
     FileStream stream;
 
     // File opened?
@@ -231,9 +261,6 @@ SimObject* Taml::read( const char* pFilename )
         return NULL;
     }
 
-    // Get the file auto-format mode.
-    const TamlFormatMode formatMode = getFileAutoFormatMode( mFilePathBuffer );
-
     // Reset the compilation.
     resetCompilation();
 
@@ -258,7 +285,49 @@ SimObject* Taml::read( const char* pFilename )
 
 //-----------------------------------------------------------------------------
 
-bool Taml::write( FileStream& stream, SimObject* pSimObject, const TamlFormatMode formatMode )
+bool Taml::write( SimObject* pSimObject, Stream& stream, const TamlFormatMode formatMode )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Taml_WriteStream);
+
+    // Reset the compilation.
+    resetCompilation();
+
+    // Write object.
+    const bool status = write( stream, pSimObject, formatMode );
+
+    // Reset the compilation.
+    resetCompilation();
+
+    return status;
+}
+
+//-----------------------------------------------------------------------------
+
+SimObject* Taml::read( const U8* pBuffer, const U32 bufferSize )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Taml_ReadBuffer);
+
+    // Sanity!
+    AssertFatal( pBuffer != NULL, "Cannot read from a NULL buffer." );
+
+    // Reset the compilation.
+    resetCompilation();
+
+    // Read object from the buffer.
+    TamlBinaryReader reader( this );
+    SimObject* pSimObject = reader.read( pBuffer, bufferSize );
+
+    // Reset the compilation.
+    resetCompilation();
+
+    return pSimObject;
+}
+
+//-----------------------------------------------------------------------------
+
+bool Taml::write( Stream& stream, SimObject* pSimObject, const TamlFormatMode formatMode )
 {
     // Sanity!
     AssertFatal( pSimObject != NULL, "Cannot write a NULL object." );
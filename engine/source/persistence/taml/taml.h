@@ -60,6 +60,7 @@ extern StringTableEntry tamlNamedObjectName;
 //-----------------------------------------------------------------------------
 
 #define TAML_SIGNATURE                  "Taml"
+#define TAML_BINARY_STRINGTABLE_VERSION 3
 #define TAML_SCHEMA_VARIABLE            "$pref::T2D::TAMLSchema"
 
 //-----------------------------------------------------------------------------
@@ -113,7 +114,7 @@ private:
     void compileCustomState( TamlWriteNode* pTamlWriteNode );
     void compileCustomNodeState( TamlCustomNode* pCustomNode );
 
-    bool write( FileStream& stream, SimObject* pSimObject, const TamlFormatMode formatMode );
+    bool write( Stream& stream, SimObject* pSimObject, const TamlFormatMode formatMode );
     SimObject* read( FileStream& stream, const TamlFormatMode formatMode );
     template<typename T> inline T* read( FileStream& stream, const TamlFormatMode formatMode )
     {
@@ -177,6 +178,7 @@ public:
 
     /// Write.
     bool write( SimObject* pSimObject, const char* pFilename );
+    bool write( SimObject* pSimObject, Stream& stream, const TamlFormatMode formatMode );
 
     /// Read.
     template<typename T> inline T* read( const char* pFilename )
@@ -192,6 +194,9 @@ public:
     }
     SimObject* read( const char* pFilename );
 
+    /// Read from a binary buffer.
+    SimObject* read( const U8* pBuffer, const U32 bufferSize );
+
     static TamlFormatMode getFormatModeEnum( const char* label );
     static const char* getFormatModeDescription( const TamlFormatMode formatMode );
 
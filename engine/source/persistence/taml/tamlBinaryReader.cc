@@ -22,10 +22,20 @@
 
 #include "persistence/taml/tamlBinaryReader.h"
 
+#ifndef _TAML_BINARYWRITER_H_
+#include "persistence/taml/tamlBinaryWriter.h"
+#endif
+
 #ifndef _ZIPSUBSTREAM_H_
 #include "io/zip/zipSubStream.h"
 #endif
 
+#ifndef _MEMSTREAM_H_
+#include "io/memstream.h"
+#endif
+
+#include "zlib.h"
+
 // Debug Profiling.
 #include "debug/profiler.h"
 
@@ -36,6 +46,36 @@ SimObject* TamlBinaryReader::read( FileStream& stream )
     // Debug Profiling.
     PROFILE_SCOPE(TamlBinaryReader_Read);
 
+    return readStream( stream, NULL );
+}
+
+//-----------------------------------------------------------------------------
+
+SimObject* TamlBinaryReader::read( const U8* pBuffer, const U32 bufferSize )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryReader_ReadBuffer);
+
+    // Sanity!
+    AssertFatal( pBuffer != NULL, "Taml: Cannot read from a NULL buffer." );
+
+    // Finish if the buffer is empty.
+    if ( bufferSize == 0 )
+    {
+        // Warn.
+        Con::warnf("Taml: Cannot read binary data from an empty buffer." );
+        return NULL;
+    }
+
+    // Read through a stream over the buffer.
+    MemStream stream( bufferSize, (void*)pBuffer, true, false );
+    return readStream( stream, pBuffer );
+}
+
+//-----------------------------------------------------------------------------
+
+SimObject* TamlBinaryReader::readStream( Stream& stream, const U8* pStreamBuffer )
+{
     // Read Taml signature.
     StringTableEntry tamlSignature = stream.readSTString();
 
@@ -51,10 +91,25 @@ SimObject* TamlBinaryReader::read( FileStream& stream )
     U32 versionId;
     stream.read( &versionId );
 
+    // Is the version known?
+    if ( versionId > TAML_BINARY_STRINGTABLE_VERSION )
+    {
+        // No, so warn.
+        Con::warnf("Taml: Cannot read binary file as version '%d' is unknown.", versionId );
+        return NULL;
+    }
+
     // Read compressed flag.
     bool compressed;
     stream.read( &compressed );
 
+    // Does the version use a string table?
+    if ( versionId >= TAML_BINARY_STRINGTABLE_VERSION )
+    {
+        // Yes, so read the payload.
+        return readPayload( stream, pStreamBuffer, compressed );
+    }
+
     SimObject* pSimObject = NULL;
 
     // Is the stream compressed?
@@ -81,6 +136,143 @@ SimObject* TamlBinaryReader::read( FileStream& stream )
 
 //-----------------------------------------------------------------------------
 
+SimObject* TamlBinaryReader::readPayload( Stream& stream, const U8* pStreamBuffer, const bool compressed )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryReader_ReadPayload);
+
+    // Read payload size.
+    U32 payloadSize;
+    stream.read( &payloadSize );
+
+    const U8* pPayload = NULL;
+
+    // Is the payload compressed?
+    if ( compressed )
+    {
+        // Yes, so read compressed size.
+        U32 compressedSize;
+        stream.read( &compressedSize );
+
+        // Finish if the compressed payload is truncated.
+        if ( stream.getStatus() != Stream::Ok || compressedSize > stream.getStreamSize() - stream.getPosition() )
+        {
+            // Warn.
+            Con::warnf("Taml: Cannot read binary file as the compressed payload is truncated." );
+            return NULL;
+        }
+
+        // Finish if the payload could not have been compressed to that size.
+        // NOTE: This stops a corrupt payload size from allocating an arbitrary amount of memory.
+        if ( payloadSize > MaxPayloadSize || (U64)payloadSize > (U64)compressedSize * MaxDeflateRatio )
+        {
+            // Warn.
+            Con::warnf("Taml: Cannot read binary file as the payload size '%u' is invalid.", payloadSize );
+            return NULL;
+        }
+
+        const U8* pCompressed = NULL;
+        Vector<U8> compressedBuffer;
+
+        // Do we have the stream buffer?
+        if ( pStreamBuffer != NULL )
+        {
+            // Yes, so use the compressed data in-place.
+            pCompressed = pStreamBuffer + stream.getPosition();
+        }
+        else
+        {
+            // No, so read the compressed data.
+            compressedBuffer.setSize( compressedSize );
+            if ( !stream.read( compressedSize, compressedBuffer.address() ) )
+            {
+                // Warn.
+                Con::warnf("Taml: Cannot read binary file as the compressed payload is truncated." );
+                return NULL;
+            }
+
+            pCompressed = compressedBuffer.address();
+        }
+
+        // Decompress the payload in a single pass.
+        mPayloadBuffer.setSize( payloadSize );
+        uLongf decompressedSize = payloadSize;
+        if ( uncompress( mPayloadBuffer.address(), &decompressedSize, pCompressed, compressedSize ) != Z_OK || decompressedSize != payloadSize )
+        {
+            // Warn.
+            Con::warnf("Taml: Cannot read binary file as the payload failed to decompress." );
+            mPayloadBuffer.clear();
+            return NULL;
+        }
+
+        pPayload = mPayloadBuffer.address();
+    }
+    else
+    {
+        // No, so finish if the payload is truncated.
+        if ( stream.getStatus() != Stream::Ok || payloadSize > stream.getStreamSize() - stream.getPosition() )
+        {
+            // Warn.
+            Con::warnf("Taml: Cannot read binary file as the payload is truncated." );
+            return NULL;
+        }
+
+        // Do we have the stream buffer?
+        if ( pStreamBuffer != NULL )
+        {
+            // Yes, so use the payload in-place.
+            pPayload = pStreamBuffer + stream.getPosition();
+        }
+        else
+        {
+            // No, so read the payload.
+            mPayloadBuffer.setSize( payloadSize );
+            if ( !stream.read( payloadSize, mPayloadBuffer.address() ) )
+            {
+                // Warn.
+                Con::warnf("Taml: Cannot read binary file as the payload is truncated." );
+                mPayloadBuffer.clear();
+                return NULL;
+            }
+
+            pPayload = mPayloadBuffer.address();
+        }
+    }
+
+    // Set the payload cursor.
+    mpCursorStart = mpCursor = pPayload;
+    mpCursorEnd = pPayload + payloadSize;
+    mCursorError = false;
+
+    // Parse the string table.
+    if ( !parseStringTable() )
+    {
+        // Warn.
+        Con::warnf("Taml: Cannot read binary file as the string table is invalid." );
+        return NULL;
+    }
+
+    // Parse element.
+    SimObject* pSimObject = parseElement( TAML_BINARY_STRINGTABLE_VERSION );
+
+    // Warn if the payload was invalid.
+    if ( mCursorError )
+    {
+        Con::warnf("Taml: Binary file payload is truncated or invalid." );
+    }
+
+    // Reset the payload state.
+    // NOTE: Strings may refer to the buffer so they cannot outlive it.
+    mpCursorStart = mpCursor = mpCursorEnd = NULL;
+    mStrings.clear();
+    mStringEntries.clear();
+    mPayloadBuffer.clear();
+
+    return pSimObject;
+}
+
+//-----------------------------------------------------------------------------
+
 void TamlBinaryReader::resetParse( void )
 {
     // Debug Profiling.
@@ -92,6 +284,91 @@ void TamlBinaryReader::resetParse( void )
 
 //-----------------------------------------------------------------------------
 
+SimObject* TamlBinaryReader::findReference( const U32 tamlRefToId )
+{
+    // Fetch reference.
+    typeObjectReferenceHash::iterator referenceItr = mObjectReferenceMap.find( tamlRefToId );
+
+    // Did we find the reference?
+    if ( referenceItr == mObjectReferenceMap.end() )
+    {
+        // No, so warn.
+        Con::warnf( "Taml: Could not find a reference Id of '%d'", tamlRefToId );
+        return NULL;
+    }
+
+    // Return object.
+    return referenceItr->value;
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryReader::registerElement( SimObject* pSimObject, StringTableEntry typeName, StringTableEntry objectName, const U32 tamlRefId )
+{
+    // Does the object require a name?
+    if ( objectName == StringTable->EmptyString )
+    {
+        // No, so just register anonymously.
+        pSimObject->registerObject();
+    }
+    else
+    {
+        // Yes, so register a named object.
+        pSimObject->registerObject( objectName );
+
+        // Was the name assigned?
+        if ( pSimObject->getName() != objectName )
+        {
+            // No, so warn that the name was rejected.
+            Con::warnf( "Taml::parseElement() - Registered an instance of type '%s' but a request to name it '%s' was rejected.  This is typically because an object of that name already exists.", typeName, objectName );
+        }
+    }
+
+    // Do we have a reference Id?
+    if ( tamlRefId != 0 )
+    {
+        // Yes, so insert reference.
+        mObjectReferenceMap.insert( tamlRefId, pSimObject );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryReader::addChildElement( SimObject* pSimObject, TamlChildren* pChildren, AbstractClassRep* pContainerChildClass, SimObject* pChildSimObject )
+{
+    // Do we have a container child class?
+    if ( pContainerChildClass != NULL )
+    {
+        // Yes, so is the child object the correctly derived type?
+        if ( !pChildSimObject->getClassRep()->isClass( pContainerChildClass ) )
+        {
+            // No, so warn.
+            Con::warnf("Taml: Child element '%s' found under parent '%s' but object is restricted to children of type '%s'.",
+                pChildSimObject->getClassName(),
+                pSimObject->getClassName(),
+                pContainerChildClass->getClassName() );
+
+            // NOTE: We can't delete the object as it may be referenced elsewhere!
+            return;
+        }
+    }
+
+    // Add child.
+    pChildren->addTamlChild( pChildSimObject );
+
+    // Find Taml callbacks for child.
+    TamlCallbacks* pChildCallbacks = dynamic_cast<TamlCallbacks*>( pChildSimObject );
+
+    // Do we have callbacks on the child?
+    if ( pChildCallbacks != NULL )
+    {
+        // Yes, so perform callback.
+        mpTaml->tamlAddParent( pChildCallbacks, pSimObject );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 SimObject* TamlBinaryReader::parseElement( Stream& stream, const U32 versionId )
 {
     // Debug Profiling.
@@ -120,19 +397,8 @@ SimObject* TamlBinaryReader::parseElement( Stream& stream, const U32 versionId )
     // Do we have a reference to Id?
     if ( tamlRefToId != 0 )
     {
-        // Yes, so fetch reference.
-        typeObjectReferenceHash::iterator referenceItr = mObjectReferenceMap.find( tamlRefToId );
-
-        // Did we find the reference?
-        if ( referenceItr == mObjectReferenceMap.end() )
-        {
-            // No, so warn.
-            Con::warnf( "Taml: Could not find a reference Id of '%d'", tamlRefToId );
-            return NULL;
-        }
-
-        // Return object.
-        return referenceItr->value;
+        // Yes, so return the reference.
+        return findReference( tamlRefToId );
     }
 
 #ifdef TORQUE_DEBUG
@@ -160,35 +426,8 @@ SimObject* TamlBinaryReader::parseElement( Stream& stream, const U32 versionId )
     // Parse attributes.
     parseAttributes( stream, pSimObject, versionId );
 
-    // Does the object require a name?
-    if ( objectName == StringTable->EmptyString )
-    {
-        // No, so just register anonymously.
-        pSimObject->registerObject();
-    }
-    else
-    {
-        // Yes, so register a named object.
-        pSimObject->registerObject( objectName );
-
-        // Was the name assigned?
-        if ( pSimObject->getName() != objectName )
-        {
-            // No, so warn that the name was rejected.
-#ifdef TORQUE_DEBUG
-            Con::warnf( "Taml::parseElement() - Registered an instance of type '%s' but a request to name it '%s' was rejected.  This is typically because an object of that name already exists.  '%s'", typeName, objectName, typeLocationBuffer );
-#else
-            Con::warnf( "Taml::parseElement() - Registered an instance of type '%s' but a request to name it '%s' was rejected.  This is typically because an object of that name already exists.", typeName, objectName );
-#endif
-        }
-    }
-
-    // Do we have a reference Id?
-    if ( tamlRefId != 0 )
-    {
-        // Yes, so insert reference.
-        mObjectReferenceMap.insert( tamlRefId, pSimObject );
-    }
+    // Register the object.
+    registerElement( pSimObject, typeName, objectName, tamlRefId );
 
     // Parse custom elements.
     TamlCustomNodes customProperties;
@@ -284,38 +523,8 @@ void TamlBinaryReader::parseChildren( Stream& stream, TamlCallbacks* pCallbacks,
         if ( pChildSimObject == NULL )
             return;
 
-        // Do we have a container child class?
-        if ( pContainerChildClass != NULL )
-        {
-            // Yes, so is the child object the correctly derived type?
-            if ( !pChildSimObject->getClassRep()->isClass( pContainerChildClass ) )
-            {
-                // No, so warn.
-                Con::warnf("Taml: Child element '%s' found under parent '%s' but object is restricted to children of type '%s'.",
-                    pChildSimObject->getClassName(),
-                    pSimObject->getClassName(),
-                    pContainerChildClass->getClassName() );
-
-                // NOTE: We can't delete the object as it may be referenced elsewhere!
-                pChildSimObject = NULL;
-
-                // Skip.
-                continue;
-            }
-        }
-
         // Add child.
-        pChildren->addTamlChild( pChildSimObject );
-
-        // Find Taml callbacks for child.
-        TamlCallbacks* pChildCallbacks = dynamic_cast<TamlCallbacks*>( pChildSimObject );
-
-        // Do we have callbacks on the child?
-        if ( pChildCallbacks != NULL )
-        {
-            // Yes, so perform callback.
-            mpTaml->tamlAddParent( pChildCallbacks, pSimObject );
-        }
+        addChildElement( pSimObject, pChildren, pContainerChildClass, pChildSimObject );
     }
 }
 
@@ -426,4 +635,398 @@ void TamlBinaryReader::parseCustomNode( Stream& stream, TamlCustomNode* pCustomN
             pChildNode->addField( fieldName, valueBuffer );
         }
     }
-}
\ No newline at end of file
+}
+//-----------------------------------------------------------------------------
+
+const char* TamlBinaryReader::readValue( void )
+{
+    // Read value length.
+    const U32 valueLength = readU32();
+
+    // Finish if the value and its terminator are not available.
+    if ( mCursorError || valueLength >= (U32)(mpCursorEnd - mpCursor) || mpCursor[valueLength] != 0 )
+    {
+        mCursorError = true;
+        return StringTable->EmptyString;
+    }
+
+    // Use the value in-place.
+    const char* pValue = (const char*)mpCursor;
+    mpCursor += valueLength + 1;
+    return pValue;
+}
+
+//-----------------------------------------------------------------------------
+
+StringTableEntry TamlBinaryReader::readStringIndex( void )
+{
+    // Read string index.
+    const U32 stringIndex = readU32();
+
+    // Is the string index valid?
+    if ( stringIndex >= (U32)mStrings.size() )
+    {
+        // No, so flag the error.
+        mCursorError = true;
+        return StringTable->EmptyString;
+    }
+
+    // Insert the string on first use.
+    StringTableEntry& stringEntry = mStringEntries[stringIndex];
+    if ( stringEntry == NULL )
+        stringEntry = StringTable->insert( mStrings[stringIndex] );
+
+    return stringEntry;
+}
+
+//-----------------------------------------------------------------------------
+
+bool TamlBinaryReader::parseStringTable( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryReader_ParseStringTable);
+
+    // Read string count.
+    const U32 stringCount = readU32();
+
+    // Each string needs at least a length and a terminator.
+    if ( mCursorError || stringCount > (U32)(mpCursorEnd - mpCursor) / (sizeof(U32) + 1) )
+        return false;
+
+    // Read strings.
+    mStrings.setSize( stringCount );
+    for ( U32 index = 0; index < stringCount; ++index )
+    {
+        mStrings[index] = readValue();
+    }
+
+    // Strings are inserted into the string table on first use.
+    mStringEntries.setSize( stringCount );
+    if ( stringCount > 0 )
+        dMemset( mStringEntries.address(), 0, mStringEntries.memSize() );
+
+    return !mCursorError;
+}
+
+//-----------------------------------------------------------------------------
+
+SimObject* TamlBinaryReader::parseElement( const U32 versionId )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryReader_ParseElement);
+
+    // Fetch element name.
+    StringTableEntry typeName = readStringIndex();
+
+    // Fetch object name.
+    StringTableEntry objectName = readStringIndex();
+
+    // Read references.
+    const U32 tamlRefId = readU32();
+    const U32 tamlRefToId = readU32();
+
+    // Finish if the payload is invalid.
+    if ( mCursorError )
+        return NULL;
+
+    // Do we have a reference to Id?
+    if ( tamlRefToId != 0 )
+    {
+        // Yes, so return the reference.
+        return findReference( tamlRefToId );
+    }
+
+#ifdef TORQUE_DEBUG
+    // Format the type location.
+    char typeLocationBuffer[64];
+    dSprintf( typeLocationBuffer, sizeof(typeLocationBuffer), "Taml [format='binary' offset=%u]", (U32)(mpCursor - mpCursorStart) );
+
+    // Create type.
+    SimObject* pSimObject = Taml::createType( typeName, mpTaml, typeLocationBuffer );
+#else
+    // Create type.
+    SimObject* pSimObject = Taml::createType( typeName, mpTaml );
+#endif
+
+    // Finish if we couldn't create the type.
+    if ( pSimObject == NULL )
+        return NULL;
+
+    // Find Taml callbacks.
+    TamlCallbacks* pCallbacks = dynamic_cast<TamlCallbacks*>( pSimObject );
+
+    // Are there any Taml callbacks?
+    if ( pCallbacks != NULL )
+    {
+        // Yes, so call it.
+        mpTaml->tamlPreRead( pCallbacks );
+    }
+
+    // Parse attributes.
+    parseAttributes( pSimObject );
+
+    // Register the object.
+    registerElement( pSimObject, typeName, objectName, tamlRefId );
+
+    // Parse custom elements.
+    TamlCustomNodes customProperties;
+
+    // Parse children.
+    parseChildren( pCallbacks, pSimObject, versionId );
+
+    // Parse custom elements.
+    parseCustomElements( pCallbacks, customProperties, versionId );
+
+    // Are there any Taml callbacks?
+    if ( pCallbacks != NULL )
+    {
+        // Yes, so call it.
+        mpTaml->tamlPostRead( pCallbacks, customProperties );
+    }
+
+    // Return object.
+    return pSimObject;
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryReader::parseAttributes( SimObject* pSimObject )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryReader_ParseAttributes);
+
+    // Sanity!
+    AssertFatal( pSimObject != NULL, "Taml: Cannot parse attributes on a NULL object." );
+
+    // Fetch attribute count.
+    const U32 attributeCount = readU32();
+
+    // Iterate attributes.
+    for ( U32 index = 0; index < attributeCount && !mCursorError; ++index )
+    {
+        // Fetch attribute name and value kind.
+        StringTableEntry attributeName = readStringIndex();
+        const TamlBinaryWriter::ValueKind valueKind = (TamlBinaryWriter::ValueKind)readU8();
+
+        // Is the value a string?
+        if ( valueKind == TamlBinaryWriter::StringValue )
+        {
+            // Yes, so set the field using the value in-place.
+            const char* pValue = readValue();
+            if ( !mCursorError )
+                pSimObject->setPrefixedDataField( attributeName, NULL, pValue );
+
+            continue;
+        }
+
+        bool boolValue = false;
+        S32 s32Value = 0;
+        F32 f32Value = 0.0f;
+
+        // Read the native value.
+        switch( valueKind )
+        {
+            case TamlBinaryWriter::BoolValue:   boolValue = readU8() != 0; break;
+            case TamlBinaryWriter::S32Value:    s32Value = (S32)readU32(); break;
+            case TamlBinaryWriter::F32Value:    f32Value = readF32(); break;
+
+            default:
+                // Unknown value kind so the rest of the payload can't be parsed.
+                Con::warnf( "Taml: Unknown value kind '%d' for field '%s'.", (S32)valueKind, attributeName );
+                mCursorError = true;
+                return;
+        }
+
+        if ( mCursorError )
+            return;
+
+        // Fetch the static field.
+        const AbstractClassRep::Field* pField = pSimObject->isModStaticFields() ? pSimObject->findField( attributeName ) : NULL;
+
+        // Can the value be applied directly to the field?
+        // Fields with a setter or validator must go through the usual path.
+        if ( pField != NULL &&
+            TamlBinaryWriter::getFieldValueKind( pField ) == valueKind &&
+            pField->setDataFn == &defaultProtectedSetFn &&
+            pField->validator == NULL )
+        {
+            // Yes, so apply the value.
+            void* pFieldData = (U8*)pSimObject + pField->offset;
+            switch( valueKind )
+            {
+                case TamlBinaryWriter::BoolValue:   *(bool*)pFieldData = boolValue; break;
+                case TamlBinaryWriter::S32Value:    *(S32*)pFieldData = s32Value; break;
+                default:                            *(F32*)pFieldData = f32Value; break;
+            }
+
+            // Notify the modification.
+            pSimObject->onStaticModified( attributeName );
+            continue;
+        }
+
+        // No, so format the value.
+        // NOTE: Floats use enough precision to round-trip exactly.
+        char valueBuffer[32];
+        switch( valueKind )
+        {
+            case TamlBinaryWriter::BoolValue:   dStrcpy( valueBuffer, boolValue ? "1" : "0" ); break;
+            case TamlBinaryWriter::S32Value:    dSprintf( valueBuffer, sizeof(valueBuffer), "%d", s32Value ); break;
+            default:                            dSprintf( valueBuffer, sizeof(valueBuffer), "%.9g", f32Value ); break;
+        }
+
+        // Set the field.
+        pSimObject->setPrefixedDataField( attributeName, NULL, valueBuffer );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryReader::parseChildren( TamlCallbacks* pCallbacks, SimObject* pSimObject, const U32 versionId )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryReader_ParseChildren);
+
+    // Sanity!
+    AssertFatal( pSimObject != NULL, "Taml: Cannot parse children on a NULL object." );
+
+    // Fetch children count.
+    const U32 childrenCount = readU32();
+
+    // Finish if no children.
+    if ( childrenCount == 0 || mCursorError )
+        return;
+
+    // Fetch the Taml children.
+    TamlChildren* pChildren = dynamic_cast<TamlChildren*>( pSimObject );
+
+    // Is this a sim set?
+    if ( pChildren == NULL )
+    {
+        // No, so warn.
+        // NOTE: The children can't be skipped so the rest of the payload is ignored.
+        Con::warnf("Taml: Child element found under parent but object cannot have children." );
+        mCursorError = true;
+        return;
+    }
+
+    // Fetch any container child class specifier.
+    AbstractClassRep* pContainerChildClass = pSimObject->getClassRep()->getContainerChildClass( true );
+
+    // Iterate children.
+    for ( U32 index = 0; index < childrenCount; ++ index )
+    {
+        // Parse child element.
+        SimObject* pChildSimObject = parseElement( versionId );
+
+        // Finish if child failed.
+        if ( pChildSimObject == NULL )
+            return;
+
+        // Add child.
+        addChildElement( pSimObject, pChildren, pContainerChildClass, pChildSimObject );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryReader::parseCustomElements( TamlCallbacks* pCallbacks, TamlCustomNodes& customNodes, const U32 versionId )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryReader_ParseCustomElement);
+
+    // Read custom node count.
+    const U32 customNodeCount = readU32();
+
+    // Finish if no custom nodes.
+    if ( customNodeCount == 0 || mCursorError )
+        return;
+
+    // Iterate custom nodes.
+    for ( U32 nodeIndex = 0; nodeIndex < customNodeCount && !mCursorError; ++nodeIndex )
+    {
+        //Read custom node name.
+        StringTableEntry nodeName = readStringIndex();
+
+        // Add custom node.
+        TamlCustomNode* pCustomNode = customNodes.addNode( nodeName );
+
+        // Read child node count.
+        const U32 childNodeCount = readU32();
+
+        // Parse the custom node children.
+        for ( U32 childIndex = 0; childIndex < childNodeCount && !mCursorError; ++childIndex )
+        {
+            parseCustomNode( pCustomNode, versionId );
+        }
+    }
+
+    // Do we have callbacks?
+    if ( pCallbacks == NULL )
+    {
+        // No, so warn.
+        Con::warnf( "Taml: Encountered custom data but object does not support custom data." );
+        return;
+    }
+
+    // Custom read callback.
+    mpTaml->tamlCustomRead( pCallbacks, customNodes );
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryReader::parseCustomNode( TamlCustomNode* pCustomNode, const U32 versionId )
+{
+    // Fetch if a proxy object.
+    const bool isProxyObject = readU8() != 0;
+
+    // Is this a proxy object?
+    if ( isProxyObject )
+    {
+        // Yes, so parse proxy object.
+        SimObject* pProxyObject = parseElement( versionId );
+
+        // Add child node.
+        if ( pProxyObject != NULL )
+            pCustomNode->addNode( pProxyObject );
+
+        return;
+    }
+
+    // No, so read custom node name.
+    StringTableEntry nodeName = readStringIndex();
+
+    // Read child node text.
+    const char* pNodeText = readValue();
+
+    // Finish if the payload is invalid.
+    if ( mCursorError )
+        return;
+
+    // Add child node.
+    TamlCustomNode* pChildNode = pCustomNode->addNode( nodeName );
+    pChildNode->setNodeText( pNodeText );
+
+    // Read child node count.
+    const U32 childNodeCount = readU32();
+
+    // Parse children nodes.
+    for( U32 childIndex = 0; childIndex < childNodeCount && !mCursorError; ++childIndex )
+    {
+        parseCustomNode( pChildNode, versionId );
+    }
+
+    // Read child field count.
+    const U32 childFieldCount = readU32();
+
+    // Parse child fields.
+    for( U32 childFieldIndex = 0; childFieldIndex < childFieldCount && !mCursorError; ++childFieldIndex )
+    {
+        // Read field name and value.
+        StringTableEntry fieldName = readStringIndex();
+        const char* pFieldValue = readValue();
+
+        // Add field.
+        if ( !mCursorError )
+            pChildNode->addField( fieldName, pFieldValue );
+    }
+}
@@ -35,10 +35,25 @@
 
 class TamlBinaryReader
 {
+public:
+    enum
+    {
+        /// Payloads are rejected if larger than this or than their compressed size allows for.
+        MaxPayloadSize = 256 * 1024 * 1024,
+        MaxDeflateRatio = 1032,
+    };
+
 public:
     TamlBinaryReader( Taml* pTaml ) :
-        mpTaml( pTaml )
+        mpTaml( pTaml ),
+        mpCursorStart( NULL ),
+        mpCursor( NULL ),
+        mpCursorEnd( NULL ),
+        mCursorError( false )
     {
+        VECTOR_SET_ASSOCIATION( mPayloadBuffer );
+        VECTOR_SET_ASSOCIATION( mStrings );
+        VECTOR_SET_ASSOCIATION( mStringEntries );
     }
 
     virtual ~TamlBinaryReader() {}
@@ -46,6 +61,10 @@ public:
     /// Read.
     SimObject* read( FileStream& stream );
 
+    /// Read from a memory buffer such as a mapped file.
+    /// The buffer must remain valid until the read returns.
+    SimObject* read( const U8* pBuffer, const U32 bufferSize );
+
 private:
     Taml*               mpTaml;
 
@@ -53,9 +72,71 @@ private:
 
     typeObjectReferenceHash mObjectReferenceMap;
 
+    /// String table payload state.
+    Vector<U8>          mPayloadBuffer;
+    Vector<const char*> mStrings;
+    Vector<StringTableEntry> mStringEntries;
+    const U8*           mpCursorStart;
+    const U8*           mpCursor;
+    const U8*           mpCursorEnd;
+    bool                mCursorError;
+
 private:
     void resetParse( void );
 
+    SimObject* findReference( const U32 tamlRefToId );
+    void registerElement( SimObject* pSimObject, StringTableEntry typeName, StringTableEntry objectName, const U32 tamlRefId );
+    void addChildElement( SimObject* pSimObject, TamlChildren* pChildren, AbstractClassRep* pContainerChildClass, SimObject* pChildSimObject );
+
+    SimObject* readStream( Stream& stream, const U8* pStreamBuffer );
+    SimObject* readPayload( Stream& stream, const U8* pStreamBuffer, const bool compressed );
+
+    /// String table payload parsing.
+    inline bool canRead( const U32 size )
+    {
+        if ( !mCursorError && (U32)(mpCursorEnd - mpCursor) >= size )
+            return true;
+
+        mCursorError = true;
+        return false;
+    }
+    inline U8 readU8( void )
+    {
+        if ( !canRead( sizeof(U8) ) )
+            return 0;
+
+        return *mpCursor++;
+    }
+    inline U32 readU32( void )
+    {
+        if ( !canRead( sizeof(U32) ) )
+            return 0;
+
+        U32 value;
+        dMemcpy( &value, mpCursor, sizeof(U32) );
+        mpCursor += sizeof(U32);
+        return convertLEndianToHost( value );
+    }
+    inline F32 readF32( void )
+    {
+        if ( !canRead( sizeof(F32) ) )
+            return 0.0f;
+
+        F32 value;
+        dMemcpy( &value, mpCursor, sizeof(F32) );
+        mpCursor += sizeof(F32);
+        return convertLEndianToHost( value );
+    }
+    const char* readValue( void );
+    StringTableEntry readStringIndex( void );
+    bool parseStringTable( void );
+
+    SimObject* parseElement( const U32 versionId );
+    void parseAttributes( SimObject* pSimObject );
+    void parseChildren( TamlCallbacks* pCallbacks, SimObject* pSimObject, const U32 versionId );
+    void parseCustomElements( TamlCallbacks* pCallbacks, TamlCustomNodes& customNodes, const U32 versionId );
+    void parseCustomNode( TamlCustomNode* pCustomNode, const U32 versionId );
+
     SimObject* parseElement( Stream& stream, const U32 versionId );
     void parseAttributes( Stream& stream, SimObject* pSimObject, const U32 versionId );
     void parseChildren( Stream& stream, TamlCallbacks* pCallbacks, SimObject* pSimObject, const U32 versionId );
@@ -22,20 +22,49 @@
 
 #include "persistence/taml/tamlBinaryWriter.h"
 
-#ifndef _ZIPSUBSTREAM_H_
-#include "io/zip/zipSubStream.h"
+#ifndef _CONSOLETYPES_H_
+#include "console/consoleTypes.h"
 #endif
 
+#ifndef _TAML_PARALLEL_WRITE_H_
+#include "persistence/taml/tamlParallelWrite.h"
+#endif
+
+#include "zlib.h"
+
 // Debug Profiling.
 #include "debug/profiler.h"
 
 //-----------------------------------------------------------------------------
 
-bool TamlBinaryWriter::write( FileStream& stream, const TamlWriteNode* pTamlWriteNode, const bool compressed )
+bool TamlBinaryWriter::write( Stream& stream, const TamlWriteNode* pTamlWriteNode, const bool compressed )
 {
     // Debug Profiling.
     PROFILE_SCOPE(TamlBinaryWriter_Write);
- 
+
+    // Reset the string table.
+    // NOTE: The empty string is always the first entry.
+    mStrings.clear();
+    mStringIndexMap.clear();
+    mElementStream.clear();
+    addString( StringTable->EmptyString );
+
+    // Collect the string table.
+    collectStrings( pTamlWriteNode );
+
+    // Write elements.
+    writeElement( mElementStream, pTamlWriteNode );
+
+    // Write string table.
+    GrowableMemStream payloadStream( mElementStream.getBufferSize() );
+    writeStringTable( payloadStream );
+
+    // Append the elements after the string table.
+    payloadStream.write( mElementStream.getBufferSize(), mElementStream.getBuffer() );
+
+    // Fetch payload.
+    const U32 payloadSize = payloadStream.getBufferSize();
+
     // Write Taml signature.
     stream.writeString( StringTable->insert( TAML_SIGNATURE ) );
 
@@ -45,26 +74,188 @@ bool TamlBinaryWriter::write( FileStream& stream, const TamlWriteNode* pTamlWrit
     // Write compressed flag.
     stream.write( compressed );
 
+    // Write payload size.
+    stream.write( payloadSize );
+
     // Are we compressed?
     if ( compressed )
     {
-        // yes, so attach zip stream.
-        ZipSubWStream zipStream;
-        zipStream.attachStream( &stream );
-
-        // Write element.
-        writeElement( zipStream, pTamlWriteNode );
+        // Yes, so compress the payload in a single pass.
+        uLongf compressedSize = compressBound( payloadSize );
+        Vector<U8> compressedBuffer;
+        compressedBuffer.setSize( (U32)compressedSize );
+        if ( compress2( compressedBuffer.address(), &compressedSize, payloadStream.getBuffer(), payloadSize, Z_DEFAULT_COMPRESSION ) != Z_OK )
+        {
+            // Warn.
+            Con::warnf( "Taml: Failed to compress the binary payload." );
+            return false;
+        }
 
-        // Detach zip stream.
-        zipStream.detachStream();
+        // Write compressed payload.
+        stream.write( (U32)compressedSize );
+        stream.write( (U32)compressedSize, compressedBuffer.address() );
     }
     else
     {
-        // No, so write element.
-        writeElement( stream, pTamlWriteNode );
+        // No, so write payload.
+        stream.write( payloadSize, payloadStream.getBuffer() );
+    }
+
+    return stream.getStatus() == Stream::Ok;
+}
+
+//-----------------------------------------------------------------------------
+
+TamlBinaryWriter::ValueKind TamlBinaryWriter::getFieldValueKind( const AbstractClassRep::Field* pField )
+{
+    // Only plain, single-element fields can be written natively.
+    // Fields with a custom getter may not reflect the raw field memory.
+    if ( pField == NULL || pField->elementCount != 1 || pField->getDataFn != &defaultProtectedGetFn )
+        return StringValue;
+
+    // NOTE: Console type Ids are assigned at runtime so can't be switched on.
+    const S32 fieldType = pField->type;
+    if ( fieldType == TypeBool )
+        return BoolValue;
+    if ( fieldType == TypeS32 )
+        return S32Value;
+    if ( fieldType == TypeF32 )
+        return F32Value;
+
+    return StringValue;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 TamlBinaryWriter::addString( const char* pString )
+{
+    // Use the existing index if the string is already in the table.
+    typeStringIndexHash::iterator stringItr = mStringIndexMap.find( pString );
+    if ( stringItr != mStringIndexMap.end() )
+        return stringItr->value;
+
+    // Add the string.
+    const U32 stringIndex = mStrings.size();
+    mStrings.push_back( pString );
+    mStringIndexMap.insert( pString, stringIndex );
+
+    return stringIndex;
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryWriter::collectStrings( const TamlWriteNode* pTamlWriteNode )
+{
+    // Add element and object names.
+    addString( pTamlWriteNode->mpSimObject->getClassName() );
+    if ( pTamlWriteNode->mpObjectName != NULL )
+        addString( pTamlWriteNode->mpObjectName );
+
+    // Finish if a reference to another node.
+    if ( pTamlWriteNode->mRefToNode != NULL )
+        return;
+
+    // Add field names.
+    const Vector<TamlWriteNode::FieldValuePair*>& fields = pTamlWriteNode->mFields;
+    for( Vector<TamlWriteNode::FieldValuePair*>::const_iterator itr = fields.begin(); itr != fields.end(); ++itr )
+    {
+        addString( (*itr)->mName );
+    }
+
+    // Add children.
+    Vector<TamlWriteNode*>* pChildren = pTamlWriteNode->mChildren;
+    if ( pChildren != NULL )
+    {
+        for( Vector<TamlWriteNode*>::iterator itr = pChildren->begin(); itr != pChildren->end(); ++itr )
+        {
+            collectStrings( *itr );
+        }
+    }
+
+    // Add custom nodes.
+    const TamlCustomNodeVector& nodes = pTamlWriteNode->mCustomNodes.getNodes();
+    for( TamlCustomNodeVector::const_iterator customNodesItr = nodes.begin(); customNodesItr != nodes.end(); ++customNodesItr )
+    {
+        // Add custom node name.
+        addString( (*customNodesItr)->getNodeName() );
+
+        // Add children nodes.
+        const TamlCustomNodeVector& nodeChildren = (*customNodesItr)->getChildren();
+        for( TamlCustomNodeVector::const_iterator childNodeItr = nodeChildren.begin(); childNodeItr != nodeChildren.end(); ++childNodeItr )
+        {
+            collectStrings( *childNodeItr );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryWriter::collectStrings( const TamlCustomNode* pCustomNode )
+{
+    // Add the proxy object.
+    if ( pCustomNode->isProxyObject() )
+    {
+        collectStrings( pCustomNode->getProxyWriteNode() );
+        return;
+    }
+
+    // Add custom node name.
+    addString( pCustomNode->getNodeName() );
+
+    // Add children nodes.
+    const TamlCustomNodeVector& nodeChildren = pCustomNode->getChildren();
+    for( TamlCustomNodeVector::const_iterator childNodeItr = nodeChildren.begin(); childNodeItr != nodeChildren.end(); ++childNodeItr )
+    {
+        collectStrings( *childNodeItr );
+    }
+
+    // Add field names.
+    const TamlCustomFieldVector& fields = pCustomNode->getFields();
+    for ( TamlCustomFieldVector::const_iterator fieldItr = fields.begin(); fieldItr != fields.end(); ++fieldItr )
+    {
+        addString( (*fieldItr)->getFieldName() );
     }
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryWriter::writeStringIndex( Stream& stream, const char* pString )
+{
+    // Fetch the string index.
+    // NOTE: This can run on a worker thread so the table is only read here.
+    typeStringIndexHash::iterator stringItr = mStringIndexMap.find( pString != NULL ? pString : StringTable->EmptyString );
+
+    // Sanity!
+    AssertFatal( stringItr != mStringIndexMap.end(), "Taml: String was not collected into the string table." );
+
+    stream.write( stringItr->value );
+}
 
-    return true;
+//-----------------------------------------------------------------------------
+
+void TamlBinaryWriter::writeValue( Stream& stream, const char* pValue )
+{
+    // Write the length and the value including its terminator so it can be used in-place when read.
+    const U32 valueLength = dStrlen( pValue );
+    stream.write( valueLength );
+    stream.write( valueLength + 1, pValue );
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryWriter::writeStringTable( Stream& stream )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryWriter_WriteStringTable);
+
+    // Write string count.
+    stream.write( (U32)mStrings.size() );
+
+    // Write strings.
+    for( Vector<const char*>::iterator itr = mStrings.begin(); itr != mStrings.end(); ++itr )
+    {
+        writeValue( stream, *itr );
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -77,17 +268,11 @@ void TamlBinaryWriter::writeElement( Stream& stream, const TamlWriteNode* pTamlW
     // Fetch object.
     SimObject* pSimObject = pTamlWriteNode->mpSimObject;
 
-    // Fetch element name.
-    const char* pElementName = pSimObject->getClassName();
-
     // Write element name.
-    stream.writeString( pElementName );
-
-    // Fetch object name.
-    const char* pObjectName = pTamlWriteNode->mpObjectName;
+    writeStringIndex( stream, pSimObject->getClassName() );
 
     // Write object name.
-    stream.writeString( pObjectName != NULL ? pObjectName : StringTable->EmptyString );
+    writeStringIndex( stream, pTamlWriteNode->mpObjectName );
 
     // Fetch reference Id.
     const U32 tamlRefId = pTamlWriteNode->mRefId;
@@ -112,7 +297,7 @@ void TamlBinaryWriter::writeElement( Stream& stream, const TamlWriteNode* pTamlW
     }
 
     // No, so write no reference to Id.
-    stream.write( 0 );
+    stream.write( (U32)0 );
 
     // Write attributes.
     writeAttributes( stream, pTamlWriteNode );
@@ -134,25 +319,59 @@ void TamlBinaryWriter::writeAttributes( Stream& stream, const TamlWriteNode* pTa
     // Fetch fields.
     const Vector<TamlWriteNode::FieldValuePair*>& fields = pTamlWriteNode->mFields;
 
-    // Write placeholder attribute count.
+    // Write attribute count.
     stream.write( (U32)fields.size() );
 
     // Finish if no fields.
     if ( fields.size() == 0 )
         return;
 
+    // Fetch object.
+    SimObject* pSimObject = pTamlWriteNode->mpSimObject;
+
     // Iterate fields.
     for( Vector<TamlWriteNode::FieldValuePair*>::const_iterator itr = fields.begin(); itr != fields.end(); ++itr )
     {
         // Fetch field/value pair.
         TamlWriteNode::FieldValuePair* pFieldValue = (*itr);
 
-        // Write attribute.
-        stream.writeString( pFieldValue->mName );
-        stream.writeLongString( 4096, pFieldValue->mpValue );
+        // Write attribute name.
+        writeStringIndex( stream, pFieldValue->mName );
+
+        // Fetch the static field.
+        // NOTE: Dynamic fields won't be found and are always written as strings.
+        const AbstractClassRep::Field* pField = pSimObject->findField( pFieldValue->mName );
+
+        // Fetch the value kind.
+        const ValueKind valueKind = getFieldValueKind( pField );
+
+        // Write the value kind.
+        stream.write( (U8)valueKind );
+
+        // Write the value.
+        switch( valueKind )
+        {
+            case BoolValue:
+                stream.write( *(const bool*)((const U8*)pSimObject + pField->offset) );
+                break;
+
+            case S32Value:
+                stream.write( *(const S32*)((const U8*)pSimObject + pField->offset) );
+                break;
+
+            case F32Value:
+                stream.write( *(const F32*)((const U8*)pSimObject + pField->offset) );
+                break;
+
+            default:
+                writeValue( stream, pFieldValue->mpValue );
+                break;
+        }
     }
 }
 
+//-----------------------------------------------------------------------------
+
 void TamlBinaryWriter::writeChildren( Stream& stream, const TamlWriteNode* pTamlWriteNode )
 {
     // Debug Profiling.
@@ -170,7 +389,19 @@ void TamlBinaryWriter::writeChildren( Stream& stream, const TamlWriteNode* pTaml
     }
 
     // Write children count.
-    stream.write( (U32)pChildren->size() );
+    const U32 childCount = pChildren->size();
+    stream.write( childCount );
+
+    // Can the children be written in parallel?
+    if ( TamlParallelWrite::canWrite( childCount ) )
+    {
+        // Yes, so write children in parallel.
+        ParallelChildren parallelChildren;
+        parallelChildren.mpWriter = this;
+        parallelChildren.mpItems = pChildren;
+        TamlParallelWrite::write( stream, &TamlBinaryWriter::writeParallelChild, &parallelChildren, childCount );
+        return;
+    }
 
     // Iterate children.
     for( Vector<TamlWriteNode*>::iterator itr = pChildren->begin(); itr != pChildren->end(); ++itr )
@@ -207,11 +438,26 @@ void TamlBinaryWriter::writeCustomElements( Stream& stream, const TamlWriteNode*
         TamlCustomNode* pCustomNode = *customNodesItr;
 
         // Write custom node name.
-        stream.writeString( pCustomNode->getNodeName() );
+        writeStringIndex( stream, pCustomNode->getNodeName() );
 
         // Fetch node children.
         const TamlCustomNodeVector& nodeChildren = pCustomNode->getChildren();
 
+        // Write child node count.
+        const U32 childNodeCount = nodeChildren.size();
+        stream.write( childNodeCount );
+
+        // Can the children nodes be written in parallel?
+        if ( TamlParallelWrite::canWrite( childNodeCount ) )
+        {
+            // Yes, so write children nodes in parallel.
+            ParallelChildren parallelChildren;
+            parallelChildren.mpWriter = this;
+            parallelChildren.mpItems = &nodeChildren;
+            TamlParallelWrite::write( stream, &TamlBinaryWriter::writeParallelCustomNode, &parallelChildren, childNodeCount );
+            continue;
+        }
+
         // Iterate children nodes.
         for( TamlCustomNodeVector::const_iterator childNodeItr = nodeChildren.begin(); childNodeItr != nodeChildren.end(); ++childNodeItr )
         {
@@ -243,10 +489,10 @@ void TamlBinaryWriter::writeCustomNode( Stream& stream, const TamlCustomNode* pC
     stream.write( false );
 
     // Write custom node name.
-    stream.writeString( pCustomNode->getNodeName() );
+    writeStringIndex( stream, pCustomNode->getNodeName() );
 
     // Write custom node text.
-    stream.writeString( pCustomNode->getNodeTextField().getFieldValue(), MAX_TAML_NODE_FIELDVALUE_LENGTH );
+    writeValue( stream, pCustomNode->getNodeTextField().getFieldValue() );
 
     // Fetch node children.
     const TamlCustomNodeVector& nodeChildren = pCustomNode->getChildren();
@@ -290,8 +536,26 @@ void TamlBinaryWriter::writeCustomNode( Stream& stream, const TamlCustomNode* pC
             const TamlCustomField* pField = *fieldItr;
 
             // Write the node field.
-            stream.writeString( pField->getFieldName() );
-            stream.writeLongString( MAX_TAML_NODE_FIELDVALUE_LENGTH, pField->getFieldValue() );
+            writeStringIndex( stream, pField->getFieldName() );
+            writeValue( stream, pField->getFieldValue() );
         }
     }
-}
\ No newline at end of file
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryWriter::writeParallelChild( void* pContext, Stream& stream, const U32 index )
+{
+    ParallelChildren* pParallelChildren = static_cast<ParallelChildren*>( pContext );
+    const Vector<TamlWriteNode*>& children = *static_cast<const Vector<TamlWriteNode*>*>( pParallelChildren->mpItems );
+    pParallelChildren->mpWriter->writeElement( stream, children[index] );
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryWriter::writeParallelCustomNode( void* pContext, Stream& stream, const U32 index )
+{
+    ParallelChildren* pParallelChildren = static_cast<ParallelChildren*>( pContext );
+    const TamlCustomNodeVector& nodes = *static_cast<const TamlCustomNodeVector*>( pParallelChildren->mpItems );
+    pParallelChildren->mpWriter->writeCustomNode( stream, nodes[index] );
+}
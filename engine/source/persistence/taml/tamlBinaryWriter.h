@@ -27,31 +27,77 @@
 #include "persistence/taml/taml.h"
 #endif
 
+#ifndef _GROWABLE_MEMSTREAM_H_
+#include "io/growableMemStream.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
+/// Writes the binary format.
+/// All type, object, field and node names are written once to a string table at the
+/// start of the payload and elements refer to them by index.  Boolean, integer and
+/// float fields are written as native values rather than as formatted strings.
+/// The string table is collected before any element is written so large sets of
+/// children and custom nodes can be written in parallel.
 class TamlBinaryWriter
 {
+public:
+    /// Attribute value kinds.
+    enum ValueKind
+    {
+        StringValue = 0,
+        BoolValue   = 1,
+        S32Value    = 2,
+        F32Value    = 3,
+    };
+
 public:
     TamlBinaryWriter( Taml* pTaml ) :
         mpTaml( pTaml ),
-        mVersionId(2)
+        mVersionId(TAML_BINARY_STRINGTABLE_VERSION)
     {
+        VECTOR_SET_ASSOCIATION( mStrings );
     }
     virtual ~TamlBinaryWriter() {}
 
     /// Write.
-    bool write( FileStream& stream, const TamlWriteNode* pTamlWriteNode, const bool compressed );
+    bool write( Stream& stream, const TamlWriteNode* pTamlWriteNode, const bool compressed );
+
+    /// Native value kind a field can be written with.
+    static ValueKind getFieldValueKind( const AbstractClassRep::Field* pField );
 
 private:
     Taml* mpTaml;
     const U32 mVersionId;
 
+    typedef HashMap<const char*, U32> typeStringIndexHash;
+
+    struct ParallelChildren
+    {
+        TamlBinaryWriter*   mpWriter;
+        const void*         mpItems;
+    };
+
+    GrowableMemStream       mElementStream;
+    Vector<const char*>     mStrings;
+    typeStringIndexHash     mStringIndexMap;
+
 private:
+    U32 addString( const char* pString );
+    void collectStrings( const TamlWriteNode* pTamlWriteNode );
+    void collectStrings( const TamlCustomNode* pCustomNode );
+    void writeStringIndex( Stream& stream, const char* pString );
+    void writeValue( Stream& stream, const char* pValue );
+    void writeStringTable( Stream& stream );
+
     void writeElement( Stream& stream, const TamlWriteNode* pTamlWriteNode );
     void writeAttributes( Stream& stream, const TamlWriteNode* pTamlWriteNode );
     void writeChildren( Stream& stream, const TamlWriteNode* pTamlWriteNode );
     void writeCustomElements( Stream& stream, const TamlWriteNode* pTamlWriteNode );
     void writeCustomNode( Stream& stream, const TamlCustomNode* pCustomNode );
+
+    static void writeParallelChild( void* pContext, Stream& stream, const U32 index );
+    static void writeParallelCustomNode( void* pContext, Stream& stream, const U32 index );
 };
 
 #endif // _TAML_BINARYWRITER_H_
\ No newline at end of file
@@ -0,0 +1,110 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "persistence/taml/tamlParallelWrite.h"
+
+#ifndef _GROWABLE_MEMSTREAM_H_
+#include "io/growableMemStream.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_JOBPOOL_H_
+#include "platform/threads/jobPool.h"
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+bool TamlParallelWrite::smWriting = false;
+
+//-----------------------------------------------------------------------------
+
+struct TamlParallelWriteBatches
+{
+    TamlParallelWrite::WriteFunction    mFunction;
+    void*                               mpContext;
+    Vector<GrowableMemStream*>          mBuffers;
+};
+
+//-----------------------------------------------------------------------------
+
+bool TamlParallelWrite::canWrite( const U32 itemCount )
+{
+    return !smWriting &&
+        itemCount >= MinItemCount &&
+        JobPool::Instance != NULL &&
+        JobPool::Instance->getWorkerCount() > 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlParallelWrite::write( Stream& stream, WriteFunction function, void* pContext, const U32 itemCount )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlParallelWrite_Write);
+
+    // Sanity!
+    AssertFatal( !smWriting, "TamlParallelWrite::write() - Parallel writes cannot be nested." );
+
+    // Create a buffer per batch.
+    TamlParallelWriteBatches batches;
+    batches.mFunction = function;
+    batches.mpContext = pContext;
+    const U32 batchCount = (itemCount + BatchSize - 1) / BatchSize;
+    batches.mBuffers.setSize( batchCount );
+    for ( U32 index = 0; index < batchCount; ++index )
+    {
+        batches.mBuffers[index] = new GrowableMemStream();
+    }
+
+    // Write the batches.
+    // NOTE: The flag is set before any job is queued so jobs see it and won't nest.
+    smWriting = true;
+    JobPool::Instance->parallelFor( &TamlParallelWrite::writeBatch, &batches, itemCount, BatchSize );
+    smWriting = false;
+
+    // Append the batches in order.
+    for ( U32 index = 0; index < batchCount; ++index )
+    {
+        GrowableMemStream* pBuffer = batches.mBuffers[index];
+        stream.write( pBuffer->getBufferSize(), pBuffer->getBuffer() );
+        delete pBuffer;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlParallelWrite::writeBatch( void* pContext, const U32 start, const U32 end )
+{
+    TamlParallelWriteBatches* pBatches = static_cast<TamlParallelWriteBatches*>( pContext );
+
+    // Fetch the batch buffer.
+    // NOTE: When run inline the range covers every batch so everything goes into the first buffer.
+    Stream& batchStream = *pBatches->mBuffers[start / BatchSize];
+
+    // Write the items.
+    for ( U32 index = start; index < end; ++index )
+    {
+        pBatches->mFunction( pBatches->mpContext, batchStream, index );
+    }
+}
@@ -0,0 +1,60 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _TAML_PARALLEL_WRITE_H_
+#define _TAML_PARALLEL_WRITE_H_
+
+#ifndef _STREAM_H_
+#include "io/stream.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// Writes independent items, such as the children of a large scene, across the job pool.
+/// Each batch of items is written into its own memory buffer and the buffers are then
+/// appended to the output stream in order so the output is identical to a serial write.
+/// Item writers run on worker threads so must only read the compiled write nodes.
+class TamlParallelWrite
+{
+public:
+    enum
+    {
+        MinItemCount = 64,
+        BatchSize = 16,
+    };
+
+    typedef void (*WriteFunction)( void* pContext, Stream& stream, const U32 index );
+
+    /// Whether this many items should be written in parallel.
+    /// Writes already running in parallel are never nested.
+    static bool canWrite( const U32 itemCount );
+
+    /// Write the items [0, itemCount) then append them to the stream in order.
+    static void write( Stream& stream, WriteFunction function, void* pContext, const U32 itemCount );
+
+private:
+    static void writeBatch( void* pContext, const U32 start, const U32 end );
+
+    static bool smWriting;
+};
+
+#endif // _TAML_PARALLEL_WRITE_H_
@@ -22,30 +22,32 @@
 
 #include "persistence/taml/tamlXmlWriter.h"
 
+#ifndef _TAML_PARALLEL_WRITE_H_
+#include "persistence/taml/tamlParallelWrite.h"
+#endif
+
 // Debug Profiling.
 #include "debug/profiler.h"
 
 //-----------------------------------------------------------------------------
 
-bool TamlXmlWriter::write( FileStream& stream, const TamlWriteNode* pTamlWriteNode )
+bool TamlXmlWriter::write( Stream& stream, const TamlWriteNode* pTamlWriteNode )
 {
     // Debug Profiling.
     PROFILE_SCOPE(TamlXmlWriter_Write);
 
-    // Create document.
-    TiXmlDocument xmlDocument;
-
-    // Compile the root element.
-    TiXmlElement* pRootElement = compileElement( pTamlWriteNode );
-
     // Fetch any TAML Schema file reference.
     const char* pTamlSchemaFile = Con::getVariable( TAML_SCHEMA_VARIABLE );
 
+    RootAttributes rootAttributes;
+    rootAttributes.mpNamespace = NULL;
+    rootAttributes.mpSchemaLocation = NULL;
+
     // Do we have a schema file reference?
     if ( pTamlSchemaFile != NULL && *pTamlSchemaFile != 0 )
     {
         // Yes, so add namespace attribute to root.
-        pRootElement->SetAttribute( "xmlns:xsi", "http://www.w3.org/2001/XMLSchema-instance" );
+        rootAttributes.mpNamespace = "http://www.w3.org/2001/XMLSchema-instance";
 
         // Expand the file-path reference.
         char schemaFilePathBuffer[1024];
@@ -61,25 +63,26 @@ bool TamlXmlWriter::write( FileStream& stream, const TamlWriteNode* pTamlWriteNo
             *pFileStart = 0;
 
         // Fetch the schema file-path relative to the output file.
-        StringTableEntry relativeSchemaFilePath = Platform::makeRelativePathName( schemaFilePathBuffer, outputFileBuffer );
-
-        // Add schema location attribute to root.
-        pRootElement->SetAttribute( "xsi:noNamespaceSchemaLocation", relativeSchemaFilePath );
+        rootAttributes.mpSchemaLocation = Platform::makeRelativePathName( schemaFilePathBuffer, outputFileBuffer );
     }
 
-    // Link the root element.
-    xmlDocument.LinkEndChild( pRootElement );
+    // Write the root element.
+    writeElement( stream, pTamlWriteNode, 0, &rootAttributes );
+    stream.writeStringBuffer( "\n" );
 
-    // Save document to stream.
-    return xmlDocument.SaveFile( stream );
+    return stream.getStatus() == Stream::Ok;
 }
 
 //-----------------------------------------------------------------------------
 
-TiXmlElement* TamlXmlWriter::compileElement( const TamlWriteNode* pTamlWriteNode )
+void TamlXmlWriter::writeElement( Stream& stream, const TamlWriteNode* pTamlWriteNode, const U32 depth, const RootAttributes* pRootAttributes )
 {
     // Debug Profiling.
-    PROFILE_SCOPE(TamlXmlWriter_CompileElement);
+    PROFILE_SCOPE(TamlXmlWriter_WriteElement);
+
+    // Elements below the root start on a new line.
+    if ( depth > 0 )
+        stream.writeStringBuffer( "\n" );
 
     // Fetch object.
     SimObject* pSimObject = pTamlWriteNode->mpSimObject;
@@ -87,17 +90,22 @@ TiXmlElement* TamlXmlWriter::compileElement( const TamlWriteNode* pTamlWriteNode
     // Fetch element name.
     const char* pElementName = pSimObject->getClassName();
 
-    // Create element.
-    TiXmlElement* pElement = new TiXmlElement( pElementName );
+    // Write element start.
+    writeIndent( stream, depth );
+    stream.writeStringBuffer( "<" );
+    stream.writeStringBuffer( pElementName );
 
     // Fetch reference Id.
     const U32 referenceId = pTamlWriteNode->mRefId;
 
+    char referenceBuffer[16];
+
     // Do we have a reference Id?
     if ( referenceId != 0 )
     {
-        // Yes, so set reference Id attribute.
-        pElement->SetAttribute( tamlRefIdName, referenceId );
+        // Yes, so write reference Id attribute.
+        dSprintf( referenceBuffer, sizeof(referenceBuffer), "%d", referenceId );
+        writeAttribute( stream, tamlRefIdName, referenceBuffer, depth + 1 );
     }
 
     // Do we have a reference to node?
@@ -109,11 +117,13 @@ TiXmlElement* TamlXmlWriter::compileElement( const TamlWriteNode* pTamlWriteNode
         // Sanity!
         AssertFatal( referenceToId != 0, "Taml: Invalid reference to Id." );
 
-        // Set reference to Id attribute.
-        pElement->SetAttribute( tamlRefToIdName, referenceToId );
+        // Write reference to Id attribute.
+        dSprintf( referenceBuffer, sizeof(referenceBuffer), "%d", referenceToId );
+        writeAttribute( stream, tamlRefToIdName, referenceBuffer, depth + 1 );
 
         // Finish because we're a reference to another object.
-        return pElement;
+        stream.writeStringBuffer( " />" );
+        return;
     }
 
     // Fetch object name.
@@ -122,64 +132,137 @@ TiXmlElement* TamlXmlWriter::compileElement( const TamlWriteNode* pTamlWriteNode
     // Do we have a name?
     if ( pObjectName != NULL )
     {
-        // Yes, so set name attribute.
-        pElement->SetAttribute( tamlNamedObjectName, pObjectName );
+        // Yes, so write name attribute.
+        writeAttribute( stream, tamlNamedObjectName, pObjectName, depth + 1 );
     }
 
-    // Compile attributes.
-    compileAttributes( pElement, pTamlWriteNode );
+    // Write attributes.
+    writeAttributes( stream, pTamlWriteNode, depth );
+
+    // Write any root attributes.
+    if ( pRootAttributes != NULL && pRootAttributes->mpNamespace != NULL )
+    {
+        writeAttribute( stream, "xmlns:xsi", pRootAttributes->mpNamespace, depth + 1 );
+        writeAttribute( stream, "xsi:noNamespaceSchemaLocation", pRootAttributes->mpSchemaLocation, depth + 1 );
+    }
 
     // Fetch children.
     Vector<TamlWriteNode*>* pChildren = pTamlWriteNode->mChildren;
+    const U32 childCount = pChildren != NULL ? pChildren->size() : 0;
 
-    // Do we have any children?
-    if ( pChildren )
+    // Fetch whether any custom elements will be written.
+    bool hasCustomElements = false;
+    const TamlCustomNodeVector& customNodes = pTamlWriteNode->mCustomNodes.getNodes();
+    for( TamlCustomNodeVector::const_iterator customNodesItr = customNodes.begin(); customNodesItr != customNodes.end() && !hasCustomElements; ++customNodesItr )
     {
-        // Yes, so iterate children.
-        for( Vector<TamlWriteNode*>::iterator itr = pChildren->begin(); itr != pChildren->end(); ++itr )
+        // Fetch the custom node.
+        const TamlCustomNode* pCustomNode = *customNodesItr;
+
+        // Custom elements set to ignore if empty are only written if they have a child to write.
+        if ( !pCustomNode->getIgnoreEmpty() )
+        {
+            hasCustomElements = true;
+            break;
+        }
+
+        const TamlCustomNodeVector& nodeChildren = pCustomNode->getChildren();
+        for( TamlCustomNodeVector::const_iterator childNodeItr = nodeChildren.begin(); childNodeItr != nodeChildren.end(); ++childNodeItr )
+        {
+            if ( isCustomNodeWritten( *childNodeItr ) )
+            {
+                hasCustomElements = true;
+                break;
+            }
+        }
+    }
+
+    // Finish if there's no content.
+    if ( childCount == 0 && !hasCustomElements )
+    {
+        stream.writeStringBuffer( " />" );
+        return;
+    }
+
+    stream.writeStringBuffer( ">" );
+
+    // Can the children be written in parallel?
+    if ( TamlParallelWrite::canWrite( childCount ) )
+    {
+        // Yes, so write children in parallel.
+        ParallelChildren parallelChildren;
+        parallelChildren.mpWriter = this;
+        parallelChildren.mpItems = pChildren;
+        parallelChildren.mDepth = depth + 1;
+        TamlParallelWrite::write( stream, &TamlXmlWriter::writeParallelChild, &parallelChildren, childCount );
+    }
+    else
+    {
+        // No, so iterate children.
+        for( U32 index = 0; index < childCount; ++index )
         {
             // Write child element.
-            pElement->LinkEndChild( compileElement( (*itr) ) );
+            writeElement( stream, (*pChildren)[index], depth + 1, NULL );
         }
     }
 
-    // Compile custom elements.
-    compileCustomElements( pElement, pTamlWriteNode );
+    // Write custom elements.
+    writeCustomElements( stream, pTamlWriteNode, depth );
 
-    return pElement;
+    // Write element end.
+    stream.writeStringBuffer( "\n" );
+    writeIndent( stream, depth );
+    stream.writeStringBuffer( "</" );
+    stream.writeStringBuffer( pElementName );
+    stream.writeStringBuffer( ">" );
 }
 
 //-----------------------------------------------------------------------------
 
-void TamlXmlWriter::compileAttributes( TiXmlElement* pXmlElement, const TamlWriteNode* pTamlWriteNode )
+void TamlXmlWriter::writeAttributes( Stream& stream, const TamlWriteNode* pTamlWriteNode, const U32 depth )
 {
     // Debug Profiling.
-    PROFILE_SCOPE(TamlXmlWriter_CompileAttributes);
+    PROFILE_SCOPE(TamlXmlWriter_WriteAttributes);
 
     // Fetch fields.
     const Vector<TamlWriteNode::FieldValuePair*>& fields = pTamlWriteNode->mFields;
 
-    // Ignore if no fields.
-    if ( fields.size() == 0 )
-        return;
+    // Fetch field count.
+    const U32 fieldCount = fields.size();
 
     // Iterate fields.
-    for( Vector<TamlWriteNode::FieldValuePair*>::const_iterator itr = fields.begin(); itr != fields.end(); ++itr )
+    for( U32 index = 0; index < fieldCount; ++index )
     {
-        // Fetch field/value pair.
-        TamlWriteNode::FieldValuePair* pFieldValue = (*itr);
+        // Fetch field name.
+        StringTableEntry fieldName = fields[index]->mName;
+
+        // Skip if the field was already written.
+        // NOTE: Array fields repeat the same name and an attribute keeps its first position but the last value.
+        U32 previousIndex = 0;
+        while ( previousIndex < index && fields[previousIndex]->mName != fieldName )
+            ++previousIndex;
+
+        if ( previousIndex < index )
+            continue;
 
-        // Set field attribute.
-        pXmlElement->SetAttribute( pFieldValue->mName, pFieldValue->mpValue );
+        // Find the last value.
+        const char* pFieldValue = fields[index]->mpValue;
+        for( U32 nextIndex = index + 1; nextIndex < fieldCount; ++nextIndex )
+        {
+            if ( fields[nextIndex]->mName == fieldName )
+                pFieldValue = fields[nextIndex]->mpValue;
+        }
+
+        // Write field attribute.
+        writeAttribute( stream, fieldName, pFieldValue, depth + 1 );
     }
 }
 
 //-----------------------------------------------------------------------------
 
-void TamlXmlWriter::compileCustomElements( TiXmlElement* pXmlElement, const TamlWriteNode* pTamlWriteNode )
+void TamlXmlWriter::writeCustomElements( Stream& stream, const TamlWriteNode* pTamlWriteNode, const U32 depth )
 {
     // Debug Profiling.
-    PROFILE_SCOPE(TamlXmlWriter_CompileCustomElements);
+    PROFILE_SCOPE(TamlXmlWriter_WriteCustomElements);
 
     // Fetch custom nodes.
     const TamlCustomNodes& customNodes = pTamlWriteNode->mCustomNodes;
@@ -191,73 +274,99 @@ void TamlXmlWriter::compileCustomElements( TiXmlElement* pXmlElement, const Taml
     if ( nodes.size() == 0 )
         return;
 
+    // Fetch element name.
+    const char* pElementName = pTamlWriteNode->mpSimObject->getClassName();
+
     // Iterate custom nodes.
     for( TamlCustomNodeVector::const_iterator customNodesItr = nodes.begin(); customNodesItr != nodes.end(); ++customNodesItr )
     {
         // Fetch the custom node.
         TamlCustomNode* pCustomNode = *customNodesItr;
 
-        // Format extended element name.
-        char extendedElementNameBuffer[256];
-        dSprintf( extendedElementNameBuffer, sizeof(extendedElementNameBuffer), "%s.%s", pXmlElement->Value(), pCustomNode->getNodeName() );
-        StringTableEntry extendedElementName = StringTable->insert( extendedElementNameBuffer );
-
-        // Create element.
-        TiXmlElement* pExtendedPropertyElement = new TiXmlElement( extendedElementName );
-
         // Fetch node children.
         const TamlCustomNodeVector& nodeChildren = pCustomNode->getChildren();
 
-        // Iterate children nodes.
+        // Fetch whether any children will be written.
+        bool hasChildren = false;
         for( TamlCustomNodeVector::const_iterator childNodeItr = nodeChildren.begin(); childNodeItr != nodeChildren.end(); ++childNodeItr )
         {
-            // Fetch child node.
-            const TamlCustomNode* pChildNode = *childNodeItr;
+            if ( isCustomNodeWritten( *childNodeItr ) )
+            {
+                hasChildren = true;
+                break;
+            }
+        }
 
-            // Compile the custom node.
-            compileCustomNode( pExtendedPropertyElement, pChildNode );
+        // Skip if the node is set to ignore if empty and it is empty.
+        if ( pCustomNode->getIgnoreEmpty() && !hasChildren )
+            continue;
+
+        // Write extended element start.
+        stream.writeStringBuffer( "\n" );
+        writeIndent( stream, depth + 1 );
+        stream.writeFormattedBuffer( "<%s.%s", pElementName, pCustomNode->getNodeName() );
+
+        // Finish if there are no children.
+        if ( !hasChildren )
+        {
+            stream.writeStringBuffer( " />" );
+            continue;
         }
 
-        // Finish if the node is set to ignore if empty and it is empty.
-        if ( pCustomNode->getIgnoreEmpty() && pExtendedPropertyElement->NoChildren() )
+        stream.writeStringBuffer( ">" );
+
+        // Can the children be written in parallel?
+        const U32 childCount = nodeChildren.size();
+        if ( TamlParallelWrite::canWrite( childCount ) )
         {
-            // Yes, so delete the extended element.
-            delete pExtendedPropertyElement;
-            pExtendedPropertyElement = NULL;
+            // Yes, so write children in parallel.
+            ParallelChildren parallelChildren;
+            parallelChildren.mpWriter = this;
+            parallelChildren.mpItems = &nodeChildren;
+            parallelChildren.mDepth = depth + 2;
+            TamlParallelWrite::write( stream, &TamlXmlWriter::writeParallelCustomNode, &parallelChildren, childCount );
         }
         else
         {
-            // No, so add elementt as child.
-            pXmlElement->LinkEndChild( pExtendedPropertyElement );
+            // No, so iterate children nodes.
+            for( TamlCustomNodeVector::const_iterator childNodeItr = nodeChildren.begin(); childNodeItr != nodeChildren.end(); ++childNodeItr )
+            {
+                // Write the custom node.
+                writeCustomNode( stream, *childNodeItr, depth + 2 );
+            }
         }
+
+        // Write extended element end.
+        stream.writeStringBuffer( "\n" );
+        writeIndent( stream, depth + 1 );
+        stream.writeFormattedBuffer( "</%s.%s>", pElementName, pCustomNode->getNodeName() );
     }
 }
 
 //-----------------------------------------------------------------------------
 
-void TamlXmlWriter::compileCustomNode( TiXmlElement* pXmlElement, const TamlCustomNode* pCustomNode )
+void TamlXmlWriter::writeCustomNode( Stream& stream, const TamlCustomNode* pCustomNode, const U32 depth )
 {
-    // Finish if the node is set to ignore if empty and it is empty.
-    if ( pCustomNode->getIgnoreEmpty() && pCustomNode->isEmpty() )
+    // Finish if the node won't be written.
+    if ( !isCustomNodeWritten( pCustomNode ) )
         return;
 
     // Is the node a proxy object?
     if ( pCustomNode->isProxyObject() )
     {
         // Yes, so write the proxy object.
-        pXmlElement->LinkEndChild( compileElement( pCustomNode->getProxyWriteNode() ) );
+        writeElement( stream, pCustomNode->getProxyWriteNode(), depth, NULL );
         return;
     }
 
-    // Create element.
-    TiXmlElement* pNodeElement = new TiXmlElement( pCustomNode->getNodeName() );
+    // Fetch node name.
+    StringTableEntry nodeName = pCustomNode->getNodeName();
 
-    // Is there any node text?
-    if ( !pCustomNode->getNodeTextField().isValueEmpty() )
-    {
-        // Yes, so add a text node.
-        pNodeElement->LinkEndChild( new TiXmlText( pCustomNode->getNodeTextField().getFieldValue() ) );
-    }
+    // Write node start.
+    stream.writeStringBuffer( "\n" );
+    writeIndent( stream, depth );
+    stream.writeStringBuffer( "<" );
+    stream.writeStringBuffer( nodeName );
 
     // Fetch fields.
     const TamlCustomFieldVector& fields = pCustomNode->getFields();
@@ -268,33 +377,189 @@ void TamlXmlWriter::compileCustomNode( TiXmlElement* pXmlElement, const TamlCust
         // Fetch field.
         const TamlCustomField* pField = *fieldItr;
 
-        // Set field.
-        pNodeElement->SetAttribute( pField->getFieldName(), pField->getFieldValue() );
+        // Write field.
+        writeAttribute( stream, pField->getFieldName(), pField->getFieldValue(), depth + 1 );
     }
 
-    // Fetch node children.
+    // Fetch node text.
+    const bool hasText = !pCustomNode->getNodeTextField().isValueEmpty();
+
+    // Fetch whether any children will be written.
     const TamlCustomNodeVector& nodeChildren = pCustomNode->getChildren();
+    bool hasChildren = false;
+    for( TamlCustomNodeVector::const_iterator childNodeItr = nodeChildren.begin(); childNodeItr != nodeChildren.end(); ++childNodeItr )
+    {
+        if ( isCustomNodeWritten( *childNodeItr ) )
+        {
+            hasChildren = true;
+            break;
+        }
+    }
+
+    // Finish if there's no content.
+    if ( !hasText && !hasChildren )
+    {
+        stream.writeStringBuffer( " />" );
+        return;
+    }
+
+    stream.writeStringBuffer( ">" );
+
+    // Write any node text.
+    if ( hasText )
+        writeEncoded( stream, pCustomNode->getNodeTextField().getFieldValue() );
+
+    // Finish if the node only has text.
+    if ( !hasChildren )
+    {
+        stream.writeFormattedBuffer( "</%s>", nodeName );
+        return;
+    }
 
     // Iterate children nodes.
     for( TamlCustomNodeVector::const_iterator childNodeItr = nodeChildren.begin(); childNodeItr != nodeChildren.end(); ++childNodeItr )
     {
-        // Fetch child node.
-        const TamlCustomNode* pChildNode = *childNodeItr;
+        // Write the child node.
+        writeCustomNode( stream, *childNodeItr, depth + 1 );
+    }
+
+    // Write node end.
+    stream.writeStringBuffer( "\n" );
+    writeIndent( stream, depth );
+    stream.writeFormattedBuffer( "</%s>", nodeName );
+}
+
+//-----------------------------------------------------------------------------
+
+bool TamlXmlWriter::isCustomNodeWritten( const TamlCustomNode* pCustomNode )
+{
+    // Not written if the node is set to ignore if empty and it is empty.
+    if ( pCustomNode->getIgnoreEmpty() && pCustomNode->isEmpty() )
+        return false;
 
-        // Compile the child node.
-        compileCustomNode( pNodeElement, pChildNode );
+    // Proxy objects and nodes that don't ignore empty are always written.
+    if ( pCustomNode->isProxyObject() || !pCustomNode->getIgnoreEmpty() )
+        return true;
+
+    // Written if there are fields or text.
+    if ( pCustomNode->getFields().size() > 0 || !pCustomNode->getNodeTextField().isValueEmpty() )
+        return true;
+
+    // Written if any child is written.
+    const TamlCustomNodeVector& nodeChildren = pCustomNode->getChildren();
+    for( TamlCustomNodeVector::const_iterator childNodeItr = nodeChildren.begin(); childNodeItr != nodeChildren.end(); ++childNodeItr )
+    {
+        if ( isCustomNodeWritten( *childNodeItr ) )
+            return true;
     }
 
-    // Finish if the node is set to ignore if empty and it is empty (including fields).
-    if ( pCustomNode->getIgnoreEmpty() && fields.size() == 0 && pNodeElement->NoChildren() )
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlXmlWriter::writeParallelChild( void* pContext, Stream& stream, const U32 index )
+{
+    ParallelChildren* pParallelChildren = static_cast<ParallelChildren*>( pContext );
+    const Vector<TamlWriteNode*>& children = *static_cast<const Vector<TamlWriteNode*>*>( pParallelChildren->mpItems );
+    pParallelChildren->mpWriter->writeElement( stream, children[index], pParallelChildren->mDepth, NULL );
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlXmlWriter::writeParallelCustomNode( void* pContext, Stream& stream, const U32 index )
+{
+    ParallelChildren* pParallelChildren = static_cast<ParallelChildren*>( pContext );
+    const TamlCustomNodeVector& nodes = *static_cast<const TamlCustomNodeVector*>( pParallelChildren->mpItems );
+    pParallelChildren->mpWriter->writeCustomNode( stream, nodes[index], pParallelChildren->mDepth );
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlXmlWriter::writeIndent( Stream& stream, const U32 depth )
+{
+    static const char indentBuffer[] = "                                                                ";
+    const U32 indentBufferLength = sizeof(indentBuffer) - 1;
+
+    // Write four spaces per level.
+    U32 indentLength = depth * 4;
+    while ( indentLength > 0 )
     {
-        // Yes, so delete the extended element.
-        delete pNodeElement;
-        pNodeElement = NULL;
+        const U32 writeLength = getMin( indentLength, indentBufferLength );
+        stream.write( writeLength, indentBuffer );
+        indentLength -= writeLength;
     }
-    else
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlXmlWriter::writeAttribute( Stream& stream, const char* pName, const char* pValue, const U32 depth )
+{
+    stream.writeStringBuffer( "\n" );
+    writeIndent( stream, depth );
+    writeEncoded( stream, pName );
+
+    // Values containing double quotes are quoted with single quotes as TinyXML does.
+    const char* pQuote = dStrchr( pValue, '\"' ) == NULL ? "\"" : "'";
+    stream.writeStringBuffer( "=" );
+    stream.writeStringBuffer( pQuote );
+    writeEncoded( stream, pValue );
+    stream.writeStringBuffer( pQuote );
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlXmlWriter::writeEncoded( Stream& stream, const char* pValue )
+{
+    // Write runs of characters that need no encoding in one go.
+    const char* pRun = pValue;
+    const char* pChar = pValue;
+    while ( *pChar != 0 )
     {
-        // Add node element as child.
-        pXmlElement->LinkEndChild( pNodeElement );
+        const U8 c = (U8)*pChar;
+
+        // Pass through hexadecimal character references.
+        if ( c == '&' && pChar[1] == '#' && pChar[2] == 'x' )
+        {
+            while ( pChar[1] != 0 && *pChar != ';' )
+                ++pChar;
+
+            continue;
+        }
+
+        const char* pEntity = NULL;
+        char characterReference[8];
+        switch( c )
+        {
+            case '&':   pEntity = "&amp;"; break;
+            case '<':   pEntity = "&lt;"; break;
+            case '>':   pEntity = "&gt;"; break;
+            case '\"':  pEntity = "&quot;"; break;
+            case '\'':  pEntity = "&apos;"; break;
+            default:
+                if ( c < 32 )
+                {
+                    dSprintf( characterReference, sizeof(characterReference), "&#x%02X;", (U32)c );
+                    pEntity = characterReference;
+                }
+                break;
+        }
+
+        // Next character if no encoding is needed.
+        if ( pEntity == NULL )
+        {
+            ++pChar;
+            continue;
+        }
+
+        // Write the run and the entity.
+        if ( pChar > pRun )
+            stream.write( (U32)(pChar - pRun), pRun );
+        stream.writeStringBuffer( pEntity );
+        pRun = ++pChar;
     }
+
+    // Write the remaining run.
+    if ( pChar > pRun )
+        stream.write( (U32)(pChar - pRun), pRun );
 }
@@ -27,12 +27,11 @@
 #include "persistence/taml/taml.h"
 #endif
 
-#ifndef TINYXML_INCLUDED
-#include "persistence/tinyXML/tinyxml.h"
-#endif
-
 //-----------------------------------------------------------------------------
 
+/// Writes the compiled nodes directly to the stream as XML.
+/// The output matches the layout TinyXML prints but no document is built first.
+/// Large sets of children and custom nodes are written in parallel.
 class TamlXmlWriter
 {
 public:
@@ -42,16 +41,37 @@ public:
     virtual ~TamlXmlWriter() {}
 
     /// Write.
-    bool write( FileStream& stream, const TamlWriteNode* pTamlWriteNode );
+    bool write( Stream& stream, const TamlWriteNode* pTamlWriteNode );
 
 private:
     Taml* mpTaml;
 
+    struct RootAttributes
+    {
+        const char* mpNamespace;
+        const char* mpSchemaLocation;
+    };
+
+    struct ParallelChildren
+    {
+        TamlXmlWriter*  mpWriter;
+        const void*     mpItems;
+        U32             mDepth;
+    };
+
 private:
-    TiXmlElement* compileElement( const TamlWriteNode* pTamlWriteNode );
-    void compileAttributes( TiXmlElement* pXmlElement, const TamlWriteNode* pTamlWriteNode );
-    void compileCustomElements( TiXmlElement* pXmlElement, const TamlWriteNode* pTamlWriteNode );
-    void compileCustomNode( TiXmlElement* pXmlElement, const TamlCustomNode* pCustomNode );
+    void writeElement( Stream& stream, const TamlWriteNode* pTamlWriteNode, const U32 depth, const RootAttributes* pRootAttributes );
+    void writeAttributes( Stream& stream, const TamlWriteNode* pTamlWriteNode, const U32 depth );
+    void writeCustomElements( Stream& stream, const TamlWriteNode* pTamlWriteNode, const U32 depth );
+    void writeCustomNode( Stream& stream, const TamlCustomNode* pCustomNode, const U32 depth );
+
+    static bool isCustomNodeWritten( const TamlCustomNode* pCustomNode );
+    static void writeParallelChild( void* pContext, Stream& stream, const U32 index );
+    static void writeParallelCustomNode( void* pContext, Stream& stream, const U32 index );
+
+    static void writeIndent( Stream& stream, const U32 depth );
+    static void writeAttribute( Stream& stream, const char* pName, const char* pValue, const U32 depth );
+    static void writeEncoded( Stream& stream, const char* pValue );
 };
 
-#endif // _TAML_XMLWRITER_H_
\ No newline at end of file
+#endif // _TAML_XMLWRITER_H_
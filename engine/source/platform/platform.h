@@ -200,6 +200,8 @@ struct Platform
     static bool getFileTimes(const char *filePath, FileTime *createTime, FileTime *modifyTime);
     static bool isFile(const char *pFilePath);
     static S32  getFileSize(const char *pFilePath);
+    static void* mapFile(const char *pFilePath, U32& size);
+    static void unmapFile(void* pMapping, const U32 size);
     static bool hasExtension(const char* pFilename, const char* pExtension);
     static bool isDirectory(const char *pDirPath);
     static bool isSubDirectory(const char *pParent, const char *pDir);
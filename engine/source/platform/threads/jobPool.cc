@@ -0,0 +1,455 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "platform/threads/jobPool.h"
+#include "platform/platform.h"
+#include "platform/platformTLS.h"
+#include "math/mMathFn.h"
+#include "console/console.h"
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+JobPool* JobPool::Instance = NULL;
+
+/// Set to the owning pool on each worker thread.
+static ThreadStorage sgWorkerPool;
+
+//-----------------------------------------------------------------------------
+
+void JobPool::Init( const U32 workerCount )
+{
+#ifdef TORQUE_JOB_POOL_INLINE
+    // Create the job pool without workers.
+    Instance = new JobPool( 0 );
+#else
+    // Create the job pool.
+    Instance = new JobPool( workerCount );
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+void JobPool::destroy( void )
+{
+    // Delete the job pool.
+    delete Instance;
+    Instance = NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+JobPool::JobPool( const U32 workerCount ) :
+    mJobsAvailable( 0 ),
+    mShutdown( false ),
+    mNextQueue( 0 )
+{
+    // Clamp the worker count.
+    const U32 clampedWorkerCount = getMin( workerCount, (U32)MaxWorkerCount );
+
+    // Create a queue per worker and one for submitting threads.
+    for ( U32 n = 0; n <= clampedWorkerCount; ++n )
+    {
+        mQueues.push_back( new JobQueue() );
+    }
+
+    // Reset metrics.
+    mWorkerJobs.setSize( clampedWorkerCount );
+    mWorkerBusyTime.setSize( clampedWorkerCount );
+    resetMetrics();
+
+    // Start the workers.
+    for ( U32 n = 0; n < clampedWorkerCount; ++n )
+    {
+        WorkerThread* pWorker = new WorkerThread( this, n );
+        mWorkers.push_back( pWorker );
+        pWorker->start();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+JobPool::~JobPool()
+{
+    // Flag shutdown and wake all the workers.
+    mShutdown = true;
+    for ( S32 n = 0; n < mWorkers.size(); ++n )
+    {
+        mJobsAvailable.release();
+    }
+
+    // Wait for the workers to finish.
+    for ( S32 n = 0; n < mWorkers.size(); ++n )
+    {
+        mWorkers[n]->join();
+        delete mWorkers[n];
+    }
+    mWorkers.clear();
+
+    // Delete the queues.
+    for ( S32 n = 0; n < mQueues.size(); ++n )
+    {
+        delete mQueues[n];
+    }
+    mQueues.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void JobPool::submit( JobFunction function, void* pContext, const U32 start, const U32 end, JobCounter& counter )
+{
+    // Run inline if there are no workers.
+    if ( mWorkers.size() == 0 )
+    {
+        function( pContext, start, end );
+        return;
+    }
+
+    // Track the job.
+    counter.mLock.lock();
+    counter.mPending++;
+    counter.mLock.unlock();
+
+    Job job;
+    job.mFunction = function;
+    job.mpContext = pContext;
+    job.mStart = start;
+    job.mEnd = end;
+    job.mpCounter = &counter;
+
+    // Choose the next worker queue.
+    mMetricsLock.lock();
+    const U32 queueIndex = mNextQueue;
+    mNextQueue = (mNextQueue + 1) % mWorkers.size();
+    mJobsSubmitted++;
+    mMetricsLock.unlock();
+
+    // Queue the job.
+    JobQueue* pQueue = mQueues[queueIndex];
+    pQueue->mLock.lock();
+    pQueue->pushBack( job );
+    pQueue->mLock.unlock();
+
+    // Wake a worker.
+    mJobsAvailable.release();
+}
+
+//-----------------------------------------------------------------------------
+
+void JobPool::wait( JobCounter& counter )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(JobPool_Wait);
+
+    // The queue reserved for submitting threads.
+    const U32 waiterQueue = mQueues.size()-1;
+
+    while( !counter.isComplete() )
+    {
+        // Run any queued job rather than idle.
+        Job job;
+        if ( stealJob( waiterQueue, job ) )
+        {
+            runJob( job );
+
+            mMetricsLock.lock();
+            mJobsRunByWaiters++;
+            mMetricsLock.unlock();
+            continue;
+        }
+
+        // Nothing left to run so block until the workers complete the last job.
+        counter.mLock.lock();
+        const bool complete = counter.mPending == 0;
+        counter.mWaiting = !complete;
+        counter.mLock.unlock();
+
+        if ( !complete )
+            counter.mComplete.acquire();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void JobPool::parallelFor( JobFunction function, void* pContext, const U32 count, const U32 batchSize )
+{
+    // Finish if nothing to do.
+    if ( count == 0 )
+        return;
+
+    // Run inline if there are no workers or only a single batch.
+    if ( mWorkers.size() == 0 || count <= batchSize )
+    {
+        function( pContext, 0, count );
+        return;
+    }
+
+    // Debug Profiling.
+    PROFILE_SCOPE(JobPool_ParallelFor);
+
+    // Submit the batches.
+    JobCounter counter;
+    const U32 clampedBatchSize = getMax( batchSize, (U32)1 );
+    for ( U32 start = 0; start < count; start += clampedBatchSize )
+    {
+        submit( function, pContext, start, getMin( start + clampedBatchSize, count ), counter );
+    }
+
+    // Wait for the batches.
+    wait( counter );
+}
+
+//-----------------------------------------------------------------------------
+
+bool JobPool::popJob( const U32 queueIndex, Job& job )
+{
+    JobQueue* pQueue = mQueues[queueIndex];
+
+    pQueue->mLock.lock();
+
+    // Take from the back of our own queue.
+    const bool found = pQueue->mCount > 0;
+    if ( found )
+        pQueue->popBack( job );
+
+    pQueue->mLock.unlock();
+
+    return found;
+}
+
+//-----------------------------------------------------------------------------
+
+bool JobPool::stealJob( const U32 queueIndex, Job& job )
+{
+    const U32 queueCount = mQueues.size();
+
+    // Take from the front of the other queues.
+    for ( U32 n = 1; n < queueCount; ++n )
+    {
+        JobQueue* pQueue = mQueues[(queueIndex + n) % queueCount];
+
+        pQueue->mLock.lock();
+
+        if ( pQueue->mCount > 0 )
+        {
+            pQueue->popFront( job );
+            pQueue->mLock.unlock();
+            return true;
+        }
+
+        pQueue->mLock.unlock();
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+
+void JobPool::runJob( const Job& job )
+{
+    // Run the job.
+    job.mFunction( job.mpContext, job.mStart, job.mEnd );
+
+    // Complete the job.
+    JobCounter* pCounter = job.mpCounter;
+    pCounter->mLock.lock();
+    const bool wake = --pCounter->mPending == 0 && pCounter->mWaiting;
+    if ( wake )
+        pCounter->mWaiting = false;
+    pCounter->mLock.unlock();
+
+    // Wake the thread waiting on the counter.
+    // NOTE: The waiter may destroy the counter as soon as it wakes so it is not touched after this.
+    if ( wake )
+        pCounter->mComplete.release();
+}
+
+//-----------------------------------------------------------------------------
+
+void JobPool::JobQueue::pushBack( const Job& job )
+{
+    const U32 capacity = mJobs.size();
+
+    // Grow the ring when full, unwrapping the jobs.
+    if ( mCount == capacity )
+    {
+        const U32 newCapacity = getMax( capacity * 2, (U32)16 );
+        Vector<Job> jobs;
+        jobs.setSize( newCapacity );
+        for ( U32 n = 0; n < mCount; ++n )
+        {
+            jobs[n] = mJobs[(mHead + n) % capacity];
+        }
+        mJobs = jobs;
+        mHead = 0;
+    }
+
+    mJobs[(mHead + mCount) % mJobs.size()] = job;
+    mCount++;
+}
+
+//-----------------------------------------------------------------------------
+
+void JobPool::JobQueue::popBack( Job& job )
+{
+    // Sanity!
+    AssertFatal( mCount > 0, "JobPool::JobQueue::popBack() - The queue is empty." );
+
+    mCount--;
+    job = mJobs[(mHead + mCount) % mJobs.size()];
+}
+
+//-----------------------------------------------------------------------------
+
+void JobPool::JobQueue::popFront( Job& job )
+{
+    // Sanity!
+    AssertFatal( mCount > 0, "JobPool::JobQueue::popFront() - The queue is empty." );
+
+    job = mJobs[mHead];
+    mHead = (mHead + 1) % mJobs.size();
+    mCount--;
+}
+
+//-----------------------------------------------------------------------------
+
+bool JobPool::isWorkerThread( void )
+{
+    return sgWorkerPool.get() != NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+void JobPool::workerLoop( const U32 workerIndex )
+{
+    // Note this thread as a worker.
+    sgWorkerPool.set( this );
+
+    while( true )
+    {
+        // Wait for work.
+        mJobsAvailable.acquire();
+
+        // Finish if shutting down.
+        if ( mShutdown )
+            return;
+
+        const U32 busyStartTime = Platform::getRealMilliseconds();
+        U32 jobsRun = 0;
+        U32 jobsStolen = 0;
+
+        // Drain our own queue then steal from the others.
+        Job job;
+        while( true )
+        {
+            if ( !popJob( workerIndex, job ) )
+            {
+                if ( !stealJob( workerIndex, job ) )
+                    break;
+
+                jobsStolen++;
+            }
+
+            runJob( job );
+            jobsRun++;
+        }
+
+        // Update metrics.
+        mMetricsLock.lock();
+        mWorkerJobs[workerIndex] += jobsRun;
+        mWorkerBusyTime[workerIndex] += Platform::getRealMilliseconds() - busyStartTime;
+        mJobsStolen += jobsStolen;
+        mMetricsLock.unlock();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void JobPool::WorkerThread::run( void* arg )
+{
+    mpJobPool->workerLoop( mWorkerIndex );
+}
+
+//-----------------------------------------------------------------------------
+
+void JobPool::resetMetrics( void )
+{
+    mMetricsLock.lock();
+
+    mMetricsStartTime = Platform::getRealMilliseconds();
+    mJobsSubmitted = 0;
+    mJobsStolen = 0;
+    mJobsRunByWaiters = 0;
+
+    for ( S32 n = 0; n < mWorkerJobs.size(); ++n )
+    {
+        mWorkerJobs[n] = 0;
+        mWorkerBusyTime[n] = 0;
+    }
+
+    mMetricsLock.unlock();
+}
+
+//-----------------------------------------------------------------------------
+
+void JobPool::dumpMetrics( void )
+{
+    mMetricsLock.lock();
+
+    const U32 elapsedTime = getMax( Platform::getRealMilliseconds() - mMetricsStartTime, (U32)1 );
+
+    Con::printf( "Job Pool Metrics:" );
+    Con::printf( "  %d worker(s), %d job(s) submitted, %d stolen, %d run by waiting threads over %dms.",
+        mWorkers.size(), mJobsSubmitted, mJobsStolen, mJobsRunByWaiters, elapsedTime );
+
+    for ( S32 n = 0; n < mWorkers.size(); ++n )
+    {
+        Con::printf( "  Worker %d: %d job(s), %.1f%% utilisation.",
+            n, mWorkerJobs[n], 100.0f * (F32)mWorkerBusyTime[n] / (F32)elapsedTime );
+    }
+
+    mMetricsLock.unlock();
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleFunction( dumpJobPoolMetrics, void, 1, 1, "() Dump the job pool metrics including the utilisation of each worker." )
+{
+    if ( JobPool::Instance )
+        JobPool::Instance->dumpMetrics();
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleFunction( resetJobPoolMetrics, void, 1, 1, "() Reset the job pool metrics." )
+{
+    if ( JobPool::Instance )
+        JobPool::Instance->resetMetrics();
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleFunction( getJobPoolWorkerCount, S32, 1, 1, "() Gets the number of job pool worker threads.\n"
+                                                    "@return The number of worker threads (zero when jobs run inline)." )
+{
+    return JobPool::Instance ? JobPool::Instance->getWorkerCount() : 0;
+}
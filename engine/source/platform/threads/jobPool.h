@@ -0,0 +1,173 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _PLATFORM_THREADS_JOBPOOL_H_
+#define _PLATFORM_THREADS_JOBPOOL_H_
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+#ifndef _PLATFORM_THREAD_SEMAPHORE_H_
+#include "platform/threads/semaphore.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// A job processes the items [start, end) of the data it is handed.
+typedef void (*JobFunction)( void* pContext, const U32 start, const U32 end );
+
+//-----------------------------------------------------------------------------
+
+/// Tracks the outstanding jobs of a single submission so a caller can wait on them.
+class JobCounter
+{
+    friend class JobPool;
+
+    Mutex     mLock;
+    U32       mPending;
+    bool      mWaiting;
+    Semaphore mComplete;
+
+public:
+    JobCounter() : mPending( 0 ), mWaiting( false ), mComplete( 0 ) {}
+
+    bool isComplete( void ) { mLock.lock(); const bool complete = mPending == 0; mLock.unlock(); return complete; }
+};
+
+//-----------------------------------------------------------------------------
+
+/// Work-stealing pool of worker threads shared by engine subsystems.
+/// Each worker owns a queue it pops from the back of while idle workers steal from
+/// the front of the others. A thread waiting on a counter runs queued jobs itself
+/// and only blocks once nothing is left to run. A pool created with no workers, as
+/// every pool is when TORQUE_JOB_POOL_INLINE is defined, runs all jobs inline on
+/// the submitting thread.
+///
+/// Unless TORQUE_MULTITHREAD is defined the console and sim are not thread-safe so
+/// jobs must not execute script nor add or remove objects from sim sets. Those
+/// entry points assert with AssertNotJobWorker when called from a worker.
+class JobPool
+{
+public:
+    enum
+    {
+        DefaultWorkerCount = 3,
+        MaxWorkerCount = 16,
+    };
+
+private:
+    struct Job
+    {
+        JobFunction mFunction;
+        void*       mpContext;
+        U32         mStart;
+        U32         mEnd;
+        JobCounter* mpCounter;
+    };
+
+    /// Ring of jobs so that both the owner and thieves take jobs in constant time.
+    struct JobQueue
+    {
+        JobQueue() : mHead( 0 ), mCount( 0 ) {}
+
+        void pushBack( const Job& job );
+        void popBack( Job& job );
+        void popFront( Job& job );
+
+        Mutex       mLock;
+        Vector<Job> mJobs;
+        U32         mHead;
+        U32         mCount;
+    };
+
+    class WorkerThread : public Thread
+    {
+    public:
+        WorkerThread( JobPool* pJobPool, const U32 workerIndex ) : Thread( 0, 0, false ), mpJobPool( pJobPool ), mWorkerIndex( workerIndex ) {}
+        virtual void run( void* arg = 0 );
+
+    private:
+        JobPool* mpJobPool;
+        U32      mWorkerIndex;
+    };
+
+    /// One queue per worker plus one for the submitting threads.
+    Vector<JobQueue*>       mQueues;
+    Vector<WorkerThread*>   mWorkers;
+    Semaphore               mJobsAvailable;
+    bool                    mShutdown;
+    U32                     mNextQueue;
+
+    /// Metrics.
+    Mutex                   mMetricsLock;
+    U32                     mMetricsStartTime;
+    U32                     mJobsSubmitted;
+    U32                     mJobsStolen;
+    U32                     mJobsRunByWaiters;
+    Vector<U32>             mWorkerJobs;
+    Vector<U32>             mWorkerBusyTime;
+
+private:
+    bool popJob( const U32 queueIndex, Job& job );
+    bool stealJob( const U32 queueIndex, Job& job );
+    void runJob( const Job& job );
+    void workerLoop( const U32 workerIndex );
+
+public:
+    JobPool( const U32 workerCount );
+    ~JobPool();
+
+    static void Init( const U32 workerCount = DefaultWorkerCount );
+    static void destroy( void );
+    static JobPool* Instance;
+
+    inline U32 getWorkerCount( void ) const { return (U32)mWorkers.size(); }
+
+    /// Whether the calling thread is a worker of any job pool.
+    static bool isWorkerThread( void );
+
+    /// Queue a job over the items [start, end) and increment the counter.
+    void submit( JobFunction function, void* pContext, const U32 start, const U32 end, JobCounter& counter );
+
+    /// Block until all jobs tracked by the counter have completed, running queued jobs meanwhile.
+    void wait( JobCounter& counter );
+
+    /// Split the items [0, count) into batches, run them across the pool and wait for them all.
+    /// The function runs on the workers so it must only touch thread-safe systems.
+    void parallelFor( JobFunction function, void* pContext, const U32 count, const U32 batchSize );
+
+    /// Metrics.
+    void resetMetrics( void );
+    void dumpMetrics( void );
+};
+
+//-----------------------------------------------------------------------------
+
+/// Assert that a system which is only thread-safe with TORQUE_MULTITHREAD is not used by a job.
+#ifdef TORQUE_MULTITHREAD
+#define AssertNotJobWorker( system )
+#else
+#define AssertNotJobWorker( system ) AssertFatal( !JobPool::isWorkerThread(), system " cannot be used by jobs unless TORQUE_MULTITHREAD is defined." )
+#endif
+
+#endif // _PLATFORM_THREADS_JOBPOOL_H_
@@ -30,6 +30,9 @@
 
 #include <sys/stat.h>
 #include <sys/time.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 // Maximum character length for file paths
 #define MAX_MAC_PATH_LONG 2048
@@ -978,6 +981,46 @@ S32 Platform::getFileSize(const char* pFilePath)
     return fileLength;
 }
 
+//-----------------------------------------------------------------------------
+void* Platform::mapFile(const char *pFilePath, U32& size)
+{
+    size = 0;
+
+    if (!pFilePath || !*pFilePath)
+        return NULL;
+
+    // Open the file.
+    const int fd = open(pFilePath, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+
+    // Fetch the file size.
+    struct stat fStat;
+    if (fstat(fd, &fStat) < 0 || fStat.st_size <= 0)
+    {
+        close(fd);
+        return NULL;
+    }
+
+    // Map the file read-only.
+    // The mapping keeps the file referenced so the descriptor is no longer needed.
+    void* pMapping = mmap(NULL, (size_t)fStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (pMapping == MAP_FAILED)
+        return NULL;
+
+    size = (U32)fStat.st_size;
+    return pMapping;
+}
+
+//-----------------------------------------------------------------------------
+void Platform::unmapFile(void* pMapping, const U32 size)
+{
+    if (pMapping != NULL)
+        munmap(pMapping, size);
+}
+
 //-----------------------------------------------------------------------------
 
 bool Platform::isSubDirectory(const char *pathParent, const char *pathSub)
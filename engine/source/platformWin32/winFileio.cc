@@ -872,6 +872,65 @@ S32 Platform::getFileSize(const char *pFilePath)
 }
 
 
+//--------------------------------------
+void* Platform::mapFile(const char *pFilePath, U32& size)
+{
+   size = 0;
+
+   if (!pFilePath || !*pFilePath)
+      return NULL;
+
+   // Open the file.
+   char filebuf[2048];
+   dStrncpy(filebuf, pFilePath, sizeof(filebuf));
+   filebuf[sizeof(filebuf)-1] = 0;
+   backslash(filebuf);
+#ifdef UNICODE
+   UTF16 fname[2048];
+   convertUTF8toUTF16((UTF8 *)filebuf, fname, sizeof(fname));
+#else
+   char *fname;
+   fname = filebuf;
+#endif
+
+   HANDLE file = CreateFile( fname, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+   if ( file == INVALID_HANDLE_VALUE )
+      return NULL;
+
+   // Fetch the file size.
+   DWORD fileSizeHigh = 0;
+   const DWORD fileSize = GetFileSize( file, &fileSizeHigh );
+   if ( fileSize == INVALID_FILE_SIZE || fileSize == 0 || fileSizeHigh != 0 )
+   {
+      CloseHandle( file );
+      return NULL;
+   }
+
+   // Map the file read-only.
+   // The view keeps the mapping and file referenced so the handles are no longer needed.
+   HANDLE mapping = CreateFileMapping( file, NULL, PAGE_READONLY, 0, 0, NULL );
+   CloseHandle( file );
+   if ( mapping == NULL )
+      return NULL;
+
+   void* pMapping = MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 );
+   CloseHandle( mapping );
+
+   if ( pMapping == NULL )
+      return NULL;
+
+   size = fileSize;
+   return pMapping;
+}
+
+//--------------------------------------
+void Platform::unmapFile(void* pMapping, const U32 size)
+{
+   if ( pMapping != NULL )
+      UnmapViewOfFile( pMapping );
+}
+
+
 //--------------------------------------
 bool Platform::isDirectory(const char *pDirPath)
 {
@@ -74,6 +74,7 @@
  #include <sys/stat.h>
  #include <unistd.h>
  #include <fcntl.h>
+ #include <sys/mman.h>
  #include <errno.h>
  #include <stdlib.h>
  
@@ -930,6 +931,46 @@ bool dPathCopy(const char *fromName, const char *toName, bool nooverwrite)
    // Must be something else or we can't read the file.
    return -1;
  }
+
+ //-----------------------------------------------------------------------------
+ void* Platform::mapFile(const char *pFilePath, U32& size)
+ {
+    size = 0;
+
+    if (!pFilePath || !*pFilePath)
+       return NULL;
+
+    // Open the file.
+    const int fd = open(pFilePath, O_RDONLY);
+    if (fd < 0)
+       return NULL;
+
+    // Fetch the file size.
+    struct stat fStat;
+    if (fstat(fd, &fStat) < 0 || fStat.st_size <= 0)
+    {
+       close(fd);
+       return NULL;
+    }
+
+    // Map the file read-only.
+    // The mapping keeps the file referenced so the descriptor is no longer needed.
+    void* pMapping = mmap(NULL, (size_t)fStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (pMapping == MAP_FAILED)
+       return NULL;
+
+    size = (U32)fStat.st_size;
+    return pMapping;
+ }
+
+ //-----------------------------------------------------------------------------
+ void Platform::unmapFile(void* pMapping, const U32 size)
+ {
+    if (pMapping != NULL)
+       munmap(pMapping, size);
+ }
  
  //-----------------------------------------------------------------------------
  bool Platform::isDirectory(const char *pDirPath)
@@ -32,6 +32,7 @@
 #include "debug/profiler.h"
 #include "console/consoleTypeValidators.h"
 #include "memory/frameAllocator.h"
+#include "platform/threads/jobPool.h"
 
 //////////////////////////////////////////////////////////////////////////
 // Sim Set
@@ -39,6 +40,8 @@
 
 void SimSet::addObject(SimObject* obj)
 {
+   AssertNotJobWorker( "SimSet::addObject()" );
+
    lock();
    objectList.pushBack(obj);
    deleteNotify(obj);
@@ -47,6 +50,8 @@ void SimSet::addObject(SimObject* obj)
 
 void SimSet::removeObject(SimObject* obj)
 {
+   AssertNotJobWorker( "SimSet::removeObject()" );
+
    lock();
    objectList.remove(obj);
    clearNotify(obj);
@@ -0,0 +1,191 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// Benchmarks are only built on request.
+#if defined(TORQUE_BENCHMARKS) && !defined(TORQUE_SHIPPING)
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _BITSTREAM_H_
+#include "io/bitStream.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define BITSTREAM_BENCHMARK_BUFFERSIZE      1024
+#define BITSTREAM_BENCHMARK_OBJECTS         48
+#define BITSTREAM_BENCHMARK_PACKETS         20000
+
+//-----------------------------------------------------------------------------
+
+struct BitStreamBenchmarkObject
+{
+    F32 mPosition[2];
+    F32 mAngle;
+    S32 mVelocity[2];
+    S32 mLayer;
+};
+
+//-----------------------------------------------------------------------------
+
+TEST( BitStreamBenchmarks, PacketBuildAndParse )
+{
+    // Build a set of objects in the same shape as a scene replication update.
+    BitStreamBenchmarkObject objects[BITSTREAM_BENCHMARK_OBJECTS];
+    for ( U32 n = 0; n < BITSTREAM_BENCHMARK_OBJECTS; ++n )
+    {
+        objects[n].mPosition[0] = (F32)((n * 37) % 200) - 100.0f;
+        objects[n].mPosition[1] = (F32)((n * 53) % 200) - 100.0f;
+        objects[n].mAngle = (F32)(n % 16) / 16.0f;
+        objects[n].mVelocity[0] = (S32)(n * 7 % 2000) - 1000;
+        objects[n].mVelocity[1] = (S32)(n * 11 % 2000) - 1000;
+        objects[n].mLayer = n % 32;
+    }
+
+    U8 buffer[BITSTREAM_BENCHMARK_BUFFERSIZE];
+    S32 packetBits = 0;
+
+    // Build the packets a value at a time.
+    U32 startTime = Platform::getRealMilliseconds();
+    for ( U32 packet = 0; packet < BITSTREAM_BENCHMARK_PACKETS; ++packet )
+    {
+        BitStream stream( buffer, sizeof(buffer) );
+        stream.writeInt( packet, 32 );
+        stream.writeString( "SceneObjectGhost" );
+        for ( U32 n = 0; n < BITSTREAM_BENCHMARK_OBJECTS; ++n )
+        {
+            const BitStreamBenchmarkObject& object = objects[n];
+            stream.writeFlag( true );
+            stream.writeRangedF32( object.mPosition[0], -100.0f, 100.0f, 20 );
+            stream.writeRangedF32( object.mPosition[1], -100.0f, 100.0f, 20 );
+            stream.writeFloat( object.mAngle, 14 );
+            stream.writeSignedInt( object.mVelocity[0], 12 );
+            stream.writeSignedInt( object.mVelocity[1], 12 );
+            stream.writeInt( object.mLayer, 5 );
+        }
+        packetBits = stream.getCurPos();
+    }
+    const U32 singleBuildTime = Platform::getRealMilliseconds() - startTime;
+
+    // Parse the packets a value at a time.
+    char name[256];
+    BitStreamBenchmarkObject results[BITSTREAM_BENCHMARK_OBJECTS];
+    startTime = Platform::getRealMilliseconds();
+    for ( U32 packet = 0; packet < BITSTREAM_BENCHMARK_PACKETS; ++packet )
+    {
+        BitStream stream( buffer, sizeof(buffer) );
+        stream.readInt( 32 );
+        stream.readString( name );
+        for ( U32 n = 0; n < BITSTREAM_BENCHMARK_OBJECTS; ++n )
+        {
+            BitStreamBenchmarkObject& result = results[n];
+            stream.readFlag();
+            result.mPosition[0] = stream.readRangedF32( -100.0f, 100.0f, 20 );
+            result.mPosition[1] = stream.readRangedF32( -100.0f, 100.0f, 20 );
+            result.mAngle = stream.readFloat( 14 );
+            result.mVelocity[0] = stream.readSignedInt( 12 );
+            result.mVelocity[1] = stream.readSignedInt( 12 );
+            result.mLayer = stream.readInt( 5 );
+        }
+    }
+    const U32 singleParseTime = Platform::getRealMilliseconds() - startTime;
+
+    // Every object must have survived the round trip within the quantization.
+    ASSERT_STREQ( name, "SceneObjectGhost" );
+    for ( U32 n = 0; n < BITSTREAM_BENCHMARK_OBJECTS; ++n )
+    {
+        ASSERT_NEAR( objects[n].mPosition[0], results[n].mPosition[0], 0.001f );
+        ASSERT_NEAR( objects[n].mPosition[1], results[n].mPosition[1], 0.001f );
+        ASSERT_NEAR( objects[n].mAngle, results[n].mAngle, 0.001f );
+        ASSERT_EQ( objects[n].mVelocity[0], results[n].mVelocity[0] );
+        ASSERT_EQ( objects[n].mVelocity[1], results[n].mVelocity[1] );
+        ASSERT_EQ( objects[n].mLayer, results[n].mLayer );
+    }
+
+    // Gather each field into its own array.
+    F32 positions[BITSTREAM_BENCHMARK_OBJECTS * 2];
+    F32 angles[BITSTREAM_BENCHMARK_OBJECTS];
+    S32 velocities[BITSTREAM_BENCHMARK_OBJECTS * 2];
+    S32 layers[BITSTREAM_BENCHMARK_OBJECTS];
+    for ( U32 n = 0; n < BITSTREAM_BENCHMARK_OBJECTS; ++n )
+    {
+        positions[n*2] = objects[n].mPosition[0];
+        positions[n*2+1] = objects[n].mPosition[1];
+        angles[n] = objects[n].mAngle;
+        velocities[n*2] = objects[n].mVelocity[0];
+        velocities[n*2+1] = objects[n].mVelocity[1];
+        layers[n] = objects[n].mLayer;
+    }
+
+    // Build the packets a field at a time.
+    startTime = Platform::getRealMilliseconds();
+    for ( U32 packet = 0; packet < BITSTREAM_BENCHMARK_PACKETS; ++packet )
+    {
+        BitStream stream( buffer, sizeof(buffer) );
+        stream.writeInt( packet, 32 );
+        stream.writeString( "SceneObjectGhost" );
+        stream.writeRangedF32s( positions, BITSTREAM_BENCHMARK_OBJECTS * 2, -100.0f, 100.0f, 20 );
+        stream.writeFloats( angles, BITSTREAM_BENCHMARK_OBJECTS, 14 );
+        stream.writeSignedInts( velocities, BITSTREAM_BENCHMARK_OBJECTS * 2, 12 );
+        stream.writeInts( layers, BITSTREAM_BENCHMARK_OBJECTS, 5 );
+    }
+    const U32 batchBuildTime = Platform::getRealMilliseconds() - startTime;
+
+    // Parse the packets a field at a time.
+    startTime = Platform::getRealMilliseconds();
+    for ( U32 packet = 0; packet < BITSTREAM_BENCHMARK_PACKETS; ++packet )
+    {
+        BitStream stream( buffer, sizeof(buffer) );
+        stream.readInt( 32 );
+        stream.readString( name );
+        stream.readRangedF32s( positions, BITSTREAM_BENCHMARK_OBJECTS * 2, -100.0f, 100.0f, 20 );
+        stream.readFloats( angles, BITSTREAM_BENCHMARK_OBJECTS, 14 );
+        stream.readSignedInts( velocities, BITSTREAM_BENCHMARK_OBJECTS * 2, 12 );
+        stream.readInts( layers, BITSTREAM_BENCHMARK_OBJECTS, 5 );
+    }
+    const U32 batchParseTime = Platform::getRealMilliseconds() - startTime;
+
+    // The batches must match the single values.
+    ASSERT_STREQ( name, "SceneObjectGhost" );
+    for ( U32 n = 0; n < BITSTREAM_BENCHMARK_OBJECTS; ++n )
+    {
+        ASSERT_NEAR( results[n].mPosition[0], positions[n*2], 0.001f );
+        ASSERT_NEAR( results[n].mPosition[1], positions[n*2+1], 0.001f );
+        ASSERT_NEAR( results[n].mAngle, angles[n], 0.001f );
+        ASSERT_EQ( results[n].mVelocity[0], velocities[n*2] );
+        ASSERT_EQ( results[n].mVelocity[1], velocities[n*2+1] );
+        ASSERT_EQ( results[n].mLayer, layers[n] );
+    }
+
+    Con::printf( ">> %d packets of %d objects (%d bytes): single values took %dms to build and %dms to parse.",
+        BITSTREAM_BENCHMARK_PACKETS, BITSTREAM_BENCHMARK_OBJECTS, (packetBits + 7) >> 3, singleBuildTime, singleParseTime );
+    Con::printf( ">> %d packets of %d objects: batches took %dms to build and %dms to parse.",
+        BITSTREAM_BENCHMARK_PACKETS, BITSTREAM_BENCHMARK_OBJECTS, batchBuildTime, batchParseTime );
+}
+
+#endif // TORQUE_BENCHMARKS
@@ -0,0 +1,265 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// Benchmarks are only built on request.
+#if defined(TORQUE_BENCHMARKS) && !defined(TORQUE_SHIPPING)
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _NETCONNECTION_H_
+#include "network/netConnection.h"
+#endif
+
+#ifndef _NETINTERESTGRID_H_
+#include "network/netInterestGrid.h"
+#endif
+
+#ifndef _BITSTREAM_H_
+#include "io/bitStream.h"
+#endif
+
+#ifndef _MRANDOM_H_
+#include "math/mRandom.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define NETGHOST_BENCHMARK_WORLD_SIZE        2000.0f
+#define NETGHOST_BENCHMARK_OBJECTS           20000
+#define NETGHOST_BENCHMARK_CONNECTIONS       64
+#define NETGHOST_BENCHMARK_VIEW_DISTANCE     150.0f
+#define NETGHOST_BENCHMARK_PACKET_SIZE       1400
+#define NETGHOST_BENCHMARK_SETTLE_FRAMES     100
+#define NETGHOST_BENCHMARK_FRAMES            100
+#define NETGHOST_BENCHMARK_MOVES_PER_FRAME   2000
+
+//-----------------------------------------------------------------------------
+
+class NetGhostBenchmarkObject : public NetObject
+{
+    typedef NetObject Parent;
+
+public:
+    enum MaskBits
+    {
+        PositionMask = BIT(0),
+    };
+
+    NetGhostBenchmarkObject() : mProxyId( NetInterestGrid::InvalidProxy )
+    {
+        mPosition.set( 0.0f, 0.0f );
+        mNetFlags.set( Ghostable );
+    }
+
+    void setPosition( const Point2F& position )
+    {
+        mPosition = position;
+        setMaskBits( PositionMask );
+    }
+
+    virtual F32 getUpdatePriority( CameraScopeQuery* pFocusObject, U32 updateMask, S32 updateSkips )
+    {
+        // Nearer objects and those skipped for longer first.
+        const Point2F offset( mPosition.x - pFocusObject->pos.x, mPosition.y - pFocusObject->pos.y );
+        return 1.0f - mClampF( offset.len() / pFocusObject->visibleDistance, 0.0f, 1.0f ) + (F32)updateSkips * 0.1f;
+    }
+
+    virtual U32 packUpdate( NetConnection* pConnection, U32 mask, BitStream* pStream )
+    {
+        if ( pStream->writeFlag( mask & PositionMask ) )
+        {
+            pStream->write( mPosition.x );
+            pStream->write( mPosition.y );
+        }
+
+        return 0;
+    }
+
+    virtual void unpackUpdate( NetConnection* pConnection, BitStream* pStream )
+    {
+        if ( pStream->readFlag() )
+        {
+            pStream->read( &mPosition.x );
+            pStream->read( &mPosition.y );
+        }
+    }
+
+    Point2F mPosition;
+    S32     mProxyId;
+
+    DECLARE_CONOBJECT( NetGhostBenchmarkObject );
+};
+
+IMPLEMENT_CO_NETOBJECT_V1( NetGhostBenchmarkObject );
+
+//-----------------------------------------------------------------------------
+
+class NetGhostBenchmarkScope : public NetObject
+{
+public:
+    NetGhostBenchmarkScope() : mpGrid( NULL ) { mCamera.set( 0.0f, 0.0f ); }
+
+    virtual void onCameraScopeQuery( NetConnection* pConnection, CameraScopeQuery* pCameraInfo )
+    {
+        pCameraInfo->camera = this;
+        pCameraInfo->pos.set( mCamera.x, mCamera.y, 0.0f );
+        pCameraInfo->visibleDistance = NETGHOST_BENCHMARK_VIEW_DISTANCE;
+
+        mpGrid->scopeObjects( pConnection, mCamera, NETGHOST_BENCHMARK_VIEW_DISTANCE );
+    }
+
+    NetInterestGrid*    mpGrid;
+    Point2F             mCamera;
+};
+
+//-----------------------------------------------------------------------------
+
+class NetGhostBenchmarkConnection : public NetConnection
+{
+public:
+    void startGhosting( void )
+    {
+        setGhostFrom( true );
+        activateGhosting();
+        mGhosting = true;
+    }
+
+    /// Write a packet of ghost updates and acknowledge it straight away.
+    U32 writeGhostPacket( void )
+    {
+        BitStream* pStream = BitStream::getPacketStream( NETGHOST_BENCHMARK_PACKET_SIZE );
+        PacketNotify* pNotify = allocNotify();
+        ghostWritePacket( pStream, pNotify );
+        const U32 bits = pStream->getCurPos();
+        ghostPacketReceived( pNotify );
+        delete pNotify;
+        return bits;
+    }
+};
+
+//-----------------------------------------------------------------------------
+
+TEST( NetGhostBenchmarks, Loopback )
+{
+    NetInterestGrid grid;
+    RandomLCG random( 5678 );
+    const F32 worldExtent = NETGHOST_BENCHMARK_WORLD_SIZE * 0.5f;
+
+    // Create the ghosted objects.
+    Vector<NetGhostBenchmarkObject*> objects;
+    for ( U32 n = 0; n < NETGHOST_BENCHMARK_OBJECTS; ++n )
+    {
+        NetGhostBenchmarkObject* pObject = new NetGhostBenchmarkObject();
+        pObject->mPosition.set( random.randRangeF( -worldExtent, worldExtent ), random.randRangeF( -worldExtent, worldExtent ) );
+        ASSERT_TRUE( pObject->registerObject() );
+        pObject->mProxyId = grid.addObject( pObject, pObject->mPosition, 1.0f );
+        objects.push_back( pObject );
+    }
+
+    // Create the connections, each with its own camera.
+    Vector<NetGhostBenchmarkConnection*> connections;
+    Vector<NetGhostBenchmarkScope*> scopes;
+    for ( U32 n = 0; n < NETGHOST_BENCHMARK_CONNECTIONS; ++n )
+    {
+        NetGhostBenchmarkScope* pScope = new NetGhostBenchmarkScope();
+        pScope->mpGrid = &grid;
+        pScope->mCamera.set( random.randRangeF( -worldExtent, worldExtent ), random.randRangeF( -worldExtent, worldExtent ) );
+        ASSERT_TRUE( pScope->registerObject() );
+        scopes.push_back( pScope );
+
+        NetGhostBenchmarkConnection* pConnection = new NetGhostBenchmarkConnection();
+        ASSERT_TRUE( pConnection->registerObject() );
+        pConnection->setScopeObject( pScope );
+        pConnection->startGhosting();
+        connections.push_back( pConnection );
+    }
+
+    // Ghost the objects in view while nothing moves.
+    U64 totalBits = 0;
+    U32 startTime = Platform::getRealMilliseconds();
+    for ( U32 frame = 0; frame < NETGHOST_BENCHMARK_SETTLE_FRAMES; ++frame )
+    {
+        for ( S32 n = 0; n < connections.size(); ++n )
+            totalBits += connections[n]->writeGhostPacket();
+    }
+    const U32 settleTime = Platform::getRealMilliseconds() - startTime;
+
+    // Every object in view should now be ghosted.
+    U32 ghostCount = 0;
+    Vector<NetObject*> visible;
+    for ( S32 n = 0; n < connections.size(); ++n )
+    {
+        visible.clear();
+        grid.findObjects( scopes[n]->mCamera, NETGHOST_BENCHMARK_VIEW_DISTANCE, visible );
+        for ( S32 i = 0; i < visible.size(); ++i )
+        {
+            ASSERT_GE( connections[n]->getGhostIndex( visible[i] ), 0 ) << "Object in view of connection " << n << " was not ghosted.";
+        }
+        ghostCount += visible.size();
+    }
+
+    // Move objects and cameras every frame.
+    startTime = Platform::getRealMilliseconds();
+    for ( U32 frame = 0; frame < NETGHOST_BENCHMARK_FRAMES; ++frame )
+    {
+        for ( U32 n = 0; n < NETGHOST_BENCHMARK_MOVES_PER_FRAME; ++n )
+        {
+            NetGhostBenchmarkObject* pObject = objects[random.randRangeI( 0, objects.size() - 1 )];
+            const Point2F position( mClampF( pObject->mPosition.x + random.randRangeF( -2.0f, 2.0f ), -worldExtent, worldExtent ),
+                                    mClampF( pObject->mPosition.y + random.randRangeF( -2.0f, 2.0f ), -worldExtent, worldExtent ) );
+            pObject->setPosition( position );
+            grid.moveObject( pObject->mProxyId, position, 1.0f );
+        }
+
+        // Fold the moves into the ghost update masks.
+        NetObject::collapseDirtyList();
+
+        for ( S32 n = 0; n < connections.size(); ++n )
+        {
+            scopes[n]->mCamera.x = mClampF( scopes[n]->mCamera.x + 1.0f, -worldExtent, worldExtent );
+            totalBits += connections[n]->writeGhostPacket();
+        }
+    }
+    const U32 updateTime = Platform::getRealMilliseconds() - startTime;
+
+    const U32 packetCount = (NETGHOST_BENCHMARK_SETTLE_FRAMES + NETGHOST_BENCHMARK_FRAMES) * NETGHOST_BENCHMARK_CONNECTIONS;
+    Con::printf( "NetGhostBenchmarks: %d objects, %d connections, %d ghosts in view.", NETGHOST_BENCHMARK_OBJECTS, NETGHOST_BENCHMARK_CONNECTIONS, ghostCount );
+    Con::printf( "NetGhostBenchmarks: settle %dms, update %dms (%.3fms per packet), %.1f bytes per packet.",
+        settleTime, updateTime, (F32)updateTime / (F32)(NETGHOST_BENCHMARK_FRAMES * NETGHOST_BENCHMARK_CONNECTIONS), (F64)totalBits / 8.0 / (F64)packetCount );
+
+    // Clean up.
+    for ( S32 n = 0; n < connections.size(); ++n )
+    {
+        connections[n]->deleteObject();
+        scopes[n]->deleteObject();
+    }
+    for ( S32 n = 0; n < objects.size(); ++n )
+        objects[n]->deleteObject();
+}
+
+#endif // TORQUE_BENCHMARKS
@@ -0,0 +1,166 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// Benchmarks are only built on request.
+#if defined(TORQUE_BENCHMARKS) && !defined(TORQUE_SHIPPING)
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _ATTRACTOR_CONTROLLER_H_
+#include "2d/controllers/PointForceController.h"
+#endif
+
+#ifndef _BUOYANCY_CONTROLLER_H_
+#include "2d/controllers/BuoyancyController.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define SCENE_CONTROLLER_BENCHMARK_BODY_ROWS         100
+#define SCENE_CONTROLLER_BENCHMARK_CONTROLLER_ROWS   10
+#define SCENE_CONTROLLER_BENCHMARK_TICKS             60
+
+//-----------------------------------------------------------------------------
+
+static Scene* createControllerBenchmarkScene( void )
+{
+    // Create the scene without gravity so only the controllers move bodies.
+    Scene* pScene = new Scene();
+    pScene->registerObject();
+    pScene->setGravity( b2Vec2_zero );
+
+    // Add a grid of 10k dynamic bodies.
+    for ( U32 y = 0; y < SCENE_CONTROLLER_BENCHMARK_BODY_ROWS; ++y )
+    {
+        for ( U32 x = 0; x < SCENE_CONTROLLER_BENCHMARK_BODY_ROWS; ++x )
+        {
+            SceneObject* pSceneObject = new SceneObject();
+            pSceneObject->registerObject();
+            pSceneObject->setBodyType( b2_dynamicBody );
+            pSceneObject->setPosition( Vector2( (F32)x, (F32)y ) );
+            pSceneObject->setSize( Vector2( 0.5f, 0.5f ) );
+            pSceneObject->createCircleCollisionShape( 0.25f );
+            pScene->addToScene( pSceneObject );
+        }
+    }
+
+    return pScene;
+}
+
+//-----------------------------------------------------------------------------
+
+static U32 tickControllerBenchmarkScene( Scene* pScene )
+{
+    // Tick the scene.
+    const U32 startTime = Platform::getRealMilliseconds();
+    for ( U32 n = 0; n < SCENE_CONTROLLER_BENCHMARK_TICKS; ++n )
+    {
+        pScene->processTick();
+    }
+
+    return Platform::getRealMilliseconds() - startTime;
+}
+
+//-----------------------------------------------------------------------------
+
+static U32 countMovingBodies( Scene* pScene )
+{
+    U32 movingCount = 0;
+    for ( U32 n = 0; n < pScene->getSceneObjectCount(); ++n )
+    {
+        if ( pScene->getSceneObject( n )->getLinearVelocity().notZero() )
+            movingCount++;
+    }
+
+    return movingCount;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneControllerBenchmarks, PointForceRegions )
+{
+    Scene* pScene = createControllerBenchmarkScene();
+
+    // Add a grid of 100 point-force controllers.
+    const F32 controllerSpacing = (F32)SCENE_CONTROLLER_BENCHMARK_BODY_ROWS / (F32)SCENE_CONTROLLER_BENCHMARK_CONTROLLER_ROWS;
+    for ( U32 y = 0; y < SCENE_CONTROLLER_BENCHMARK_CONTROLLER_ROWS; ++y )
+    {
+        for ( U32 x = 0; x < SCENE_CONTROLLER_BENCHMARK_CONTROLLER_ROWS; ++x )
+        {
+            PointForceController* pController = new PointForceController();
+            pController->registerObject();
+            pController->setPosition( Vector2( ((F32)x + 0.5f) * controllerSpacing, ((F32)y + 0.5f) * controllerSpacing ) );
+            pController->setRadius( controllerSpacing * 0.5f );
+            pController->setForce( 10.0f );
+            pScene->getControllers()->addObject( pController );
+        }
+    }
+
+    // Tick the scene.
+    const U32 elapsedTime = tickControllerBenchmarkScene( pScene );
+    Con::printf( ">> %d point-force controllers over %d bodies took %dms for %d ticks.",
+        pScene->getControllers()->size(), pScene->getSceneObjectCount(), elapsedTime, SCENE_CONTROLLER_BENCHMARK_TICKS );
+
+    // Check the controllers moved bodies inside their regions.
+    ASSERT_GT( countMovingBodies( pScene ), (U32)0 ) << "No bodies were moved by the point-force controllers.";
+
+    pScene->deleteObject();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneControllerBenchmarks, BuoyancyRegions )
+{
+    Scene* pScene = createControllerBenchmarkScene();
+
+    // Add 100 buoyancy controllers in horizontal bands.
+    const F32 controllerSpacing = (F32)SCENE_CONTROLLER_BENCHMARK_BODY_ROWS / (F32)(SCENE_CONTROLLER_BENCHMARK_CONTROLLER_ROWS * SCENE_CONTROLLER_BENCHMARK_CONTROLLER_ROWS);
+    for ( U32 n = 0; n < SCENE_CONTROLLER_BENCHMARK_CONTROLLER_ROWS * SCENE_CONTROLLER_BENCHMARK_CONTROLLER_ROWS; ++n )
+    {
+        BuoyancyController* pController = new BuoyancyController();
+        pController->registerObject();
+        pController->setDataField( StringTable->insert("FluidArea"), NULL, avar( "0 %g %d %g", (F32)n * controllerSpacing, SCENE_CONTROLLER_BENCHMARK_BODY_ROWS, ((F32)n + 0.5f) * controllerSpacing ) );
+        pScene->getControllers()->addObject( pController );
+    }
+
+    // Tick the scene.
+    const U32 elapsedTime = tickControllerBenchmarkScene( pScene );
+    Con::printf( ">> %d buoyancy controllers over %d bodies took %dms for %d ticks.",
+        pScene->getControllers()->size(), pScene->getSceneObjectCount(), elapsedTime, SCENE_CONTROLLER_BENCHMARK_TICKS );
+
+    // Check the controllers moved bodies inside their regions.
+    ASSERT_GT( countMovingBodies( pScene ), (U32)0 ) << "No bodies were moved by the buoyancy controllers.";
+
+    pScene->deleteObject();
+}
+
+#endif // TORQUE_BENCHMARKS
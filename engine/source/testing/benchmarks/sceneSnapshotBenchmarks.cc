@@ -0,0 +1,151 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// Benchmarks are only built on request.
+#if defined(TORQUE_BENCHMARKS) && !defined(TORQUE_SHIPPING)
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _SCENE_OBJECT_H_
+#include "2d/sceneobject/SceneObject.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define SCENE_SNAPSHOT_BENCHMARK_OBJECT_ROWS        200
+#define SCENE_SNAPSHOT_BENCHMARK_OBJECT_COLUMNS     100
+#define SCENE_SNAPSHOT_BENCHMARK_ITERATIONS         10
+#define SCENE_SNAPSHOT_BENCHMARK_DELETE_STRIDE      10
+
+//-----------------------------------------------------------------------------
+
+static Scene* createSnapshotBenchmarkScene( void )
+{
+    // Create the scene without gravity so only the benchmark moves bodies.
+    Scene* pScene = new Scene();
+    pScene->registerObject();
+    pScene->setGravity( b2Vec2_zero );
+
+    // Add a grid of 20k dynamic bodies.
+    for ( U32 y = 0; y < SCENE_SNAPSHOT_BENCHMARK_OBJECT_ROWS; ++y )
+    {
+        for ( U32 x = 0; x < SCENE_SNAPSHOT_BENCHMARK_OBJECT_COLUMNS; ++x )
+        {
+            SceneObject* pSceneObject = new SceneObject();
+            pSceneObject->registerObject();
+            pSceneObject->setBodyType( b2_dynamicBody );
+            pSceneObject->setPosition( Vector2( (F32)x, (F32)y ) );
+            pSceneObject->setSize( Vector2( 0.5f, 0.5f ) );
+            pSceneObject->setLinearVelocity( Vector2( 1.0f, 0.0f ) );
+            pScene->addToScene( pSceneObject );
+        }
+    }
+
+    return pScene;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneSnapshotBenchmarks, CaptureAndRestore )
+{
+    Scene* pScene = createSnapshotBenchmarkScene();
+    const U32 objectCount = pScene->getSceneObjectCount();
+
+    // Capture the scene.
+    U32 memorySize = 0;
+    U32 startTime = Platform::getRealMilliseconds();
+    for ( U32 n = 0; n < SCENE_SNAPSHOT_BENCHMARK_ITERATIONS; ++n )
+    {
+        memorySize = pScene->saveSnapshot( "benchmark" );
+    }
+    const U32 captureTime = Platform::getRealMilliseconds() - startTime;
+
+    // Restore after moving every object.
+    U32 restoreTime = 0;
+    for ( U32 n = 0; n < SCENE_SNAPSHOT_BENCHMARK_ITERATIONS; ++n )
+    {
+        for ( U32 objectIndex = 0; objectIndex < objectCount; ++objectIndex )
+        {
+            pScene->getSceneObject( objectIndex )->setPosition( Vector2( (F32)objectIndex, -1.0f ) );
+        }
+
+        startTime = Platform::getRealMilliseconds();
+        pScene->restoreSnapshot( "benchmark" );
+        restoreTime += Platform::getRealMilliseconds() - startTime;
+    }
+
+    Con::printf( ">> Snapshot of %d objects (%d bytes) took %dms to capture and %dms to restore moved objects for %d iterations.",
+        objectCount, memorySize, captureTime, restoreTime, SCENE_SNAPSHOT_BENCHMARK_ITERATIONS );
+
+    // Check the objects were restored.
+    ASSERT_EQ( pScene->getSceneObjectCount(), objectCount );
+    ASSERT_TRUE( pScene->getSceneObject( 0 )->getPosition() == Vector2( 0.0f, 0.0f ) );
+
+    pScene->deleteObject();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneSnapshotBenchmarks, RestoreDeletedObjects )
+{
+    Scene* pScene = createSnapshotBenchmarkScene();
+    const U32 objectCount = pScene->getSceneObjectCount();
+
+    pScene->saveSnapshot( "benchmark" );
+
+    // Restore after deleting every tenth object.
+    U32 restoreTime = 0;
+    U32 deletedCount = 0;
+    for ( U32 n = 0; n < SCENE_SNAPSHOT_BENCHMARK_ITERATIONS; ++n )
+    {
+        typeSceneObjectVector sceneObjects = pScene->getSceneObjects();
+        for ( S32 objectIndex = 0; objectIndex < sceneObjects.size(); objectIndex += SCENE_SNAPSHOT_BENCHMARK_DELETE_STRIDE )
+        {
+            sceneObjects[objectIndex]->deleteObject();
+            deletedCount++;
+        }
+
+        const U32 startTime = Platform::getRealMilliseconds();
+        pScene->restoreSnapshot( "benchmark" );
+        restoreTime += Platform::getRealMilliseconds() - startTime;
+    }
+
+    Con::printf( ">> Snapshot of %d objects took %dms to recreate %d deleted objects over %d iterations.",
+        objectCount, restoreTime, deletedCount, SCENE_SNAPSHOT_BENCHMARK_ITERATIONS );
+
+    // Check the objects were recreated.
+    ASSERT_EQ( pScene->getSceneObjectCount(), objectCount );
+
+    pScene->deleteObject();
+}
+
+#endif // TORQUE_BENCHMARKS
@@ -0,0 +1,138 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// Benchmarks are only built on request.
+#if defined(TORQUE_BENCHMARKS) && !defined(TORQUE_SHIPPING)
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _SCENE_OBJECT_H_
+#include "2d/sceneobject/SceneObject.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define WORLD_QUERY_BENCHMARK_OBJECT_ROWS   150
+#define WORLD_QUERY_BENCHMARK_TICKS         60
+#define WORLD_QUERY_BENCHMARK_QUERIES       100
+
+//-----------------------------------------------------------------------------
+
+static Scene* createWorldQueryBenchmarkScene( const bool spatialHash )
+{
+    // Create the scene.
+    Scene* pScene = new Scene();
+    pScene->registerObject();
+    pScene->setGravity( b2Vec2_zero );
+    pScene->setSpatialHash( spatialHash );
+
+    // Add a grid of small, fast-moving objects without collision shapes.
+    for ( U32 y = 0; y < WORLD_QUERY_BENCHMARK_OBJECT_ROWS; ++y )
+    {
+        for ( U32 x = 0; x < WORLD_QUERY_BENCHMARK_OBJECT_ROWS; ++x )
+        {
+            SceneObject* pSceneObject = new SceneObject();
+            pSceneObject->registerObject();
+            pSceneObject->setBodyType( b2_dynamicBody );
+            pSceneObject->setPosition( Vector2( (F32)x, (F32)y ) );
+            pSceneObject->setSize( Vector2( 0.25f, 0.25f ) );
+            pSceneObject->setLinearVelocity( Vector2( (F32)((x * 7) % 11) - 5.0f, (F32)((y * 5) % 13) - 6.0f ) );
+            pScene->addToScene( pSceneObject );
+        }
+    }
+
+    return pScene;
+}
+
+//-----------------------------------------------------------------------------
+
+static U32 queryWorldQueryBenchmarkScene( Scene* pScene )
+{
+    // Fetch world query.
+    WorldQuery* pWorldQuery = pScene->getWorldQuery( true );
+    pWorldQuery->setQueryFilter( WorldQueryFilter( MASK_ALL, MASK_ALL, true, false, true, true ) );
+
+    // Perform a grid of area, point and ray picks.
+    // These compare against the object bounds so the results do not depend on the index used.
+    U32 resultCount = 0;
+    for ( U32 n = 0; n < WORLD_QUERY_BENCHMARK_QUERIES; ++n )
+    {
+        const F32 x = (F32)((n * 37) % WORLD_QUERY_BENCHMARK_OBJECT_ROWS);
+        const F32 y = (F32)((n * 53) % WORLD_QUERY_BENCHMARK_OBJECT_ROWS);
+
+        b2AABB aabb;
+        aabb.lowerBound.Set( x - 2.0f, y - 2.0f );
+        aabb.upperBound.Set( x + 2.0f, y + 2.0f );
+        pWorldQuery->clearQuery();
+        resultCount += pWorldQuery->oobbQueryAABB( aabb );
+
+        pWorldQuery->clearQuery();
+        resultCount += pWorldQuery->oobbQueryPoint( Vector2( x, y ) );
+
+        pWorldQuery->clearQuery();
+        resultCount += pWorldQuery->oobbQueryRay( Vector2( x - 10.0f, y - 0.1f ), Vector2( x + 10.0f, y + 0.1f ) );
+    }
+
+    pWorldQuery->clearQuery();
+
+    return resultCount;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( WorldQueryBenchmarks, SpatialHash )
+{
+    const char* indexNames[2] = { "dynamic tree", "spatial hash" };
+
+    for ( U32 index = 0; index < 2; ++index )
+    {
+        Scene* pScene = createWorldQueryBenchmarkScene( index == 1 );
+
+        // Tick and pick every tick.
+        const U32 startTime = Platform::getRealMilliseconds();
+        U32 resultCount = 0;
+        for ( U32 n = 0; n < WORLD_QUERY_BENCHMARK_TICKS; ++n )
+        {
+            pScene->processTick();
+            resultCount += queryWorldQueryBenchmarkScene( pScene );
+        }
+        const U32 elapsedTime = Platform::getRealMilliseconds() - startTime;
+
+        Con::printf( ">> %s: %d objects took %dms for %d ticks of %d picks (%d results).",
+            indexNames[index], pScene->getSceneObjectCount(), elapsedTime, WORLD_QUERY_BENCHMARK_TICKS, WORLD_QUERY_BENCHMARK_QUERIES * 3, resultCount );
+
+        pScene->deleteObject();
+    }
+}
+
+#endif // TORQUE_BENCHMARKS
@@ -0,0 +1,166 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _BEHAVIOR_COMPONENT_H_
+#include "component/behaviors/behaviorComponent.h"
+#endif
+
+#ifndef _BEHAVIORTEMPLATE_H_
+#include "component/behaviors/behaviorTemplate.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define BEHAVIOR_COMPONENT_UNITTEST_TEMPLATE    "BehaviorComponentUnitTestTemplate"
+#define BEHAVIOR_COMPONENT_UNITTEST_OUTPUT      "fired"
+#define BEHAVIOR_COMPONENT_UNITTEST_INPUT       "onFired"
+
+//-----------------------------------------------------------------------------
+
+/// Two output behaviors both connected to one input behavior that counts its inputs.
+struct BehaviorRaiseTestFixture
+{
+    BehaviorTemplate*   mpTemplate;
+    BehaviorComponent*  mpComponent;
+    BehaviorInstance*   mpOutputA;
+    BehaviorInstance*   mpOutputB;
+    BehaviorInstance*   mpInput;
+    StringTableEntry    mOutputName;
+    StringTableEntry    mInputName;
+
+    BehaviorRaiseTestFixture()
+    {
+        mOutputName = StringTable->insert( BEHAVIOR_COMPONENT_UNITTEST_OUTPUT );
+        mInputName = StringTable->insert( BEHAVIOR_COMPONENT_UNITTEST_INPUT );
+
+        // Count the inputs and remove the nominated behavior when an input arrives.
+        Con::evaluate(
+            "function " BEHAVIOR_COMPONENT_UNITTEST_TEMPLATE "::" BEHAVIOR_COMPONENT_UNITTEST_INPUT "( %this, %outputBehavior, %outputName )"
+            "{"
+            "    $BehaviorComponentUnitTest::Count++;"
+            "    if ( isObject( $BehaviorComponentUnitTest::Remove ) )"
+            "        $BehaviorComponentUnitTest::Component.removeBehavior( $BehaviorComponentUnitTest::Remove, false );"
+            "}" );
+        Con::setIntVariable( "$BehaviorComponentUnitTest::Count", 0 );
+        Con::setVariable( "$BehaviorComponentUnitTest::Remove", "" );
+
+        // Create the template.
+        mpTemplate = new BehaviorTemplate();
+        mpTemplate->registerObject( BEHAVIOR_COMPONENT_UNITTEST_TEMPLATE );
+        mpTemplate->addBehaviorOutput( BEHAVIOR_COMPONENT_UNITTEST_OUTPUT, "Fired", "Fired output." );
+        mpTemplate->addBehaviorInput( BEHAVIOR_COMPONENT_UNITTEST_INPUT, "On Fired", "Fired input." );
+
+        // Create the component.
+        mpComponent = new BehaviorComponent();
+        mpComponent->registerObject();
+        Con::setVariable( "$BehaviorComponentUnitTest::Component", mpComponent->getIdString() );
+
+        // Create the behaviors.
+        mpOutputA = mpTemplate->createInstance();
+        mpOutputB = mpTemplate->createInstance();
+        mpInput = mpTemplate->createInstance();
+        mpComponent->addBehavior( mpOutputA );
+        mpComponent->addBehavior( mpOutputB );
+        mpComponent->addBehavior( mpInput );
+        mpComponent->connect( mpOutputA, mpInput, mOutputName, mInputName );
+        mpComponent->connect( mpOutputB, mpInput, mOutputName, mInputName );
+    }
+
+    ~BehaviorRaiseTestFixture()
+    {
+        // Delete any behaviors that were removed without being deleted.
+        if ( mpOutputA->getBehaviorOwner() == NULL )
+            mpOutputA->deleteObject();
+        if ( mpOutputB->getBehaviorOwner() == NULL )
+            mpOutputB->deleteObject();
+
+        mpComponent->deleteObject();
+        mpTemplate->deleteObject();
+    }
+
+    S32 getInputCount( void ) const { return Con::getIntVariable( "$BehaviorComponentUnitTest::Count" ); }
+};
+
+//-----------------------------------------------------------------------------
+
+TEST( BehaviorComponentTests, CoalesceQueuedRaises )
+{
+    BehaviorRaiseTestFixture fixture;
+
+    // Queue the same output several times.
+    ASSERT_TRUE( fixture.mpComponent->queueRaise( fixture.mpOutputA, fixture.mOutputName ) );
+    ASSERT_TRUE( fixture.mpComponent->queueRaise( fixture.mpOutputA, fixture.mOutputName ) );
+    ASSERT_TRUE( fixture.mpComponent->queueRaise( fixture.mpOutputA, fixture.mOutputName ) );
+    ASSERT_EQ( BehaviorComponent::getQueuedRaiseCount(), 1u );
+
+    // The same output on another behavior is queued separately.
+    ASSERT_TRUE( fixture.mpComponent->queueRaise( fixture.mpOutputB, fixture.mOutputName ) );
+    ASSERT_EQ( BehaviorComponent::getQueuedRaiseCount(), 2u );
+
+    // Nothing is raised until dispatch.
+    ASSERT_EQ( fixture.getInputCount(), 0 );
+    BehaviorComponent::dispatchQueuedRaises();
+    ASSERT_EQ( fixture.getInputCount(), 2 );
+    ASSERT_EQ( BehaviorComponent::getQueuedRaiseCount(), 0u );
+
+    // Dispatching released the behaviors so they can be queued again.
+    ASSERT_TRUE( fixture.mpComponent->queueRaise( fixture.mpOutputA, fixture.mOutputName ) );
+    ASSERT_EQ( BehaviorComponent::getQueuedRaiseCount(), 1u );
+    BehaviorComponent::dispatchQueuedRaises();
+    ASSERT_EQ( fixture.getInputCount(), 3 );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( BehaviorComponentTests, CancelRemovedBehaviorRaises )
+{
+    BehaviorRaiseTestFixture fixture;
+
+    // Removing a behavior before dispatch cancels its queued raise.
+    ASSERT_TRUE( fixture.mpComponent->queueRaise( fixture.mpOutputA, fixture.mOutputName ) );
+    ASSERT_TRUE( fixture.mpComponent->queueRaise( fixture.mpOutputB, fixture.mOutputName ) );
+    ASSERT_TRUE( fixture.mpComponent->removeBehavior( fixture.mpOutputA, false ) );
+    BehaviorComponent::dispatchQueuedRaises();
+    ASSERT_EQ( fixture.getInputCount(), 1 );
+
+    // Add the behavior back and queue it ahead of the other output.
+    ASSERT_TRUE( fixture.mpComponent->addBehavior( fixture.mpOutputA ) );
+    ASSERT_TRUE( fixture.mpComponent->connect( fixture.mpOutputA, fixture.mpInput, fixture.mOutputName, fixture.mInputName ) );
+    ASSERT_TRUE( fixture.mpComponent->queueRaise( fixture.mpOutputA, fixture.mOutputName ) );
+    ASSERT_TRUE( fixture.mpComponent->queueRaise( fixture.mpOutputB, fixture.mOutputName ) );
+
+    // Removing a behavior during dispatch cancels its raise still to be dispatched.
+    Con::setVariable( "$BehaviorComponentUnitTest::Remove", fixture.mpOutputB->getIdString() );
+    BehaviorComponent::dispatchQueuedRaises();
+    ASSERT_EQ( fixture.getInputCount(), 2 );
+    ASSERT_TRUE( fixture.mpOutputB->getBehaviorOwner() == NULL );
+    ASSERT_EQ( BehaviorComponent::getQueuedRaiseCount(), 0u );
+}
+
+#endif // TORQUE_SHIPPING
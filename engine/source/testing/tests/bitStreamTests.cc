@@ -0,0 +1,197 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _BITSTREAM_H_
+#include "io/bitStream.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define BITSTREAM_UNITTEST_BUFFERSIZE       1024
+#define BITSTREAM_UNITTEST_OBJECTS          48
+
+//-----------------------------------------------------------------------------
+
+static const char* gBitStreamTestStrings[] =
+{
+    "",
+    "a",
+    "GarageGames",
+    "The quick brown fox jumps over the lazy dog.",
+    "~`!@#$%^&*()_+{}|:\"<>?\x01\x02\x7f\xff",
+    "setPosition 10.5 -20.25; setAngle 90; setLinearVelocity 0 0; setSceneLayer 5; setVisible true; setCollisionGroups all;",
+};
+
+//-----------------------------------------------------------------------------
+
+TEST( BitStreamTests, BatchMatchesSingleValues )
+{
+    U8 singleBuffer[BITSTREAM_UNITTEST_BUFFERSIZE];
+    U8 batchBuffer[BITSTREAM_UNITTEST_BUFFERSIZE];
+    dMemset( singleBuffer, 0, sizeof(singleBuffer) );
+    dMemset( batchBuffer, 0, sizeof(batchBuffer) );
+
+    S32 values[BITSTREAM_UNITTEST_OBJECTS];
+    F32 floats[BITSTREAM_UNITTEST_OBJECTS];
+    for ( U32 n = 0; n < BITSTREAM_UNITTEST_OBJECTS; ++n )
+    {
+        values[n] = (S32)((n * 2654435761u) >> (n % 17));
+        floats[n] = (F32)n / (F32)BITSTREAM_UNITTEST_OBJECTS;
+    }
+
+    for ( S32 bitCount = 1; bitCount <= 32; ++bitCount )
+    {
+        BitStream singleStream( singleBuffer, sizeof(singleBuffer) );
+        BitStream batchStream( batchBuffer, sizeof(batchBuffer) );
+
+        // Start both streams off a byte boundary.
+        singleStream.writeInt( bitCount, 5 );
+        batchStream.writeInt( bitCount, 5 );
+
+        // Write the values one at a time and as a batch.
+        for ( U32 n = 0; n < BITSTREAM_UNITTEST_OBJECTS; ++n )
+            singleStream.writeInt( values[n], bitCount );
+        batchStream.writeInts( values, BITSTREAM_UNITTEST_OBJECTS, bitCount );
+
+        if ( bitCount > 1 )
+        {
+            // Keep the magnitudes within the bits available after the sign.
+            S32 signedValues[BITSTREAM_UNITTEST_OBJECTS];
+            for ( U32 n = 0; n < BITSTREAM_UNITTEST_OBJECTS; ++n )
+            {
+                const S32 magnitude = (S32)((U32)values[n] >> (33 - bitCount));
+                signedValues[n] = (n & 1) ? -magnitude : magnitude;
+                singleStream.writeSignedInt( signedValues[n], bitCount );
+            }
+            batchStream.writeSignedInts( signedValues, BITSTREAM_UNITTEST_OBJECTS, bitCount );
+        }
+
+        if ( bitCount <= 24 )
+        {
+            for ( U32 n = 0; n < BITSTREAM_UNITTEST_OBJECTS; ++n )
+                singleStream.writeRangedF32( floats[n] * 100.0f - 50.0f, -50.0f, 50.0f, bitCount );
+
+            F32 rangedValues[BITSTREAM_UNITTEST_OBJECTS];
+            for ( U32 n = 0; n < BITSTREAM_UNITTEST_OBJECTS; ++n )
+                rangedValues[n] = floats[n] * 100.0f - 50.0f;
+            batchStream.writeRangedF32s( rangedValues, BITSTREAM_UNITTEST_OBJECTS, -50.0f, 50.0f, bitCount );
+        }
+
+        // Check the streams are identical.
+        ASSERT_EQ( singleStream.getCurPos(), batchStream.getCurPos() ) << "Batch writes used a different number of bits at " << bitCount << " bits.";
+        ASSERT_EQ( dMemcmp( singleBuffer, batchBuffer, singleStream.getPosition() ), 0 ) << "Batch writes differ from single writes at " << bitCount << " bits.";
+
+        // Read the batch back one value at a time.
+        batchStream.setCurPos( 5 );
+        for ( U32 n = 0; n < BITSTREAM_UNITTEST_OBJECTS; ++n )
+        {
+            const U32 mask = bitCount == 32 ? 0xFFFFFFFF : (1u << bitCount) - 1;
+            ASSERT_EQ( (U32)batchStream.readInt( bitCount ), (U32)values[n] & mask ) << "Single read of a batch write failed at " << bitCount << " bits.";
+        }
+
+        // Read the single values back as a batch.
+        S32 readValues[BITSTREAM_UNITTEST_OBJECTS];
+        singleStream.setCurPos( 5 );
+        singleStream.readInts( readValues, BITSTREAM_UNITTEST_OBJECTS, bitCount );
+        batchStream.setCurPos( 5 );
+        for ( U32 n = 0; n < BITSTREAM_UNITTEST_OBJECTS; ++n )
+            ASSERT_EQ( readValues[n], batchStream.readInt( bitCount ) ) << "Batch read of single writes failed at " << bitCount << " bits.";
+
+        ASSERT_TRUE( singleStream.isValid() && batchStream.isValid() );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( BitStreamTests, UnalignedBitsRoundTrip )
+{
+    U8 source[64];
+    for ( U32 n = 0; n < sizeof(source); ++n )
+        source[n] = (U8)(n * 37 + 11);
+
+    U8 buffer[BITSTREAM_UNITTEST_BUFFERSIZE];
+    for ( S32 offset = 0; offset < 8; ++offset )
+    {
+        for ( S32 bitCount = 1; bitCount <= (S32)sizeof(source) * 8; bitCount += 13 )
+        {
+            dMemset( buffer, 0xFF, sizeof(buffer) );
+            BitStream stream( buffer, sizeof(buffer) );
+
+            // Write the bits between two flags.
+            stream.writeInt( 0, offset );
+            stream.writeBits( bitCount, source );
+            stream.writeFlag( false );
+
+            // Read them back.
+            U8 result[sizeof(source) + 1];
+            stream.setCurPos( offset );
+            stream.readBits( bitCount, result );
+            ASSERT_EQ( dMemcmp( result, source, bitCount >> 3 ), 0 ) << "Whole bytes differ at offset " << offset << " for " << bitCount << " bits.";
+            if ( bitCount & 0x7 )
+            {
+                const U8 mask = (U8)((1 << (bitCount & 0x7)) - 1);
+                ASSERT_EQ( result[bitCount >> 3], source[bitCount >> 3] & mask ) << "Trailing bits differ at offset " << offset << " for " << bitCount << " bits.";
+            }
+
+            // Check the bits after were left alone.
+            ASSERT_FALSE( stream.readFlag() ) << "Trailing flag was overwritten at offset " << offset << " for " << bitCount << " bits.";
+            ASSERT_TRUE( stream.readFlag() ) << "Bits past the write were changed at offset " << offset << " for " << bitCount << " bits.";
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( BitStreamTests, StringRoundTrip )
+{
+    U8 buffer[BITSTREAM_UNITTEST_BUFFERSIZE];
+    const U32 stringCount = sizeof(gBitStreamTestStrings) / sizeof(const char*);
+
+    // Write every string behind a flag so they start off a byte boundary.
+    BitStream stream( buffer, sizeof(buffer) );
+    for ( U32 n = 0; n < stringCount; ++n )
+    {
+        stream.writeFlag( true );
+        stream.writeString( gBitStreamTestStrings[n] );
+    }
+    const S32 endPosition = stream.getCurPos();
+
+    // Read them back.
+    stream.setCurPos( 0 );
+    char result[256];
+    for ( U32 n = 0; n < stringCount; ++n )
+    {
+        ASSERT_TRUE( stream.readFlag() );
+        stream.readString( result );
+        ASSERT_STREQ( gBitStreamTestStrings[n], result ) << "String round trip failed.";
+    }
+    ASSERT_EQ( stream.getCurPos(), endPosition ) << "Strings read a different number of bits than were written.";
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,142 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_JOBPOOL_H_
+#include "platform/threads/jobPool.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define JOB_POOL_UNITTEST_WORKERS       4
+#define JOB_POOL_UNITTEST_ITEMS         100000
+#define JOB_POOL_UNITTEST_BATCH         500
+#define JOB_POOL_UNITTEST_SUBMISSIONS   2000
+
+//-----------------------------------------------------------------------------
+
+struct JobPoolTestItems
+{
+    Vector<U32> mValues;
+    Vector<U32> mThreadIds;
+};
+
+//-----------------------------------------------------------------------------
+
+static void jobPoolTestFill( void* pContext, const U32 start, const U32 end )
+{
+    JobPoolTestItems* pItems = static_cast<JobPoolTestItems*>( pContext );
+
+    for ( U32 index = start; index < end; ++index )
+    {
+        pItems->mValues[index] = index * 2;
+        pItems->mThreadIds[index] = ThreadManager::getCurrentThreadId();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void jobPoolTestIncrement( void* pContext, const U32 start, const U32 end )
+{
+    // Each job owns its own slot so no locking is needed.
+    U32* pSlots = static_cast<U32*>( pContext );
+    pSlots[start]++;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( JobPoolTests, ParallelForCoversRange )
+{
+    // Create a pool with workers regardless of the shared pool configuration.
+    JobPool jobPool( JOB_POOL_UNITTEST_WORKERS );
+    ASSERT_EQ( (U32)JOB_POOL_UNITTEST_WORKERS, jobPool.getWorkerCount() );
+
+    JobPoolTestItems items;
+    items.mValues.setSize( JOB_POOL_UNITTEST_ITEMS );
+    items.mThreadIds.setSize( JOB_POOL_UNITTEST_ITEMS );
+    dMemset( items.mValues.address(), 0xFF, items.mValues.memSize() );
+
+    jobPool.parallelFor( &jobPoolTestFill, &items, JOB_POOL_UNITTEST_ITEMS, JOB_POOL_UNITTEST_BATCH );
+
+    // Every item must have been written exactly as expected.
+    for ( U32 index = 0; index < JOB_POOL_UNITTEST_ITEMS; ++index )
+    {
+        ASSERT_EQ( index * 2, items.mValues[index] ) << "Item " << index << " was not processed.";
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( JobPoolTests, WaitReturnsOnceJobsComplete )
+{
+    JobPool jobPool( JOB_POOL_UNITTEST_WORKERS );
+
+    U32 slots[JOB_POOL_UNITTEST_WORKERS];
+
+    // Repeat short submissions to exercise the wake-up of a blocked waiter.
+    for ( U32 submission = 0; submission < JOB_POOL_UNITTEST_SUBMISSIONS; ++submission )
+    {
+        dMemset( slots, 0, sizeof(slots) );
+
+        JobCounter counter;
+        for ( U32 slot = 0; slot < JOB_POOL_UNITTEST_WORKERS; ++slot )
+        {
+            jobPool.submit( &jobPoolTestIncrement, slots, slot, slot + 1, counter );
+        }
+        jobPool.wait( counter );
+
+        ASSERT_TRUE( counter.isComplete() );
+        for ( U32 slot = 0; slot < JOB_POOL_UNITTEST_WORKERS; ++slot )
+        {
+            ASSERT_EQ( 1U, slots[slot] ) << "Submission " << submission << " returned before job " << slot << " ran.";
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( JobPoolTests, InlinePoolRunsOnCaller )
+{
+    // A pool without workers runs everything on the calling thread.
+    JobPool jobPool( 0 );
+
+    JobPoolTestItems items;
+    items.mValues.setSize( JOB_POOL_UNITTEST_BATCH * 4 );
+    items.mThreadIds.setSize( JOB_POOL_UNITTEST_BATCH * 4 );
+
+    jobPool.parallelFor( &jobPoolTestFill, &items, items.mValues.size(), JOB_POOL_UNITTEST_BATCH );
+
+    const U32 threadId = ThreadManager::getCurrentThreadId();
+    for ( S32 index = 0; index < items.mValues.size(); ++index )
+    {
+        ASSERT_EQ( (U32)index * 2, items.mValues[index] );
+        ASSERT_TRUE( ThreadManager::compare( threadId, items.mThreadIds[index] ) );
+    }
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,323 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _NETCONNECTION_H_
+#include "network/netConnection.h"
+#endif
+
+#ifndef _NETINTERESTGRID_H_
+#include "network/netInterestGrid.h"
+#endif
+
+#ifndef _BITSTREAM_H_
+#include "io/bitStream.h"
+#endif
+
+#ifndef _MRANDOM_H_
+#include "math/mRandom.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define NETGHOST_UNITTEST_WORLD_SIZE        400.0f
+#define NETGHOST_UNITTEST_OBJECTS           1000
+#define NETGHOST_UNITTEST_CONNECTIONS       4
+#define NETGHOST_UNITTEST_VIEW_DISTANCE     100.0f
+#define NETGHOST_UNITTEST_PACKET_SIZE       1400
+#define NETGHOST_UNITTEST_SETTLE_FRAMES     100
+#define NETGHOST_UNITTEST_UPDATE_FRAMES     20
+#define NETGHOST_UNITTEST_MOVES             100
+
+//-----------------------------------------------------------------------------
+
+class NetGhostTestObject : public NetObject
+{
+    typedef NetObject Parent;
+
+public:
+    enum MaskBits
+    {
+        PositionMask = BIT(0),
+    };
+
+    NetGhostTestObject() : mProxyId( NetInterestGrid::InvalidProxy ), mPackCount( 0 )
+    {
+        mPosition.set( 0.0f, 0.0f );
+        mNetFlags.set( Ghostable );
+    }
+
+    void setPosition( const Point2F& position )
+    {
+        mPosition = position;
+        setMaskBits( PositionMask );
+    }
+
+    virtual F32 getUpdatePriority( CameraScopeQuery* pFocusObject, U32 updateMask, S32 updateSkips )
+    {
+        // Nearer objects and those skipped for longer first.
+        const Point2F offset( mPosition.x - pFocusObject->pos.x, mPosition.y - pFocusObject->pos.y );
+        return 1.0f - mClampF( offset.len() / pFocusObject->visibleDistance, 0.0f, 1.0f ) + (F32)updateSkips * 0.1f;
+    }
+
+    virtual U32 packUpdate( NetConnection* pConnection, U32 mask, BitStream* pStream )
+    {
+        if ( pStream->writeFlag( mask & PositionMask ) )
+        {
+            pStream->write( mPosition.x );
+            pStream->write( mPosition.y );
+        }
+
+        mPackCount++;
+        return 0;
+    }
+
+    virtual void unpackUpdate( NetConnection* pConnection, BitStream* pStream )
+    {
+        if ( pStream->readFlag() )
+        {
+            pStream->read( &mPosition.x );
+            pStream->read( &mPosition.y );
+        }
+    }
+
+    Point2F mPosition;
+    S32     mProxyId;
+    U32     mPackCount;
+
+    DECLARE_CONOBJECT( NetGhostTestObject );
+};
+
+IMPLEMENT_CO_NETOBJECT_V1( NetGhostTestObject );
+
+//-----------------------------------------------------------------------------
+
+class NetGhostTestScope : public NetObject
+{
+public:
+    NetGhostTestScope() : mpGrid( NULL ) { mCamera.set( 0.0f, 0.0f ); }
+
+    virtual void onCameraScopeQuery( NetConnection* pConnection, CameraScopeQuery* pCameraInfo )
+    {
+        pCameraInfo->camera = this;
+        pCameraInfo->pos.set( mCamera.x, mCamera.y, 0.0f );
+        pCameraInfo->visibleDistance = NETGHOST_UNITTEST_VIEW_DISTANCE;
+
+        mpGrid->scopeObjects( pConnection, mCamera, NETGHOST_UNITTEST_VIEW_DISTANCE );
+    }
+
+    NetInterestGrid*    mpGrid;
+    Point2F             mCamera;
+};
+
+//-----------------------------------------------------------------------------
+
+class NetGhostTestConnection : public NetConnection
+{
+public:
+    void startGhosting( void )
+    {
+        setGhostFrom( true );
+        activateGhosting();
+        mGhosting = true;
+    }
+
+    /// Write a packet of ghost updates and acknowledge it straight away.
+    U32 writeGhostPacket( void )
+    {
+        BitStream* pStream = BitStream::getPacketStream( NETGHOST_UNITTEST_PACKET_SIZE );
+        PacketNotify* pNotify = allocNotify();
+        ghostWritePacket( pStream, pNotify );
+        const U32 bits = pStream->getCurPos();
+        ghostPacketReceived( pNotify );
+        delete pNotify;
+        return bits;
+    }
+};
+
+//-----------------------------------------------------------------------------
+
+TEST( NetGhostTests, InterestGridMatchesLinearSearch )
+{
+    NetInterestGrid grid( 16.0f );
+    RandomLCG random( 1234 );
+
+    // Enter some objects, then move and remove a few.
+    const U32 objectCount = 2000;
+    NetGhostTestObject* pObjects = new NetGhostTestObject[objectCount];
+    for ( U32 n = 0; n < objectCount; ++n )
+    {
+        pObjects[n].mPosition.set( random.randRangeF( -200.0f, 200.0f ), random.randRangeF( -200.0f, 200.0f ) );
+        pObjects[n].mProxyId = grid.addObject( &pObjects[n], pObjects[n].mPosition, random.randRangeF( 0.0f, 4.0f ) );
+    }
+    for ( U32 n = 0; n < objectCount; n += 3 )
+    {
+        pObjects[n].mPosition.set( random.randRangeF( -200.0f, 200.0f ), random.randRangeF( -200.0f, 200.0f ) );
+        grid.moveObject( pObjects[n].mProxyId, pObjects[n].mPosition, 0.0f );
+    }
+    for ( U32 n = 0; n < objectCount; n += 7 )
+    {
+        grid.removeObject( pObjects[n].mProxyId );
+        pObjects[n].mProxyId = NetInterestGrid::InvalidProxy;
+    }
+
+    // Compare the points found against the ones in range, both for small and large queries.
+    Vector<NetObject*> results;
+    for ( U32 query = 0; query < 50; ++query )
+    {
+        const Point2F center( random.randRangeF( -250.0f, 250.0f ), random.randRangeF( -250.0f, 250.0f ) );
+        const F32 distance = query & 1 ? random.randRangeF( 1.0f, 40.0f ) : random.randRangeF( 300.0f, 600.0f );
+
+        results.clear();
+        grid.findObjects( center, distance, results );
+
+        U32 expected = 0;
+        for ( U32 n = 0; n < objectCount; ++n )
+        {
+            // Moved objects have no radius, so only the centers of the objects are checked.
+            if ( pObjects[n].mProxyId == NetInterestGrid::InvalidProxy || n % 3 != 0 )
+                continue;
+
+            const Point2F offset = pObjects[n].mPosition - center;
+            const bool inRange = offset.len() <= distance;
+            expected += inRange ? 1 : 0;
+
+            bool found = false;
+            for ( S32 i = 0; i < results.size() && !found; ++i )
+                found = results[i] == &pObjects[n];
+
+            ASSERT_EQ( inRange, found ) << "Object " << n << " was not found correctly.";
+        }
+
+        ASSERT_GE( (U32)results.size(), expected );
+    }
+
+    ASSERT_EQ( grid.getObjectCount(), objectCount - (objectCount + 6) / 7 );
+
+    delete [] pObjects;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( NetGhostTests, GhostsObjectsInViewAndSendsChanges )
+{
+    NetInterestGrid grid;
+    RandomLCG random( 5678 );
+    const F32 worldExtent = NETGHOST_UNITTEST_WORLD_SIZE * 0.5f;
+
+    // Create the ghosted objects.
+    Vector<NetGhostTestObject*> objects;
+    for ( U32 n = 0; n < NETGHOST_UNITTEST_OBJECTS; ++n )
+    {
+        NetGhostTestObject* pObject = new NetGhostTestObject();
+        pObject->mPosition.set( random.randRangeF( -worldExtent, worldExtent ), random.randRangeF( -worldExtent, worldExtent ) );
+        ASSERT_TRUE( pObject->registerObject() );
+        pObject->mProxyId = grid.addObject( pObject, pObject->mPosition, 1.0f );
+        objects.push_back( pObject );
+    }
+
+    // Create the connections, each with its own camera.
+    Vector<NetGhostTestConnection*> connections;
+    Vector<NetGhostTestScope*> scopes;
+    for ( U32 n = 0; n < NETGHOST_UNITTEST_CONNECTIONS; ++n )
+    {
+        NetGhostTestScope* pScope = new NetGhostTestScope();
+        pScope->mpGrid = &grid;
+        pScope->mCamera.set( random.randRangeF( -worldExtent, worldExtent ), random.randRangeF( -worldExtent, worldExtent ) );
+        ASSERT_TRUE( pScope->registerObject() );
+        scopes.push_back( pScope );
+
+        NetGhostTestConnection* pConnection = new NetGhostTestConnection();
+        ASSERT_TRUE( pConnection->registerObject() );
+        pConnection->setScopeObject( pScope );
+        pConnection->startGhosting();
+        connections.push_back( pConnection );
+    }
+
+    // Ghost the objects in view while nothing moves.
+    for ( U32 frame = 0; frame < NETGHOST_UNITTEST_SETTLE_FRAMES; ++frame )
+    {
+        for ( S32 n = 0; n < connections.size(); ++n )
+            connections[n]->writeGhostPacket();
+    }
+
+    // Every object in view should now be ghosted.
+    Vector<NetObject*> visible;
+    for ( S32 n = 0; n < connections.size(); ++n )
+    {
+        visible.clear();
+        grid.findObjects( scopes[n]->mCamera, NETGHOST_UNITTEST_VIEW_DISTANCE, visible );
+        ASSERT_GT( visible.size(), 0 );
+        for ( S32 i = 0; i < visible.size(); ++i )
+        {
+            ASSERT_GE( connections[n]->getGhostIndex( visible[i] ), 0 ) << "Object in view of connection " << n << " was not ghosted.";
+        }
+    }
+
+    // Mark some objects as changed while the cameras stay still, so only their priorities are re-evaluated.
+    Vector<NetGhostTestObject*> moved;
+    for ( U32 n = 0; n < NETGHOST_UNITTEST_MOVES; ++n )
+    {
+        NetGhostTestObject* pObject = objects[random.randRangeI( 0, objects.size() - 1 )];
+        pObject->mPackCount = 0;
+        pObject->setPosition( pObject->mPosition );
+        moved.push_back( pObject );
+    }
+    NetObject::collapseDirtyList();
+
+    for ( U32 frame = 0; frame < NETGHOST_UNITTEST_UPDATE_FRAMES; ++frame )
+    {
+        for ( S32 n = 0; n < connections.size(); ++n )
+            connections[n]->writeGhostPacket();
+    }
+
+    // Every changed object should have been sent once to each connection it is ghosted on.
+    for ( S32 i = 0; i < moved.size(); ++i )
+    {
+        U32 ghostedCount = 0;
+        for ( S32 n = 0; n < connections.size(); ++n )
+            ghostedCount += connections[n]->getGhostIndex( moved[i] ) >= 0 ? 1 : 0;
+
+        ASSERT_EQ( moved[i]->mPackCount, ghostedCount ) << "Changed object " << i << " was not updated on every connection.";
+    }
+
+    // Clean up.
+    for ( S32 n = 0; n < connections.size(); ++n )
+    {
+        connections[n]->deleteObject();
+        scopes[n]->deleteObject();
+    }
+    for ( S32 n = 0; n < objects.size(); ++n )
+        objects[n]->deleteObject();
+}
+
+#endif // TORQUE_SHIPPING
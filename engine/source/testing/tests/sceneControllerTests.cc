@@ -0,0 +1,247 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _ATTRACTOR_CONTROLLER_H_
+#include "2d/controllers/PointForceController.h"
+#endif
+
+#ifndef _BUOYANCY_CONTROLLER_H_
+#include "2d/controllers/BuoyancyController.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define SCENE_CONTROLLER_UNITTEST_BODY_ROWS     15
+
+//-----------------------------------------------------------------------------
+
+static Scene* createControllerTestScene( Vector<SceneObject*>& bodies )
+{
+    // Create the scene without gravity so only the controllers move bodies.
+    Scene* pScene = new Scene();
+    pScene->registerObject();
+    pScene->setGravity( b2Vec2_zero );
+
+    // Add a grid of dynamic bodies, one per unit.
+    bodies.clear();
+    for ( U32 y = 0; y < SCENE_CONTROLLER_UNITTEST_BODY_ROWS; ++y )
+    {
+        for ( U32 x = 0; x < SCENE_CONTROLLER_UNITTEST_BODY_ROWS; ++x )
+        {
+            SceneObject* pSceneObject = new SceneObject();
+            pSceneObject->registerObject();
+            pSceneObject->setBodyType( b2_dynamicBody );
+            pSceneObject->setPosition( Vector2( (F32)x, (F32)y ) );
+            pSceneObject->setSize( Vector2( 0.5f, 0.5f ) );
+            pSceneObject->createCircleCollisionShape( 0.25f );
+            pScene->addToScene( pSceneObject );
+            bodies.push_back( pSceneObject );
+        }
+    }
+
+    return pScene;
+}
+
+//-----------------------------------------------------------------------------
+
+static SceneObject* getControllerTestBody( const Vector<SceneObject*>& bodies, const U32 x, const U32 y )
+{
+    return bodies[y * SCENE_CONTROLLER_UNITTEST_BODY_ROWS + x];
+}
+
+//-----------------------------------------------------------------------------
+
+static bool containsSceneObject( const typeSceneObjectVector& sceneObjects, const SceneObject* pSceneObject )
+{
+    for ( S32 n = 0; n < sceneObjects.size(); ++n )
+    {
+        if ( sceneObjects[n] == pSceneObject )
+            return true;
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneControllerTests, RegionQueryMatchesAnyQuery )
+{
+    Vector<SceneObject*> bodies;
+    Scene* pScene = createControllerTestScene( bodies );
+
+    // Add a rotated body whose AABB is much larger than its OOBB.
+    SceneObject* pRotatedObject = new SceneObject();
+    pRotatedObject->registerObject();
+    pRotatedObject->setPosition( Vector2( 30.0f, 0.0f ) );
+    pRotatedObject->setSize( Vector2( 4.0f, 0.5f ) );
+    pRotatedObject->setAngle( mDegToRad( 45.0f ) );
+    pScene->addToScene( pRotatedObject );
+
+    // Add a body whose collision shape reaches well outside its size.
+    SceneObject* pFixtureObject = new SceneObject();
+    pFixtureObject->registerObject();
+    pFixtureObject->setPosition( Vector2( 40.0f, 0.0f ) );
+    pFixtureObject->setSize( Vector2( 0.5f, 0.5f ) );
+    pFixtureObject->createCircleCollisionShape( 3.0f );
+    pScene->addToScene( pFixtureObject );
+
+    // Add an always-in-scope body far from everything.
+    SceneObject* pAlwaysInScopeObject = new SceneObject();
+    pAlwaysInScopeObject->registerObject();
+    pAlwaysInScopeObject->setPosition( Vector2( 100.0f, 100.0f ) );
+    pScene->addToScene( pAlwaysInScopeObject );
+    pScene->getWorldQuery()->addAlwaysInScope( pAlwaysInScopeObject );
+
+    // Settle the proxies.
+    pScene->processTick();
+
+    // Set up the regions.
+    const F32 regionBounds[][4] =
+    {
+        { 1.5f, 1.5f, 3.5f, 3.5f },         // Four grid bodies.
+        { 2.5f, 2.5f, 6.5f, 4.5f },         // Overlaps the first region so both share a cluster.
+        { 31.2f, -1.6f, 31.6f, -1.2f },     // Inside the rotated AABB but outside its OOBB.
+        { 29.8f, -0.2f, 30.2f, 0.2f },      // Inside the rotated OOBB.
+        { 42.0f, -0.5f, 43.0f, 0.5f },      // Only overlaps the large collision shape.
+        { 60.0f, 60.0f, 61.0f, 61.0f },     // Empty apart from always-in-scope.
+    };
+    const U32 regionCount = sizeof(regionBounds) / sizeof(regionBounds[0]);
+
+    Vector<typeSceneObjectVector> regionResults;
+    regionResults.setSize( regionCount );
+    Vector<WorldQueryRegion> regions;
+    for ( U32 n = 0; n < regionCount; ++n )
+    {
+        WorldQueryRegion region;
+        region.mAABB.lowerBound.Set( regionBounds[n][0], regionBounds[n][1] );
+        region.mAABB.upperBound.Set( regionBounds[n][2], regionBounds[n][3] );
+        region.mpResults = &regionResults[n];
+        regions.push_back( region );
+    }
+
+    pScene->getWorldQuery()->regionQuery( regions );
+
+    // Check specific bodies inside and outside the regions.
+    ASSERT_EQ( regionResults[0].size(), 5 );
+    ASSERT_TRUE( containsSceneObject( regionResults[0], getControllerTestBody( bodies, 2, 2 ) ) );
+    ASSERT_TRUE( containsSceneObject( regionResults[0], getControllerTestBody( bodies, 3, 3 ) ) );
+    ASSERT_FALSE( containsSceneObject( regionResults[0], getControllerTestBody( bodies, 4, 4 ) ) );
+    ASSERT_FALSE( containsSceneObject( regionResults[0], getControllerTestBody( bodies, 1, 1 ) ) );
+    ASSERT_TRUE( containsSceneObject( regionResults[1], getControllerTestBody( bodies, 6, 4 ) ) );
+    ASSERT_FALSE( containsSceneObject( regionResults[1], getControllerTestBody( bodies, 2, 2 ) ) );
+    ASSERT_FALSE( containsSceneObject( regionResults[2], pRotatedObject ) );
+    ASSERT_TRUE( containsSceneObject( regionResults[3], pRotatedObject ) );
+    ASSERT_TRUE( containsSceneObject( regionResults[4], pFixtureObject ) );
+    ASSERT_EQ( regionResults[5].size(), 1 );
+    for ( U32 n = 0; n < regionCount; ++n )
+    {
+        ASSERT_TRUE( containsSceneObject( regionResults[n], pAlwaysInScopeObject ) ) << "Region " << n << " is missing the always-in-scope body.";
+    }
+
+    // Check every region found exactly what an individual query finds.
+    for ( U32 n = 0; n < regionCount; ++n )
+    {
+        WorldQuery* pWorldQuery = pScene->getWorldQuery( true );
+        pWorldQuery->setQueryFilter( regions[n].mQueryFilter );
+        pWorldQuery->anyQueryAABB( regions[n].mAABB );
+        typeWorldQueryResultVector& queryResults = pWorldQuery->getQueryResults();
+
+        ASSERT_EQ( regionResults[n].size(), queryResults.size() ) << "Region " << n << " found a different number of bodies.";
+        for ( S32 i = 0; i < queryResults.size(); ++i )
+        {
+            ASSERT_TRUE( containsSceneObject( regionResults[n], queryResults[i].mpSceneObject ) ) << "Region " << n << " is missing a body.";
+        }
+    }
+
+    pScene->getWorldQuery()->removeAlwaysInScope( pAlwaysInScopeObject );
+    pScene->deleteObject();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneControllerTests, PointForceRegions )
+{
+    Vector<SceneObject*> bodies;
+    Scene* pScene = createControllerTestScene( bodies );
+
+    // Add an attractor in the middle of the grid.
+    PointForceController* pController = new PointForceController();
+    pController->registerObject();
+    pController->setPosition( Vector2( 5.0f, 5.0f ) );
+    pController->setRadius( 2.0f );
+    pController->setForce( 10.0f );
+    pScene->getControllers()->addObject( pController );
+
+    pScene->processTick();
+
+    // Bodies within the radius are pulled towards the controller.
+    ASSERT_LT( getControllerTestBody( bodies, 5, 6 )->getLinearVelocity().y, 0.0f );
+    ASSERT_GT( getControllerTestBody( bodies, 4, 5 )->getLinearVelocity().x, 0.0f );
+    ASSERT_GT( getControllerTestBody( bodies, 6, 4 )->getLinearVelocity().y, 0.0f );
+
+    // Bodies centered on the controller, inside the region but outside the radius, or outside the region are not.
+    ASSERT_TRUE( getControllerTestBody( bodies, 5, 5 )->getLinearVelocity().isZero() );
+    ASSERT_TRUE( getControllerTestBody( bodies, 7, 7 )->getLinearVelocity().isZero() );
+    ASSERT_TRUE( getControllerTestBody( bodies, 9, 5 )->getLinearVelocity().isZero() );
+    ASSERT_TRUE( getControllerTestBody( bodies, 0, 0 )->getLinearVelocity().isZero() );
+
+    pScene->deleteObject();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneControllerTests, BuoyancyRegions )
+{
+    Vector<SceneObject*> bodies;
+    Scene* pScene = createControllerTestScene( bodies );
+
+    // Add a fluid covering the bottom-left of the grid.
+    BuoyancyController* pController = new BuoyancyController();
+    pController->registerObject();
+    pController->setDataField( StringTable->insert("FluidArea"), NULL, "0 0 6.5 3.5" );
+    pScene->getControllers()->addObject( pController );
+
+    pScene->processTick();
+
+    // Submerged bodies float up.
+    ASSERT_GT( getControllerTestBody( bodies, 0, 0 )->getLinearVelocity().y, 0.0f );
+    ASSERT_GT( getControllerTestBody( bodies, 6, 3 )->getLinearVelocity().y, 0.0f );
+
+    // Bodies above the surface or beside the fluid are not.
+    ASSERT_TRUE( getControllerTestBody( bodies, 2, 4 )->getLinearVelocity().isZero() );
+    ASSERT_TRUE( getControllerTestBody( bodies, 8, 1 )->getLinearVelocity().isZero() );
+
+    pScene->deleteObject();
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,115 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _SCENE_POOL_H_
+#include "2d/scene/ScenePool.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define SCENE_POOL_UNITTEST_OBJECTS     4
+
+//-----------------------------------------------------------------------------
+
+TEST( ScenePoolTests, SnapshotRestoreKeepsThePoolConsistent )
+{
+    // Create the scene.
+    Scene* pScene = new Scene();
+    ASSERT_TRUE( pScene->registerObject() );
+    pScene->setGravity( b2Vec2_zero );
+
+    // Create the template outside of the scene.
+    SceneObject* pTemplate = new SceneObject();
+    ASSERT_TRUE( pTemplate->registerObject() );
+    pTemplate->setSize( Vector2( 2.0f, 2.0f ) );
+
+    // Create the pool.
+    ScenePool* pPool = new ScenePool();
+    ASSERT_TRUE( pPool->registerObject() );
+    pPool->setScene( pScene );
+    pPool->setTemplate( pTemplate );
+    pPool->setGrowCount( 0 );
+    pPool->reserve( SCENE_POOL_UNITTEST_OBJECTS );
+    ASSERT_EQ( pPool->getFreeCount(), (U32)SCENE_POOL_UNITTEST_OBJECTS );
+
+    // Parked objects are not persisted.
+    ASSERT_EQ( pScene->getTamlChildCount(), 0u );
+
+    // Spawn two objects and park one of them.
+    SceneObject* pLive = pPool->acquire( Vector2( 1.0f, 2.0f ), 0.0f );
+    SceneObject* pParked = pPool->acquire( Vector2( 3.0f, 4.0f ), 0.0f );
+    ASSERT_TRUE( pLive != NULL && pParked != NULL );
+    ASSERT_TRUE( pPool->release( pParked ) );
+    ASSERT_EQ( pScene->getTamlChildCount(), 1u );
+    ASSERT_EQ( pScene->getTamlChild( 0 ), (SimObject*)pLive );
+
+    // Snapshot with one object live.
+    pScene->saveSnapshot( "pool" );
+
+    // Swap which object is live.
+    ASSERT_EQ( pPool->acquire( Vector2( 5.0f, 6.0f ), 0.0f ), pParked );
+    ASSERT_TRUE( pPool->release( pLive ) );
+    ASSERT_TRUE( pLive->getIsPooled() );
+
+    // Restore.
+    ASSERT_TRUE( pScene->restoreSnapshot( "pool" ) );
+
+    // The snapshot object is back out of the pool and the other returned to it.
+    ASSERT_FALSE( pLive->getIsPooled() );
+    ASSERT_TRUE( pLive->isEnabled() );
+    ASSERT_TRUE( pLive->getPosition() == Vector2( 1.0f, 2.0f ) );
+    ASSERT_TRUE( pParked->getIsPooled() );
+    ASSERT_FALSE( pParked->isEnabled() );
+    ASSERT_EQ( pPool->getActiveCount(), 1u );
+    ASSERT_EQ( pPool->getFreeCount(), (U32)SCENE_POOL_UNITTEST_OBJECTS - 1 );
+
+    // Acquiring never hands out the live object.
+    for ( U32 n = 0; n < SCENE_POOL_UNITTEST_OBJECTS - 1; ++n )
+    {
+        SceneObject* pSceneObject = pPool->acquire();
+        ASSERT_TRUE( pSceneObject != NULL );
+        ASSERT_NE( pSceneObject, pLive ) << "An object that is already live was acquired.";
+        ASSERT_FALSE( pSceneObject->getIsPooled() );
+    }
+
+    // The pool is exhausted as every object is live.
+    ASSERT_EQ( pPool->getFreeCount(), 0u );
+    ASSERT_EQ( pScene->getTamlChildCount(), (U32)SCENE_POOL_UNITTEST_OBJECTS );
+
+    // Clean up.
+    pPool->deleteObject();
+    pTemplate->deleteObject();
+    pScene->deleteObject();
+}
+
+#endif // TORQUE_SHIPPING
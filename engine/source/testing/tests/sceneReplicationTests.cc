@@ -0,0 +1,206 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _SCENE_REPLICATION_H_
+#include "2d/scene/SceneReplication.h"
+#endif
+
+#ifndef _NETCONNECTION_H_
+#include "network/netConnection.h"
+#endif
+
+#ifndef _BITSTREAM_H_
+#include "io/bitStream.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define SCENE_REPLICATION_UNITTEST_OBJECT_ROWS  5
+#define SCENE_REPLICATION_UNITTEST_PACKET_SIZE  1400
+#define SCENE_REPLICATION_UNITTEST_MOVE_TICKS   60
+#define SCENE_REPLICATION_UNITTEST_SETTLE_TICKS 60
+#define SCENE_REPLICATION_UNITTEST_IDLE_TICKS   30
+#define SCENE_REPLICATION_UNITTEST_TOLERANCE    0.05f
+
+//-----------------------------------------------------------------------------
+
+class SceneReplicationTestConnection : public NetConnection
+{
+public:
+    /// Start ghosting without waiting for the client to acknowledge.
+    void startGhosting( void )
+    {
+        mGhosting = true;
+    }
+
+    /// Write a packet of ghost updates, optionally have the client read it, then acknowledge it.
+    void sendGhostPacket( SceneReplicationTestConnection* pClientConnection )
+    {
+        BitStream* pStream = BitStream::getPacketStream( SCENE_REPLICATION_UNITTEST_PACKET_SIZE );
+        PacketNotify* pNotify = allocNotify();
+        ghostWritePacket( pStream, pNotify );
+
+        if ( pClientConnection != NULL )
+        {
+            pStream->setPosition( 0 );
+            pClientConnection->ghostReadPacket( pStream );
+        }
+
+        ghostPacketReceived( pNotify );
+        delete pNotify;
+    }
+};
+
+//-----------------------------------------------------------------------------
+
+static void tickSceneReplicationTest( Scene* pServerScene, Scene* pClientScene, SceneReplicationTestConnection* pServerConnection, SceneReplicationTestConnection* pClientConnection, SceneReplicationTestConnection* pDistantConnection )
+{
+    // Tick the server and flag the changed ghosts.
+    pServerScene->processTick();
+    NetObject::collapseDirtyList();
+
+    // Send to both connections but only the first has a client.
+    pServerConnection->sendGhostPacket( pClientConnection );
+    pDistantConnection->sendGhostPacket( NULL );
+
+    // Tick the client.
+    pClientScene->processTick();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneReplicationTests, ReplicasTrackTheServerOverLoopback )
+{
+    StringTableEntry keyField = StringTable->insert( "replicationTestKey" );
+
+    // Create the server scene with a grid of moving objects.
+    Scene* pServerScene = new Scene();
+    ASSERT_TRUE( pServerScene->registerObject() );
+    pServerScene->setGravity( b2Vec2_zero );
+
+    Vector<SceneObject*> serverObjects;
+    for ( U32 y = 0; y < SCENE_REPLICATION_UNITTEST_OBJECT_ROWS; ++y )
+    {
+        for ( U32 x = 0; x < SCENE_REPLICATION_UNITTEST_OBJECT_ROWS; ++x )
+        {
+            SceneObject* pSceneObject = new SceneObject();
+            ASSERT_TRUE( pSceneObject->registerObject() );
+            pSceneObject->setBodyType( b2_dynamicBody );
+            pSceneObject->setPosition( Vector2( (F32)x * 4.0f, (F32)y * 4.0f ) );
+            pSceneObject->setLinearVelocity( Vector2( (F32)x - 2.0f, (F32)y - 2.0f ) );
+            pSceneObject->setAngularVelocity( 0.5f );
+            pSceneObject->setDataField( keyField, NULL, Con::getIntArg( serverObjects.size() ) );
+            pServerScene->addToScene( pSceneObject );
+            serverObjects.push_back( pSceneObject );
+        }
+    }
+
+    pServerScene->setReplicatedFields( keyField );
+    pServerScene->setReplicationMode( Scene::REPLICATION_SERVER );
+
+    // Create the client scene.
+    Scene* pClientScene = new Scene();
+    ASSERT_TRUE( pClientScene->registerObject() );
+    pClientScene->setGravity( b2Vec2_zero );
+    pClientScene->setReplicationMode( Scene::REPLICATION_CLIENT );
+
+    // Create the client connection.
+    SceneReplicationTestConnection* pClientConnection = new SceneReplicationTestConnection();
+    ASSERT_TRUE( pClientConnection->registerObject() );
+    pClientConnection->setGhostTo( true );
+
+    // Replicate to a connection viewing the objects and one too far away to see any.
+    SceneReplicationTestConnection* pServerConnection = new SceneReplicationTestConnection();
+    ASSERT_TRUE( pServerConnection->registerObject() );
+    SceneReplicationScope* pServerScope = pServerScene->replicateTo( pServerConnection );
+    ASSERT_TRUE( pServerScope != NULL );
+    pServerScope->setCameraPosition( Vector2( 8.0f, 8.0f ) );
+    pServerScope->setViewDistance( 1000.0f );
+    pServerConnection->startGhosting();
+
+    SceneReplicationTestConnection* pDistantConnection = new SceneReplicationTestConnection();
+    ASSERT_TRUE( pDistantConnection->registerObject() );
+    SceneReplicationScope* pDistantScope = pServerScene->replicateTo( pDistantConnection );
+    ASSERT_TRUE( pDistantScope != NULL );
+    pDistantScope->setCameraPosition( Vector2( 100000.0f, 100000.0f ) );
+    pDistantScope->setViewDistance( 10.0f );
+    pDistantConnection->startGhosting();
+
+    // Move the objects.
+    for ( U32 tick = 0; tick < SCENE_REPLICATION_UNITTEST_MOVE_TICKS; ++tick )
+        tickSceneReplicationTest( pServerScene, pClientScene, pServerConnection, pClientConnection, pDistantConnection );
+
+    ASSERT_EQ( pClientScene->getSceneObjectCount(), (U32)serverObjects.size() ) << "Not every object in view was replicated.";
+
+    // Stop the objects and let the replicas settle.
+    for ( S32 n = 0; n < serverObjects.size(); ++n )
+    {
+        serverObjects[n]->setLinearVelocity( Vector2::getZero() );
+        serverObjects[n]->setAngularVelocity( 0.0f );
+    }
+
+    for ( U32 tick = 0; tick < SCENE_REPLICATION_UNITTEST_SETTLE_TICKS; ++tick )
+        tickSceneReplicationTest( pServerScene, pClientScene, pServerConnection, pClientConnection, pDistantConnection );
+
+    // Every replica should be where its server object is.
+    for ( U32 n = 0; n < pClientScene->getSceneObjectCount(); ++n )
+    {
+        SceneObject* pReplica = pClientScene->getSceneObject( n );
+        const S32 key = dAtoi( pReplica->getDataField( keyField, NULL ) );
+        ASSERT_TRUE( key >= 0 && key < serverObjects.size() ) << "Replica " << n << " has no replicated key.";
+
+        const Vector2 offset = pReplica->getPosition() - serverObjects[key]->getPosition();
+        ASSERT_LT( offset.Length(), SCENE_REPLICATION_UNITTEST_TOLERANCE ) << "Replica of object " << key << " did not track the server.";
+    }
+
+    // The bandwidth is measured per connection and nothing is sent to the distant one.
+    const U32 bytesSent = pServerScope->getBytesSent();
+    ASSERT_GT( bytesSent, 0u );
+    ASSERT_EQ( pDistantScope->getBytesSent(), 0u );
+    ASSERT_EQ( pDistantScope->getScopedCount(), 0u );
+
+    // Nothing is sent while nothing changes.
+    for ( U32 tick = 0; tick < SCENE_REPLICATION_UNITTEST_IDLE_TICKS; ++tick )
+        tickSceneReplicationTest( pServerScene, pClientScene, pServerConnection, pClientConnection, pDistantConnection );
+
+    ASSERT_EQ( pServerScope->getBytesSent(), bytesSent ) << "Updates were sent for objects that did not change.";
+
+    // Clean up.
+    pServerConnection->deleteObject();
+    pDistantConnection->deleteObject();
+    pClientConnection->deleteObject();
+    pClientScene->deleteObject();
+    pServerScene->deleteObject();
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,164 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _SCENE_OBJECT_H_
+#include "2d/sceneobject/SceneObject.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define SCENE_SNAPSHOT_UNITTEST_NAME    "SceneSnapshotUnitTestObject"
+
+//-----------------------------------------------------------------------------
+
+static SceneObject* createSnapshotTestObject( Scene* pScene, const Vector2& position )
+{
+    SceneObject* pSceneObject = new SceneObject();
+    pSceneObject->registerObject();
+    pSceneObject->setBodyType( b2_dynamicBody );
+    pSceneObject->setPosition( position );
+    pScene->addToScene( pSceneObject );
+
+    return pSceneObject;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneSnapshotTests, RoundTrip )
+{
+    // Create the scene without gravity so only the test moves bodies.
+    Scene* pScene = new Scene();
+    ASSERT_TRUE( pScene->registerObject() );
+    pScene->setGravity( b2Vec2_zero );
+
+    // Create an object that is moved after the snapshot.
+    SceneObject* pMoved = createSnapshotTestObject( pScene, Vector2( 1.0f, 2.0f ) );
+    pMoved->setAngle( 0.5f );
+    pMoved->setLinearVelocity( Vector2( 3.0f, 4.0f ) );
+    pMoved->setAngularVelocity( 1.5f );
+
+    // Create an object that is deleted after the snapshot.
+    SceneObject* pDeleted = createSnapshotTestObject( pScene, Vector2( 5.0f, 6.0f ) );
+    pDeleted->assignName( SCENE_SNAPSHOT_UNITTEST_NAME );
+    pDeleted->setSize( Vector2( 2.0f, 3.0f ) );
+    pDeleted->setSceneLayer( 5 );
+    pDeleted->setSceneGroup( 7 );
+    pDeleted->setLinearVelocity( Vector2( -1.0f, 0.0f ) );
+    const SimObjectId deletedId = pDeleted->getId();
+
+    // Snapshot.
+    ASSERT_GT( pScene->saveSnapshot( "roundTrip" ), 0u );
+
+    // Move the first object and stop it.
+    pMoved->setPosition( Vector2( 10.0f, 20.0f ) );
+    pMoved->setAngle( 2.0f );
+    pMoved->setLinearVelocity( Vector2::getZero() );
+    pMoved->setAngularVelocity( 0.0f );
+
+    // Delete the second object.
+    pDeleted->deleteObject();
+    ASSERT_TRUE( Sim::findObject( deletedId ) == NULL );
+
+    // Add an object that is not in the snapshot.
+    SimObjectPtr<SceneObject> pAdded = createSnapshotTestObject( pScene, Vector2( 7.0f, 8.0f ) );
+    ASSERT_EQ( pScene->getSceneObjectCount(), 2u );
+
+    // Restore.
+    ASSERT_TRUE( pScene->restoreSnapshot( "roundTrip" ) );
+    ASSERT_EQ( pScene->getSceneObjectCount(), 2u );
+
+    // The moved object is patched in-place.
+    ASSERT_TRUE( pMoved->getScene() == pScene );
+    ASSERT_TRUE( pMoved->getPosition() == Vector2( 1.0f, 2.0f ) );
+    ASSERT_FLOAT_EQ( pMoved->getAngle(), 0.5f );
+    ASSERT_TRUE( pMoved->getLinearVelocity() == Vector2( 3.0f, 4.0f ) );
+    ASSERT_FLOAT_EQ( pMoved->getAngularVelocity(), 1.5f );
+
+    // The added object is removed.
+    ASSERT_TRUE( pAdded.isNull() || pAdded->getScene() == NULL );
+
+    // The deleted object is recreated from the captured state.
+    SceneObject* pRecreated = dynamic_cast<SceneObject*>( Sim::findObject( SCENE_SNAPSHOT_UNITTEST_NAME ) );
+    ASSERT_TRUE( pRecreated != NULL );
+    ASSERT_NE( pRecreated, pMoved );
+    ASSERT_TRUE( pRecreated->getScene() == pScene );
+    ASSERT_STREQ( pRecreated->getClassName(), "SceneObject" );
+    ASSERT_TRUE( pRecreated->getSize() == Vector2( 2.0f, 3.0f ) );
+    ASSERT_EQ( pRecreated->getSceneLayer(), 5u );
+    ASSERT_EQ( pRecreated->getSceneGroup(), 7u );
+    ASSERT_EQ( pRecreated->getBodyType(), b2_dynamicBody );
+    ASSERT_TRUE( pRecreated->getPosition() == Vector2( 5.0f, 6.0f ) );
+    ASSERT_TRUE( pRecreated->getLinearVelocity() == Vector2( -1.0f, 0.0f ) );
+
+    // Restoring again patches the recreated object rather than creating another.
+    pRecreated->setPosition( Vector2( 50.0f, 60.0f ) );
+    ASSERT_TRUE( pScene->restoreSnapshot( "roundTrip" ) );
+    ASSERT_EQ( pScene->getSceneObjectCount(), 2u );
+    ASSERT_EQ( Sim::findObject( SCENE_SNAPSHOT_UNITTEST_NAME ), (SimObject*)pRecreated );
+    ASSERT_TRUE( pRecreated->getPosition() == Vector2( 5.0f, 6.0f ) );
+
+    // Clean up.
+    if ( !pAdded.isNull() )
+        pAdded->deleteObject();
+    pScene->deleteObject();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneSnapshotTests, RestoreSelectedFields )
+{
+    // Create the scene.
+    Scene* pScene = new Scene();
+    ASSERT_TRUE( pScene->registerObject() );
+
+    // Create an object with a dynamic field.
+    SceneObject* pSceneObject = createSnapshotTestObject( pScene, Vector2( 0.0f, 0.0f ) );
+    StringTableEntry fieldName = StringTable->insert( "snapshotValue" );
+    pSceneObject->setDataField( fieldName, NULL, "before" );
+
+    // Snapshot the field.
+    pScene->saveSnapshot( "fields", "snapshotValue" );
+
+    // Change and restore the field.
+    pSceneObject->setDataField( fieldName, NULL, "after" );
+    ASSERT_TRUE( pScene->restoreSnapshot( "fields" ) );
+    ASSERT_STREQ( pSceneObject->getDataField( fieldName, NULL ), "before" );
+
+    // Unknown snapshots are not restored.
+    ASSERT_FALSE( pScene->restoreSnapshot( "missing" ) );
+
+    // Clean up.
+    pScene->deleteObject();
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,243 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _TAML_H_
+#include "persistence/taml/taml.h"
+#endif
+
+#ifndef _TAML_BINARYREADER_H_
+#include "persistence/taml/tamlBinaryReader.h"
+#endif
+
+#ifndef _GROWABLE_MEMSTREAM_H_
+#include "io/growableMemStream.h"
+#endif
+
+#ifndef _MEMSTREAM_H_
+#include "io/memstream.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define TAML_BINARY_UNITTEST_CHILDREN       3
+#define TAML_BINARY_UNITTEST_LEGACY_VERSION 2
+
+//-----------------------------------------------------------------------------
+
+static SimSet* createTamlBinaryTestObject( void )
+{
+    // Create a set with a field and children with their own fields.
+    SimSet* pSimSet = new SimSet();
+    pSimSet->registerObject();
+    pSimSet->setDataField( StringTable->insert("rootValue"), NULL, "root" );
+
+    for ( U32 n = 0; n < TAML_BINARY_UNITTEST_CHILDREN; ++n )
+    {
+        SimObject* pChild = new SimObject();
+        pChild->registerObject();
+        pChild->setDataField( StringTable->insert("childValue"), NULL, avar( "child%d", n ) );
+        pSimSet->addObject( pChild );
+    }
+
+    return pSimSet;
+}
+
+//-----------------------------------------------------------------------------
+
+static void checkTamlBinaryTestObject( SimObject* pSimObject, const U32 childCount )
+{
+    // Check the set.
+    SimSet* pSimSet = dynamic_cast<SimSet*>( pSimObject );
+    ASSERT_TRUE( pSimSet != NULL ) << "The root object was not read as a set.";
+    ASSERT_STREQ( pSimSet->getDataField( StringTable->insert("rootValue"), NULL ), "root" );
+    ASSERT_EQ( (U32)pSimSet->size(), childCount );
+
+    // Check the children in order.
+    for ( U32 n = 0; n < childCount; ++n )
+    {
+        ASSERT_STREQ( pSimSet->at( n )->getDataField( StringTable->insert("childValue"), NULL ), avar( "child%d", n ) );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void deleteTamlBinaryTestObject( SimObject* pSimObject )
+{
+    // Delete the children as sets do not own them.
+    SimSet* pSimSet = dynamic_cast<SimSet*>( pSimObject );
+    while ( pSimSet != NULL && pSimSet->size() > 0 )
+        pSimSet->last()->deleteObject();
+
+    pSimObject->deleteObject();
+}
+
+//-----------------------------------------------------------------------------
+
+static void writeTamlBinary( SimObject* pSimObject, const bool compressed, GrowableMemStream& stream )
+{
+    Taml taml;
+    taml.setBinaryCompression( compressed );
+    taml.write( pSimObject, stream, Taml::BinaryFormat );
+}
+
+//-----------------------------------------------------------------------------
+
+static SimObject* readTamlBinary( const U8* pBuffer, const U32 bufferSize )
+{
+    Taml taml;
+    return taml.read( pBuffer, bufferSize );
+}
+
+//-----------------------------------------------------------------------------
+
+static void writeLegacyElement( Stream& stream, const char* pTypeName, const char* pFieldName, const char* pFieldValue, const U32 childCount )
+{
+    // Write the type, name and references.
+    stream.writeString( pTypeName );
+    stream.writeString( "" );
+    stream.write( U32(0) );
+    stream.write( U32(0) );
+
+    // Write the field.
+    stream.write( U32(1) );
+    stream.writeString( pFieldName );
+    stream.writeLongString( 4096, pFieldValue );
+
+    // Write the children count with the children following.
+    stream.write( childCount );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( TamlBinaryTests, RoundTrip )
+{
+    SimSet* pSimSet = createTamlBinaryTestObject();
+
+    // Round-trip with and without compression.
+    for ( U32 compressed = 0; compressed < 2; ++compressed )
+    {
+        GrowableMemStream stream;
+        writeTamlBinary( pSimSet, compressed != 0, stream );
+        ASSERT_GT( stream.getBufferSize(), 0u );
+
+        SimObject* pSimObject = readTamlBinary( stream.getBuffer(), stream.getBufferSize() );
+        ASSERT_TRUE( pSimObject != NULL ) << "Could not read the written binary.";
+        checkTamlBinaryTestObject( pSimObject, TAML_BINARY_UNITTEST_CHILDREN );
+        deleteTamlBinaryTestObject( pSimObject );
+    }
+
+    deleteTamlBinaryTestObject( pSimSet );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( TamlBinaryTests, ReadOlderVersion )
+{
+    // Write a file in the format before the string table was added.
+    GrowableMemStream stream;
+    stream.writeString( TAML_SIGNATURE );
+    stream.write( U32(TAML_BINARY_UNITTEST_LEGACY_VERSION) );
+    stream.write( false );
+
+    // Write the set and its children.
+    writeLegacyElement( stream, "SimSet", "rootValue", "root", TAML_BINARY_UNITTEST_CHILDREN );
+    for ( U32 n = 0; n < TAML_BINARY_UNITTEST_CHILDREN; ++n )
+    {
+        writeLegacyElement( stream, "SimObject", "childValue", avar( "child%d", n ), 0 );
+
+        // Write no custom elements for the child.
+        stream.write( U32(0) );
+    }
+
+    // Write no custom elements for the set.
+    stream.write( U32(0) );
+
+    // Read the file.
+    SimObject* pSimObject = readTamlBinary( stream.getBuffer(), stream.getBufferSize() );
+    ASSERT_TRUE( pSimObject != NULL ) << "Could not read the older binary version.";
+    checkTamlBinaryTestObject( pSimObject, TAML_BINARY_UNITTEST_CHILDREN );
+    deleteTamlBinaryTestObject( pSimObject );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( TamlBinaryTests, RejectTruncatedAndCorrupt )
+{
+    SimSet* pSimSet = createTamlBinaryTestObject();
+
+    // The payload size follows the signature, version and compressed flag.
+    const U32 payloadSizeOffset = 1 + dStrlen( TAML_SIGNATURE ) + sizeof(U32) + sizeof(bool);
+
+    for ( U32 compressed = 0; compressed < 2; ++compressed )
+    {
+        GrowableMemStream stream;
+        writeTamlBinary( pSimSet, compressed != 0, stream );
+        const U32 bufferSize = stream.getBufferSize();
+
+        // Truncated files are rejected.
+        ASSERT_TRUE( readTamlBinary( stream.getBuffer(), payloadSizeOffset + 2 ) == NULL );
+        ASSERT_TRUE( readTamlBinary( stream.getBuffer(), bufferSize / 2 ) == NULL );
+        ASSERT_TRUE( readTamlBinary( stream.getBuffer(), bufferSize - 1 ) == NULL );
+
+        // Copy the file to corrupt it.
+        Vector<U8> corruptBuffer;
+        corruptBuffer.setSize( bufferSize );
+        dMemcpy( corruptBuffer.address(), stream.getBuffer(), bufferSize );
+        MemStream corruptStream( bufferSize, corruptBuffer.address(), true, true );
+
+        // A payload size too large for the file is rejected before it is allocated.
+        corruptStream.setPosition( payloadSizeOffset );
+        corruptStream.write( U32(TamlBinaryReader::MaxPayloadSize - 1) );
+        ASSERT_TRUE( readTamlBinary( corruptBuffer.address(), bufferSize ) == NULL );
+
+        // A payload size beyond the limit is rejected.
+        corruptStream.setPosition( payloadSizeOffset );
+        corruptStream.write( U32(0xFFFFFFFF) );
+        ASSERT_TRUE( readTamlBinary( corruptBuffer.address(), bufferSize ) == NULL );
+
+        // An unknown signature is rejected.
+        dMemcpy( corruptBuffer.address(), stream.getBuffer(), bufferSize );
+        corruptBuffer[1] = 'X';
+        ASSERT_TRUE( readTamlBinary( corruptBuffer.address(), bufferSize ) == NULL );
+    }
+
+    // A corrupt compressed payload is rejected.
+    GrowableMemStream stream;
+    writeTamlBinary( pSimSet, true, stream );
+    Vector<U8> corruptBuffer;
+    corruptBuffer.setSize( stream.getBufferSize() );
+    dMemcpy( corruptBuffer.address(), stream.getBuffer(), stream.getBufferSize() );
+    for ( U32 n = payloadSizeOffset + 2 * sizeof(U32); n < (U32)corruptBuffer.size(); ++n )
+        corruptBuffer[n] ^= 0x5A;
+    ASSERT_TRUE( readTamlBinary( corruptBuffer.address(), corruptBuffer.size() ) == NULL );
+
+    deleteTamlBinaryTestObject( pSimSet );
+}
+
+#endif // TORQUE_SHIPPING
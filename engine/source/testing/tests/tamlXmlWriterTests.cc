@@ -0,0 +1,210 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _TAML_H_
+#include "persistence/taml/taml.h"
+#endif
+
+#ifndef _TAML_PARALLEL_WRITE_H_
+#include "persistence/taml/tamlParallelWrite.h"
+#endif
+
+#ifndef TINYXML_INCLUDED
+#include "persistence/tinyXML/tinyxml.h"
+#endif
+
+#ifndef _GROWABLE_MEMSTREAM_H_
+#include "io/growableMemStream.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_JOBPOOL_H_
+#include "platform/threads/jobPool.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define TAML_XML_UNITTEST_FILE              "_unitTestTamlXml_RemoveMe.taml"
+#define TAML_XML_UNITTEST_TINYXML_FILE      "_unitTestTamlTinyXml_RemoveMe.taml"
+#define TAML_XML_UNITTEST_WORKERS           3
+#define TAML_XML_UNITTEST_PARALLEL_ITEMS    (TamlParallelWrite::MinItemCount * 4 + 5)
+
+//-----------------------------------------------------------------------------
+
+static SimSet* createTamlXmlTestObject( const U32 childCount )
+{
+    // Create a set with fields that need encoding.
+    SimSet* pSimSet = new SimSet();
+    pSimSet->registerObject();
+    pSimSet->setDataField( StringTable->insert("plainValue"), NULL, "value" );
+    pSimSet->setDataField( StringTable->insert("encodedValue"), NULL, "a < b & c > d 'e'" );
+    pSimSet->setDataField( StringTable->insert("quotedValue"), NULL, "say \"hi\"" );
+
+    // Add the children.
+    for ( U32 n = 0; n < childCount; ++n )
+    {
+        SimObject* pChild = new SimObject();
+        pChild->registerObject();
+        pChild->setDataField( StringTable->insert("childValue"), NULL, avar( "child%d", n ) );
+        pSimSet->addObject( pChild );
+    }
+
+    return pSimSet;
+}
+
+//-----------------------------------------------------------------------------
+
+static void deleteTamlXmlTestObject( SimSet* pSimSet )
+{
+    // Delete the children as sets do not own them.
+    while ( pSimSet->size() > 0 )
+        pSimSet->last()->deleteObject();
+
+    pSimSet->deleteObject();
+}
+
+//-----------------------------------------------------------------------------
+
+static bool readTamlXmlTestFile( const char* pFilePath, Vector<U8>& buffer )
+{
+    FileStream stream;
+    if ( !stream.open( pFilePath, FileStream::Read ) )
+        return false;
+
+    buffer.setSize( stream.getStreamSize() );
+    return buffer.size() == 0 || stream.read( buffer.size(), buffer.address() );
+}
+
+//-----------------------------------------------------------------------------
+
+static void checkMatchesTinyXml( SimObject* pSimObject )
+{
+    // Write the object with the streaming writer.
+    FileStream stream;
+    ASSERT_TRUE( stream.open( TAML_XML_UNITTEST_FILE, FileStream::Write ) );
+    Taml taml;
+    ASSERT_TRUE( taml.write( pSimObject, stream, Taml::XmlFormat ) );
+    stream.close();
+
+    // Read the file and print it again with TinyXML.
+    TiXmlDocument xmlDocument;
+    ASSERT_TRUE( stream.open( TAML_XML_UNITTEST_FILE, FileStream::Read ) );
+    ASSERT_TRUE( xmlDocument.LoadFile( stream ) ) << "TinyXML could not parse the written file.";
+    stream.close();
+    ASSERT_TRUE( stream.open( TAML_XML_UNITTEST_TINYXML_FILE, FileStream::Write ) );
+    ASSERT_TRUE( xmlDocument.SaveFile( stream ) );
+    stream.close();
+
+    // Compare the files.
+    Vector<U8> writtenBuffer;
+    Vector<U8> tinyXmlBuffer;
+    ASSERT_TRUE( readTamlXmlTestFile( TAML_XML_UNITTEST_FILE, writtenBuffer ) );
+    ASSERT_TRUE( readTamlXmlTestFile( TAML_XML_UNITTEST_TINYXML_FILE, tinyXmlBuffer ) );
+    ASSERT_EQ( writtenBuffer.size(), tinyXmlBuffer.size() ) << "The written file differs in size from the TinyXML output.";
+    ASSERT_EQ( dMemcmp( writtenBuffer.address(), tinyXmlBuffer.address(), writtenBuffer.size() ), 0 ) << "The written file differs from the TinyXML output.";
+
+    // Remove the files.
+    ASSERT_TRUE( Platform::fileDelete( TAML_XML_UNITTEST_FILE ) );
+    ASSERT_TRUE( Platform::fileDelete( TAML_XML_UNITTEST_TINYXML_FILE ) );
+}
+
+//-----------------------------------------------------------------------------
+
+static void writeParallelTestItem( void* pContext, Stream& stream, const U32 index )
+{
+    // Writes must never nest.
+    if ( TamlParallelWrite::canWrite( TamlParallelWrite::MinItemCount ) )
+        stream.writeStringBuffer( "nested" );
+
+    stream.writeFormattedBuffer( "%d,", index );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( TamlXmlWriterTests, MatchesTinyXml )
+{
+    // Without children.
+    SimSet* pSimSet = createTamlXmlTestObject( 0 );
+    checkMatchesTinyXml( pSimSet );
+    deleteTamlXmlTestObject( pSimSet );
+
+    // With children.
+    pSimSet = createTamlXmlTestObject( 3 );
+    checkMatchesTinyXml( pSimSet );
+    deleteTamlXmlTestObject( pSimSet );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( TamlXmlWriterTests, ParallelChildrenMatchTinyXml )
+{
+    // Write through a pool with workers so the children are written in parallel.
+    JobPool* pPreviousJobPool = JobPool::Instance;
+    JobPool jobPool( TAML_XML_UNITTEST_WORKERS );
+    JobPool::Instance = &jobPool;
+
+    // Fetch whether the children are written in parallel.
+    const bool parallelBelowMinimum = TamlParallelWrite::canWrite( TamlParallelWrite::MinItemCount - 1 );
+    const bool parallel = TamlParallelWrite::canWrite( TAML_XML_UNITTEST_PARALLEL_ITEMS );
+
+    SimSet* pSimSet = createTamlXmlTestObject( TAML_XML_UNITTEST_PARALLEL_ITEMS );
+    checkMatchesTinyXml( pSimSet );
+    deleteTamlXmlTestObject( pSimSet );
+
+    JobPool::Instance = pPreviousJobPool;
+
+    // Only enough children with pool workers are written in parallel.
+    ASSERT_FALSE( parallelBelowMinimum );
+    ASSERT_EQ( parallel, jobPool.getWorkerCount() > 0 );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( TamlXmlWriterTests, ParallelWriteKeepsOrder )
+{
+    JobPool* pPreviousJobPool = JobPool::Instance;
+    JobPool jobPool( TAML_XML_UNITTEST_WORKERS );
+    JobPool::Instance = &jobPool;
+
+    // Write the items in parallel.
+    GrowableMemStream parallelStream;
+    TamlParallelWrite::write( parallelStream, &writeParallelTestItem, NULL, TAML_XML_UNITTEST_PARALLEL_ITEMS );
+
+    JobPool::Instance = pPreviousJobPool;
+
+    // Write the items serially.
+    GrowableMemStream serialStream;
+    for ( U32 index = 0; index < TAML_XML_UNITTEST_PARALLEL_ITEMS; ++index )
+        serialStream.writeFormattedBuffer( "%d,", index );
+
+    // The output is identical.
+    ASSERT_EQ( parallelStream.getBufferSize(), serialStream.getBufferSize() );
+    ASSERT_EQ( dMemcmp( parallelStream.getBuffer(), serialStream.getBuffer(), serialStream.getBufferSize() ), 0 ) << "The parallel write is out of order or nested.";
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,260 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _SCENE_OBJECT_H_
+#include "2d/sceneobject/SceneObject.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define WORLD_QUERY_UNITTEST_OBJECT_ROWS    60
+#define WORLD_QUERY_UNITTEST_QUERIES        100
+
+//-----------------------------------------------------------------------------
+
+static Scene* createWorldQueryTestScene( const bool spatialHash )
+{
+    // Create the scene.
+    Scene* pScene = new Scene();
+    pScene->registerObject();
+    pScene->setGravity( b2Vec2_zero );
+    pScene->setSpatialHash( spatialHash );
+
+    // Add a grid of small, fast-moving objects without collision shapes.
+    for ( U32 y = 0; y < WORLD_QUERY_UNITTEST_OBJECT_ROWS; ++y )
+    {
+        for ( U32 x = 0; x < WORLD_QUERY_UNITTEST_OBJECT_ROWS; ++x )
+        {
+            SceneObject* pSceneObject = new SceneObject();
+            pSceneObject->registerObject();
+            pSceneObject->setBodyType( b2_dynamicBody );
+            pSceneObject->setPosition( Vector2( (F32)x, (F32)y ) );
+            pSceneObject->setSize( Vector2( 0.25f, 0.25f ) );
+            pSceneObject->setLinearVelocity( Vector2( (F32)((x * 7) % 11) - 5.0f, (F32)((y * 5) % 13) - 6.0f ) );
+            pScene->addToScene( pSceneObject );
+        }
+    }
+
+    return pScene;
+}
+
+//-----------------------------------------------------------------------------
+
+static S32 QSORT_CALLBACK compareWorldQueryTestIds( const void* a, const void* b )
+{
+    const SimObjectId idA = *(const SimObjectId*)a;
+    const SimObjectId idB = *(const SimObjectId*)b;
+    return idA < idB ? -1 : (idA > idB ? 1 : 0);
+}
+
+//-----------------------------------------------------------------------------
+
+static void gatherWorldQueryTestResults( WorldQuery* pWorldQuery, Vector<SimObjectId>& results )
+{
+    // Append the ids found in a canonical order so result sets compare regardless of the index used.
+    typeWorldQueryResultVector& queryResults = pWorldQuery->getQueryResults();
+    const S32 start = results.size();
+    for ( S32 n = 0; n < queryResults.size(); ++n )
+        results.push_back( queryResults[n].mpSceneObject->getId() );
+
+    if ( results.size() > start )
+        dQsort( results.address() + start, results.size() - start, sizeof(SimObjectId), compareWorldQueryTestIds );
+
+    // Separate each query.
+    results.push_back( 0 );
+
+    pWorldQuery->clearQuery();
+}
+
+//-----------------------------------------------------------------------------
+
+static void queryWorldQueryTestScene( Scene* pScene, const Vector<b2AABB>& areas, Vector<SimObjectId>& results )
+{
+    // Fetch world query.
+    WorldQuery* pWorldQuery = pScene->getWorldQuery( true );
+    pWorldQuery->setQueryFilter( WorldQueryFilter( MASK_ALL, MASK_ALL, true, false, true, true ) );
+
+    // Perform an area, point and ray pick for each area.
+    // These compare against the object bounds so the results do not depend on the index used.
+    results.clear();
+    for ( S32 n = 0; n < areas.size(); ++n )
+    {
+        const b2AABB& aabb = areas[n];
+        const b2Vec2 center = aabb.GetCenter();
+        const b2Vec2 extents = aabb.GetExtents();
+
+        pWorldQuery->oobbQueryAABB( aabb );
+        gatherWorldQueryTestResults( pWorldQuery, results );
+
+        pWorldQuery->oobbQueryPoint( center );
+        gatherWorldQueryTestResults( pWorldQuery, results );
+
+        pWorldQuery->oobbQueryRay( Vector2( aabb.lowerBound.x, center.y - extents.y * 0.05f ), Vector2( aabb.upperBound.x, center.y + extents.y * 0.05f ) );
+        gatherWorldQueryTestResults( pWorldQuery, results );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void checkWorldQueryTestResults( const Vector<SimObjectId>& results, const Vector<SimObjectId>& expectedResults, const char* pIndexName )
+{
+    ASSERT_EQ( results.size(), expectedResults.size() ) << "The " << pIndexName << " queries found a different number of objects to the dynamic tree.";
+
+    for ( S32 n = 0; n < results.size(); ++n )
+    {
+        ASSERT_EQ( results[n], expectedResults[n] ) << "The " << pIndexName << " queries found different objects to the dynamic tree.";
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( WorldQueryTests, SpatialHashMatchesDynamicTree )
+{
+    Scene* pScene = createWorldQueryTestScene( false );
+
+    // Set up a spread of query areas over the grid.
+    Vector<b2AABB> areas;
+    for ( U32 n = 0; n < WORLD_QUERY_UNITTEST_QUERIES; ++n )
+    {
+        const F32 x = (F32)((n * 37) % WORLD_QUERY_UNITTEST_OBJECT_ROWS);
+        const F32 y = (F32)((n * 53) % WORLD_QUERY_UNITTEST_OBJECT_ROWS);
+        const F32 extent = (n & 1) ? 2.0f : 20.0f;
+
+        b2AABB aabb;
+        aabb.lowerBound.Set( x - extent, y - extent );
+        aabb.upperBound.Set( x + extent, y + extent );
+        areas.push_back( aabb );
+    }
+
+    // Query using the dynamic tree.
+    Vector<SimObjectId> treeResults;
+    queryWorldQueryTestScene( pScene, areas, treeResults );
+    ASSERT_GT( treeResults.size(), (S32)(WORLD_QUERY_UNITTEST_QUERIES * 3) ) << "The dynamic tree queries found nothing.";
+
+    // Move every object into the spatial hash and query again.
+    Vector<SimObjectId> results;
+    pScene->setSpatialHash( true );
+    ASSERT_EQ( pScene->getWorldQuery()->getSpatialHashProxyCount(), pScene->getSceneObjectCount() ) << "Not every object moved to the spatial hash.";
+    queryWorldQueryTestScene( pScene, areas, results );
+    checkWorldQueryTestResults( results, treeResults, "spatial hash" );
+
+    // Move half the objects back to the dynamic tree and query again.
+    pScene->setSpatialHash( false );
+    for ( U32 n = 0; n < pScene->getSceneObjectCount(); n += 2 )
+    {
+        pScene->getSceneObject( n )->setSpatialHash( true );
+    }
+    queryWorldQueryTestScene( pScene, areas, results );
+    checkWorldQueryTestResults( results, treeResults, "mixed index" );
+
+    pScene->deleteObject();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( WorldQueryTests, SpatialHashHandlesDistantBounds )
+{
+    Scene* pScene = createWorldQueryTestScene( false );
+
+    // Add objects far beyond the range of the cells and one larger than the whole grid.
+    const F32 distantPositions[][2] =
+    {
+        { 1.0e12f, 1.0e12f },
+        { -1.0e12f, 3.0e10f },
+        { 5.0e9f, -5.0e9f },
+    };
+    const U32 distantCount = sizeof(distantPositions) / sizeof(distantPositions[0]);
+    Vector<SimObjectId> distantIds;
+    for ( U32 n = 0; n < distantCount; ++n )
+    {
+        SceneObject* pSceneObject = new SceneObject();
+        pSceneObject->registerObject();
+        pSceneObject->setPosition( Vector2( distantPositions[n][0], distantPositions[n][1] ) );
+        pSceneObject->setSize( Vector2( 1.0e6f, 1.0e6f ) );
+        pScene->addToScene( pSceneObject );
+        distantIds.push_back( pSceneObject->getId() );
+    }
+
+    SceneObject* pHugeObject = new SceneObject();
+    pHugeObject->registerObject();
+    pHugeObject->setSize( Vector2( 1.0e10f, 1.0e10f ) );
+    pScene->addToScene( pHugeObject );
+
+    // Query around the distant objects, across the whole range and around the grid.
+    Vector<b2AABB> areas;
+    for ( U32 n = 0; n < distantCount; ++n )
+    {
+        b2AABB aabb;
+        aabb.lowerBound.Set( distantPositions[n][0] - 1.0e6f, distantPositions[n][1] - 1.0e6f );
+        aabb.upperBound.Set( distantPositions[n][0] + 1.0e6f, distantPositions[n][1] + 1.0e6f );
+        areas.push_back( aabb );
+    }
+
+    b2AABB aabb;
+    aabb.lowerBound.Set( -2.0e12f, -2.0e12f );
+    aabb.upperBound.Set( 2.0e12f, 2.0e12f );
+    areas.push_back( aabb );
+    aabb.lowerBound.Set( 10.0f, 10.0f );
+    aabb.upperBound.Set( 12.0f, 12.0f );
+    areas.push_back( aabb );
+
+    // Query using the dynamic tree.
+    Vector<SimObjectId> treeResults;
+    queryWorldQueryTestScene( pScene, areas, treeResults );
+
+    // Every distant object is found by the area query around it.
+    S32 queryStart = 0;
+    for ( U32 n = 0; n < distantCount; ++n )
+    {
+        bool found = false;
+        for ( ; treeResults[queryStart] != 0; ++queryStart )
+            found |= treeResults[queryStart] == distantIds[n];
+
+        ASSERT_TRUE( found ) << "The query around distant object " << n << " did not find it.";
+
+        // Skip the point and ray queries.
+        for ( U32 separators = 0; separators < 3; ++queryStart )
+            separators += treeResults[queryStart] == 0 ? 1 : 0;
+    }
+
+    // Query using the spatial hash.
+    Vector<SimObjectId> results;
+    pScene->setSpatialHash( true );
+    queryWorldQueryTestScene( pScene, areas, results );
+    checkWorldQueryTestResults( results, treeResults, "spatial hash" );
+
+    pScene->deleteObject();
+}
+
+#endif // TORQUE_SHIPPING
@@ -82,7 +82,12 @@ class TorqueUnitTestListener : public ::testing::EmptyTestEventListener
 
 //-----------------------------------------------------------------------------
 
-ConsoleFunction( runAllUnitTests, S32, 1, 1, "() - Runs all the registered unit tests." )
+/// Benchmarks are registered as test cases named '...Benchmarks'.
+static const char* gBenchmarkFilter = "*Benchmarks.*";
+
+//-----------------------------------------------------------------------------
+
+static S32 runUnitTests( const char* pFilter, const char* pTitle )
 {
     // Set-up some empty arguments.
     S32 testArgc = 0;
@@ -97,25 +102,50 @@ ConsoleFunction( runAllUnitTests, S32, 1, 1, "() - Runs all the registered unit
     // Fetch the unit test event listeners.
     testing::TestEventListeners& listeners = unitTest.listeners();
 
-    // Release the default listener.
-    delete listeners.Release( listeners.default_result_printer() );
+    // Replace the default listener with the Torque unit test listener.
+    testing::TestEventListener* pDefaultListener = listeners.Release( listeners.default_result_printer() );
+    if ( pDefaultListener != NULL )
+    {
+        delete pDefaultListener;
+        listeners.Append( new TorqueUnitTestListener );
+    }
 
-    // Add the Torque unit test listener.
-    listeners.Append( new TorqueUnitTestListener );
+    // Select the tests to run.
+    testing::GTEST_FLAG(filter) = pFilter;
 
     Con::printBlankLine();
     Con::printSeparator();
-    Con::printf( "Unit Tests Starting..." );
+    Con::printf( "%s Starting...", pTitle );
     Con::printBlankLine();
 
     const S32 result RUN_ALL_TESTS();
 
     Con::printBlankLine();
-    Con::printf( "... Unit Tests Ended." );
+    Con::printf( "... %s Ended.", pTitle );
     Con::printSeparator();
     Con::printBlankLine();
 
     return result;
 }
 
+//-----------------------------------------------------------------------------
+
+ConsoleFunction( runAllUnitTests, S32, 1, 1, "() - Runs all the registered unit tests." )
+{
+    // Run everything except the benchmarks.
+    char filter[64];
+    dSprintf( filter, sizeof(filter), "-%s", gBenchmarkFilter );
+
+    return runUnitTests( filter, "Unit Tests" );
+}
+
+//-----------------------------------------------------------------------------
+
+#ifdef TORQUE_BENCHMARKS
+ConsoleFunction( runAllBenchmarks, S32, 1, 1, "() - Runs all the registered benchmarks.  Only available when built with TORQUE_BENCHMARKS." )
+{
+    return runUnitTests( gBenchmarkFilter, "Benchmarks" );
+}
+#endif
+
 #endif // TORQUE_SHIPPING
\ No newline at end of file
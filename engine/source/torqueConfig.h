@@ -87,6 +87,14 @@
 /// When defined, Torque will attempt to make select systems thread-safe.  This does not
 /// make the entire engine thread-safe nor is it a magic bullet that will make the engine
 /// perform operations in parallel and speed-up the engine.
+///
+/// 'TORQUE_JOB_POOL_INLINE'
+/// When defined, the job pool creates no worker threads and runs every job inline on the
+/// thread that submits it.  Useful when debugging code that runs on the job pool.
+///
+/// 'TORQUE_BENCHMARKS'
+/// When defined, the benchmarks in 'testing/benchmarks' are built.  They are run with
+/// 'runAllBenchmarks()' rather than 'runAllUnitTests()' as they take a while to run.
 
 #endif
 
@@ -28,6 +28,11 @@
     exec("./scripts/canvas.cs");
     exec("./scripts/openal.cs");
     
+    // Cache parsed asset declarations and references between runs if enabled.
+    // Only asset files that have changed since the cache was written are parsed.
+    if ( $pref::T2D::assetManifestCache )
+        AssetDatabase.ManifestCacheFile = $pref::T2D::assetManifestCacheFile;
+    
     // Initialize the canvas
     initializeCanvas("Torque 2D");
     
@@ -54,7 +54,12 @@
 $pref::T2D::warnFileDeprecated = 1;
 $pref::T2D::warnSceneOccupancy = 1;
 $pref::T2D::imageAssetGlobalFilterMode = Bilinear;
+$pref::T2D::imageAssetAsyncLoad = 0;
+$pref::T2D::imageAssetAtlas = 0;
+$pref::T2D::imageAssetAtlasMaxSize = 256;
 $pref::T2D::TAMLSchema="";
+$pref::T2D::assetManifestCache = 0;
+$pref::T2D::assetManifestCacheFile = expandPath( "^AppCore/assetManifest.cache" );
 
 /// Video
 $pref::Video::appliedPref = 0;
@@ -65,6 +70,14 @@
 $pref::Video::defaultResolution = "1024 768";
 $pref::Video::windowedRes = "800 600 32";
 $pref::OpenGL::gammaCorrection = 0.5;
+$pref::OpenGL::textureUploadBudget = 2.0;
+$pref::OpenGL::textureResidencyBudget = 0;
+$pref::OpenGL::textureEvictionAge = 120;
+$pref::OpenGL::textureEvictBitmaps = 0;
+$pref::OpenGL::discardTextureBitmaps = 0;
+$pref::OpenGL::textureCache = 0;
+$pref::OpenGL::textureCacheCompress = 1;
+$pref::OpenGL::textureCacheDirectory = expandPath( "^AppCore/textureCache" );
 
 /// Fonts.
 $Gui::fontCacheDirectory = expandPath( "^AppCore/fonts" );